@@ -18,6 +18,8 @@
 
 #include "dp_ratetable.h"
 #include "qdf_module.h"
+#include "qdf_trace.h"
+#include "qdf_util.h"
 #include "cdp_txrx_mon_struct.h"
 
 enum {
@@ -3427,7 +3429,8 @@ enum DP_CMN_MODULATION_TYPE dp_getmodulation(
 	return modulation;
 }
 
-/* dp_getrateindex - calculate ratekbps
+/* dp_getrateindex_slow - calculate ratekbps by walking preamble/bw/nss
+ * @gi - guard interval
  * @mcs - MCS index
  * @nss - NSS 1...8
  * preamble - preamble
@@ -3437,8 +3440,8 @@ enum DP_CMN_MODULATION_TYPE dp_getmodulation(
  *
  * return - rate in kbps
  */
-uint32_t
-dp_getrateindex(uint32_t gi, uint16_t mcs, uint8_t nss, uint8_t preamble,
+static uint32_t
+dp_getrateindex_slow(uint32_t gi, uint16_t mcs, uint8_t nss, uint8_t preamble,
 		uint8_t bw, uint32_t *rix, uint16_t *ratecode)
 {
 	uint32_t ratekbps = 0, res = RT_INVALID_INDEX; /* represents failure */
@@ -3503,8 +3506,163 @@ done:
 	return ratekbps;
 }
 
+/*
+ * Rate table base index per (preamble, bw, nss). The entry for an MCS is
+ * base + mcs, so dp_getrateindex() needs neither the modulation lookup
+ * nor the preamble switch. Generated from the same _rc_idx layout and
+ * per preamble MCS counts the slow path uses.
+ */
+#define DP_RATE_LUT_BW_CNT CMN_BW_80_80MHZ
+#define DP_RATE_LUT_NSS_CNT NUM_SPATIAL_STREAMS
+
+#define DP_RATE_LUT_NSS(_base, _stride) \
+	{ (_base), (_base) + (_stride), (_base) + 2 * (_stride), \
+	  (_base) + 3 * (_stride), (_base) + 4 * (_stride), \
+	  (_base) + 5 * (_stride), (_base) + 6 * (_stride), \
+	  (_base) + 7 * (_stride) }
+
+static const uint16_t
+dp_rate_base_lut[DP_CMN_RATECODE_PREAM_COUNT][DP_RATE_LUT_BW_CNT]
+		[DP_RATE_LUT_NSS_CNT] = {
+	[DP_CMN_RATECODE_PREAM_OFDM] = {
+		DP_RATE_LUT_NSS(OFDM_RATE_TABLE_INDEX, 0),
+		DP_RATE_LUT_NSS(OFDM_RATE_TABLE_INDEX, 0),
+		DP_RATE_LUT_NSS(OFDM_RATE_TABLE_INDEX, 0),
+		DP_RATE_LUT_NSS(OFDM_RATE_TABLE_INDEX, 0),
+	},
+	[DP_CMN_RATECODE_PREAM_CCK] = {
+		DP_RATE_LUT_NSS(CCK_RATE_TABLE_INDEX, 0),
+		DP_RATE_LUT_NSS(CCK_RATE_TABLE_INDEX, 0),
+		DP_RATE_LUT_NSS(CCK_RATE_TABLE_INDEX, 0),
+		DP_RATE_LUT_NSS(CCK_RATE_TABLE_INDEX, 0),
+	},
+	[DP_CMN_RATECODE_PREAM_HT] = {
+		DP_RATE_LUT_NSS(HT_20_RATE_TABLE_INDEX, NUM_HT_MCS),
+		DP_RATE_LUT_NSS(HT_40_RATE_TABLE_INDEX, NUM_HT_MCS),
+		DP_RATE_LUT_NSS(HT_40_RATE_TABLE_INDEX, NUM_HT_MCS),
+		DP_RATE_LUT_NSS(HT_40_RATE_TABLE_INDEX, NUM_HT_MCS),
+	},
+	[DP_CMN_RATECODE_PREAM_VHT] = {
+		DP_RATE_LUT_NSS(VHT_20_RATE_TABLE_INDEX, NUM_VHT_MCS),
+		DP_RATE_LUT_NSS(VHT_40_RATE_TABLE_INDEX, NUM_VHT_MCS),
+		DP_RATE_LUT_NSS(VHT_80_RATE_TABLE_INDEX, NUM_VHT_MCS),
+		DP_RATE_LUT_NSS(VHT_160_RATE_TABLE_INDEX, NUM_VHT_MCS),
+	},
+	[DP_CMN_RATECODE_PREAM_HE] = {
+		DP_RATE_LUT_NSS(HE_20_RATE_TABLE_INDEX, NUM_HE_MCS),
+		DP_RATE_LUT_NSS(HE_40_RATE_TABLE_INDEX, NUM_HE_MCS),
+		DP_RATE_LUT_NSS(HE_80_RATE_TABLE_INDEX, NUM_HE_MCS),
+		DP_RATE_LUT_NSS(HE_160_RATE_TABLE_INDEX, NUM_HE_MCS),
+	},
+};
+
+/* dp_getrateindex - calculate ratekbps
+ * @gi - guard interval
+ * @mcs - MCS index
+ * @nss - NSS 1...8
+ * preamble - preamble
+ * @bw - Transmission Bandwidth
+ * @rix: rate index to be populated
+ * @ratecode: ratecode
+ *
+ * Inputs outside the base table (unknown preamble, 80+80 bw, nss > 7)
+ * take the slow path, which gives the same result for everything else.
+ *
+ * return - rate in kbps
+ */
+uint32_t
+dp_getrateindex(uint32_t gi, uint16_t mcs, uint8_t nss, uint8_t preamble,
+		uint8_t bw, uint32_t *rix, uint16_t *ratecode)
+{
+	uint32_t ratekbps = 0, res;
+
+	if (qdf_unlikely(preamble >= DP_CMN_RATECODE_PREAM_COUNT ||
+			 bw >= DP_RATE_LUT_BW_CNT ||
+			 nss >= DP_RATE_LUT_NSS_CNT))
+		return dp_getrateindex_slow(gi, mcs, nss, preamble, bw,
+					    rix, ratecode);
+
+	if (preamble == DP_CMN_RATECODE_PREAM_CCK)
+		mcs &= ~HW_RATECODE_CCK_SHORT_PREAM_MASK;
+
+	res = dp_rate_base_lut[preamble][bw][nss] + mcs;
+	*rix = res;
+	*ratecode = 0;
+	if (qdf_unlikely(res >= DP_RATE_TABLE_SIZE))
+		return 0;
+
+	switch (gi) {
+	case CDP_SGI_0_8_US:
+		ratekbps = dp_11abgnratetable.info[res].userratekbps;
+		break;
+	case CDP_SGI_0_4_US:
+		ratekbps = dp_11abgnratetable.info[res].ratekbpssgi;
+		break;
+	case CDP_SGI_1_6_US:
+		ratekbps = dp_11abgnratetable.info[res].ratekbpsdgi;
+		break;
+	case CDP_SGI_3_2_US:
+		ratekbps = dp_11abgnratetable.info[res].ratekbpsqgi;
+		break;
+	}
+	*ratecode = dp_11abgnratetable.info[res].ratecode;
+
+	return ratekbps;
+}
+
 qdf_export_symbol(dp_getrateindex);
 
+void dp_getrateindex_batch(struct dp_rate_info *info, uint32_t num)
+{
+	uint32_t i;
+
+	for (i = 0; i < num; i++)
+		info[i].ratekbps = dp_getrateindex(info[i].gi, info[i].mcs,
+						   info[i].nss,
+						   info[i].preamble,
+						   info[i].bw, &info[i].rix,
+						   &info[i].ratecode);
+}
+
+qdf_export_symbol(dp_getrateindex_batch);
+
+#ifdef WLAN_DP_RATETABLE_VERIFY
+uint32_t dp_ratetable_verify(void)
+{
+	uint32_t gi, mcs, nss, preamble, bw;
+	uint32_t kbps, kbps_ref, rix, rix_ref, mismatch = 0;
+	uint16_t rc, rc_ref;
+
+	for (preamble = 0; preamble <= DP_CMN_RATECODE_PREAM_COUNT;
+	     preamble++) {
+		for (bw = 0; bw < DP_RATE_LUT_BW_CNT; bw++) {
+			for (nss = 0; nss <= DP_RATE_LUT_NSS_CNT; nss++) {
+				for (gi = 0; gi <= CDP_SGI_3_2_US + 1; gi++) {
+					for (mcs = 0; mcs <= 0xffff; mcs++) {
+						kbps = dp_getrateindex(gi, mcs,
+							nss, preamble, bw,
+							&rix, &rc);
+						kbps_ref = dp_getrateindex_slow(
+							gi, mcs, nss, preamble,
+							bw, &rix_ref, &rc_ref);
+						if (kbps != kbps_ref ||
+						    rix != rix_ref ||
+						    rc != rc_ref)
+							mismatch++;
+					}
+				}
+			}
+		}
+	}
+
+	qdf_nofl_info("rate LUT verify: %u mismatches", mismatch);
+
+	return mismatch;
+}
+
+qdf_export_symbol(dp_ratetable_verify);
+#endif /* WLAN_DP_RATETABLE_VERIFY */
+
 /* dp_rate_idx_to_kbps - get rate kbps from index
  * @rate_idx - rate index
  * @gintval - guard interval
@@ -190,8 +190,54 @@ uint32_t
 dp_getrateindex(uint32_t gi, uint16_t mcs, uint8_t nss, uint8_t preamble,
 		uint8_t bw, uint32_t *rix, uint16_t *ratecode);
 
+/**
+ * struct dp_rate_info - rate lookup for one user of a PPDU
+ * @gi: guard interval, CDP_SGI_*
+ * @mcs: MCS index
+ * @nss: NSS - 1
+ * @preamble: DP_CMN_RATECODE_PREAM_*
+ * @bw: CMN_BW_*
+ * @ratekbps: rate in kbps, 0 when invalid
+ * @rix: rate table index
+ * @ratecode: HW ratecode
+ */
+struct dp_rate_info {
+	uint32_t gi;
+	uint16_t mcs;
+	uint8_t nss;
+	uint8_t preamble;
+	uint8_t bw;
+	uint32_t ratekbps;
+	uint32_t rix;
+	uint16_t ratecode;
+};
+
+/**
+ * dp_getrateindex_batch() - dp_getrateindex() for all users of a PPDU
+ * @info: per user request, the result fields are filled in
+ * @num: number of users
+ *
+ * Return: None
+ */
+void dp_getrateindex_batch(struct dp_rate_info *info, uint32_t num);
+
 int dp_rate_idx_to_kbps(uint8_t rate_idx, uint8_t gintval);
 
+#ifdef WLAN_DP_RATETABLE_VERIFY
+/**
+ * dp_ratetable_verify() - Compare the rate LUT against the reference
+ *			   computation for every preamble, bw, nss, gi and mcs
+ *
+ * Return: number of mismatching inputs
+ */
+uint32_t dp_ratetable_verify(void);
+#else
+static inline uint32_t dp_ratetable_verify(void)
+{
+	return 0;
+}
+#endif
+
 #if ALL_POSSIBLE_RATES_SUPPORTED
 int dp_get_supported_rates(int mode, int shortgi, int **rates);
 #else
@@ -490,6 +490,20 @@ struct cdp_ast_entry_info {
 	uint16_t peer_id;
 };
 
+/**
+ *  struct cdp_wds_del_info - WDS entry delete request
+ *  @wds_macaddr: mac address of the WDS entry
+ *  @vdev_id: vdev_id
+ *  @type: ast entry type
+ *  @delete_in_fw: entry has to be removed from the target as well
+ */
+struct cdp_wds_del_info {
+	uint8_t wds_macaddr[QDF_MAC_ADDR_SIZE];
+	uint8_t vdev_id;
+	uint8_t type;
+	uint8_t delete_in_fw;
+};
+
 #define MIC_SEQ_CTR_SIZE 6
 
 enum cdp_rx_frame_type {
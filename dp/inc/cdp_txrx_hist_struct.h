@@ -63,6 +63,20 @@ enum cdp_hist_types {
 	CDP_HIST_TYPE_MAX,
 };
 
+/*
+ * Log-linear (HDR style) delay histogram: values below
+ * 2^CDP_HIST_LL_SUB_BITS get a bucket each, every power of two above that
+ * is split into 2^CDP_HIST_LL_SUB_BITS equal sub-buckets (<= 25% relative
+ * error). Values of 2^(CDP_HIST_LL_MAX_EXP + 1) and above share the last
+ * bucket. The histogram is embedded in every per-TID per-ring delay stat
+ * of every peer, so it is only built in with WLAN_DP_HIST_LOG_LINEAR.
+ */
+#define CDP_HIST_LL_SUB_BITS 2
+#define CDP_HIST_LL_MAX_EXP 12
+#define CDP_HIST_LL_BUCKET_MAX \
+	((CDP_HIST_LL_MAX_EXP - CDP_HIST_LL_SUB_BITS + 2) << \
+	 CDP_HIST_LL_SUB_BITS)
+
 /*
  * cdp_hist_bucket: Histogram Bucket
  * @hist_type: Histogram type
@@ -76,12 +90,16 @@ struct cdp_hist_bucket {
 /*
  * cdp_hist_stats : Histogram of a stats type
  * @hist: Frequency distribution
+ * @ll_freq: Log-linear frequency distribution, WLAN_DP_HIST_LOG_LINEAR only
  * @max: Max frequency
  * @min: Minimum frequency
  * @avg: Average frequency
  */
 struct cdp_hist_stats {
 	struct cdp_hist_bucket hist;
+#ifdef WLAN_DP_HIST_LOG_LINEAR
+	uint32_t ll_freq[CDP_HIST_LL_BUCKET_MAX];
+#endif
 	int max;
 	int min;
 	int avg;
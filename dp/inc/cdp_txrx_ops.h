@@ -1152,6 +1152,9 @@ struct ol_if_ops {
 				   uint8_t *wds_macaddr,
 				   uint8_t type,
 				   uint8_t delete_in_fw);
+	void (*peer_del_multi_wds_entry)(struct cdp_ctrl_objmgr_psoc *soc,
+					 struct cdp_wds_del_info *entries,
+					 uint16_t num_entries);
 	QDF_STATUS
 	(*lro_hash_config)(struct cdp_ctrl_objmgr_psoc *psoc, uint8_t pdev_id,
 			   struct cdp_lro_hash_config *rx_offld_hash);
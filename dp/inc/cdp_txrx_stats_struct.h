@@ -1572,6 +1572,11 @@ struct cdp_tx_ingress_stats {
 		uint32_t ucast;
 		uint32_t fail_seg_alloc;
 		uint32_t clone_fail;
+		/* ME fan-out groups posted to TCL with one HP update */
+		uint32_t fanout_groups;
+		uint32_t fanout_max;
+		uint32_t fanout_lat_max_us;
+		uint64_t fanout_lat_sum_us;
 	} mcast_en;
 
 	/* IGMP Multicast Enhancement packets info */
@@ -469,6 +469,8 @@ more_data:
 	}
 done:
 	dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+	dp_rx_trace_ring_reap(soc, hal_ring_hdl, reo_ring_num,
+			      num_rx_bufs_reaped, quota);
 
 	replenish_soc = dp_rx_replensih_soc_get(soc, reo_ring_num);
 	for (mac_id = 0; mac_id < MAX_PDEV_CNT; mac_id++) {
@@ -781,6 +783,7 @@ done:
 							 nbuf);
 
 		dp_rx_update_stats(soc, nbuf);
+		dp_rx_trace_msdu(reo_ring_num, nbuf);
 		DP_RX_LIST_APPEND(deliver_list_head,
 				  deliver_list_tail,
 				  nbuf);
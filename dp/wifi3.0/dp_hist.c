@@ -22,111 +22,177 @@
 #include "dp_hist.h"
 
 /*
- * dp_hist_sw_enq_dbucket: Sofware enqueue delay bucket in ms
- * @index_0 = 0_1 ms
- * @index_1 = 1_2 ms
- * @index_2 = 2_3 ms
- * @index_3 = 3_4 ms
- * @index_4 = 4_5 ms
- * @index_5 = 5_6 ms
- * @index_6 = 6_7 ms
- * @index_7 = 7_8 ms
- * @index_8 = 8_9 ms
- * @index_8 = 9+ ms
+ * struct dp_hist_bucket_cfg: Uniform bucket layout of a histogram type
+ * @width: Bucket width in ms, the last bucket is open ended
+ * @recip: Q16 reciprocal of @width, exact for values below the last
+ *	   bucket so the index is found with a multiply and a shift
  */
-static uint16_t dp_hist_sw_enq_dbucket[CDP_HIST_BUCKET_MAX] = {
-	0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+struct dp_hist_bucket_cfg {
+	uint16_t width;
+	uint32_t recip;
+};
 
-/*
- * cdp_hist_fw2hw_dbucket: HW enqueue to Completion Delay
- * @index_0 = 0_10 ms
- * @index_1 = 10_20 ms
- * @index_2 = 20_30ms
- * @index_3 = 30_40 ms
- * @index_4 = 40_50 ms
- * @index_5 = 50_60 ms
- * @index_6 = 60_70 ms
- * @index_7 = 70_80 ms
- * @index_8 = 80_90 ms
- * @index_9 = 90+ ms
- */
-static uint16_t dp_hist_fw2hw_dbucket[CDP_HIST_BUCKET_MAX] = {
-	0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+#define DP_HIST_BUCKET_CFG(_width) \
+	{ .width = (_width), .recip = (0x10000 + (_width) - 1) / (_width) }
 
 /*
- * dp_hist_reap2stack_bucket: Reap to stack bucket
- * @index_0 = 0_5 ms
- * @index_1 = 5_10 ms
- * @index_2 = 10_15 ms
- * @index_3 = 15_20 ms
- * @index_4 = 20_25 ms
- * @index_5 = 25_30 ms
- * @index_6 = 30_35 ms
- * @index_7 = 35_40 ms
- * @index_8 = 40_45 ms
- * @index_9 = 45+ ms
+ * dp_hist_bucket_cfg: Per type bucket layout
+ *
+ * CDP_HIST_TYPE_SW_ENQEUE_DELAY: 0_1, 1_2, ... 8_9, 9+ ms
+ * CDP_HIST_TYPE_HW_COMP_DELAY: 0_10, 10_20, ... 80_90, 90+ ms
+ * CDP_HIST_TYPE_REAP_STACK: 0_5, 5_10, ... 40_45, 45+ ms
  */
-static uint16_t dp_hist_reap2stack_bucket[CDP_HIST_BUCKET_MAX] = {
-	0, 5, 10, 15, 20, 25, 30, 35, 40, 45};
+static const struct dp_hist_bucket_cfg dp_hist_bucket_cfg[CDP_HIST_TYPE_MAX] = {
+	[CDP_HIST_TYPE_SW_ENQEUE_DELAY] = DP_HIST_BUCKET_CFG(1),
+	[CDP_HIST_TYPE_HW_COMP_DELAY] = DP_HIST_BUCKET_CFG(10),
+	[CDP_HIST_TYPE_REAP_STACK] = DP_HIST_BUCKET_CFG(5),
+};
 
 /*
  * dp_hist_find_bucket_idx: Find the bucket index
- * @bucket_array: Bucket array
+ * @cfg: Bucket layout
  * @value: Frequency value
  *
  * Return: The bucket index
  */
-static int dp_hist_find_bucket_idx(int16_t *bucket_array, int value)
+static inline int dp_hist_find_bucket_idx(const struct dp_hist_bucket_cfg *cfg,
+					  int value)
 {
-	uint8_t idx = CDP_HIST_BUCKET_0;
+	uint32_t last = cfg->width * (CDP_HIST_BUCKET_MAX - 1);
 
-	for (; idx < (CDP_HIST_BUCKET_MAX - 1); idx++) {
-		if (value < bucket_array[idx + 1])
-			break;
-	}
+	if (qdf_unlikely(value < 0))
+		return CDP_HIST_BUCKET_0;
 
-	return idx;
+	if ((uint32_t)value >= last)
+		return CDP_HIST_BUCKET_MAX - 1;
+
+	return ((uint32_t)value * cfg->recip) >> 16;
 }
 
+#ifdef WLAN_DP_HIST_LOG_LINEAR
 /*
- * dp_hist_fill_buckets: Fill the histogram frequency buckets
- * @hist_bucket: Histogram bukcets
+ * dp_hist_ll_find_bucket_idx: Find the log-linear bucket index
+ * @value: Frequency value
+ *
+ * Return: The log-linear bucket index
+ */
+static inline int dp_hist_ll_find_bucket_idx(int value)
+{
+	uint32_t v = value < 0 ? 0 : value;
+	int exp;
+
+	if (v < (1 << CDP_HIST_LL_SUB_BITS))
+		return v;
+
+	exp = qdf_fls(v) - 1;
+	if (qdf_unlikely(exp > CDP_HIST_LL_MAX_EXP))
+		return CDP_HIST_LL_BUCKET_MAX - 1;
+
+	return ((exp - CDP_HIST_LL_SUB_BITS + 1) << CDP_HIST_LL_SUB_BITS) +
+	       ((v >> (exp - CDP_HIST_LL_SUB_BITS)) &
+		((1 << CDP_HIST_LL_SUB_BITS) - 1));
+}
+
+/*
+ * dp_hist_ll_bucket_lower(): Smallest value of a log-linear bucket
+ * @idx: Log-linear bucket index
+ *
+ * Return: lower bound of the bucket
+ */
+static uint32_t dp_hist_ll_bucket_lower(int idx)
+{
+	int exp;
+
+	if (idx < (1 << CDP_HIST_LL_SUB_BITS))
+		return idx;
+
+	exp = (idx >> CDP_HIST_LL_SUB_BITS) + CDP_HIST_LL_SUB_BITS - 1;
+
+	return ((1 << CDP_HIST_LL_SUB_BITS) +
+		(idx & ((1 << CDP_HIST_LL_SUB_BITS) - 1))) <<
+	       (exp - CDP_HIST_LL_SUB_BITS);
+}
+
+/*
+ * dp_hist_ll_fill_bucket(): Count a value in the log-linear buckets
+ * @hist_stats: Hist stats object
  * @value: Frequency value
  *
  * Return: void
  */
-static void dp_hist_fill_buckets(struct cdp_hist_bucket *hist_bucket, int value)
+static inline void dp_hist_ll_fill_bucket(struct cdp_hist_stats *hist_stats,
+					  int value)
 {
-	enum cdp_hist_types hist_type;
-	int idx = CDP_HIST_BUCKET_MAX;
+	hist_stats->ll_freq[dp_hist_ll_find_bucket_idx(value)]++;
+}
 
-	if (qdf_unlikely(!hist_bucket))
-		return;
+/*
+ * dp_hist_ll_copy(): Copy the log-linear buckets
+ * @src_hist_stats: Source histogram stats
+ * @dst_hist_stats: Destination histogram stats
+ *
+ * Return: void
+ */
+static inline void dp_hist_ll_copy(struct cdp_hist_stats *src_hist_stats,
+				   struct cdp_hist_stats *dst_hist_stats)
+{
+	qdf_mem_copy(dst_hist_stats->ll_freq, src_hist_stats->ll_freq,
+		     sizeof(dst_hist_stats->ll_freq));
+}
 
-	hist_type = hist_bucket->hist_type;
-
-	/* Identify the bucket the bucket and update. */
-	switch (hist_type) {
-	case CDP_HIST_TYPE_SW_ENQEUE_DELAY:
-		idx =  dp_hist_find_bucket_idx(&dp_hist_sw_enq_dbucket[0],
-					       value);
-		break;
-	case CDP_HIST_TYPE_HW_COMP_DELAY:
-		idx =  dp_hist_find_bucket_idx(&dp_hist_fw2hw_dbucket[0],
-					       value);
-		break;
-	case CDP_HIST_TYPE_REAP_STACK:
-		idx =  dp_hist_find_bucket_idx(
-				&dp_hist_reap2stack_bucket[0], value);
-		break;
-	default:
-		break;
-	}
+/*
+ * dp_hist_ll_accumulate(): Accumulate the log-linear buckets of src to dst
+ * @src_hist_stats: Source histogram stats
+ * @dst_hist_stats: Destination histogram stats
+ *
+ * Return: void
+ */
+static inline void
+dp_hist_ll_accumulate(struct cdp_hist_stats *src_hist_stats,
+		      struct cdp_hist_stats *dst_hist_stats)
+{
+	uint8_t index;
+
+	for (index = 0; index < CDP_HIST_LL_BUCKET_MAX; index++)
+		dst_hist_stats->ll_freq[index] +=
+			src_hist_stats->ll_freq[index];
+}
+#else
+static inline void dp_hist_ll_fill_bucket(struct cdp_hist_stats *hist_stats,
+					  int value)
+{
+}
 
-	if (idx == CDP_HIST_BUCKET_MAX)
+static inline void dp_hist_ll_copy(struct cdp_hist_stats *src_hist_stats,
+				   struct cdp_hist_stats *dst_hist_stats)
+{
+}
+
+static inline void
+dp_hist_ll_accumulate(struct cdp_hist_stats *src_hist_stats,
+		      struct cdp_hist_stats *dst_hist_stats)
+{
+}
+#endif
+
+/*
+ * dp_hist_fill_buckets: Fill the histogram frequency buckets
+ * @hist_stats: Hist stats object
+ * @value: Frequency value
+ *
+ * Return: void
+ */
+static void dp_hist_fill_buckets(struct cdp_hist_stats *hist_stats, int value)
+{
+	enum cdp_hist_types hist_type = hist_stats->hist.hist_type;
+
+	dp_hist_ll_fill_bucket(hist_stats, value);
+
+	if (qdf_unlikely(hist_type >= CDP_HIST_TYPE_MAX))
 		return;
 
-	hist_bucket->freq[idx]++;
+	hist_stats->hist.freq[dp_hist_find_bucket_idx(
+				&dp_hist_bucket_cfg[hist_type], value)]++;
 }
 
 /*
@@ -144,7 +210,7 @@ void dp_hist_update_stats(struct cdp_hist_stats *hist_stats, int value)
 	/*
 	 * Fill the histogram buckets according to the delay
 	 */
-	dp_hist_fill_buckets(&hist_stats->hist, value);
+	dp_hist_fill_buckets(hist_stats, value);
 
 	/*
 	 * Compute the min, max and average. Average computed is weighted
@@ -178,6 +244,7 @@ void dp_copy_hist_stats(struct cdp_hist_stats *src_hist_stats,
 	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
 		dst_hist_stats->hist.freq[index] =
 			src_hist_stats->hist.freq[index];
+	dp_hist_ll_copy(src_hist_stats, dst_hist_stats);
 	dst_hist_stats->min = src_hist_stats->min;
 	dst_hist_stats->max = src_hist_stats->max;
 	dst_hist_stats->avg = src_hist_stats->avg;
@@ -198,6 +265,7 @@ void dp_accumulate_hist_stats(struct cdp_hist_stats *src_hist_stats,
 	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
 		dst_hist_stats->hist.freq[index] +=
 			src_hist_stats->hist.freq[index];
+	dp_hist_ll_accumulate(src_hist_stats, dst_hist_stats);
 	dst_hist_stats->min = QDF_MIN(src_hist_stats->min, dst_hist_stats->min);
 	dst_hist_stats->max = QDF_MAX(src_hist_stats->max, dst_hist_stats->max);
 	dst_hist_stats->avg = (src_hist_stats->avg + dst_hist_stats->avg) >> 1;
@@ -214,3 +282,34 @@ void dp_hist_init(struct cdp_hist_stats *hist_stats,
 	qdf_mem_zero(hist_stats, sizeof(*hist_stats));
 	hist_stats->hist.hist_type = hist_type;
 }
+
+#ifdef WLAN_DP_HIST_LOG_LINEAR
+/*
+ * dp_hist_ll_percentile(): Estimate a percentile from the log-linear buckets
+ * @hist_stats: Hist stats object
+ * @pct: Percentile, 1 to 100
+ *
+ * Return: lower bound of the bucket holding the percentile, 0 when empty
+ */
+uint32_t dp_hist_ll_percentile(struct cdp_hist_stats *hist_stats, uint8_t pct)
+{
+	uint64_t total = 0, rank, seen = 0;
+	int idx;
+
+	for (idx = 0; idx < CDP_HIST_LL_BUCKET_MAX; idx++)
+		total += hist_stats->ll_freq[idx];
+
+	if (!total)
+		return 0;
+
+	rank = qdf_do_div(total * pct + 99, 100);
+	for (idx = 0; idx < CDP_HIST_LL_BUCKET_MAX; idx++) {
+		seen += hist_stats->ll_freq[idx];
+		if (seen >= rank)
+			break;
+	}
+
+	return dp_hist_ll_bucket_lower(qdf_min(idx,
+					       CDP_HIST_LL_BUCKET_MAX - 1));
+}
+#endif
@@ -40,4 +40,15 @@ void dp_accumulate_hist_stats(struct cdp_hist_stats *src_hist_stats,
 			      struct cdp_hist_stats *dst_hist_stats);
 void dp_copy_hist_stats(struct cdp_hist_stats *src_hist_stats,
 			struct cdp_hist_stats *dst_hist_stats);
+
+#ifdef WLAN_DP_HIST_LOG_LINEAR
+/*
+ * dp_hist_ll_percentile(): Estimate a percentile from the log-linear buckets
+ * @hist_stats: Hist stats object
+ * @pct: Percentile, 1 to 100
+ *
+ * Return: lower bound of the bucket holding the percentile, 0 when empty
+ */
+uint32_t dp_hist_ll_percentile(struct cdp_hist_stats *hist_stats, uint8_t pct);
+#endif
 #endif /* __DP_HIST_H_ */
@@ -2866,27 +2866,257 @@ dp_rx_mlo_timestamp_ind_handler(void *soc_handle,
 #endif
 
 /*
- * dp_htt_t2h_msg_handler() - Generic Target to host Msg/event handler
- * @context:	Opaque context (HTT SOC handle)
- * @pkt:	HTC packet
+ * dp_htt_peer_map_event_decode() - decode a peer map/unmap message
+ * @soc: HTT SOC handle
+ * @msg_type: one of the peer map/unmap T2H message types
+ * @msg_word: message payload
+ * @ev: decoded event
+ * @ast_flow_info: filled for PEER_MAP_V2 messages
+ *
+ * Return: true if @ast_flow_info was filled
  */
-static void dp_htt_t2h_msg_handler(void *context, HTC_PACKET *pkt)
+static bool
+dp_htt_peer_map_event_decode(struct htt_soc *soc,
+			     enum htt_t2h_msg_type msg_type,
+			     uint32_t *msg_word,
+			     struct dp_peer_map_event *ev,
+			     struct dp_ast_flow_override_info *ast_flow_info)
 {
-	struct htt_soc *soc = (struct htt_soc *) context;
-	qdf_nbuf_t htt_t2h_msg = (qdf_nbuf_t) pkt->pPktContext;
-	u_int32_t *msg_word;
-	enum htt_t2h_msg_type msg_type;
-	bool free_buf = true;
+	u_int8_t mac_addr_deswizzle_buf[QDF_MAC_ADDR_SIZE];
+	u_int8_t *mac_addr = NULL;
+	bool has_flow_info = false;
 
-	/* check for successful message reception */
-	if (pkt->Status != QDF_STATUS_SUCCESS) {
-		if (pkt->Status != QDF_STATUS_E_CANCELED)
-			soc->stats.htc_err_cnt++;
+	qdf_mem_zero(ev, sizeof(*ev));
+	ev->free_wds_count = DP_PEER_WDS_COUNT_INVALID;
 
-		qdf_nbuf_free(htt_t2h_msg);
+	switch (msg_type) {
+	case HTT_T2H_MSG_TYPE_PEER_MAP:
+		ev->peer_id = HTT_RX_PEER_MAP_PEER_ID_GET(*msg_word);
+		ev->hw_peer_id =
+			HTT_RX_PEER_MAP_HW_PEER_ID_GET(*(msg_word + 2));
+		ev->vdev_id = HTT_RX_PEER_MAP_VDEV_ID_GET(*msg_word);
+		mac_addr = htt_t2h_mac_addr_deswizzle(
+				(u_int8_t *)(msg_word + 1),
+				&mac_addr_deswizzle_buf[0]);
+		/*
+		 * check if peer already exists for this peer_id, if so
+		 * this peer map event is in response for a wds peer add
+		 * wmi command sent during wds source port learning.
+		 * in this case just add the ast entry to the existing
+		 * peer ast_list.
+		 */
+		ev->is_wds =
+			!!(soc->dp_soc->peer_id_to_obj_map[ev->peer_id]);
+		break;
+	case HTT_T2H_MSG_TYPE_PEER_UNMAP:
+		ev->peer_id = HTT_RX_PEER_UNMAP_PEER_ID_GET(*msg_word);
+		ev->vdev_id = HTT_RX_PEER_UNMAP_VDEV_ID_GET(*msg_word);
+		ev->is_unmap = true;
+		break;
+	case HTT_T2H_MSG_TYPE_PEER_MAP_V2:
+		ev->peer_id = HTT_RX_PEER_MAP_V2_SW_PEER_ID_GET(*msg_word);
+		ev->hw_peer_id =
+			HTT_RX_PEER_MAP_V2_HW_PEER_ID_GET(*(msg_word + 2));
+		ev->vdev_id = HTT_RX_PEER_MAP_V2_VDEV_ID_GET(*msg_word);
+		mac_addr = htt_t2h_mac_addr_deswizzle(
+				(u_int8_t *)(msg_word + 1),
+				&mac_addr_deswizzle_buf[0]);
+		ev->is_wds =
+			HTT_RX_PEER_MAP_V2_NEXT_HOP_GET(*(msg_word + 3));
+		ev->ast_hash =
+			HTT_RX_PEER_MAP_V2_AST_HASH_VALUE_GET(*(msg_word + 3));
+
+		qdf_mem_set(ast_flow_info, 0,
+			    sizeof(struct dp_ast_flow_override_info));
+		/*
+		 * Update 4 ast_index per peer, ast valid mask
+		 * and TID flow valid mask.
+		 * AST valid mask is 3 bit field corresponds to
+		 * ast_index[3:1]. ast_index 0 is always valid.
+		 */
+		ast_flow_info->ast_valid_mask =
+		HTT_RX_PEER_MAP_V2_AST_VALID_MASK_GET(*(msg_word + 3));
+		ast_flow_info->ast_idx[0] = ev->hw_peer_id;
+		ast_flow_info->ast_flow_mask[0] =
+		HTT_RX_PEER_MAP_V2_AST_0_FLOW_MASK_GET(*(msg_word + 4));
+		ast_flow_info->ast_idx[1] =
+		HTT_RX_PEER_MAP_V2_AST_INDEX_1_GET(*(msg_word + 4));
+		ast_flow_info->ast_flow_mask[1] =
+		HTT_RX_PEER_MAP_V2_AST_1_FLOW_MASK_GET(*(msg_word + 4));
+		ast_flow_info->ast_idx[2] =
+		HTT_RX_PEER_MAP_V2_AST_INDEX_2_GET(*(msg_word + 5));
+		ast_flow_info->ast_flow_mask[2] =
+		HTT_RX_PEER_MAP_V2_AST_2_FLOW_MASK_GET(*(msg_word + 4));
+		ast_flow_info->ast_idx[3] =
+		HTT_RX_PEER_MAP_V2_AST_INDEX_3_GET(*(msg_word + 6));
+		ast_flow_info->ast_flow_mask[3] =
+		HTT_RX_PEER_MAP_V2_AST_3_FLOW_MASK_GET(*(msg_word + 4));
+		/*
+		 * TID valid mask is applicable only
+		 * for HI and LOW priority flows.
+		 * tid_valid_mas is 8 bit field corresponds
+		 * to TID[7:0]
+		 */
+		ast_flow_info->tid_valid_low_pri_mask =
+		HTT_RX_PEER_MAP_V2_TID_VALID_LOW_PRI_GET(*(msg_word + 5));
+		ast_flow_info->tid_valid_hi_pri_mask =
+		HTT_RX_PEER_MAP_V2_TID_VALID_HI_PRI_GET(*(msg_word + 5));
+
+		QDF_TRACE(QDF_MODULE_ID_TXRX,
+			  QDF_TRACE_LEVEL_INFO,
+			  "ast_idx[0] %d ast_idx[1] %d ast_idx[2] %d ast_idx[3] %d n",
+			  ast_flow_info->ast_idx[0],
+			  ast_flow_info->ast_idx[1],
+			  ast_flow_info->ast_idx[2],
+			  ast_flow_info->ast_idx[3]);
+		has_flow_info = true;
+		break;
+	case HTT_T2H_MSG_TYPE_PEER_UNMAP_V2:
+		ev->peer_id =
+			HTT_RX_PEER_UNMAP_V2_SW_PEER_ID_GET(*msg_word);
+		ev->vdev_id = HTT_RX_PEER_UNMAP_V2_VDEV_ID_GET(*msg_word);
+		mac_addr = htt_t2h_mac_addr_deswizzle(
+				(u_int8_t *)(msg_word + 1),
+				&mac_addr_deswizzle_buf[0]);
+		ev->is_wds =
+			HTT_RX_PEER_UNMAP_V2_NEXT_HOP_GET(*(msg_word + 2));
+		ev->free_wds_count =
+		HTT_RX_PEER_UNMAP_V2_PEER_WDS_FREE_COUNT_GET(*(msg_word + 4));
+		ev->is_unmap = true;
+		break;
+	case HTT_T2H_MSG_TYPE_PEER_MAP_V3:
+		ev->peer_id = HTT_RX_PEER_MAP_V3_SW_PEER_ID_GET(*msg_word);
+		ev->vdev_id = HTT_RX_PEER_MAP_V3_VDEV_ID_GET(*msg_word);
+		mac_addr = htt_t2h_mac_addr_deswizzle(
+				(u_int8_t *)(msg_word + 1),
+				&mac_addr_deswizzle_buf[0]);
+		ev->hw_peer_id =
+			HTT_RX_PEER_MAP_V3_HW_PEER_ID_GET(*(msg_word + 3));
+		ev->ast_hash =
+			HTT_RX_PEER_MAP_V3_CACHE_SET_NUM_GET(*(msg_word + 3));
+		ev->is_wds = HTT_RX_PEER_MAP_V3_NEXT_HOP_GET(*(msg_word + 4));
+		break;
+	default:
+		break;
+	}
+
+	if (mac_addr)
+		qdf_mem_copy(ev->mac_addr, mac_addr, QDF_MAC_ADDR_SIZE);
+
+	dp_htt_debug("peer %s msg %d for peer id %d vdev id %d",
+		     ev->is_unmap ? "unmap" : "map", msg_type,
+		     ev->peer_id, ev->vdev_id);
+
+	return has_flow_info;
+}
+
+/*
+ * dp_htt_peer_map_flow_override() - apply ast flow override of a peer map
+ * @soc: HTT SOC handle
+ * @ev: peer map event, already applied
+ * @ast_flow_info: ast flow override info from the PEER_MAP_V2 message
+ *
+ * Return: None
+ */
+static inline void
+dp_htt_peer_map_flow_override(struct htt_soc *soc,
+			      struct dp_peer_map_event *ev,
+			      struct dp_ast_flow_override_info *ast_flow_info)
+{
+	/*
+	 * Update ast indexes for flow override support
+	 * Applicable only for non wds peers
+	 */
+	if (!soc->dp_soc->ast_offload_support)
+		dp_peer_ast_index_flow_queue_map_create(soc->dp_soc,
+							ev->is_wds,
+							ev->peer_id,
+							ev->mac_addr,
+							ast_flow_info);
+}
+
+/*
+ * dp_htt_peer_map_burst_flush() - apply the pending peer map/unmap batch
+ * @soc: HTT SOC handle
+ *
+ * Return: None
+ */
+static void dp_htt_peer_map_burst_flush(struct htt_soc *soc)
+{
+	struct dp_htt_peer_map_burst *burst = &soc->peer_map_burst;
+	uint32_t i;
+
+	if (!burst->num_events)
 		return;
+
+	dp_rx_peer_map_batch_handler(soc->dp_soc, burst->events,
+				     burst->num_events);
+
+	for (i = 0; i < burst->num_events; i++) {
+		if (burst->has_flow_info[i])
+			dp_htt_peer_map_flow_override(soc,
+						      &burst->events[i],
+						      &burst->flow_info[i]);
+	}
+
+	soc->stats.peer_map_batch_cnt++;
+	soc->stats.peer_map_batch_evt_cnt += burst->num_events;
+	burst->num_events = 0;
+}
+
+/*
+ * dp_htt_peer_map_burst_has_event() - check for a pending event of a peer
+ * @burst: pending peer map/unmap batch
+ * @ev: event about to be queued
+ *
+ * Any pending event for the peer_id forces a flush, whatever its kind.
+ * A PEER_MAP (v1) infers is_wds from the peer_id table when it is
+ * decoded, so after an UNMAP of the same peer_id it must be decoded
+ * against the table the UNMAP left behind.
+ *
+ * Return: true if an event for the same peer_id is pending
+ */
+static inline bool
+dp_htt_peer_map_burst_has_event(struct dp_htt_peer_map_burst *burst,
+				struct dp_peer_map_event *ev)
+{
+	uint32_t i;
+
+	for (i = 0; i < burst->num_events; i++) {
+		if (burst->events[i].peer_id == ev->peer_id)
+			return true;
 	}
 
+	return false;
+}
+
+static inline bool dp_htt_is_peer_map_msg(enum htt_t2h_msg_type msg_type)
+{
+	switch (msg_type) {
+	case HTT_T2H_MSG_TYPE_PEER_MAP:
+	case HTT_T2H_MSG_TYPE_PEER_UNMAP:
+	case HTT_T2H_MSG_TYPE_PEER_MAP_V2:
+	case HTT_T2H_MSG_TYPE_PEER_UNMAP_V2:
+	case HTT_T2H_MSG_TYPE_PEER_MAP_V3:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/*
+ * dp_htt_t2h_msg_process() - handle a T2H message other than peer map/unmap
+ * @soc: HTT SOC handle
+ * @htt_t2h_msg: T2H message buffer, consumed
+ *
+ * Return: None
+ */
+static void dp_htt_t2h_msg_process(struct htt_soc *soc, qdf_nbuf_t htt_t2h_msg)
+{
+	u_int32_t *msg_word;
+	enum htt_t2h_msg_type msg_type;
+	bool free_buf = true;
+
 	/* TODO: Check if we should pop the HTC/HTT header alignment padding */
 
 	msg_word = (u_int32_t *) qdf_nbuf_data(htt_t2h_msg);
@@ -2899,54 +3129,6 @@ static void dp_htt_t2h_msg_handler(void *context, HTC_PACKET *pkt)
 		dp_htt_bkp_event_alert(msg_word, soc);
 		break;
 	}
-	case HTT_T2H_MSG_TYPE_PEER_MAP:
-		{
-			u_int8_t mac_addr_deswizzle_buf[QDF_MAC_ADDR_SIZE];
-			u_int8_t *peer_mac_addr;
-			u_int16_t peer_id;
-			u_int16_t hw_peer_id;
-			u_int8_t vdev_id;
-			u_int8_t is_wds;
-			struct dp_soc *dpsoc = (struct dp_soc *)soc->dp_soc;
-
-			peer_id = HTT_RX_PEER_MAP_PEER_ID_GET(*msg_word);
-			hw_peer_id =
-				HTT_RX_PEER_MAP_HW_PEER_ID_GET(*(msg_word+2));
-			vdev_id = HTT_RX_PEER_MAP_VDEV_ID_GET(*msg_word);
-			peer_mac_addr = htt_t2h_mac_addr_deswizzle(
-				(u_int8_t *) (msg_word+1),
-				&mac_addr_deswizzle_buf[0]);
-			QDF_TRACE(QDF_MODULE_ID_TXRX,
-				QDF_TRACE_LEVEL_DEBUG,
-				"HTT_T2H_MSG_TYPE_PEER_MAP msg for peer id %d vdev id %d n",
-				peer_id, vdev_id);
-
-			/*
-			 * check if peer already exists for this peer_id, if so
-			 * this peer map event is in response for a wds peer add
-			 * wmi command sent during wds source port learning.
-			 * in this case just add the ast entry to the existing
-			 * peer ast_list.
-			 */
-			is_wds = !!(dpsoc->peer_id_to_obj_map[peer_id]);
-			dp_rx_peer_map_handler(soc->dp_soc, peer_id, hw_peer_id,
-					       vdev_id, peer_mac_addr, 0,
-					       is_wds);
-			break;
-		}
-	case HTT_T2H_MSG_TYPE_PEER_UNMAP:
-		{
-			u_int16_t peer_id;
-			u_int8_t vdev_id;
-			u_int8_t mac_addr[QDF_MAC_ADDR_SIZE] = {0};
-			peer_id = HTT_RX_PEER_UNMAP_PEER_ID_GET(*msg_word);
-			vdev_id = HTT_RX_PEER_UNMAP_VDEV_ID_GET(*msg_word);
-
-			dp_rx_peer_unmap_handler(soc->dp_soc, peer_id,
-						 vdev_id, mac_addr, 0,
-						 DP_PEER_WDS_COUNT_INVALID);
-			break;
-		}
 	case HTT_T2H_MSG_TYPE_SEC_IND:
 		{
 			u_int16_t peer_id;
@@ -3067,125 +3249,6 @@ static void dp_htt_t2h_msg_handler(void *context, HTC_PACKET *pkt)
 			dp_txrx_fw_stats_handler(soc->dp_soc, htt_t2h_msg);
 			break;
 		}
-	case HTT_T2H_MSG_TYPE_PEER_MAP_V2:
-		{
-			u_int8_t mac_addr_deswizzle_buf[QDF_MAC_ADDR_SIZE];
-			u_int8_t *peer_mac_addr;
-			u_int16_t peer_id;
-			u_int16_t hw_peer_id;
-			u_int8_t vdev_id;
-			bool is_wds;
-			u_int16_t ast_hash;
-			struct dp_ast_flow_override_info ast_flow_info;
-
-			qdf_mem_set(&ast_flow_info, 0,
-					    sizeof(struct dp_ast_flow_override_info));
-
-			peer_id = HTT_RX_PEER_MAP_V2_SW_PEER_ID_GET(*msg_word);
-			hw_peer_id =
-			HTT_RX_PEER_MAP_V2_HW_PEER_ID_GET(*(msg_word + 2));
-			vdev_id = HTT_RX_PEER_MAP_V2_VDEV_ID_GET(*msg_word);
-			peer_mac_addr =
-			htt_t2h_mac_addr_deswizzle((u_int8_t *)(msg_word + 1),
-						   &mac_addr_deswizzle_buf[0]);
-			is_wds =
-			HTT_RX_PEER_MAP_V2_NEXT_HOP_GET(*(msg_word + 3));
-			ast_hash =
-			HTT_RX_PEER_MAP_V2_AST_HASH_VALUE_GET(*(msg_word + 3));
-			/*
-			 * Update 4 ast_index per peer, ast valid mask
-			 * and TID flow valid mask.
-			 * AST valid mask is 3 bit field corresponds to
-			 * ast_index[3:1]. ast_index 0 is always valid.
-			 */
-			ast_flow_info.ast_valid_mask =
-			HTT_RX_PEER_MAP_V2_AST_VALID_MASK_GET(*(msg_word + 3));
-			ast_flow_info.ast_idx[0] = hw_peer_id;
-			ast_flow_info.ast_flow_mask[0] =
-			HTT_RX_PEER_MAP_V2_AST_0_FLOW_MASK_GET(*(msg_word + 4));
-			ast_flow_info.ast_idx[1] =
-			HTT_RX_PEER_MAP_V2_AST_INDEX_1_GET(*(msg_word + 4));
-			ast_flow_info.ast_flow_mask[1] =
-			HTT_RX_PEER_MAP_V2_AST_1_FLOW_MASK_GET(*(msg_word + 4));
-			ast_flow_info.ast_idx[2] =
-			HTT_RX_PEER_MAP_V2_AST_INDEX_2_GET(*(msg_word + 5));
-			ast_flow_info.ast_flow_mask[2] =
-			HTT_RX_PEER_MAP_V2_AST_2_FLOW_MASK_GET(*(msg_word + 4));
-			ast_flow_info.ast_idx[3] =
-			HTT_RX_PEER_MAP_V2_AST_INDEX_3_GET(*(msg_word + 6));
-			ast_flow_info.ast_flow_mask[3] =
-			HTT_RX_PEER_MAP_V2_AST_3_FLOW_MASK_GET(*(msg_word + 4));
-			/*
-			 * TID valid mask is applicable only
-			 * for HI and LOW priority flows.
-			 * tid_valid_mas is 8 bit field corresponds
-			 * to TID[7:0]
-			 */
-			ast_flow_info.tid_valid_low_pri_mask =
-			HTT_RX_PEER_MAP_V2_TID_VALID_LOW_PRI_GET(*(msg_word + 5));
-			ast_flow_info.tid_valid_hi_pri_mask =
-			HTT_RX_PEER_MAP_V2_TID_VALID_HI_PRI_GET(*(msg_word + 5));
-
-			QDF_TRACE(QDF_MODULE_ID_TXRX,
-				  QDF_TRACE_LEVEL_DEBUG,
-				  "HTT_T2H_MSG_TYPE_PEER_MAP msg for peer id %d vdev id %d n",
-				  peer_id, vdev_id);
-
-			QDF_TRACE(QDF_MODULE_ID_TXRX,
-				  QDF_TRACE_LEVEL_INFO,
-				  "ast_idx[0] %d ast_idx[1] %d ast_idx[2] %d ast_idx[3] %d n",
-				  ast_flow_info.ast_idx[0],
-				  ast_flow_info.ast_idx[1],
-				  ast_flow_info.ast_idx[2],
-				  ast_flow_info.ast_idx[3]);
-
-			dp_rx_peer_map_handler(soc->dp_soc, peer_id,
-					       hw_peer_id, vdev_id,
-					       peer_mac_addr, ast_hash,
-					       is_wds);
-
-			/*
-			 * Update ast indexes for flow override support
-			 * Applicable only for non wds peers
-			 */
-			if (!soc->dp_soc->ast_offload_support)
-				dp_peer_ast_index_flow_queue_map_create(
-						soc->dp_soc, is_wds,
-						peer_id, peer_mac_addr,
-						&ast_flow_info);
-
-			break;
-		}
-	case HTT_T2H_MSG_TYPE_PEER_UNMAP_V2:
-		{
-			u_int8_t mac_addr_deswizzle_buf[QDF_MAC_ADDR_SIZE];
-			u_int8_t *mac_addr;
-			u_int16_t peer_id;
-			u_int8_t vdev_id;
-			u_int8_t is_wds;
-			u_int32_t free_wds_count;
-
-			peer_id =
-			HTT_RX_PEER_UNMAP_V2_SW_PEER_ID_GET(*msg_word);
-			vdev_id = HTT_RX_PEER_UNMAP_V2_VDEV_ID_GET(*msg_word);
-			mac_addr =
-			htt_t2h_mac_addr_deswizzle((u_int8_t *)(msg_word + 1),
-						   &mac_addr_deswizzle_buf[0]);
-			is_wds =
-			HTT_RX_PEER_UNMAP_V2_NEXT_HOP_GET(*(msg_word + 2));
-			free_wds_count =
-			HTT_RX_PEER_UNMAP_V2_PEER_WDS_FREE_COUNT_GET(*(msg_word + 4));
-
-			QDF_TRACE(QDF_MODULE_ID_TXRX,
-				  QDF_TRACE_LEVEL_INFO,
-				  "HTT_T2H_MSG_TYPE_PEER_UNMAP msg for peer id %d vdev id %d n",
-				  peer_id, vdev_id);
-
-			dp_rx_peer_unmap_handler(soc->dp_soc, peer_id,
-						 vdev_id, mac_addr,
-						 is_wds, free_wds_count);
-			break;
-		}
 	case HTT_T2H_MSG_TYPE_RX_DELBA:
 		{
 			uint16_t peer_id;
@@ -3230,35 +3293,6 @@ static void dp_htt_t2h_msg_handler(void *context, HTC_PACKET *pkt)
 			dp_offload_ind_handler(soc, msg_word);
 			break;
 		}
-	case HTT_T2H_MSG_TYPE_PEER_MAP_V3:
-	{
-		u_int8_t mac_addr_deswizzle_buf[QDF_MAC_ADDR_SIZE];
-		u_int8_t *peer_mac_addr;
-		u_int16_t peer_id;
-		u_int16_t hw_peer_id;
-		u_int8_t vdev_id;
-		uint8_t is_wds;
-		u_int16_t ast_hash = 0;
-
-		peer_id = HTT_RX_PEER_MAP_V3_SW_PEER_ID_GET(*msg_word);
-		vdev_id = HTT_RX_PEER_MAP_V3_VDEV_ID_GET(*msg_word);
-		peer_mac_addr =
-		htt_t2h_mac_addr_deswizzle((u_int8_t *)(msg_word + 1),
-					   &mac_addr_deswizzle_buf[0]);
-		hw_peer_id = HTT_RX_PEER_MAP_V3_HW_PEER_ID_GET(*(msg_word + 3));
-		ast_hash = HTT_RX_PEER_MAP_V3_CACHE_SET_NUM_GET(*(msg_word + 3));
-		is_wds = HTT_RX_PEER_MAP_V3_NEXT_HOP_GET(*(msg_word + 4));
-
-		dp_htt_info("HTT_T2H_MSG_TYPE_PEER_MAP_V3 msg for peer id %d vdev id %d n",
-			    peer_id, vdev_id);
-
-		dp_rx_peer_map_handler(soc->dp_soc, peer_id,
-				       hw_peer_id, vdev_id,
-				       peer_mac_addr, ast_hash,
-				       is_wds);
-
-		break;
-	}
 	case HTT_T2H_MSG_TYPE_MLO_RX_PEER_MAP:
 	{
 		dp_htt_mlo_peer_map_handler(soc, msg_word);
@@ -3288,6 +3322,193 @@ static void dp_htt_t2h_msg_handler(void *context, HTC_PACKET *pkt)
 		qdf_nbuf_free(htt_t2h_msg);
 }
 
+/*
+ * dp_htt_t2h_msg_burst_handler() - process a burst of T2H messages
+ * @soc: HTT SOC handle
+ * @msgs: T2H message buffers, in arrival order
+ * @num_msgs: number of entries in @msgs
+ *
+ * Consecutive peer map/unmap messages are decoded and applied as one
+ * batch, every other message goes through dp_htt_t2h_msg_process().
+ * All buffers in @msgs are consumed.
+ *
+ * Return: None
+ */
+static void dp_htt_t2h_msg_burst_handler(struct htt_soc *soc,
+					 qdf_nbuf_t *msgs, uint32_t num_msgs)
+{
+	struct dp_htt_peer_map_burst *burst = &soc->peer_map_burst;
+	struct dp_ast_flow_override_info ast_flow_info;
+	struct dp_peer_map_event ev;
+	enum htt_t2h_msg_type msg_type;
+	uint32_t *msg_word;
+	bool has_flow_info;
+	uint32_t i;
+
+	for (i = 0; i < num_msgs; i++) {
+		msg_word = (uint32_t *)qdf_nbuf_data(msgs[i]);
+		msg_type = HTT_T2H_MSG_TYPE_GET(*msg_word);
+
+		if (!dp_htt_is_peer_map_msg(msg_type)) {
+			/* keep firmware ordering across message types */
+			dp_htt_peer_map_burst_flush(soc);
+			dp_htt_t2h_msg_process(soc, msgs[i]);
+			continue;
+		}
+
+		htt_event_record(soc->htt_logger_handle,
+				 msg_type, (uint8_t *)msg_word);
+
+		has_flow_info = dp_htt_peer_map_event_decode(soc, msg_type,
+							     msg_word, &ev,
+							     &ast_flow_info);
+		if (burst->num_events == DP_PEER_MAP_BATCH_MAX ||
+		    dp_htt_peer_map_burst_has_event(burst, &ev)) {
+			dp_htt_peer_map_burst_flush(soc);
+			/* PEER_MAP infers is_wds from the updated table */
+			has_flow_info =
+				dp_htt_peer_map_event_decode(soc, msg_type,
+							     msg_word, &ev,
+							     &ast_flow_info);
+		}
+
+		burst->events[burst->num_events] = ev;
+		burst->has_flow_info[burst->num_events] = has_flow_info;
+		if (has_flow_info)
+			burst->flow_info[burst->num_events] = ast_flow_info;
+		burst->num_events++;
+
+		qdf_nbuf_free(msgs[i]);
+	}
+
+	dp_htt_peer_map_burst_flush(soc);
+}
+
+/*
+ * dp_htt_t2h_msg_handler() - Generic Target to host Msg/event handler
+ * @context:	Opaque context (HTT SOC handle)
+ * @pkt:	HTC packet
+ *
+ * HTC indicates one T2H message per call and gives no sign of more to
+ * come, so the message is parsed as a burst of one.
+ */
+static void dp_htt_t2h_msg_handler(void *context, HTC_PACKET *pkt)
+{
+	struct htt_soc *soc = (struct htt_soc *) context;
+	qdf_nbuf_t htt_t2h_msg = (qdf_nbuf_t) pkt->pPktContext;
+
+	/* check for successful message reception */
+	if (pkt->Status != QDF_STATUS_SUCCESS) {
+		if (pkt->Status != QDF_STATUS_E_CANCELED)
+			soc->stats.htc_err_cnt++;
+
+		qdf_nbuf_free(htt_t2h_msg);
+		return;
+	}
+
+	dp_htt_t2h_msg_burst_handler(soc, &htt_t2h_msg, 1);
+}
+
+#ifdef WLAN_DP_HTT_PEER_MAP_REPLAY
+uint64_t dp_htt_peer_map_replay(struct htt_soc *soc, qdf_nbuf_t *msgs,
+				uint32_t num_msgs, bool burst)
+{
+	uint32_t batch_cnt = soc->stats.peer_map_batch_cnt;
+	uint32_t batch_evt_cnt = soc->stats.peer_map_batch_evt_cnt;
+	uint64_t start_us;
+	uint64_t elapsed_us;
+	uint32_t i;
+
+	start_us = qdf_ktime_to_us(qdf_ktime_get());
+
+	if (burst) {
+		dp_htt_t2h_msg_burst_handler(soc, msgs, num_msgs);
+	} else {
+		for (i = 0; i < num_msgs; i++)
+			dp_htt_t2h_msg_burst_handler(soc, &msgs[i], 1);
+	}
+
+	elapsed_us = qdf_ktime_to_us(qdf_ktime_get()) - start_us;
+
+	dp_htt_info("peer map replay: %s msgs %u batches %u batched events %u time %llu us",
+		    burst ? "burst" : "per msg", num_msgs,
+		    soc->stats.peer_map_batch_cnt - batch_cnt,
+		    soc->stats.peer_map_batch_evt_cnt - batch_evt_cnt,
+		    elapsed_us);
+
+	return elapsed_us;
+}
+
+/*
+ * dp_htt_peer_map_burst_test_queue() - queue an event in a test burst
+ * @burst: test burst
+ * @peer_id: peer id of the event
+ * @is_unmap: queue an unmap event
+ *
+ * Return: None
+ */
+static void
+dp_htt_peer_map_burst_test_queue(struct dp_htt_peer_map_burst *burst,
+				 uint16_t peer_id, bool is_unmap)
+{
+	struct dp_peer_map_event *ev = &burst->events[burst->num_events++];
+
+	qdf_mem_zero(ev, sizeof(*ev));
+	ev->peer_id = peer_id;
+	ev->is_unmap = is_unmap;
+}
+
+uint32_t dp_htt_peer_map_burst_unit_test(void)
+{
+	struct dp_htt_peer_map_burst *burst;
+	struct dp_peer_map_event ev = {0};
+	uint32_t errors = 0;
+
+	burst = qdf_mem_malloc(sizeof(*burst));
+	if (!burst) {
+		qdf_nofl_alert("FAIL: peer map burst alloc");
+		return 1;
+	}
+
+	/* a MAP after a pending UNMAP of its peer_id must flush first ... */
+	dp_htt_peer_map_burst_test_queue(burst, 5, true);
+	ev.peer_id = 5;
+	ev.is_unmap = false;
+	if (!dp_htt_peer_map_burst_has_event(burst, &ev)) {
+		qdf_nofl_alert("FAIL: MAP batched with UNMAP of its peer_id");
+		errors++;
+	}
+
+	/* ... but can join the batch of an UNMAP of another peer_id */
+	ev.peer_id = 6;
+	if (dp_htt_peer_map_burst_has_event(burst, &ev)) {
+		qdf_nofl_alert("FAIL: MAP not batched with UNMAP of another peer_id");
+		errors++;
+	}
+
+	/* an UNMAP after a pending MAP of its peer_id must flush first */
+	burst->num_events = 0;
+	dp_htt_peer_map_burst_test_queue(burst, 5, false);
+	ev.peer_id = 5;
+	ev.is_unmap = true;
+	if (!dp_htt_peer_map_burst_has_event(burst, &ev)) {
+		qdf_nofl_alert("FAIL: UNMAP batched with MAP of its peer_id");
+		errors++;
+	}
+
+	/* as must a second MAP of the same peer_id (WDS ast add) */
+	ev.is_unmap = false;
+	if (!dp_htt_peer_map_burst_has_event(burst, &ev)) {
+		qdf_nofl_alert("FAIL: MAP batched with MAP of its peer_id");
+		errors++;
+	}
+
+	qdf_mem_free(burst);
+
+	return errors;
+}
+#endif
+
 /*
  * dp_htt_h2t_full() - Send full handler (called from HTC)
  * @context:	Opaque context (HTT SOC handle)
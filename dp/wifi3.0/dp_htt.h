@@ -216,6 +216,20 @@ struct dp_htt_timestamp {
 	long *lmac_ttt;
 };
 
+/**
+ * struct dp_htt_peer_map_burst - peer map/unmap events pending in a burst
+ * @events: decoded events, in arrival order
+ * @flow_info: ast flow override info carried by PEER_MAP_V2 events
+ * @has_flow_info: @flow_info entry is valid for the event
+ * @num_events: number of pending events
+ */
+struct dp_htt_peer_map_burst {
+	struct dp_peer_map_event events[DP_PEER_MAP_BATCH_MAX];
+	struct dp_ast_flow_override_info flow_info[DP_PEER_MAP_BATCH_MAX];
+	bool has_flow_info[DP_PEER_MAP_BATCH_MAX];
+	uint32_t num_events;
+};
+
 struct htt_soc {
 	struct cdp_ctrl_objmgr_psoc *ctrl_psoc;
 	struct dp_soc *dp_soc;
@@ -244,9 +258,15 @@ struct htt_soc {
 		int fail_count;
 		/* rtpm put skip count for ver req msg */
 		int htt_ver_req_put_skip;
+		/* peer map/unmap batches flushed by the burst handler */
+		uint32_t peer_map_batch_cnt;
+		/* peer map/unmap events applied through batches */
+		uint32_t peer_map_batch_evt_cnt;
 	} stats;
 
 	HTT_TX_MUTEX_TYPE htt_tx_mutex;
+	/* only touched from the T2H RX context */
+	struct dp_htt_peer_map_burst peer_map_burst;
 };
 
 #ifdef QCA_MONITOR_2_0_SUPPORT
@@ -801,6 +821,48 @@ htt_soc_initialize(struct htt_soc *htt_soc,
  */
 struct htt_soc *htt_soc_attach(struct dp_soc *soc, HTC_HANDLE htc_hdl);
 
+#ifdef WLAN_DP_HTT_PEER_MAP_REPLAY
+/**
+ * dp_htt_peer_map_replay() - time a replay of captured T2H messages
+ * @soc: SOC level HTT handle
+ * @msgs: captured T2H messages, consumed by the replay
+ * @num_msgs: number of entries in @msgs
+ * @burst: hand all messages to the T2H parser at once, so consecutive peer
+ *	   map/unmap messages are applied as one batch, instead of one message
+ *	   at a time as HTC does
+ *
+ * Meant for association storm captures: replay the same capture once
+ * per mode against freshly created peers and compare the results.
+ *
+ * Return: replay time in microseconds
+ */
+uint64_t dp_htt_peer_map_replay(struct htt_soc *soc, qdf_nbuf_t *msgs,
+				uint32_t num_msgs, bool burst);
+
+/**
+ * dp_htt_peer_map_burst_unit_test() - run the peer map burst unit test
+ *
+ * Checks when a peer map/unmap event may join the pending batch, among
+ * others that a PEER_MAP following an UNMAP of its peer_id is not batched
+ * with it.
+ *
+ * Return: number of failed test cases
+ */
+uint32_t dp_htt_peer_map_burst_unit_test(void);
+#else
+static inline
+uint64_t dp_htt_peer_map_replay(struct htt_soc *soc, qdf_nbuf_t *msgs,
+				uint32_t num_msgs, bool burst)
+{
+	return 0;
+}
+
+static inline uint32_t dp_htt_peer_map_burst_unit_test(void)
+{
+	return 0;
+}
+#endif
+
 /*
  * htt_set_htc_handle_() - set HTC handle
  * @htt_hdl: HTT handle/SOC
@@ -759,6 +759,35 @@ void DP_PRINT_STATS(const char *fmt, ...);
 	_handle_a->stats._field = _handle_b->stats._field; \
 }
 
+/*
+ * Per ring shards of the per-packet peer counters, see
+ * struct dp_peer_stats_shards. Only the ring context owning _ring may
+ * update a shard; readers fold them with dp_peer_stats_shards_fold().
+ */
+#define DP_PEER_RX_SHARD_INCC(_peer, _ring, _field, _delta, _cond) \
+{ \
+	if (_cond) \
+		(_peer)->stats_shards.rx[_ring].cur._field += _delta; \
+}
+
+#define DP_PEER_RX_SHARD_INC_PKT(_peer, _ring, _field, _count, _bytes) \
+{ \
+	(_peer)->stats_shards.rx[_ring].cur._field.num += _count; \
+	(_peer)->stats_shards.rx[_ring].cur._field.bytes += _bytes; \
+}
+
+#define DP_PEER_TX_SHARD_INCC(_peer, _ring, _field, _delta, _cond) \
+{ \
+	if (_cond) \
+		(_peer)->stats_shards.tx[_ring].cur._field += _delta; \
+}
+
+#define DP_PEER_TX_SHARD_INC_PKT(_peer, _ring, _field, _count, _bytes) \
+{ \
+	(_peer)->stats_shards.tx[_ring].cur._field.num += _count; \
+	(_peer)->stats_shards.tx[_ring].cur._field.bytes += _bytes; \
+}
+
 #else
 #define DP_STATS_INC(_handle, _field, _delta)
 #define DP_STATS_INCC(_handle, _field, _delta, _cond)
@@ -768,6 +797,10 @@ void DP_PRINT_STATS(const char *fmt, ...);
 #define DP_STATS_INCC_PKT(_handle, _field, _count, _bytes, _cond)
 #define DP_STATS_AGGR(_handle_a, _handle_b, _field)
 #define DP_STATS_AGGR_PKT(_handle_a, _handle_b, _field)
+#define DP_PEER_RX_SHARD_INCC(_peer, _ring, _field, _delta, _cond)
+#define DP_PEER_RX_SHARD_INC_PKT(_peer, _ring, _field, _count, _bytes)
+#define DP_PEER_TX_SHARD_INCC(_peer, _ring, _field, _delta, _cond)
+#define DP_PEER_TX_SHARD_INC_PKT(_peer, _ring, _field, _count, _bytes)
 #endif
 
 #if defined(QCA_VDEV_STATS_HW_OFFLOAD_SUPPORT) && \
@@ -22,6 +22,7 @@
 #include <qdf_net_types.h>
 #include <qdf_lro.h>
 #include <qdf_module.h>
+#include <qdf_func_tracker.h>
 #include <hal_hw_headers.h>
 #include <hal_api.h>
 #include <hif.h>
@@ -1669,7 +1670,7 @@ dp_print_peer_ast_entries(struct dp_soc *soc, struct dp_peer *peer, void *arg)
 		    ase->peer_id,
 		    type[ase->type],
 		    ase->next_hop,
-		    ase->is_active,
+		    dp_peer_ast_is_active(soc, ase),
 		    ase->ast_idx,
 		    ase->ast_hash_value,
 		    ase->delete_in_progress,
@@ -1693,6 +1694,9 @@ void dp_print_ast_stats(struct dp_soc *soc)
 	DP_PRINT_STATS("	Entries MAP ERR  = %d", soc->stats.ast.map_err);
 	DP_PRINT_STATS("	Entries Mismatch ERR  = %d",
 		       soc->stats.ast.ast_mismatch);
+	DP_PRINT_STATS("	Aging slices = %u", soc->stats.ast.age_slices);
+	DP_PRINT_STATS("	Aging max lock hold = %u us",
+		       soc->stats.ast.age_lock_hold_max_us);
 
 	DP_PRINT_STATS("AST Table:");
 
@@ -2505,6 +2509,7 @@ static uint32_t dp_service_srngs(void *dp_ctx, uint32_t dp_budget)
 	uint8_t rx_wbm_rel_mask = int_ctx->rx_wbm_rel_ring_mask;
 	uint8_t reo_status_mask = int_ctx->reo_status_ring_mask;
 	uint32_t remaining_quota = dp_budget;
+	qdf_prof_ts_t prof_ts;
 
 	dp_verbose_debug("tx %x rx %x rx_err %x rx_wbm_rel %x reo_status %x rx_mon_ring %x host2rxdma %x rxdma2host %x\n",
 			 tx_mask, rx_mask, rx_err_mask, rx_wbm_rel_mask,
@@ -2517,10 +2522,12 @@ static uint32_t dp_service_srngs(void *dp_ctx, uint32_t dp_budget)
 	for (index = 0; index < soc->num_tcl_data_rings; index++) {
 		if (!(1 << wlan_cfg_get_wbm_ring_num_for_index(soc->wlan_cfg_ctx, index) & tx_mask))
 			continue;
+		prof_ts = qdf_prof_start();
 		work_done = dp_tx_comp_handler(int_ctx,
 					       soc,
 					       soc->tx_comp_ring[index].hal_srng,
 					       index, remaining_quota);
+		qdf_prof_end(QDF_PROF_DP_TX_COMP, prof_ts);
 		if (work_done) {
 			intr_stats->num_tx_ring_masks[index]++;
 			dp_verbose_debug("tx mask 0x%x index %d, budget %d, work_done %d",
@@ -2577,10 +2584,12 @@ static uint32_t dp_service_srngs(void *dp_ctx, uint32_t dp_budget)
 		for (ring = 0; ring < soc->num_reo_dest_rings; ring++) {
 			if (!(rx_mask & (1 << ring)))
 				continue;
+			prof_ts = qdf_prof_start();
 			work_done = soc->arch_ops.dp_rx_process(int_ctx,
 						  soc->reo_dest_ring[ring].hal_srng,
 						  ring,
 						  remaining_quota);
+			qdf_prof_end(QDF_PROF_DP_RX_PROCESS, prof_ts);
 			if (work_done) {
 				intr_stats->num_rx_ring_masks[ring]++;
 				dp_verbose_debug("rx mask 0x%x ring %d, work_done %d budget %d",
@@ -6869,6 +6878,7 @@ dp_peer_create_wifi3(struct cdp_soc_t *soc_hdl, uint8_t vdev_id,
 		qdf_spinlock_create(&peer->peer_info_lock);
 		dp_peer_rx_bufq_resources_init(peer);
 
+		dp_peer_stats_shards_drop(peer);
 		DP_STATS_INIT(peer);
 		DP_STATS_UPD(peer, rx.avg_snr, CDP_INVALID_SNR);
 
@@ -8757,6 +8767,7 @@ dp_txrx_host_peer_stats_clr(struct dp_soc *soc,
 		DP_STATS_CLR(rx_tid);
 	}
 
+	dp_peer_stats_shards_drop(peer);
 	DP_STATS_CLR(peer);
 
 	dp_txrx_host_peer_ext_stats_clr(peer);
@@ -10049,6 +10060,7 @@ dp_txrx_get_peer_stats(struct cdp_soc_t *soc, uint8_t vdev_id,
 	if (!peer)
 		return QDF_STATUS_E_FAILURE;
 
+	dp_peer_stats_shards_fold(peer);
 	qdf_mem_copy(peer_stats, &peer->stats,
 		     sizeof(struct cdp_peer_stats));
 
@@ -10157,6 +10169,7 @@ dp_txrx_reset_peer_stats(struct cdp_soc_t *soc, uint8_t vdev_id,
 	if (!peer)
 		return QDF_STATUS_E_FAILURE;
 
+	dp_peer_stats_shards_drop(peer);
 	qdf_mem_zero(&peer->stats, sizeof(peer->stats));
 
 	dp_peer_unref_delete(peer, DP_MOD_ID_CDP);
@@ -703,25 +703,24 @@ void dp_peer_vdev_list_remove(struct dp_soc *soc, struct dp_vdev *vdev,
 }
 
 /*
- * dp_peer_find_id_to_obj_add() - Add peer into peer_id table
+ * __dp_peer_find_id_to_obj_add() - Add peer into peer_id table
  * @soc: SoC handle
  * @peer: peer handle
  * @peer_id: peer_id
  *
+ * Caller must hold soc->peer_map_lock.
+ *
  * Return: None
  */
-void dp_peer_find_id_to_obj_add(struct dp_soc *soc,
-				struct dp_peer *peer,
-				uint16_t peer_id)
+static inline void __dp_peer_find_id_to_obj_add(struct dp_soc *soc,
+						struct dp_peer *peer,
+						uint16_t peer_id)
 {
 	QDF_ASSERT(peer_id <= soc->max_peer_id);
 
-	qdf_spin_lock_bh(&soc->peer_map_lock);
-
 	if (QDF_IS_STATUS_ERROR(dp_peer_get_ref(soc, peer, DP_MOD_ID_CONFIG))) {
 		dp_err("unable to get peer ref at MAP mac: "QDF_MAC_ADDR_FMT" peer_id %u",
 		       QDF_MAC_ADDR_REF(peer->mac_addr.raw), peer_id);
-		qdf_spin_unlock_bh(&soc->peer_map_lock);
 		return;
 	}
 
@@ -733,26 +732,57 @@ void dp_peer_find_id_to_obj_add(struct dp_soc *soc,
 		 */
 		QDF_ASSERT(0);
 	}
+}
+
+/*
+ * dp_peer_find_id_to_obj_add() - Add peer into peer_id table
+ * @soc: SoC handle
+ * @peer: peer handle
+ * @peer_id: peer_id
+ *
+ * Return: None
+ */
+void dp_peer_find_id_to_obj_add(struct dp_soc *soc,
+				struct dp_peer *peer,
+				uint16_t peer_id)
+{
+	qdf_spin_lock_bh(&soc->peer_map_lock);
+	__dp_peer_find_id_to_obj_add(soc, peer, peer_id);
 	qdf_spin_unlock_bh(&soc->peer_map_lock);
 }
 
 /*
- * dp_peer_find_id_to_obj_remove() - remove peer from peer_id table
+ * __dp_peer_find_id_to_obj_remove() - remove peer from peer_id table
  * @soc: SoC handle
  * @peer_id: peer_id
  *
+ * Caller must hold soc->peer_map_lock.
+ *
  * Return: None
  */
-void dp_peer_find_id_to_obj_remove(struct dp_soc *soc,
-				   uint16_t peer_id)
+static inline void __dp_peer_find_id_to_obj_remove(struct dp_soc *soc,
+						   uint16_t peer_id)
 {
 	struct dp_peer *peer = NULL;
 	QDF_ASSERT(peer_id <= soc->max_peer_id);
 
-	qdf_spin_lock_bh(&soc->peer_map_lock);
 	peer = soc->peer_id_to_obj_map[peer_id];
 	soc->peer_id_to_obj_map[peer_id] = NULL;
 	dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
+}
+
+/*
+ * dp_peer_find_id_to_obj_remove() - remove peer from peer_id table
+ * @soc: SoC handle
+ * @peer_id: peer_id
+ *
+ * Return: None
+ */
+void dp_peer_find_id_to_obj_remove(struct dp_soc *soc,
+				   uint16_t peer_id)
+{
+	qdf_spin_lock_bh(&soc->peer_map_lock);
+	__dp_peer_find_id_to_obj_remove(soc, peer_id);
 	qdf_spin_unlock_bh(&soc->peer_map_lock);
 }
 
@@ -1244,6 +1274,56 @@ struct dp_ast_entry *dp_peer_ast_hash_find_soc(struct dp_soc *soc,
 	return NULL;
 }
 
+/*
+ * dp_peer_map_ast_bind() - Bind a host ast entry to the HW AST index
+ * @soc: SoC handle
+ * @peer: peer to which ast node belongs
+ * @ast_entry: ast entry found for the mapped MAC, may be NULL
+ * @mac_addr: MAC address of ast node
+ * @hw_peer_id: HW AST Index returned by target in peer map event
+ * @vdev_id: vdev id for VAP to which the peer belongs to
+ * @ast_hash: ast hash value in HW
+ * @peer_type: updated with the type of the bound ast entry
+ *
+ * Caller must hold soc->ast_lock.
+ *
+ * Return: QDF_STATUS code
+ */
+static inline QDF_STATUS
+dp_peer_map_ast_bind(struct dp_soc *soc, struct dp_peer *peer,
+		     struct dp_ast_entry *ast_entry, uint8_t *mac_addr,
+		     uint16_t hw_peer_id, uint8_t vdev_id, uint16_t ast_hash,
+		     enum cdp_txrx_ast_entry_type *peer_type)
+{
+	if (ast_entry) {
+		ast_entry->ast_idx = hw_peer_id;
+		soc->ast_table[hw_peer_id] = ast_entry;
+		dp_peer_ast_set_active(soc, ast_entry);
+		*peer_type = ast_entry->type;
+		ast_entry->ast_hash_value = ast_hash;
+		ast_entry->is_mapped = TRUE;
+		qdf_assert_always(ast_entry->peer_id == HTT_INVALID_PEER);
+
+		ast_entry->peer_id = peer->peer_id;
+		TAILQ_INSERT_TAIL(&peer->ast_entry_list, ast_entry,
+				  ase_list_elem);
+	}
+
+	if (ast_entry || (peer->vdev && peer->vdev->proxysta_vdev)) {
+		if (soc->cdp_soc.ol_ops->peer_map_event) {
+			soc->cdp_soc.ol_ops->peer_map_event(
+			soc->ctrl_psoc, peer->peer_id,
+			hw_peer_id, vdev_id,
+			mac_addr, *peer_type, ast_hash);
+		}
+	} else {
+		dp_peer_err("%pK: AST entry not found", soc);
+		return QDF_STATUS_E_NOENT;
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
 /*
  * dp_peer_map_ast() - Map the ast entry with HW AST Index
  * @soc: SoC handle
@@ -1336,31 +1416,8 @@ static inline QDF_STATUS dp_peer_map_ast(struct dp_soc *soc,
 		}
 	}
 
-	if (ast_entry) {
-		ast_entry->ast_idx = hw_peer_id;
-		soc->ast_table[hw_peer_id] = ast_entry;
-		ast_entry->is_active = TRUE;
-		peer_type = ast_entry->type;
-		ast_entry->ast_hash_value = ast_hash;
-		ast_entry->is_mapped = TRUE;
-		qdf_assert_always(ast_entry->peer_id == HTT_INVALID_PEER);
-
-		ast_entry->peer_id = peer->peer_id;
-		TAILQ_INSERT_TAIL(&peer->ast_entry_list, ast_entry,
-				  ase_list_elem);
-	}
-
-	if (ast_entry || (peer->vdev && peer->vdev->proxysta_vdev)) {
-		if (soc->cdp_soc.ol_ops->peer_map_event) {
-			soc->cdp_soc.ol_ops->peer_map_event(
-			soc->ctrl_psoc, peer->peer_id,
-			hw_peer_id, vdev_id,
-			mac_addr, peer_type, ast_hash);
-		}
-	} else {
-		dp_peer_err("%pK: AST entry not found", soc);
-		err = QDF_STATUS_E_NOENT;
-	}
+	err = dp_peer_map_ast_bind(soc, peer, ast_entry, mac_addr,
+				   hw_peer_id, vdev_id, ast_hash, &peer_type);
 
 	qdf_spin_unlock_bh(&soc->ast_lock);
 
@@ -1370,6 +1427,67 @@ static inline QDF_STATUS dp_peer_map_ast(struct dp_soc *soc,
 	return err;
 }
 
+/*
+ * dp_peer_map_ast_batch() - Map the ast entries of a peer map batch
+ * @soc: SoC handle
+ * @peers: peers resolved for each event, NULL entries are skipped
+ * @events: non-WDS peer map events
+ * @num_events: number of entries in @peers and @events
+ *
+ * Same as dp_peer_map_ast() for is_wds == 0, but binds all entries of
+ * the batch under a single hold of soc->ast_lock.
+ *
+ * Return: QDF_STATUS_SUCCESS if all entries were bound, else the error of
+ *	   the first event which failed
+ */
+static QDF_STATUS dp_peer_map_ast_batch(struct dp_soc *soc,
+					struct dp_peer **peers,
+					struct dp_peer_map_event *events,
+					uint32_t num_events)
+{
+	enum cdp_txrx_ast_entry_type peer_type[DP_PEER_MAP_BATCH_MAX];
+	QDF_STATUS err[DP_PEER_MAP_BATCH_MAX];
+	QDF_STATUS status = QDF_STATUS_SUCCESS;
+	struct dp_ast_entry *ast_entry;
+	uint32_t i;
+
+	if (soc->ast_offload_support)
+		return QDF_STATUS_SUCCESS;
+
+	qdf_spin_lock_bh(&soc->ast_lock);
+	for (i = 0; i < num_events; i++) {
+		if (!peers[i])
+			continue;
+
+		peer_type[i] = CDP_TXRX_AST_TYPE_STATIC;
+		ast_entry = dp_peer_ast_hash_find_by_vdevid(soc,
+							    events[i].mac_addr,
+							    events[i].vdev_id);
+		err[i] = dp_peer_map_ast_bind(soc, peers[i], ast_entry,
+					      events[i].mac_addr,
+					      events[i].hw_peer_id,
+					      events[i].vdev_id,
+					      events[i].ast_hash,
+					      &peer_type[i]);
+	}
+	qdf_spin_unlock_bh(&soc->ast_lock);
+
+	for (i = 0; i < num_events; i++) {
+		if (!peers[i]) {
+			if (QDF_IS_STATUS_SUCCESS(status))
+				status = QDF_STATUS_E_INVAL;
+			continue;
+		}
+
+		dp_hmwds_ast_add_notify(peers[i], events[i].mac_addr,
+					peer_type[i], err[i], true);
+		if (QDF_IS_STATUS_SUCCESS(status))
+			status = err[i];
+	}
+
+	return status;
+}
+
 void dp_peer_free_hmwds_cb(struct cdp_ctrl_objmgr_psoc *ctrl_psoc,
 			   struct cdp_soc *dp_soc,
 			   void *cookie,
@@ -1629,7 +1747,7 @@ add_ast_entry:
 		dp_peer_err("%pK: Incorrect AST entry type", soc);
 	}
 
-	ast_entry->is_active = TRUE;
+	dp_peer_ast_set_active(soc, ast_entry);
 	DP_STATS_INC(soc, ast.added, 1);
 	soc->num_ast_entries++;
 	dp_peer_ast_hash_add(soc, ast_entry);
@@ -1875,7 +1993,7 @@ int dp_peer_update_ast(struct dp_soc *soc, struct dp_peer *peer,
 	if (qdf_unlikely(ast_entry->peer_id == peer->peer_id) &&
 	    (ast_entry->type == CDP_TXRX_AST_TYPE_WDS) &&
 	    (ast_entry->vdev_id == peer->vdev->vdev_id) &&
-	    (ast_entry->is_active))
+	    dp_peer_ast_is_active(soc, ast_entry))
 		return 0;
 
 	old_peer = dp_peer_get_ref_by_id(soc, ast_entry->peer_id,
@@ -1891,7 +2009,7 @@ int dp_peer_update_ast(struct dp_soc *soc, struct dp_peer *peer,
 	ast_entry->type = CDP_TXRX_AST_TYPE_WDS;
 	ast_entry->pdev_id = peer->vdev->pdev->pdev_id;
 	ast_entry->vdev_id = peer->vdev->vdev_id;
-	ast_entry->is_active = TRUE;
+	dp_peer_ast_set_active(soc, ast_entry);
 	TAILQ_INSERT_TAIL(&peer->ast_entry_list, ast_entry, ase_list_elem);
 
 	ret = soc->cdp_soc.ol_ops->peer_update_wds_entry(
@@ -1999,6 +2117,14 @@ static inline QDF_STATUS dp_peer_map_ast(struct dp_soc *soc,
 	return QDF_STATUS_SUCCESS;
 }
 
+static inline QDF_STATUS dp_peer_map_ast_batch(struct dp_soc *soc,
+					       struct dp_peer **peers,
+					       struct dp_peer_map_event *events,
+					       uint32_t num_events)
+{
+	return QDF_STATUS_SUCCESS;
+}
+
 void dp_peer_ast_hash_detach(struct dp_soc *soc)
 {
 }
@@ -2056,6 +2182,24 @@ void dp_peer_ast_send_wds_del(struct dp_soc *soc,
 		else
 			delete_in_fw = true;
 
+		if (qdf_unlikely(soc->ast_del_batch &&
+				 soc->ast_del_batch->active)) {
+			struct dp_ast_del_batch *batch = soc->ast_del_batch;
+			struct cdp_wds_del_info *info;
+
+			if (batch->num == DP_AST_DEL_BATCH_MAX)
+				dp_peer_ast_del_batch_flush(soc);
+
+			info = &batch->entries[batch->num++];
+			qdf_mem_copy(info->wds_macaddr,
+				     ast_entry->mac_addr.raw,
+				     QDF_MAC_ADDR_SIZE);
+			info->vdev_id = ast_entry->vdev_id;
+			info->type = ast_entry->type;
+			info->delete_in_fw = delete_in_fw;
+			return;
+		}
+
 		cdp_soc->ol_ops->peer_del_wds_entry(soc->ctrl_psoc,
 						    ast_entry->vdev_id,
 						    ast_entry->mac_addr.raw,
@@ -2065,6 +2209,33 @@ void dp_peer_ast_send_wds_del(struct dp_soc *soc,
 
 }
 
+void dp_peer_ast_del_batch_flush(struct dp_soc *soc)
+{
+	struct dp_ast_del_batch *batch = soc->ast_del_batch;
+	struct ol_if_ops *ol_ops = soc->cdp_soc.ol_ops;
+	struct cdp_wds_del_info *info;
+	uint16_t i;
+
+	if (!batch || !batch->num)
+		return;
+
+	if (ol_ops->peer_del_multi_wds_entry) {
+		ol_ops->peer_del_multi_wds_entry(soc->ctrl_psoc,
+						 batch->entries, batch->num);
+	} else {
+		for (i = 0; i < batch->num; i++) {
+			info = &batch->entries[i];
+			ol_ops->peer_del_wds_entry(soc->ctrl_psoc,
+						   info->vdev_id,
+						   info->wds_macaddr,
+						   info->type,
+						   info->delete_in_fw);
+		}
+	}
+
+	batch->num = 0;
+}
+
 #ifdef FEATURE_WDS
 /**
  * dp_peer_ast_free_wds_entries() - Free wds ast entries associated with peer
@@ -2444,19 +2615,42 @@ void dp_rx_tid_stats_cb(struct dp_soc *soc, void *cb_ctxt,
 }
 
 /*
- * dp_peer_find_add_id() - map peer_id with peer
+ * dp_peer_find_add_id_complete() - finish mapping peer_id with peer
+ * @soc: soc handle
+ * @peer: peer already added to the peer_id table
+ * @peer_id: peer id that was mapped
+ *
+ * return: None
+ */
+static inline void dp_peer_find_add_id_complete(struct dp_soc *soc,
+						struct dp_peer *peer,
+						uint16_t peer_id)
+{
+	dp_mlo_partner_chips_map(soc, peer, peer_id);
+	if (peer->peer_id == HTT_INVALID_PEER) {
+		peer->peer_id = peer_id;
+		dp_monitor_peer_tid_peer_id_update(soc, peer,
+						   peer->peer_id);
+	} else {
+		QDF_ASSERT(0);
+	}
+
+	dp_peer_update_state(soc, peer, DP_PEER_STATE_ACTIVE);
+}
+
+/*
+ * dp_peer_find_map_candidate() - find the peer a peer map event refers to
  * @soc: soc handle
  * @peer_mac_addr: peer mac address
  * @peer_id: peer id to be mapped
- * @hw_peer_id: HW ast index
  * @vdev_id: vdev_id
  *
- * return: peer in success
+ * return: peer holding a DP_MOD_ID_CONFIG reference on success
  *         NULL in failure
  */
-static inline struct dp_peer *dp_peer_find_add_id(struct dp_soc *soc,
-	uint8_t *peer_mac_addr, uint16_t peer_id, uint16_t hw_peer_id,
-	uint8_t vdev_id)
+static inline struct dp_peer *
+dp_peer_find_map_candidate(struct dp_soc *soc, uint8_t *peer_mac_addr,
+			   uint16_t peer_id, uint8_t vdev_id)
 {
 	struct dp_peer *peer;
 
@@ -2486,21 +2680,36 @@ static inline struct dp_peer *dp_peer_find_add_id(struct dp_soc *soc,
 				 vdev_id);
 			return NULL;
 		}
-		dp_peer_find_id_to_obj_add(soc, peer, peer_id);
-		dp_mlo_partner_chips_map(soc, peer, peer_id);
-		if (peer->peer_id == HTT_INVALID_PEER) {
-			peer->peer_id = peer_id;
-			dp_monitor_peer_tid_peer_id_update(soc, peer,
-							   peer->peer_id);
-		} else {
-			QDF_ASSERT(0);
-		}
+	}
 
-		dp_peer_update_state(soc, peer, DP_PEER_STATE_ACTIVE);
-		return peer;
+	return peer;
+}
+
+/*
+ * dp_peer_find_add_id() - map peer_id with peer
+ * @soc: soc handle
+ * @peer_mac_addr: peer mac address
+ * @peer_id: peer id to be mapped
+ * @hw_peer_id: HW ast index
+ * @vdev_id: vdev_id
+ *
+ * return: peer in success
+ *         NULL in failure
+ */
+static inline struct dp_peer *dp_peer_find_add_id(struct dp_soc *soc,
+	uint8_t *peer_mac_addr, uint16_t peer_id, uint16_t hw_peer_id,
+	uint8_t vdev_id)
+{
+	struct dp_peer *peer;
+
+	peer = dp_peer_find_map_candidate(soc, peer_mac_addr, peer_id,
+					  vdev_id);
+	if (peer) {
+		dp_peer_find_id_to_obj_add(soc, peer, peer_id);
+		dp_peer_find_add_id_complete(soc, peer, peer_id);
 	}
 
-	return NULL;
+	return peer;
 }
 
 #ifdef WLAN_FEATURE_11BE_MLO
@@ -2577,6 +2786,117 @@ dp_rx_mlo_peer_map_handler(struct dp_soc *soc, uint16_t peer_id,
 }
 #endif
 
+/**
+ * dp_rx_peer_map_setup() - vdev and self ast setup for a mapped peer
+ * @soc: soc handle
+ * @peer: peer that was just mapped
+ * @peer_mac_addr: mac address of the peer
+ * @hw_peer_id: ast index for this peer
+ * @ast_hash: ast hash value
+ *
+ * Return: None
+ */
+static void dp_rx_peer_map_setup(struct dp_soc *soc, struct dp_peer *peer,
+				 uint8_t *peer_mac_addr, uint16_t hw_peer_id,
+				 uint16_t ast_hash)
+{
+	struct dp_vdev *vdev = peer->vdev;
+	enum cdp_txrx_ast_entry_type type = CDP_TXRX_AST_TYPE_STATIC;
+
+	/* Only check for STA Vdev and peer is not for TDLS */
+	if (wlan_op_mode_sta == vdev->opmode &&
+	    !peer->is_tdls_peer) {
+		if (qdf_mem_cmp(peer->mac_addr.raw,
+				vdev->mac_addr.raw,
+				QDF_MAC_ADDR_SIZE) != 0) {
+			dp_info("%pK: STA vdev bss_peer", soc);
+			peer->bss_peer = 1;
+		}
+
+		dp_info("bss ast_hash 0x%x, ast_index 0x%x",
+			ast_hash, hw_peer_id);
+		vdev->bss_ast_hash = ast_hash;
+		vdev->bss_ast_idx = hw_peer_id;
+	}
+
+	/* Add ast entry incase self ast entry is
+	 * deleted due to DP CP sync issue
+	 *
+	 * self_ast_entry is modified in peer create
+	 * and peer unmap path which cannot run in
+	 * parllel with peer map, no lock need before
+	 * referring it
+	 */
+	if (!soc->ast_offload_support &&
+	    !peer->self_ast_entry) {
+		dp_info("Add self ast from map "QDF_MAC_ADDR_FMT,
+			QDF_MAC_ADDR_REF(peer_mac_addr));
+		dp_peer_add_ast(soc, peer,
+				peer_mac_addr,
+				type, 0);
+	}
+}
+
+/**
+ * dp_rx_peer_map_batch_apply() - apply a run of non-WDS peer map events
+ * @soc: soc handle
+ * @events: peer map events, at most DP_PEER_MAP_BATCH_MAX
+ * @num_events: number of entries in @events
+ *
+ * Peers are looked up without locks held, then all of them are added to
+ * the peer_id table under one hold of peer_map_lock and their AST entries
+ * bound under one hold of ast_lock.
+ *
+ * Return: QDF_STATUS_SUCCESS if all AST entries were mapped
+ */
+static QDF_STATUS dp_rx_peer_map_batch_apply(struct dp_soc *soc,
+					     struct dp_peer_map_event *events,
+					     uint32_t num_events)
+{
+	struct dp_peer *peers[DP_PEER_MAP_BATCH_MAX];
+	struct dp_peer_map_event *ev;
+	uint32_t i;
+
+	for (i = 0; i < num_events; i++) {
+		ev = &events[i];
+		dp_info("peer_map_event (soc:%pK): peer_id %d, hw_peer_id %d, peer_mac "QDF_MAC_ADDR_FMT", vdev_id %d",
+			soc, ev->peer_id, ev->hw_peer_id,
+			QDF_MAC_ADDR_REF(ev->mac_addr), ev->vdev_id);
+
+		if (!soc->ast_offload_support &&
+		    ev->hw_peer_id >=
+		    wlan_cfg_get_max_ast_idx(soc->wlan_cfg_ctx)) {
+			dp_peer_err("%pK: invalid hw_peer_id: %d", soc,
+				    ev->hw_peer_id);
+			qdf_assert_always(0);
+		}
+
+		peers[i] = dp_peer_find_map_candidate(soc, ev->mac_addr,
+						      ev->peer_id,
+						      ev->vdev_id);
+	}
+
+	qdf_spin_lock_bh(&soc->peer_map_lock);
+	for (i = 0; i < num_events; i++) {
+		if (peers[i])
+			__dp_peer_find_id_to_obj_add(soc, peers[i],
+						     events[i].peer_id);
+	}
+	qdf_spin_unlock_bh(&soc->peer_map_lock);
+
+	for (i = 0; i < num_events; i++) {
+		if (!peers[i])
+			continue;
+
+		ev = &events[i];
+		dp_peer_find_add_id_complete(soc, peers[i], ev->peer_id);
+		dp_rx_peer_map_setup(soc, peers[i], ev->mac_addr,
+				     ev->hw_peer_id, ev->ast_hash);
+	}
+
+	return dp_peer_map_ast_batch(soc, peers, events, num_events);
+}
+
 /**
  * dp_rx_peer_map_handler() - handle peer map event from firmware
  * @soc_handle - genereic soc handle
@@ -2589,6 +2909,7 @@ dp_rx_mlo_peer_map_handler(struct dp_soc *soc, uint16_t peer_id,
  *
  * associate the peer_id that firmware provided with peer entry
  * and update the ast table in the host with the hw_peer_id.
+ * A non-WDS event is applied as a batch of one.
  *
  * Return: QDF_STATUS code
  */
@@ -2599,11 +2920,20 @@ dp_rx_peer_map_handler(struct dp_soc *soc, uint16_t peer_id,
 		       uint8_t *peer_mac_addr, uint16_t ast_hash,
 		       uint8_t is_wds)
 {
+	struct dp_peer_map_event ev = {0};
 	struct dp_peer *peer = NULL;
-	struct dp_vdev *vdev = NULL;
-	enum cdp_txrx_ast_entry_type type = CDP_TXRX_AST_TYPE_STATIC;
 	QDF_STATUS err = QDF_STATUS_SUCCESS;
 
+	if (!is_wds) {
+		ev.peer_id = peer_id;
+		ev.hw_peer_id = hw_peer_id;
+		ev.vdev_id = vdev_id;
+		ev.ast_hash = ast_hash;
+		qdf_mem_copy(ev.mac_addr, peer_mac_addr, QDF_MAC_ADDR_SIZE);
+
+		return dp_rx_peer_map_batch_apply(soc, &ev, 1);
+	}
+
 	dp_info("peer_map_event (soc:%pK): peer_id %d, hw_peer_id %d, peer_mac "QDF_MAC_ADDR_FMT", vdev_id %d",
 		soc, peer_id, hw_peer_id,
 		QDF_MAC_ADDR_REF(peer_mac_addr), vdev_id);
@@ -2611,74 +2941,107 @@ dp_rx_peer_map_handler(struct dp_soc *soc, uint16_t peer_id,
 	/* Peer map event for WDS ast entry get the peer from
 	 * obj map
 	 */
-	if (is_wds) {
-		if (!soc->ast_offload_support) {
-			peer = dp_peer_get_ref_by_id(soc, peer_id,
-						     DP_MOD_ID_HTT);
-
-			err = dp_peer_map_ast(soc, peer, peer_mac_addr,
-					      hw_peer_id,
-					      vdev_id, ast_hash, is_wds);
-			if (peer)
-				dp_peer_unref_delete(peer, DP_MOD_ID_HTT);
-		}
-	} else {
-		/*
-		 * It's the responsibility of the CP and FW to ensure
-		 * that peer is created successfully. Ideally DP should
-		 * not hit the below condition for directly assocaited
-		 * peers.
-		 */
-		if ((!soc->ast_offload_support) && ((hw_peer_id < 0) ||
-		    (hw_peer_id >=
-		     wlan_cfg_get_max_ast_idx(soc->wlan_cfg_ctx)))) {
-			dp_peer_err("%pK: invalid hw_peer_id: %d", soc, hw_peer_id);
-			qdf_assert_always(0);
-		}
+	if (!soc->ast_offload_support) {
+		peer = dp_peer_get_ref_by_id(soc, peer_id, DP_MOD_ID_HTT);
 
-		peer = dp_peer_find_add_id(soc, peer_mac_addr, peer_id,
-					   hw_peer_id, vdev_id);
+		err = dp_peer_map_ast(soc, peer, peer_mac_addr, hw_peer_id,
+				      vdev_id, ast_hash, is_wds);
+		if (peer)
+			dp_peer_unref_delete(peer, DP_MOD_ID_HTT);
+	}
 
-		if (peer) {
-			vdev = peer->vdev;
-			/* Only check for STA Vdev and peer is not for TDLS */
-			if (wlan_op_mode_sta == vdev->opmode &&
-			    !peer->is_tdls_peer) {
-				if (qdf_mem_cmp(peer->mac_addr.raw,
-						vdev->mac_addr.raw,
-						QDF_MAC_ADDR_SIZE) != 0) {
-					dp_info("%pK: STA vdev bss_peer", soc);
-					peer->bss_peer = 1;
-				}
+	return err;
+}
 
-				dp_info("bss ast_hash 0x%x, ast_index 0x%x",
-					ast_hash, hw_peer_id);
-				vdev->bss_ast_hash = ast_hash;
-				vdev->bss_ast_idx = hw_peer_id;
-			}
+/**
+ * dp_rx_peer_unmap_complete() - finish unmap of a peer
+ * @soc: soc handle
+ * @peer: peer removed from the peer_id table, holding a DP_MOD_ID_HTT ref
+ * @peer_id: peer id that was unmapped
+ * @vdev_id: vdev ID
+ *
+ * Drops the HTT reference and the map reference taken at peer map.
+ *
+ * Return: None
+ */
+static void dp_rx_peer_unmap_complete(struct dp_soc *soc,
+				      struct dp_peer *peer,
+				      uint16_t peer_id, uint8_t vdev_id)
+{
+	struct dp_vdev *vdev;
 
-			/* Add ast entry incase self ast entry is
-			 * deleted due to DP CP sync issue
-			 *
-			 * self_ast_entry is modified in peer create
-			 * and peer unmap path which cannot run in
-			 * parllel with peer map, no lock need before
-			 * referring it
-			 */
-			if (!soc->ast_offload_support &&
-				!peer->self_ast_entry) {
-				dp_info("Add self ast from map "QDF_MAC_ADDR_FMT,
-					QDF_MAC_ADDR_REF(peer_mac_addr));
-				dp_peer_add_ast(soc, peer,
-						peer_mac_addr,
-						type, 0);
-			}
+	dp_mlo_partner_chips_unmap(soc, peer_id);
+	peer->peer_id = HTT_INVALID_PEER;
+
+	/*
+	 *	 Reset ast flow mapping table
+	 */
+	if (!soc->ast_offload_support)
+		dp_peer_reset_flowq_map(peer);
+
+	if (soc->cdp_soc.ol_ops->peer_unmap_event) {
+		soc->cdp_soc.ol_ops->peer_unmap_event(soc->ctrl_psoc,
+				peer_id, vdev_id);
+	}
+
+	vdev = peer->vdev;
+	dp_peer_stats_shards_fold(peer);
+	DP_UPDATE_STATS(vdev, peer);
+
+	dp_peer_update_state(soc, peer, DP_PEER_STATE_INACTIVE);
+	dp_peer_unref_delete(peer, DP_MOD_ID_HTT);
+	/*
+	 * Remove a reference to the peer.
+	 * If there are no more references, delete the peer object.
+	 */
+	dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
+}
+
+/**
+ * dp_rx_peer_unmap_batch_apply() - apply a run of non-WDS peer unmap events
+ * @soc: soc handle
+ * @events: peer unmap events, at most DP_PEER_MAP_BATCH_MAX
+ * @num_events: number of entries in @events
+ *
+ * Return: None
+ */
+static void dp_rx_peer_unmap_batch_apply(struct dp_soc *soc,
+					 struct dp_peer_map_event *events,
+					 uint32_t num_events)
+{
+	struct dp_peer *peers[DP_PEER_MAP_BATCH_MAX];
+	uint32_t i;
+
+	for (i = 0; i < num_events; i++) {
+		peers[i] = __dp_peer_get_ref_by_id(soc, events[i].peer_id,
+						   DP_MOD_ID_HTT);
+		if (!peers[i]) {
+			dp_err("Received unmap event for invalid peer_id %u",
+			       events[i].peer_id);
+			continue;
 		}
-		err = dp_peer_map_ast(soc, peer, peer_mac_addr, hw_peer_id,
-				      vdev_id, ast_hash, is_wds);
+
+		dp_peer_clean_wds_entries(soc, peers[i],
+					  events[i].free_wds_count);
+
+		dp_info("peer_unmap_event (soc:%pK) peer_id %d peer %pK",
+			soc, events[i].peer_id, peers[i]);
 	}
 
-	return err;
+	qdf_spin_lock_bh(&soc->peer_map_lock);
+	for (i = 0; i < num_events; i++) {
+		if (peers[i])
+			__dp_peer_find_id_to_obj_remove(soc,
+							events[i].peer_id);
+	}
+	qdf_spin_unlock_bh(&soc->peer_map_lock);
+
+	for (i = 0; i < num_events; i++) {
+		if (peers[i])
+			dp_rx_peer_unmap_complete(soc, peers[i],
+						  events[i].peer_id,
+						  events[i].vdev_id);
+	}
 }
 
 /**
@@ -2697,12 +3060,21 @@ dp_rx_peer_unmap_handler(struct dp_soc *soc, uint16_t peer_id,
 			 uint8_t vdev_id, uint8_t *mac_addr,
 			 uint8_t is_wds, uint32_t free_wds_count)
 {
+	struct dp_peer_map_event ev = {0};
 	struct dp_peer *peer;
-	struct dp_vdev *vdev = NULL;
 
 	if (soc->ast_offload_support && is_wds)
 		return;
 
+	if (!is_wds) {
+		ev.peer_id = peer_id;
+		ev.vdev_id = vdev_id;
+		ev.is_unmap = true;
+		ev.free_wds_count = free_wds_count;
+		dp_rx_peer_unmap_batch_apply(soc, &ev, 1);
+		return;
+	}
+
 	peer = __dp_peer_get_ref_by_id(soc, peer_id, DP_MOD_ID_HTT);
 
 	/*
@@ -2719,53 +3091,66 @@ dp_rx_peer_unmap_handler(struct dp_soc *soc, uint16_t peer_id,
 	/* If V2 Peer map messages are enabled AST entry has to be
 	 * freed here
 	 */
-	if (is_wds) {
-		if (!dp_peer_ast_free_entry_by_mac(soc, peer, vdev_id,
-						   mac_addr)) {
-			dp_peer_unref_delete(peer, DP_MOD_ID_HTT);
-			return;
-		}
-
-		dp_alert("AST entry not found with peer %pK peer_id %u peer_mac "QDF_MAC_ADDR_FMT" mac_addr "QDF_MAC_ADDR_FMT" vdev_id %u next_hop %u",
-			  peer, peer->peer_id,
-			  QDF_MAC_ADDR_REF(peer->mac_addr.raw),
-			  QDF_MAC_ADDR_REF(mac_addr), vdev_id,
-			  is_wds);
-
+	if (!dp_peer_ast_free_entry_by_mac(soc, peer, vdev_id, mac_addr)) {
 		dp_peer_unref_delete(peer, DP_MOD_ID_HTT);
 		return;
 	}
 
-	dp_peer_clean_wds_entries(soc, peer, free_wds_count);
+	dp_alert("AST entry not found with peer %pK peer_id %u peer_mac "QDF_MAC_ADDR_FMT" mac_addr "QDF_MAC_ADDR_FMT" vdev_id %u next_hop %u",
+		  peer, peer->peer_id,
+		  QDF_MAC_ADDR_REF(peer->mac_addr.raw),
+		  QDF_MAC_ADDR_REF(mac_addr), vdev_id,
+		  is_wds);
 
-	dp_info("peer_unmap_event (soc:%pK) peer_id %d peer %pK",
-		soc, peer_id, peer);
+	dp_peer_unref_delete(peer, DP_MOD_ID_HTT);
+}
 
-	dp_peer_find_id_to_obj_remove(soc, peer_id);
-	dp_mlo_partner_chips_unmap(soc, peer_id);
-	peer->peer_id = HTT_INVALID_PEER;
+void dp_rx_peer_map_batch_handler(struct dp_soc *soc,
+				  struct dp_peer_map_event *events,
+				  uint32_t num_events)
+{
+	struct dp_peer_map_event *ev;
+	uint32_t start = 0;
+	uint32_t end;
 
-	/*
-	 *	 Reset ast flow mapping table
-	 */
-	if (!soc->ast_offload_support)
-		dp_peer_reset_flowq_map(peer);
+	while (start < num_events) {
+		ev = &events[start];
 
-	if (soc->cdp_soc.ol_ops->peer_unmap_event) {
-		soc->cdp_soc.ol_ops->peer_unmap_event(soc->ctrl_psoc,
-				peer_id, vdev_id);
-	}
+		/* WDS events depend on the peer_id table state left by
+		 * the events before them, apply them one at a time.
+		 */
+		if (ev->is_wds) {
+			if (ev->is_unmap)
+				dp_rx_peer_unmap_handler(soc, ev->peer_id,
+							 ev->vdev_id,
+							 ev->mac_addr,
+							 ev->is_wds,
+							 ev->free_wds_count);
+			else
+				dp_rx_peer_map_handler(soc, ev->peer_id,
+						       ev->hw_peer_id,
+						       ev->vdev_id,
+						       ev->mac_addr,
+						       ev->ast_hash,
+						       ev->is_wds);
+			start++;
+			continue;
+		}
 
-	vdev = peer->vdev;
-	DP_UPDATE_STATS(vdev, peer);
+		end = start + 1;
+		while (end < num_events &&
+		       (end - start) < DP_PEER_MAP_BATCH_MAX &&
+		       !events[end].is_wds &&
+		       events[end].is_unmap == ev->is_unmap)
+			end++;
 
-	dp_peer_update_state(soc, peer, DP_PEER_STATE_INACTIVE);
-	dp_peer_unref_delete(peer, DP_MOD_ID_HTT);
-	/*
-	 * Remove a reference to the peer.
-	 * If there are no more references, delete the peer object.
-	 */
-	dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
+		if (ev->is_unmap)
+			dp_rx_peer_unmap_batch_apply(soc, ev, end - start);
+		else
+			dp_rx_peer_map_batch_apply(soc, ev, end - start);
+
+		start = end;
+	}
 }
 
 #ifdef WLAN_FEATURE_11BE_MLO
@@ -5477,3 +5862,76 @@ void dp_peer_flush_frags(struct cdp_soc_t *soc_hdl, uint8_t vdev_id,
 
 	dp_peer_unref_delete(peer, DP_MOD_ID_CDP);
 }
+
+/**
+ * dp_peer_stats_shards_sync() - Account the per ring peer counters
+ * @peer: DP peer handle
+ * @apply: add the unaccounted part to peer->stats, else discard it
+ *
+ * Shard counters only ever grow, so the part not yet in peer->stats is
+ * the difference to the last folded snapshot. Writers are never stopped;
+ * an increment racing with the snapshot is picked up by the next fold.
+ *
+ * Return: None
+ */
+static void dp_peer_stats_shards_sync(struct dp_peer *peer, bool apply)
+{
+	struct dp_peer_stats_shards *shards = &peer->stats_shards;
+	struct dp_peer_rx_stats_shard rx, *rx_folded;
+	struct dp_peer_tx_stats_shard tx, *tx_folded;
+	uint8_t i;
+
+	qdf_spin_lock_bh(&peer->peer_info_lock);
+
+	for (i = 0; i < CDP_MAX_RX_RINGS; i++) {
+		rx = shards->rx[i].cur;
+		rx_folded = &shards->rx_folded[i];
+		if (apply) {
+			peer->stats.rx.rcvd_reo[i].num +=
+				rx.rcvd_reo.num - rx_folded->rcvd_reo.num;
+			peer->stats.rx.rcvd_reo[i].bytes +=
+				rx.rcvd_reo.bytes - rx_folded->rcvd_reo.bytes;
+			peer->stats.rx.non_amsdu_cnt +=
+				rx.non_amsdu_cnt - rx_folded->non_amsdu_cnt;
+			peer->stats.rx.amsdu_cnt +=
+				rx.amsdu_cnt - rx_folded->amsdu_cnt;
+			peer->stats.rx.rx_retries +=
+				rx.rx_retries - rx_folded->rx_retries;
+		}
+		*rx_folded = rx;
+	}
+
+	for (i = 0; i < CDP_MAX_TX_COMP_RINGS; i++) {
+		tx = shards->tx[i].cur;
+		tx_folded = &shards->tx_folded[i];
+		if (apply) {
+			peer->stats.tx.comp_pkt.num +=
+				tx.comp_pkt.num - tx_folded->comp_pkt.num;
+			peer->stats.tx.comp_pkt.bytes +=
+				tx.comp_pkt.bytes - tx_folded->comp_pkt.bytes;
+			peer->stats.tx.retry_count +=
+				tx.retry_count - tx_folded->retry_count;
+			peer->stats.tx.multiple_retry_count +=
+				tx.multiple_retry_count -
+				tx_folded->multiple_retry_count;
+			peer->stats.tx.ofdma += tx.ofdma - tx_folded->ofdma;
+			peer->stats.tx.amsdu_cnt +=
+				tx.amsdu_cnt - tx_folded->amsdu_cnt;
+			peer->stats.tx.non_amsdu_cnt +=
+				tx.non_amsdu_cnt - tx_folded->non_amsdu_cnt;
+		}
+		*tx_folded = tx;
+	}
+
+	qdf_spin_unlock_bh(&peer->peer_info_lock);
+}
+
+void dp_peer_stats_shards_fold(struct dp_peer *peer)
+{
+	dp_peer_stats_shards_sync(peer, true);
+}
+
+void dp_peer_stats_shards_drop(struct dp_peer *peer)
+{
+	dp_peer_stats_shards_sync(peer, false);
+}
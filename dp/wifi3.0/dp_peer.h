@@ -58,11 +58,6 @@ struct reo_qdesc_event {
 };
 #endif
 
-struct ast_del_ctxt {
-	bool age;
-	int del_count;
-};
-
 typedef void dp_peer_iter_func(struct dp_soc *soc, struct dp_peer *peer,
 			       void *arg);
 void dp_peer_unref_delete(struct dp_peer *peer, enum dp_mod_id id);
@@ -574,6 +569,23 @@ void dp_rx_peer_unmap_handler(struct dp_soc *soc, uint16_t peer_id,
 			      uint8_t vdev_id, uint8_t *peer_mac_addr,
 			      uint8_t is_wds, uint32_t free_wds_count);
 
+/**
+ * dp_rx_peer_map_batch_handler() - handle a burst of peer map/unmap events
+ * @soc: soc handle
+ * @events: events in the order firmware sent them
+ * @num_events: number of entries in @events
+ *
+ * Consecutive non-WDS events of the same kind are applied as one batch:
+ * the peer_id table is updated under a single peer_map_lock hold and the
+ * AST entries are bound under a single ast_lock hold. Callers must not
+ * pass two events for one peer_id in a single call.
+ *
+ * Return: None
+ */
+void dp_rx_peer_map_batch_handler(struct dp_soc *soc,
+				  struct dp_peer_map_event *events,
+				  uint32_t num_events);
+
 #ifdef WLAN_FEATURE_11BE_MLO
 /**
  * dp_rx_mlo_peer_map_handler() - handle MLO peer map event from firmware
@@ -646,10 +658,115 @@ void dp_peer_ast_set_type(struct dp_soc *soc,
 				struct dp_ast_entry *ast_entry,
 				enum cdp_txrx_ast_entry_type type);
 
+/* Generic AST entry aging timer value */
+#define DP_AST_AGING_TIMER_DEFAULT_MS	5000
+/* WDS AST entry aging timer value */
+#define DP_WDS_AST_AGING_TIMER_DEFAULT_MS	120000
+/* aging timer ticks, i.e. epochs, an idle WDS AST entry survives */
+#define DP_AST_AGE_EPOCHS \
+(DP_WDS_AST_AGING_TIMER_DEFAULT_MS / DP_AST_AGING_TIMER_DEFAULT_MS)
+
+/**
+ * dp_peer_ast_set_active() - Mark an AST entry as seen in this epoch
+ * @soc: DP soc
+ * @ase: AST entry
+ *
+ * Called from the data path without the ast lock; the entry is only
+ * written when the epoch moved on, so a busy entry keeps its cache line
+ * clean.
+ *
+ * Return: None
+ */
+static inline void dp_peer_ast_set_active(struct dp_soc *soc,
+					  struct dp_ast_entry *ase)
+{
+	uint32_t epoch = soc->ast_aging_epoch;
+
+	if (ase->seen_epoch != epoch)
+		ase->seen_epoch = epoch;
+}
+
+/**
+ * dp_peer_ast_set_inactive() - Make an AST entry due for aging
+ * @soc: DP soc
+ * @ase: AST entry
+ *
+ * Return: None
+ */
+static inline void dp_peer_ast_set_inactive(struct dp_soc *soc,
+					    struct dp_ast_entry *ase)
+{
+	ase->seen_epoch = soc->ast_aging_epoch - DP_AST_AGE_EPOCHS - 1;
+}
+
+/**
+ * dp_peer_ast_is_active() - Check if an AST entry saw traffic recently
+ * @soc: DP soc
+ * @ase: AST entry
+ *
+ * Return: true if the entry was hit within the last DP_AST_AGE_EPOCHS
+ */
+static inline bool dp_peer_ast_is_active(struct dp_soc *soc,
+					 struct dp_ast_entry *ase)
+{
+	return (uint32_t)(soc->ast_aging_epoch - ase->seen_epoch) <=
+		DP_AST_AGE_EPOCHS;
+}
 void dp_peer_ast_send_wds_del(struct dp_soc *soc,
 			      struct dp_ast_entry *ast_entry,
 			      struct dp_peer *peer);
 
+#define DP_AST_DEL_BATCH_MAX 32
+
+/**
+ * struct dp_ast_del_batch - WDS deletes collected under the ast lock
+ * @active: dp_peer_ast_send_wds_del() appends here instead of sending
+ * @num: number of valid entries
+ * @entries: pending delete requests
+ */
+struct dp_ast_del_batch {
+	bool active;
+	uint16_t num;
+	struct cdp_wds_del_info entries[DP_AST_DEL_BATCH_MAX];
+};
+
+/**
+ * dp_peer_ast_del_batch_flush() - Send the collected WDS deletes to FW
+ * @soc: SoC handle
+ *
+ * Uses the multi entry delete of the control path when it has one,
+ * otherwise falls back to one request per entry. Called with the ast
+ * lock held so that the deletes cannot overtake a later add of the
+ * same address.
+ *
+ * Return: None
+ */
+void dp_peer_ast_del_batch_flush(struct dp_soc *soc);
+
+/**
+ * dp_peer_stats_shards_fold() - Add the per ring peer counters not yet
+ *				 accounted to peer->stats
+ * @peer: DP peer handle
+ *
+ * Must be called before peer->stats is read as a whole (stats dump,
+ * cdp peer/vdev stats queries, peer unmap accounting).
+ *
+ * Return: None
+ */
+void dp_peer_stats_shards_fold(struct dp_peer *peer);
+
+/**
+ * dp_peer_stats_shards_drop() - Discard the per ring peer counters not yet
+ *				 accounted to peer->stats
+ * @peer: DP peer handle
+ *
+ * Used when peer->stats is cleared, so that counts from before the clear
+ * are not folded in afterwards.
+ *
+ * Return: None
+ */
+void dp_peer_stats_shards_drop(struct dp_peer *peer);
+
 void dp_peer_free_hmwds_cb(struct cdp_ctrl_objmgr_psoc *ctrl_psoc,
 			   struct cdp_soc *dp_soc,
 			   void *cookie,
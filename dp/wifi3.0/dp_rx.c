@@ -1518,6 +1518,35 @@ dp_rx_enqueue_rx(struct dp_peer *peer, qdf_nbuf_t rx_buf_list)
 }
 #endif
 
+/**
+ * dp_rx_trace_peer_deliver() - Emit the per-peer rx delivery tracepoint
+ * @vdev: vdev the list is delivered on
+ * @peer: peer the list belongs to, may be NULL
+ * @nbuf_head: head of the msdu list
+ *
+ * Return: None
+ */
+static void dp_rx_trace_peer_deliver(struct dp_vdev *vdev,
+				     struct dp_peer *peer,
+				     qdf_nbuf_t nbuf_head)
+{
+	uint32_t num_msdus = 0;
+	uint32_t num_bytes = 0;
+	qdf_nbuf_t nbuf;
+
+	if (qdf_likely(!qdf_trace_dp_rx_peer_deliver_enabled()))
+		return;
+
+	for (nbuf = nbuf_head; nbuf; nbuf = qdf_nbuf_next(nbuf)) {
+		num_msdus++;
+		num_bytes += qdf_nbuf_len(nbuf);
+	}
+
+	qdf_trace_dp_rx_peer_deliver(vdev->vdev_id,
+				     peer ? peer->peer_id : HTT_INVALID_PEER,
+				     num_msdus, num_bytes);
+}
+
 #ifndef DELIVERY_TO_STACK_STATUS_CHECK
 /**
  * dp_rx_check_delivery_to_stack() - Deliver pkts to network
@@ -1640,10 +1669,16 @@ QDF_STATUS dp_rx_deliver_to_stack(struct dp_soc *soc,
 				  qdf_nbuf_t nbuf_head,
 				  qdf_nbuf_t nbuf_tail)
 {
+	qdf_prof_ts_t prof_ts;
+
 	if (dp_rx_validate_rx_callbacks(soc, vdev, peer, nbuf_head) !=
 					QDF_STATUS_SUCCESS)
 		return QDF_STATUS_E_FAILURE;
 
+	dp_rx_trace_peer_deliver(vdev, peer, nbuf_head);
+
+	prof_ts = qdf_prof_start();
+
 	if (qdf_unlikely(vdev->rx_decap_type == htt_cmn_pkt_type_raw) ||
 			(vdev->rx_decap_type == htt_cmn_pkt_type_native_wifi)) {
 		vdev->osif_rsim_rx_decap(vdev->osif_vdev, &nbuf_head,
@@ -1652,6 +1687,8 @@ QDF_STATUS dp_rx_deliver_to_stack(struct dp_soc *soc,
 
 	dp_rx_check_delivery_to_stack(soc, vdev, peer, nbuf_head);
 
+	qdf_prof_end(QDF_PROF_DP_RX_DELIVER, prof_ts);
+
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -1725,10 +1762,11 @@ void dp_rx_msdu_stats_update(struct dp_soc *soc, qdf_nbuf_t nbuf,
 	is_not_amsdu = qdf_nbuf_is_rx_chfrag_start(nbuf) &
 			qdf_nbuf_is_rx_chfrag_end(nbuf);
 
-	DP_STATS_INC_PKT(peer, rx.rcvd_reo[ring_id], 1, msdu_len);
-	DP_STATS_INCC(peer, rx.non_amsdu_cnt, 1, is_not_amsdu);
-	DP_STATS_INCC(peer, rx.amsdu_cnt, 1, !is_not_amsdu);
-	DP_STATS_INCC(peer, rx.rx_retries, 1, qdf_nbuf_is_rx_retry_flag(nbuf));
+	DP_PEER_RX_SHARD_INC_PKT(peer, ring_id, rcvd_reo, 1, msdu_len);
+	DP_PEER_RX_SHARD_INCC(peer, ring_id, non_amsdu_cnt, 1, is_not_amsdu);
+	DP_PEER_RX_SHARD_INCC(peer, ring_id, amsdu_cnt, 1, !is_not_amsdu);
+	DP_PEER_RX_SHARD_INCC(peer, ring_id, rx_retries, 1,
+			      qdf_nbuf_is_rx_retry_flag(nbuf));
 
 	tid_stats->msdu_cnt++;
 	if (qdf_unlikely(qdf_nbuf_is_da_mcbc(nbuf) &&
@@ -2185,4 +2185,47 @@ bool dp_rx_pkt_tracepoints_enabled(void)
 		qdf_trace_dp_rx_udp_pkt_enabled() ||
 		qdf_trace_dp_rx_pkt_enabled());
 }
+
+/**
+ * dp_rx_trace_msdu() - Emit the per-msdu rx tracepoint
+ * @ring_id: REO destination ring the msdu was reaped from
+ * @nbuf: msdu with its rx cb fields filled from the ring descriptor
+ *
+ * Return: None
+ */
+static inline
+void dp_rx_trace_msdu(uint8_t ring_id, qdf_nbuf_t nbuf)
+{
+	if (qdf_likely(!qdf_trace_dp_rx_msdu_enabled()))
+		return;
+
+	qdf_trace_dp_rx_msdu(ring_id, QDF_NBUF_CB_RX_VDEV_ID(nbuf),
+			     QDF_NBUF_CB_RX_PEER_ID(nbuf),
+			     qdf_nbuf_get_tid_val(nbuf),
+			     QDF_NBUF_CB_RX_PKT_LEN(nbuf), 0, 0);
+}
+
+/**
+ * dp_rx_trace_ring_reap() - Emit the per-ring rx reap tracepoint
+ * @soc: DP soc
+ * @hal_ring_hdl: REO destination ring handle, after access end
+ * @ring_id: REO destination ring number
+ * @num_reaped: number of ring entries reaped in this pass
+ * @quota: quota remaining after the reap
+ *
+ * Return: None
+ */
+static inline
+void dp_rx_trace_ring_reap(struct dp_soc *soc, hal_ring_handle_t hal_ring_hdl,
+			   uint8_t ring_id, uint32_t num_reaped,
+			   uint32_t quota)
+{
+	uint32_t hp, tp;
+
+	if (qdf_likely(!qdf_trace_dp_rx_ring_reap_enabled()))
+		return;
+
+	hal_get_sw_hptp(soc->hal_soc, hal_ring_hdl, &tp, &hp);
+	qdf_trace_dp_rx_ring_reap(ring_id, hp, tp, num_reaped, quota);
+}
 #endif /* _DP_RX_H */
@@ -5672,7 +5672,15 @@ static void dp_print_hist_stats(struct cdp_hist_stats *hstats,
 
 	DP_PRINT_STATS("Min = %u", hstats->min);
 	DP_PRINT_STATS("Max = %u", hstats->max);
+#ifdef WLAN_DP_HIST_LOG_LINEAR
+	DP_PRINT_STATS("Avg = %u", hstats->avg);
+	DP_PRINT_STATS("P50 = %u P90 = %u P99 = %u\n",
+		       dp_hist_ll_percentile(hstats, 50),
+		       dp_hist_ll_percentile(hstats, 90),
+		       dp_hist_ll_percentile(hstats, 99));
+#else
 	DP_PRINT_STATS("Avg = %u\n", hstats->avg);
+#endif
 }
 
 void dp_accumulate_delay_tid_stats(struct dp_soc *soc,
@@ -5839,6 +5847,8 @@ void dp_print_peer_stats(struct dp_peer *peer)
 
 	pdev = peer->vdev->pdev;
 
+	dp_peer_stats_shards_fold(peer);
+
 	DP_PRINT_STATS("Node Tx Stats:\n");
 	DP_PRINT_STATS("Total Packet Completions = %d",
 		       peer->stats.tx.comp_pkt.num);
@@ -6505,6 +6515,17 @@ dp_print_pdev_tx_stats(struct dp_pdev *pdev)
 		       pdev->stats.tx_i.mcast_en.dropped_send_fail);
 	DP_PRINT_STATS("	Unicast sent = %u",
 		       pdev->stats.tx_i.mcast_en.ucast);
+	DP_PRINT_STATS("	Fan-out groups = %u",
+		       pdev->stats.tx_i.mcast_en.fanout_groups);
+	DP_PRINT_STATS("	Fan-out max clients = %u",
+		       pdev->stats.tx_i.mcast_en.fanout_max);
+	DP_PRINT_STATS("	Fan-out latency max = %u us",
+		       pdev->stats.tx_i.mcast_en.fanout_lat_max_us);
+	DP_PRINT_STATS("	Fan-out latency avg = %llu us",
+		       pdev->stats.tx_i.mcast_en.fanout_groups ?
+		       qdf_do_div(pdev->stats.tx_i.mcast_en.fanout_lat_sum_us,
+				  pdev->stats.tx_i.mcast_en.fanout_groups) :
+		       0);
 	DP_PRINT_STATS("IGMP Mcast Enhancement:");
 	DP_PRINT_STATS("	IGMP packets received = %u",
 		       pdev->stats.tx_i.igmp_mcast_en.igmp_rcvd);
@@ -7136,6 +7157,8 @@ void dp_update_vdev_stats(struct dp_soc *soc,
 	if (qdf_unlikely(dp_is_wds_extended(srcobj)))
 		return;
 
+	dp_peer_stats_shards_fold(srcobj);
+
 	for (pream_type = 0; pream_type < DOT11_MAX; pream_type++) {
 		for (i = 0; i < MAX_MCS; i++) {
 			tgtobj->tx.pkt_type[pream_type].
@@ -7505,6 +7528,16 @@ void dp_update_pdev_ingress_stats(struct dp_pdev *tgtobj,
 	DP_STATS_AGGR(tgtobj, srcobj,
 		      tx_i.mcast_en.dropped_send_fail);
 	DP_STATS_AGGR(tgtobj, srcobj, tx_i.mcast_en.ucast);
+	DP_STATS_AGGR(tgtobj, srcobj, tx_i.mcast_en.fanout_groups);
+	DP_STATS_AGGR(tgtobj, srcobj, tx_i.mcast_en.fanout_lat_sum_us);
+	if (srcobj->stats.tx_i.mcast_en.fanout_max >
+	    tgtobj->stats.tx_i.mcast_en.fanout_max)
+		DP_STATS_UPD(tgtobj, tx_i.mcast_en.fanout_max,
+			     srcobj->stats.tx_i.mcast_en.fanout_max);
+	if (srcobj->stats.tx_i.mcast_en.fanout_lat_max_us >
+	    tgtobj->stats.tx_i.mcast_en.fanout_lat_max_us)
+		DP_STATS_UPD(tgtobj, tx_i.mcast_en.fanout_lat_max_us,
+			     srcobj->stats.tx_i.mcast_en.fanout_lat_max_us);
 	DP_STATS_AGGR(tgtobj, srcobj, tx_i.igmp_mcast_en.igmp_rcvd);
 	DP_STATS_AGGR(tgtobj, srcobj, tx_i.igmp_mcast_en.igmp_ucast_converted);
 	DP_STATS_AGGR(tgtobj, srcobj, tx_i.dropped.dma_error);
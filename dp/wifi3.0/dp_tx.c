@@ -1461,6 +1461,8 @@ dp_tx_ring_access_end(struct dp_soc *soc, hal_ring_handle_t hal_ring_hdl,
 		dp_tx_hal_ring_access_end(soc, hal_ring_hdl);
 }
 
+#endif /* WLAN_DP_FEATURE_SW_LATENCY_MGR */
+
 static inline void
 dp_tx_is_hp_update_required(uint32_t i, struct dp_tx_msdu_info_s *msdu_info)
 {
@@ -1494,19 +1496,6 @@ dp_tx_check_and_flush_hp(struct dp_soc *soc,
 			(msdu_info->tx_queue.ring_id & DP_TX_QUEUE_MASK));
 	}
 }
-#else
-static inline void
-dp_tx_is_hp_update_required(uint32_t i, struct dp_tx_msdu_info_s *msdu_info)
-{
-}
-
-static inline void
-dp_tx_check_and_flush_hp(struct dp_soc *soc,
-			 QDF_STATUS status,
-			 struct dp_tx_msdu_info_s *msdu_info)
-{
-}
-#endif
 
 #ifdef FEATURE_RUNTIME_PM
 static inline int dp_get_rtpm_tput_policy_requirement(struct dp_soc *soc)
@@ -2030,6 +2019,7 @@ dp_tx_send_msdu_single(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 	enum cdp_tx_sw_drop drop_code = TX_MAX_DROP;
 	uint8_t tid = msdu_info->tid;
 	struct cdp_tid_tx_stats *tid_stats = NULL;
+	uint16_t trace_len;
 
 	/* Setup Tx descriptor for an MSDU, and MSDU extension descriptor */
 	tx_desc = dp_tx_prepare_desc_single(vdev, nbuf, tx_q->desc_pool_id,
@@ -2074,6 +2064,11 @@ dp_tx_send_msdu_single(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 	tx_desc->dma_addr = qdf_nbuf_mapped_paddr_get(tx_desc->nbuf);
 	dp_tx_desc_history_add(soc, tx_desc->dma_addr, nbuf,
 			       tx_desc->id, DP_TX_DESC_MAP);
+	/*
+	 * The nbuf may be completed and freed as soon as it is enqueued,
+	 * so take what the tracepoint needs from it beforehand.
+	 */
+	trace_len = qdf_nbuf_len(nbuf);
 	/* Enqueue the Tx MSDU descriptor to HW for transmit */
 	status = soc->arch_ops.tx_hw_enqueue(soc, vdev, tx_desc,
 					     htt_tcl_metadata,
@@ -2091,6 +2086,10 @@ dp_tx_send_msdu_single(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 		goto release_desc;
 	}
 
+	if (qdf_unlikely(qdf_trace_dp_tx_send_msdu_enabled()))
+		qdf_trace_dp_tx_send_msdu(tx_q->ring_id, vdev->vdev_id,
+					  peer_id, tid, trace_len, 0, 0);
+
 	return NULL;
 
 release_desc:
@@ -2156,6 +2155,48 @@ nbuf_free:
 	qdf_nbuf_free(nbuf);
 }
 
+/**
+ * dp_tx_me_fanout_stats_update() - Account one ME fan-out group
+ * @vdev: DP vdev handle
+ * @num_clients: number of unicast copies enqueued for the group
+ * @start_us: time the first copy of the group was picked up
+ *
+ * All copies of an ME group share one payload mapping and are written to
+ * TCL under a single HP update; the latency recorded here is the time
+ * from the first descriptor being prepared to the last one being posted.
+ *
+ * Return: none
+ */
+static inline void
+dp_tx_me_fanout_stats_update(struct dp_vdev *vdev, uint32_t num_clients,
+			     int64_t start_us)
+{
+	uint32_t lat_us;
+
+	lat_us = (uint32_t)(qdf_ktime_to_us(qdf_ktime_get()) - start_us);
+
+	DP_STATS_INC(vdev, tx_i.mcast_en.fanout_groups, 1);
+	DP_STATS_INC(vdev, tx_i.mcast_en.fanout_lat_sum_us, lat_us);
+	if (num_clients > vdev->stats.tx_i.mcast_en.fanout_max)
+		DP_STATS_UPD(vdev, tx_i.mcast_en.fanout_max, num_clients);
+	if (lat_us > vdev->stats.tx_i.mcast_en.fanout_lat_max_us)
+		DP_STATS_UPD(vdev, tx_i.mcast_en.fanout_lat_max_us, lat_us);
+}
+
+/**
+ * dp_tx_seg_len() - Get the length of the segment being enqueued
+ * @msdu_info: MSDU info of a TSO, SG or ME frame
+ *
+ * Return: length of the current TSO segment or SG/ME segment
+ */
+static inline uint16_t dp_tx_seg_len(struct dp_tx_msdu_info_s *msdu_info)
+{
+	if (msdu_info->frm_type == dp_tx_frm_tso)
+		return msdu_info->u.tso_info.curr_seg->seg.total_len;
+
+	return msdu_info->u.sg_info.curr_seg->total_len;
+}
+
 /**
  * dp_tx_send_msdu_multiple() - Enqueue multiple MSDUs
  * @vdev: DP vdev handle
@@ -2184,9 +2225,15 @@ qdf_nbuf_t dp_tx_send_msdu_multiple(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 	struct dp_tx_queue *tx_q = &msdu_info->tx_queue;
 	struct cdp_tid_tx_stats *tid_stats = NULL;
 	uint8_t prep_desc_fail = 0, hw_enq_fail = 0;
+	bool hp_pending = false;
+	int64_t me_start_us = 0;
+	uint16_t trace_len;
+	uint8_t trace_tid;
 
-	if (msdu_info->frm_type == dp_tx_frm_me)
+	if (msdu_info->frm_type == dp_tx_frm_me) {
 		nbuf = msdu_info->u.sg_info.curr_seg->nbuf;
+		me_start_us = qdf_ktime_to_us(qdf_ktime_get());
+	}
 
 	i = 0;
 	/* Print statement to track i and num_seg */
@@ -2269,6 +2316,14 @@ qdf_nbuf_t dp_tx_send_msdu_multiple(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 		if (is_cce_classified)
 			tx_desc->flags |= DP_TX_DESC_FLAG_TO_FW;
 
+		/*
+		 * The descriptor may be completed and reused as soon as it is
+		 * enqueued, and curr_seg moves on below, so take what the
+		 * tracepoint needs beforehand.
+		 */
+		trace_len = dp_tx_seg_len(msdu_info);
+		trace_tid = msdu_info->tid;
+
 		htt_tcl_metadata = vdev->htt_tcl_metadata;
 		if (msdu_info->exception_fw) {
 			HTT_TX_TCL_METADATA_VALID_HTT_SET(htt_tcl_metadata, 1);
@@ -2309,6 +2364,14 @@ qdf_nbuf_t dp_tx_send_msdu_multiple(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 
 		dp_tx_check_and_flush_hp(soc, status, msdu_info);
 
+		/*
+		 * HP is left behind the written descriptors only when this
+		 * segment was posted with its update deferred; a posted last
+		 * segment or the flush above brings it up to date.
+		 */
+		if (QDF_IS_STATUS_SUCCESS(status) || !msdu_info->skip_hp_update)
+			hp_pending = msdu_info->skip_hp_update;
+
 		if (status != QDF_STATUS_SUCCESS) {
 			dp_info("Tx_hw_enqueue Fail tx_desc %pK queue %d",
 				tx_desc, tx_q->ring_id);
@@ -2372,6 +2435,11 @@ qdf_nbuf_t dp_tx_send_msdu_multiple(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 			goto done;
 		}
 
+		if (qdf_unlikely(qdf_trace_dp_tx_send_msdu_enabled()))
+			qdf_trace_dp_tx_send_msdu(tx_q->ring_id, vdev->vdev_id,
+						  HTT_INVALID_PEER, trace_tid,
+						  trace_len, 0, 0);
+
 		/*
 		 * TODO
 		 * if tso_info structure can be modified to have curr_seg
@@ -2399,6 +2467,18 @@ qdf_nbuf_t dp_tx_send_msdu_multiple(struct dp_vdev *vdev, qdf_nbuf_t nbuf,
 	nbuf = NULL;
 
 done:
+	/*
+	 * Trailing segments of the burst may have failed descriptor
+	 * preparation after earlier ones were posted with HP deferred.
+	 */
+	if (qdf_unlikely(hp_pending))
+		dp_flush_tcp_hp(soc, (tx_q->ring_id & DP_TX_QUEUE_MASK));
+
+	if (msdu_info->frm_type == dp_tx_frm_me)
+		dp_tx_me_fanout_stats_update(vdev, msdu_info->num_seg -
+					     prep_desc_fail - hw_enq_fail,
+					     me_start_us);
+
 	return nbuf;
 }
 
@@ -3816,7 +3896,7 @@ dp_tx_update_peer_stats(struct dp_tx_desc_s *tx_desc,
 	}
 
 	length = qdf_nbuf_len(tx_desc->nbuf);
-	DP_STATS_INC_PKT(peer, tx.comp_pkt, 1, length);
+	DP_PEER_TX_SHARD_INC_PKT(peer, ring_id, comp_pkt, 1, length);
 
 	if (qdf_unlikely(pdev->delay_stats_flag) ||
 	    qdf_unlikely(dp_is_vdev_tx_delay_stats_enabled(peer->vdev)))
@@ -3827,14 +3907,15 @@ dp_tx_update_peer_stats(struct dp_tx_desc_s *tx_desc,
 	}
 
 	if (qdf_likely(ts->status == HAL_TX_TQM_RR_FRAME_ACKED)) {
-		DP_STATS_INCC(peer, tx.retry_count, 1,
-			      ts->transmit_cnt > 1);
-		DP_STATS_INCC(peer, tx.multiple_retry_count, 1,
-			      ts->transmit_cnt > 2);
-		DP_STATS_INCC(peer, tx.ofdma, 1, ts->ofdma);
-		DP_STATS_INCC(peer, tx.amsdu_cnt, 1, ts->msdu_part_of_amsdu);
-		DP_STATS_INCC(peer, tx.non_amsdu_cnt, 1,
-			      !ts->msdu_part_of_amsdu);
+		DP_PEER_TX_SHARD_INCC(peer, ring_id, retry_count, 1,
+				      ts->transmit_cnt > 1);
+		DP_PEER_TX_SHARD_INCC(peer, ring_id, multiple_retry_count, 1,
+				      ts->transmit_cnt > 2);
+		DP_PEER_TX_SHARD_INCC(peer, ring_id, ofdma, 1, ts->ofdma);
+		DP_PEER_TX_SHARD_INCC(peer, ring_id, amsdu_cnt, 1,
+				      ts->msdu_part_of_amsdu);
+		DP_PEER_TX_SHARD_INCC(peer, ring_id, non_amsdu_cnt, 1,
+				      !ts->msdu_part_of_amsdu);
 
 		/*
 		 * Following Rate Statistics are updated from HTT PPDU events
@@ -4387,24 +4468,27 @@ out:
  * @length: Length of the packet
  * @tx_status: Tx status from TQM/FW
  * @update: enhanced flag value present in dp_pdev
+ * @ring_id: Tx completion ring the status was reaped from
  *
  * Return: none
  */
 void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
-				   uint8_t tx_status, bool update)
+				   uint8_t tx_status, bool update,
+				   uint8_t ring_id)
 {
 	if ((!peer->hw_txrx_stats_en) || update) {
-		DP_STATS_INC_PKT(peer, tx.comp_pkt, 1, length);
+		DP_PEER_TX_SHARD_INC_PKT(peer, ring_id, comp_pkt, 1, length);
 		DP_STATS_INCC(peer, tx.tx_failed, 1,
 			      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
 	}
 }
 #elif defined(QCA_VDEV_STATS_HW_OFFLOAD_SUPPORT)
 void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
-				   uint8_t tx_status, bool update)
+				   uint8_t tx_status, bool update,
+				   uint8_t ring_id)
 {
 	if (!peer->hw_txrx_stats_en) {
-		DP_STATS_INC_PKT(peer, tx.comp_pkt, 1, length);
+		DP_PEER_TX_SHARD_INC_PKT(peer, ring_id, comp_pkt, 1, length);
 		DP_STATS_INCC(peer, tx.tx_failed, 1,
 			      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
 	}
@@ -4412,14 +4496,44 @@ void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
 
 #else
 void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
-				   uint8_t tx_status, bool update)
+				   uint8_t tx_status, bool update,
+				   uint8_t ring_id)
 {
-	DP_STATS_INC_PKT(peer, tx.comp_pkt, 1, length);
+	DP_PEER_TX_SHARD_INC_PKT(peer, ring_id, comp_pkt, 1, length);
 	DP_STATS_INCC(peer, tx.tx_failed, 1,
 		      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
 }
 #endif
 
+/**
+ * dp_tx_trace_comp_msdu() - Emit the per-msdu tx completion tracepoint
+ * @ring_id: tx completion ring the descriptor was reaped from
+ * @desc: software tx descriptor
+ * @tid: tid from the completion status, 0 for simple completions
+ * @status: completion status
+ *
+ * Latency is only reported for descriptors stamped by
+ * dp_tx_desc_set_ktimestamp(), whose timestamp is in the same clock.
+ *
+ * Return: None
+ */
+static inline void dp_tx_trace_comp_msdu(uint8_t ring_id,
+					 struct dp_tx_desc_s *desc,
+					 uint8_t tid, uint8_t status)
+{
+	uint32_t latency = 0;
+
+	if (qdf_likely(!qdf_trace_dp_tx_comp_msdu_enabled()))
+		return;
+
+	if (desc->flags & DP_TX_DESC_FLAG_KTIMESTAMP)
+		latency = qdf_ktime_to_ms(qdf_ktime_real_get()) -
+			  desc->timestamp;
+
+	qdf_trace_dp_tx_comp_msdu(ring_id, desc->vdev_id, desc->peer_id, tid,
+				  desc->length, status, latency);
+}
+
 /**
  * dp_tx_comp_process_desc_list() - Tx complete software descriptor handler
  * @soc: core txrx main context
@@ -4460,9 +4574,11 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 				dp_tx_update_peer_basic_stats(peer,
 							      desc->length,
 							      desc->tx_status,
-							      false);
+							      false, ring_id);
 			qdf_assert(pdev);
 			dp_tx_outstanding_dec(pdev);
+			dp_tx_trace_comp_msdu(ring_id, desc, 0,
+					      desc->tx_status);
 
 			/*
 			 * Calling a QDF WRAPPER here is creating signifcant
@@ -4485,6 +4601,8 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 
 		dp_tx_comp_process_tx_status(soc, desc, &ts, peer, ring_id);
 
+		dp_tx_trace_comp_msdu(ring_id, desc, ts.tid, ts.status);
+
 		dp_tx_comp_process_desc(soc, desc, &ts, peer);
 
 		next = desc->next;
@@ -4763,6 +4881,7 @@ next_desc:
 	}
 
 	dp_srng_access_end(int_ctx, soc, hal_ring_hdl);
+	dp_tx_trace_comp_ring_reap(soc, hal_ring_hdl, ring_id, count, quota);
 
 	/* Process the reaped descriptors */
 	if (head_desc)
@@ -51,6 +51,7 @@
 #define DP_TX_DESC_FLAG_UNMAP_DONE	0x800
 #define DP_TX_DESC_FLAG_TX_COMP_ERR	0x1000
 #define DP_TX_DESC_FLAG_FLUSH		0x2000
+#define DP_TX_DESC_FLAG_KTIMESTAMP	0x4000
 
 #define DP_TX_EXT_DESC_FLAG_METADATA_VALID 0x1
 
@@ -179,7 +180,8 @@ struct dp_tx_queue {
  * @exception_fw: Duplicate frame to be sent to firmware
  * @ppdu_cookie: 16-bit ppdu_cookie that has to be replayed back in completions
  * @ix_tx_sniffer: Indicates if the packet has to be sniffed
- * @skip_hp_update : Skip HP update for TSO segments and update in last segment
+ * @skip_hp_update : Skip HP update for TSO/ME segments and update in last
+ *		    segment, so that a whole burst costs one TCL HP write
  *
  * This structure holds the complete MSDU information needed to program the
  * Hardware TCL and MSDU extension descriptors for different frame types
@@ -198,9 +200,7 @@ struct dp_tx_msdu_info_s {
 	} u;
 	uint32_t meta_data[DP_TX_MSDU_INFO_META_DATA_DWORDS];
 	uint16_t ppdu_cookie;
-#ifdef WLAN_DP_FEATURE_SW_LATENCY_MGR
 	uint8_t skip_hp_update;
-#endif
 };
 
 #ifndef QCA_HOST_MODE_WIFI_DISABLED
@@ -257,7 +257,8 @@ void dp_tx_inspect_handler(struct dp_soc *soc,
 			   struct dp_tx_desc_s *tx_desc,
 			   uint8_t *status);
 void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
-				   uint8_t tx_status, bool update);
+				   uint8_t tx_status, bool update,
+				   uint8_t ring_id);
 
 #ifndef QCA_HOST_MODE_WIFI_DISABLED
 /**
@@ -761,9 +762,16 @@ static inline void
 dp_tx_ring_access_end(struct dp_soc *soc, hal_ring_handle_t hal_ring_hdl,
 		      int coalesce)
 {
-	dp_tx_hal_ring_access_end(soc, hal_ring_hdl);
+	if (coalesce)
+		dp_tx_hal_ring_access_end_reap(soc, hal_ring_hdl);
+	else
+		dp_tx_hal_ring_access_end(soc, hal_ring_hdl);
 }
 
+/*
+ * Without SWLM only intra-burst segments (TSO/ME) are coalesced; the
+ * HP update is deferred to the last segment of the burst.
+ */
 static inline int
 dp_tx_attempt_coalescing(struct dp_soc *soc, struct dp_vdev *vdev,
 			 struct dp_tx_desc_s *tx_desc,
@@ -771,7 +779,7 @@ dp_tx_attempt_coalescing(struct dp_soc *soc, struct dp_vdev *vdev,
 			 struct dp_tx_msdu_info_s *msdu_info,
 			 uint8_t ring_id)
 {
-	return 0;
+	return msdu_info->skip_hp_update;
 }
 
 #endif /* WLAN_DP_FEATURE_SW_LATENCY_MGR */
@@ -896,7 +904,33 @@ bool dp_tx_pkt_tracepoints_enabled(void)
 {
 	return (qdf_trace_dp_tx_comp_tcp_pkt_enabled() ||
 		qdf_trace_dp_tx_comp_udp_pkt_enabled() ||
-		qdf_trace_dp_tx_comp_pkt_enabled());
+		qdf_trace_dp_tx_comp_pkt_enabled() ||
+		qdf_trace_dp_tx_comp_msdu_enabled());
+}
+
+/**
+ * dp_tx_trace_comp_ring_reap() - Emit the per-ring tx completion tracepoint
+ * @soc: DP soc
+ * @hal_ring_hdl: WBM completion ring handle, after access end
+ * @ring_id: tx completion ring number
+ * @num_reaped: number of ring entries reaped in this pass
+ * @quota: quota remaining after the reap
+ *
+ * Return: None
+ */
+static inline
+void dp_tx_trace_comp_ring_reap(struct dp_soc *soc,
+				hal_ring_handle_t hal_ring_hdl,
+				uint8_t ring_id, uint32_t num_reaped,
+				uint32_t quota)
+{
+	uint32_t hp, tp;
+
+	if (qdf_likely(!qdf_trace_dp_tx_comp_ring_reap_enabled()))
+		return;
+
+	hal_get_sw_hptp(soc->hal_soc, hal_ring_hdl, &tp, &hp);
+	qdf_trace_dp_tx_comp_ring_reap(ring_id, hp, tp, num_reaped, quota);
 }
 
 #ifdef DP_TX_TRACKING
@@ -940,6 +974,10 @@ void dp_tx_desc_check_corruption(struct dp_tx_desc_s *tx_desc)
  * @vdev: DP vdev handle
  * @tx_desc: tx descriptor
  *
+ * The timestamp is in milliseconds of qdf_ktime_real_get() and the
+ * descriptor is marked with DP_TX_DESC_FLAG_KTIMESTAMP, so consumers can
+ * tell it from the qdf_system_ticks() stamp of dp_tx_desc_set_timestamp().
+ *
  * Return: true when descriptor is timestamped, false otherwise
  */
 static inline
@@ -952,6 +990,7 @@ bool dp_tx_desc_set_ktimestamp(struct dp_vdev *vdev,
 	    qdf_unlikely(vdev->pdev->soc->rdkstats_enabled) ||
 	    qdf_unlikely(dp_is_vdev_tx_delay_stats_enabled(vdev))) {
 		tx_desc->timestamp = qdf_ktime_to_ms(qdf_ktime_real_get());
+		tx_desc->flags |= DP_TX_DESC_FLAG_KTIMESTAMP;
 		return true;
 	}
 	return false;
@@ -966,6 +1005,7 @@ bool dp_tx_desc_set_ktimestamp(struct dp_vdev *vdev,
 	    qdf_unlikely(dp_tx_pkt_tracepoints_enabled()) ||
 	    qdf_unlikely(vdev->pdev->soc->rdkstats_enabled)) {
 		tx_desc->timestamp = qdf_ktime_to_ms(qdf_ktime_real_get());
+		tx_desc->flags |= DP_TX_DESC_FLAG_KTIMESTAMP;
 		return true;
 	}
 	return false;
@@ -29,8 +29,6 @@
 #endif
 #include "dp_txrx_wds.h"
 
-/* Generic AST entry aging timer value */
-#define DP_AST_AGING_TIMER_DEFAULT_MS	5000
 #define DP_VLAN_UNTAGGED 0
 #define DP_VLAN_TAGGED_MULTICAST 1
 #define DP_VLAN_TAGGED_UNICAST 2
@@ -43,42 +41,98 @@
 #define DP_PEER_AST3_FLOW_MASK 0x2
 #define DP_MAX_AST_INDEX_PER_PEER 4
 
-static void
-dp_peer_age_ast_entries(struct dp_soc *soc, struct dp_peer *peer, void *arg)
+/* AST hash bins aged under one hold of the ast lock */
+#define DP_AST_AGING_BINS_PER_SLICE 16
+
+/**
+ * dp_ast_age_bin() - Age out idle WDS entries of one AST hash bin
+ * @soc: DP soc
+ * @bin: AST hash bin
+ * @budget: number of entries that may still be deleted in this tick
+ * @done: set to false if the budget ran out before the end of the bin
+ *
+ * Called with the ast lock held. Static and HM WDS entries never expire.
+ *
+ * Return: number of entries deleted
+ */
+static uint32_t dp_ast_age_bin(struct dp_soc *soc, uint32_t bin,
+			       uint32_t budget, bool *done)
 {
 	struct dp_ast_entry *ase, *temp_ase;
-	struct ast_del_ctxt *del_ctxt = (struct ast_del_ctxt *)arg;
+	uint32_t del_count = 0;
 
-	if ((del_ctxt->del_count >= soc->max_ast_ageout_count) &&
-	    !del_ctxt->age) {
-		return;
-	}
-
-	DP_PEER_ITERATE_ASE_LIST(peer, ase, temp_ase) {
-		/*
-		 * Do not expire static ast entries and HM WDS entries
-		 */
+	*done = true;
+	TAILQ_FOREACH_SAFE(ase, &soc->ast_hash.bins[bin], hash_list_elem,
+			   temp_ase) {
 		if (ase->type != CDP_TXRX_AST_TYPE_WDS &&
 		    ase->type != CDP_TXRX_AST_TYPE_DA)
 			continue;
 
-		if (ase->is_active) {
-			if (del_ctxt->age)
-				ase->is_active = FALSE;
-
+		if (ase->delete_in_progress || dp_peer_ast_is_active(soc, ase))
 			continue;
-		}
 
-		if (del_ctxt->del_count < soc->max_ast_ageout_count) {
-			DP_STATS_INC(soc, ast.aged_out, 1);
-			dp_peer_del_ast(soc, ase);
-			del_ctxt->del_count++;
-		} else {
-			soc->pending_ageout = true;
-			if (!del_ctxt->age)
-				break;
+		if (del_count == budget) {
+			*done = false;
+			break;
 		}
+
+		DP_STATS_INC(soc, ast.aged_out, 1);
+		dp_peer_del_ast(soc, ase);
+		del_count++;
+	}
+
+	return del_count;
+}
+
+/**
+ * dp_ast_age_slice() - Age out a slice of AST hash bins
+ * @soc: DP soc
+ * @num_bins: number of bins to visit
+ * @budget: number of entries that may still be deleted in this tick
+ * @done: set to false if the budget ran out inside the slice
+ *
+ * The bins are visited from soc->ast_aging_cursor onwards under a single
+ * hold of the ast lock and the WDS deletes of the slice go to the target
+ * in one request. The lock hold time is accounted in the AST stats.
+ *
+ * Return: number of entries deleted
+ */
+static uint32_t dp_ast_age_slice(struct dp_soc *soc, uint32_t num_bins,
+				 uint32_t budget, bool *done)
+{
+	uint32_t del_count = 0;
+	uint64_t start, hold_us;
+	uint32_t i;
+
+	qdf_spin_lock_bh(&soc->ast_lock);
+	start = qdf_get_monotonic_boottime();
+
+	if (soc->ast_del_batch)
+		soc->ast_del_batch->active = true;
+
+	for (i = 0; i < num_bins; i++) {
+		del_count += dp_ast_age_bin(soc, soc->ast_aging_cursor,
+					    budget - del_count, done);
+		if (!*done)
+			break;
+
+		soc->ast_aging_cursor = (soc->ast_aging_cursor + 1) &
+					soc->ast_hash.mask;
 	}
+
+	if (soc->ast_del_batch) {
+		dp_peer_ast_del_batch_flush(soc);
+		soc->ast_del_batch->active = false;
+	}
+
+	hold_us = qdf_get_monotonic_boottime() - start;
+	qdf_spin_unlock_bh(&soc->ast_lock);
+
+	DP_STATS_INC(soc, ast.age_slices, 1);
+	if (hold_us > soc->stats.ast.age_lock_hold_max_us)
+		soc->stats.ast.age_lock_hold_max_us = hold_us;
+
+	return del_count;
 }
 
 static void
@@ -112,26 +166,35 @@ dp_peer_age_mec_entries(struct dp_soc *soc)
 	dp_peer_mec_free_list(soc, &free_list);
 }
 
+/**
+ * dp_ast_aging_timer_fn() - AST and MEC aging timer handler
+ * @soc_hdl: DP soc
+ *
+ * Every tick advances the AST aging epoch and sweeps the share of the
+ * AST hash that makes one full pass take DP_AST_AGE_EPOCHS ticks, so an
+ * entry idle for that many epochs is found within two passes without
+ * ever walking the whole table at once. At most max_ast_ageout_count
+ * entries are deleted per tick; the sweep resumes where it stopped.
+ *
+ * Return: None
+ */
 static void dp_ast_aging_timer_fn(void *soc_hdl)
 {
 	struct dp_soc *soc = (struct dp_soc *)soc_hdl;
-	struct ast_del_ctxt del_ctxt = {0};
-
-
-	if (soc->wds_ast_aging_timer_cnt++ >= DP_WDS_AST_AGING_TIMER_CNT) {
-		del_ctxt.age = true;
-		soc->wds_ast_aging_timer_cnt = 0;
-	}
-
-	if (soc->pending_ageout || del_ctxt.age) {
-		soc->pending_ageout = false;
-
-		/* AST list access lock */
-		qdf_spin_lock_bh(&soc->ast_lock);
-
-		dp_soc_iterate_peer(soc, dp_peer_age_ast_entries, &del_ctxt,
-				    DP_MOD_ID_AST);
-		qdf_spin_unlock_bh(&soc->ast_lock);
+	uint32_t num_bins = soc->ast_hash.mask + 1;
+	uint32_t bins_per_tick;
+	uint32_t budget = soc->max_ast_ageout_count;
+	uint32_t slice;
+	bool done = true;
+
+	soc->ast_aging_epoch++;
+
+	bins_per_tick = (num_bins + DP_AST_AGE_EPOCHS - 1) / DP_AST_AGE_EPOCHS;
+	while (bins_per_tick && budget && done) {
+		slice = qdf_min(bins_per_tick,
+				(uint32_t)DP_AST_AGING_BINS_PER_SLICE);
+		budget -= dp_ast_age_slice(soc, slice, budget, &done);
+		bins_per_tick -= slice;
 	}
 
 	/*
@@ -158,8 +221,12 @@ void dp_soc_wds_attach(struct dp_soc *soc)
 	if (soc->ast_offload_support)
 		return;
 
-	soc->wds_ast_aging_timer_cnt = 0;
-	soc->pending_ageout = false;
+	soc->ast_aging_epoch = 0;
+	soc->ast_aging_cursor = 0;
+	soc->ast_del_batch = qdf_mem_malloc(sizeof(*soc->ast_del_batch));
+	if (!soc->ast_del_batch)
+		dp_info("AST delete batching disabled");
+
 	qdf_timer_init(soc->osdev, &soc->ast_aging_timer,
 		       dp_ast_aging_timer_fn, (void *)soc,
 		       QDF_TIMER_TYPE_WAKE_APPS);
@@ -177,6 +244,9 @@ void dp_soc_wds_detach(struct dp_soc *soc)
 {
 	qdf_timer_stop(&soc->ast_aging_timer);
 	qdf_timer_free(&soc->ast_aging_timer);
+
+	qdf_mem_free(soc->ast_del_batch);
+	soc->ast_del_batch = NULL;
 }
 
 /**
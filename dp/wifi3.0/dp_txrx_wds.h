@@ -28,10 +28,6 @@
 /* host managed flag */
 #define DP_AST_FLAGS_HM 0x0020
 
-/* WDS AST entry aging timer value */
-#define DP_WDS_AST_AGING_TIMER_DEFAULT_MS	120000
-#define DP_WDS_AST_AGING_TIMER_CNT \
-((DP_WDS_AST_AGING_TIMER_DEFAULT_MS / DP_AST_AGING_TIMER_DEFAULT_MS) - 1)
 void dp_soc_wds_attach(struct dp_soc *soc);
 void dp_soc_wds_detach(struct dp_soc *soc);
 #ifdef QCA_PEER_MULTIQ_SUPPORT
@@ -255,7 +251,7 @@ dp_rx_wds_add_or_update_ast(struct dp_soc *soc, struct dp_peer *ta_peer,
 	 * AST MAP event , so this check is mandatory
 	 */
 	if (ast->is_mapped && (ast->ast_idx == sa_idx))
-		ast->is_active = TRUE;
+		dp_peer_ast_set_active(soc, ast);
 
 	if (sa_sw_peer_id != ta_peer->peer_id) {
 
@@ -404,7 +400,10 @@ static inline QDF_STATUS dp_rx_ast_set_active(struct dp_soc *soc,
 	 * AST MAP event , so this check is mandatory
 	 */
 	if (ast->ast_idx == sa_idx) {
-		ast->is_active = is_active;
+		if (is_active)
+			dp_peer_ast_set_active(soc, ast);
+		else
+			dp_peer_ast_set_inactive(soc, ast);
 		qdf_spin_unlock_bh(&soc->ast_lock);
 		return QDF_STATUS_SUCCESS;
 	}
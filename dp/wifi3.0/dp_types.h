@@ -984,6 +984,8 @@ struct dp_soc_stats {
 		uint32_t aged_out;
 		uint32_t map_err;
 		uint32_t ast_mismatch;
+		uint32_t age_slices;
+		uint32_t age_lock_hold_max_us;
 	} ast;
 
 	struct {
@@ -1213,8 +1215,8 @@ struct dp_ast_free_cb_params {
  *           associated peer with this MAC address)
  * @mac_addr:  MAC Address for this AST entry
  * @next_hop: Set to 1 if this is for a WDS node
- * @is_active: flag to indicate active data traffic on this node
- *             (used for aging out/expiry)
+ * @seen_epoch: soc AST aging epoch of the last data traffic on this node,
+ *              written without the ast lock (used for aging out/expiry)
  * @ase_list_elem: node in peer AST list
  * @is_bss: flag to indicate if entry corresponds to bss peer
  * @is_mapped: flag to indicate that we have mapped the AST entry
@@ -1235,11 +1237,11 @@ struct dp_ast_entry {
 	uint16_t peer_id;
 	union dp_align_mac_addr mac_addr;
 	bool next_hop;
-	bool is_active;
 	bool is_mapped;
 	uint8_t pdev_id;
 	uint8_t vdev_id;
 	uint16_t ast_hash_value;
+	uint32_t seen_epoch;
 	qdf_atomic_t ref_cnt;
 	enum cdp_txrx_ast_entry_type type;
 	bool delete_in_progress;
@@ -2093,9 +2095,12 @@ struct dp_soc {
 	/*Timer for AST entry ageout maintainance */
 	qdf_timer_t ast_aging_timer;
 
-	/*Timer counter for WDS AST entry ageout*/
-	uint8_t wds_ast_aging_timer_cnt;
-	bool pending_ageout;
+	/* AST aging epoch, advanced every aging timer tick */
+	uint32_t ast_aging_epoch;
+	/* next AST hash bin the incremental aging sweep visits */
+	uint32_t ast_aging_cursor;
+	/* WDS deletes of the current aging slice, sent to FW in one go */
+	struct dp_ast_del_batch *ast_del_batch;
 	bool ast_offload_support;
 	uint32_t max_ast_ageout_count;
 	uint8_t eapol_over_control_port;
@@ -3209,6 +3214,31 @@ struct dp_ast_flow_override_info {
 	uint8_t tid_valid_hi_pri_mask;
 };
 
+/* Max peer map/unmap events applied under one lock hold */
+#define DP_PEER_MAP_BATCH_MAX 32
+
+/**
+ * struct dp_peer_map_event - decoded peer map/unmap event from firmware
+ * @mac_addr: mac address of the peer or wds entry
+ * @peer_id: peer_id from firmware
+ * @hw_peer_id: ast index for this peer, map only
+ * @ast_hash: ast hash value, map only
+ * @vdev_id: vdev ID
+ * @is_wds: flag to indicate event for WDS ast entry
+ * @is_unmap: event is a peer unmap
+ * @free_wds_count: number of wds entries freed by FW, unmap only
+ */
+struct dp_peer_map_event {
+	uint8_t mac_addr[QDF_MAC_ADDR_SIZE];
+	uint16_t peer_id;
+	uint16_t hw_peer_id;
+	uint16_t ast_hash;
+	uint8_t vdev_id;
+	uint8_t is_wds;
+	bool is_unmap;
+	uint32_t free_wds_count;
+};
+
 /*
  * struct dp_peer_ast_params - ast parameters for a msdu flow-queue
  * @ast_index - ast index populated by FW
@@ -3346,6 +3376,61 @@ struct dp_mld_link_peers {
 #endif
 
 /* Peer structure for data path state */
+/**
+ * struct dp_peer_rx_stats_shard - Per REO ring share of hot peer rx counters
+ * @rcvd_reo: MSDUs received on the ring
+ * @non_amsdu_cnt: MSDUs not part of an A-MSDU
+ * @amsdu_cnt: MSDUs part of an A-MSDU
+ * @rx_retries: MSDUs with the retry bit set
+ */
+struct dp_peer_rx_stats_shard {
+	struct cdp_pkt_info rcvd_reo;
+	uint32_t non_amsdu_cnt;
+	uint32_t amsdu_cnt;
+	uint32_t rx_retries;
+};
+
+/**
+ * struct dp_peer_tx_stats_shard - Per completion ring share of hot peer
+ *				    tx counters
+ * @comp_pkt: MSDUs completed by TQM
+ * @retry_count: acked MSDUs that needed a retry
+ * @multiple_retry_count: acked MSDUs that needed more than one retry
+ * @ofdma: acked MSDUs sent in OFDMA
+ * @amsdu_cnt: acked MSDUs part of an A-MSDU
+ * @non_amsdu_cnt: acked MSDUs not part of an A-MSDU
+ */
+struct dp_peer_tx_stats_shard {
+	struct cdp_pkt_info comp_pkt;
+	uint32_t retry_count;
+	uint32_t multiple_retry_count;
+	uint32_t ofdma;
+	uint32_t amsdu_cnt;
+	uint32_t non_amsdu_cnt;
+};
+
+/**
+ * struct dp_peer_stats_shards - Per ring peer counters, folded on read
+ * @rx: rx shards, written only from the REO ring context they belong to
+ * @tx: tx shards, written only from the completion ring they belong to
+ * @rx_folded: rx shard values already added to peer->stats
+ * @tx_folded: tx shard values already added to peer->stats
+ *
+ * Every shard sits on its own cache line so that rings serviced from
+ * different cores do not bounce the peer stats line between them. The
+ * folded copies are only touched by readers, under peer_info_lock.
+ */
+struct dp_peer_stats_shards {
+	struct {
+		struct dp_peer_rx_stats_shard cur;
+	} qdf_cacheline_aligned rx[CDP_MAX_RX_RINGS];
+	struct {
+		struct dp_peer_tx_stats_shard cur;
+	} qdf_cacheline_aligned tx[CDP_MAX_TX_COMP_RINGS];
+	struct dp_peer_rx_stats_shard rx_folded[CDP_MAX_RX_RINGS];
+	struct dp_peer_tx_stats_shard tx_folded[CDP_MAX_TX_COMP_RINGS];
+};
+
 struct dp_peer {
 	/* VDEV to which this peer is associated */
 	struct dp_vdev *vdev;
@@ -3406,6 +3491,9 @@ struct dp_peer {
 	/* Peer Stats */
 	struct cdp_peer_stats stats;
 
+	/* Per ring shards of the per-packet peer counters */
+	struct dp_peer_stats_shards stats_shards;
+
 	/* Peer extended stats */
 	struct cdp_peer_ext_stats *pext_stats;
 
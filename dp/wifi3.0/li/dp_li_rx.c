@@ -104,7 +104,7 @@ dp_rx_intrabss_ucast_check_li(struct dp_soc *soc, qdf_nbuf_t nbuf,
 		return false;
 
 	if (ast_entry->type == CDP_TXRX_AST_TYPE_DA) {
-		ast_entry->is_active = TRUE;
+		dp_peer_ast_set_active(soc, ast_entry);
 		return false;
 	}
 
@@ -546,6 +546,8 @@ more_data:
 	}
 done:
 	dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+	dp_rx_trace_ring_reap(soc, hal_ring_hdl, reo_ring_num,
+			      num_rx_bufs_reaped, quota);
 
 	DP_STATS_INCC(soc,
 		      rx.ring_packets[qdf_get_smp_processor_id()][reo_ring_num],
@@ -911,6 +913,7 @@ done:
 		dp_pkt_add_timestamp(peer->vdev, QDF_PKT_RX_DRIVER_ENTRY,
 				     current_time, nbuf);
 
+		dp_rx_trace_msdu(reo_ring_num, nbuf);
 		DP_RX_LIST_APPEND(deliver_list_head,
 				  deliver_list_tail,
 				  nbuf);
@@ -1302,6 +1302,7 @@ dp_tx_stats_update(struct dp_pdev *pdev, struct dp_peer *peer,
 	dp_peer_stats_notify(pdev, peer);
 
 #if defined(FEATURE_PERPKT_INFO) && WDI_EVENT_ENABLE
+	dp_peer_stats_shards_fold(peer);
 	dp_wdi_event_handler(WDI_EVENT_UPDATE_DP_STATS, pdev->soc,
 			     &peer->stats, ppdu->peer_id,
 			     UPDATE_PEER_STATS, pdev->pdev_id);
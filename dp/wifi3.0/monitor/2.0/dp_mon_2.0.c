@@ -211,7 +211,8 @@ dp_mon_buffers_replenish(struct dp_soc *dp_soc,
 		num_req_buffers = num_entries_avail;
 	}
 
-	while (count <= num_req_buffers) {
+	/* desc_list holds exactly num_req_buffers descriptors */
+	while (count < num_req_buffers) {
 		ret = dp_mon_frag_alloc_and_map(dp_soc,
 						&mon_desc,
 						mon_desc_pool);
@@ -232,6 +233,8 @@ dp_mon_buffers_replenish(struct dp_soc *dp_soc,
 
 		(*desc_list)->mon_desc.in_use = 1;
 		(*desc_list)->mon_desc.unmapped = 0;
+		(*desc_list)->mon_desc.buf_addr = mon_desc.buf_addr;
+		(*desc_list)->mon_desc.paddr = mon_desc.paddr;
 
 		hal_mon_buff_addr_info_set(dp_soc->hal_soc,
 					   mon_ring_entry,
@@ -401,13 +404,6 @@ QDF_STATUS dp_mon_pdev_htt_srng_setup_2_0(struct dp_soc *soc,
 	return status;
 }
 
-static uint32_t
-dp_rx_mon_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
-		      uint32_t mac_id, uint32_t quota)
-{
-	return 0;
-}
-
 static
 QDF_STATUS dp_mon_soc_detach_2_0(struct dp_soc *soc)
 {
@@ -647,6 +643,8 @@ void dp_mon_pdev_free_2_0(struct dp_pdev *pdev)
 {
 	struct dp_pdev_be *be_pdev = dp_get_be_pdev_from_dp_pdev(pdev);
 
+	if (be_pdev->monitor_pdev_be)
+		qdf_nbuf_queue_free(&be_pdev->monitor_pdev_be->rx_mon_deliver_q);
 	qdf_mem_free(be_pdev->monitor_pdev_be);
 	be_pdev->monitor_pdev_be = NULL;
 }
@@ -663,6 +661,7 @@ QDF_STATUS dp_mon_pdev_alloc_2_0(struct dp_pdev *pdev)
 		return QDF_STATUS_E_NOMEM;
 	}
 	qdf_mem_zero(mon_pdev, sizeof(*mon_pdev));
+	qdf_nbuf_queue_init(&mon_pdev->rx_mon_deliver_q);
 	be_pdev->monitor_pdev_be = mon_pdev;
 
 	return QDF_STATUS_SUCCESS;
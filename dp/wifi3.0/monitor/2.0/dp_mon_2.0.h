@@ -84,14 +84,47 @@ struct dp_mon_desc_pool {
 	uint8_t buf_alignment;
 };
 
+/**
+ * struct dp_rx_mon_be_stats - Rx monitor 2.0 pipeline stats
+ * @status_buf: status buffers reaped from the monitor destination ring
+ * @pkt_buf: packet buffers referenced by MON_BUFFER_ADDR TLVs
+ * @ppdu_done: PPDUs completed
+ * @mpdu_built: MPDUs assembled as frag chains
+ * @mpdu_delivered: MPDUs handed to the monitor vdev
+ * @mpdu_drop: MPDUs dropped on FCS error, overflow or missing vdev
+ * @nbuf_alloc_fail: MPDU head nbuf allocation failures
+ * @radiotap_fail: radiotap header updates that did not fit the headroom
+ * @invalid_cookie: ring entries and MON_BUFFER_ADDR TLVs dropped for not
+ *		    carrying a buffer descriptor
+ */
+struct dp_rx_mon_be_stats {
+	uint32_t status_buf;
+	uint32_t pkt_buf;
+	uint32_t ppdu_done;
+	uint32_t mpdu_built;
+	uint32_t mpdu_delivered;
+	uint32_t mpdu_drop;
+	uint32_t nbuf_alloc_fail;
+	uint32_t radiotap_fail;
+	uint32_t invalid_cookie;
+};
+
 /**
  * struct dp_mon_pdev_be - BE specific monitor pdev object
  * @filter_be: Monitor Filter pointer
  * @mon_pdev: monitor pdev structure
+ * @rx_mon_deliver_q: radiotap-ready MPDUs of completed PPDUs waiting to be
+ *		      delivered once the monitor ring lock is dropped
+ * @rx_mon_replay: ring replay in progress, assemble MPDUs without a
+ *		   monitor vdev
+ * @rx_mon_stats: Rx monitor 2.0 pipeline stats
  */
 struct dp_mon_pdev_be {
 	struct dp_mon_filter_be **filter_be;
 	struct dp_mon_pdev mon_pdev;
+	qdf_nbuf_queue_t rx_mon_deliver_q;
+	bool rx_mon_replay;
+	struct dp_rx_mon_be_stats rx_mon_stats;
 };
 
 /**
@@ -120,6 +153,32 @@ struct dp_mon_soc_be {
 };
 #endif
 
+/**
+ * dp_mon_add_to_free_desc_list() - Add a reaped descriptor to a local list
+ * @head: head of the local descriptor list
+ * @tail: tail of the local descriptor list
+ * @mon_desc: descriptor whose buffer has been consumed
+ *
+ * The list is handed back to dp_mon_buffers_replenish() so that the
+ * descriptors are refilled without going through the pool freelist.
+ *
+ * Return: None
+ */
+static inline
+void dp_mon_add_to_free_desc_list(union dp_mon_desc_list_elem_t **head,
+				  union dp_mon_desc_list_elem_t **tail,
+				  struct dp_mon_desc *mon_desc)
+{
+	union dp_mon_desc_list_elem_t *new =
+		(union dp_mon_desc_list_elem_t *)mon_desc;
+
+	mon_desc->in_use = 0;
+	new->next = *head;
+	*head = new;
+	if (!*tail)
+		*tail = new;
+}
+
 /**
  * dp_mon_desc_pool_init() - Monitor descriptor pool init
  * @mon_desc_pool: mon desc pool
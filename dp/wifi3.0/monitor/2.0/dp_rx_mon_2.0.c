@@ -28,6 +28,72 @@
 #include <dp_be.h>
 #include <hal_be_api_mon.h>
 
+/**
+ * dp_rx_mon_deliver_take_2_0() - Take the queued MPDUs for delivery
+ * @pdev: DP pdev handle
+ * @deliver_q: filled with the MPDUs to deliver
+ *
+ * Called once per ring reap with the MPDUs of all PPDUs completed in it.
+ * The MPDUs are dropped if there is no monitor vdev to deliver them to.
+ * Caller must hold mon_lock.
+ *
+ * Return: monitor vdev holding a DP_MOD_ID_RX reference, or NULL if there
+ *	   is nothing to deliver
+ */
+static struct dp_vdev *
+dp_rx_mon_deliver_take_2_0(struct dp_pdev *pdev, qdf_nbuf_queue_t *deliver_q)
+{
+	struct dp_mon_pdev *mon_pdev = pdev->monitor_pdev;
+	struct dp_mon_pdev_be *mon_pdev_be =
+			dp_get_be_pdev_from_dp_pdev(pdev)->monitor_pdev_be;
+	qdf_nbuf_queue_t *pending_q = &mon_pdev_be->rx_mon_deliver_q;
+	struct dp_vdev *mvdev = mon_pdev->mvdev;
+
+	qdf_nbuf_queue_init(deliver_q);
+	if (qdf_nbuf_is_queue_empty(pending_q))
+		return NULL;
+
+	if (!mvdev || !mvdev->osif_vdev || !mvdev->monitor_vdev ||
+	    !mvdev->monitor_vdev->osif_rx_mon || mon_pdev_be->rx_mon_replay ||
+	    dp_vdev_get_ref(pdev->soc, mvdev, DP_MOD_ID_RX) !=
+	    QDF_STATUS_SUCCESS) {
+		mon_pdev_be->rx_mon_stats.mpdu_drop +=
+					qdf_nbuf_queue_len(pending_q);
+		qdf_nbuf_queue_free(pending_q);
+		return NULL;
+	}
+
+	mon_pdev_be->rx_mon_stats.mpdu_delivered +=
+					qdf_nbuf_queue_len(pending_q);
+	qdf_nbuf_queue_append(deliver_q, pending_q);
+	qdf_nbuf_queue_init(pending_q);
+
+	return mvdev;
+}
+
+/**
+ * dp_rx_mon_deliver_2_0() - Deliver MPDUs to the monitor vdev
+ * @soc: DP soc handle
+ * @mvdev: monitor vdev returned by dp_rx_mon_deliver_take_2_0()
+ * @deliver_q: MPDUs returned by dp_rx_mon_deliver_take_2_0()
+ *
+ * Called after mon_lock is released, so the OS interface does not run
+ * under it. Drops the vdev reference.
+ *
+ * Return: None
+ */
+static void dp_rx_mon_deliver_2_0(struct dp_soc *soc, struct dp_vdev *mvdev,
+				  qdf_nbuf_queue_t *deliver_q)
+{
+	struct dp_mon_vdev *mon_vdev = mvdev->monitor_vdev;
+	qdf_nbuf_t nbuf;
+
+	while ((nbuf = qdf_nbuf_queue_remove(deliver_q)))
+		mon_vdev->osif_rx_mon(mvdev->osif_vdev, nbuf, NULL);
+
+	dp_vdev_unref_delete(soc, mvdev, DP_MOD_ID_RX);
+}
+
 static inline uint32_t
 dp_rx_mon_srng_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
 			   uint32_t mac_id, uint32_t quota)
@@ -39,6 +105,13 @@ dp_rx_mon_srng_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
 	struct dp_mon_pdev *mon_pdev;
 	struct dp_soc_be *be_soc = dp_get_be_soc_from_dp_soc(soc);
 	struct dp_mon_soc_be *monitor_soc = be_soc->monitor_soc_be;
+	struct dp_mon_desc_pool *rx_desc_pool = &monitor_soc->rx_desc_mon;
+	struct dp_mon_pdev_be *mon_pdev_be;
+	union dp_mon_desc_list_elem_t *desc_list = NULL;
+	union dp_mon_desc_list_elem_t *tail = NULL;
+	qdf_nbuf_queue_t deliver_q;
+	struct dp_vdev *mvdev;
+	uint32_t num_descs = 0;
 	uint32_t work_done = 0;
 
 	if (!pdev) {
@@ -56,6 +129,7 @@ dp_rx_mon_srng_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
 	}
 
 	hal_soc = soc->hal_soc;
+	mon_pdev_be = dp_get_be_pdev_from_dp_pdev(pdev)->monitor_pdev_be;
 
 	qdf_assert((hal_soc && pdev));
 
@@ -73,14 +147,16 @@ dp_rx_mon_srng_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
 				&& quota--)) {
 		struct hal_mon_desc hal_mon_rx_desc;
 		struct dp_mon_desc *mon_desc;
-		struct dp_mon_desc_pool *rx_desc_pool;
 
-		rx_desc_pool = &monitor_soc->rx_desc_mon;
 		hal_mon_buf_get(soc->hal_soc,
 				rx_mon_dst_ring_desc,
 				&hal_mon_rx_desc);
 		mon_desc = (struct dp_mon_desc *)(uintptr_t)(hal_mon_rx_desc.buf_addr);
-		qdf_assert_always(mon_desc);
+		if (qdf_unlikely(!mon_desc)) {
+			mon_pdev_be->rx_mon_stats.invalid_cookie++;
+			work_done++;
+			continue;
+		}
 
 		if (!mon_desc->unmapped) {
 			qdf_mem_unmap_page(soc->osdev, mon_desc->paddr,
@@ -89,16 +165,34 @@ dp_rx_mon_srng_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
 			mon_desc->unmapped = 1;
 		}
 
-		dp_rx_mon_process_status_tlv(soc, pdev,
-					     &hal_mon_rx_desc,
-					     mon_desc->paddr);
+		if (!hal_mon_rx_desc.empty_descriptor)
+			num_descs +=
+				dp_rx_mon_process_status_tlv(soc, pdev,
+							     &hal_mon_rx_desc,
+							     mon_desc->buf_addr,
+							     &desc_list,
+							     &tail);
 
+		/* frags of the MPDUs hold their own reference */
 		qdf_frag_free(mon_desc->buf_addr);
+		dp_mon_add_to_free_desc_list(&desc_list, &tail, mon_desc);
+		num_descs++;
 		work_done++;
 	}
 	dp_srng_access_end(int_ctx, soc, mon_dst_srng);
 
+	if (num_descs)
+		dp_mon_buffers_replenish(soc, &soc->rxdma_mon_buf_ring[0],
+					 rx_desc_pool, num_descs,
+					 &desc_list, &tail);
+
+	mvdev = dp_rx_mon_deliver_take_2_0(pdev, &deliver_q);
+
 	qdf_spin_unlock_bh(&mon_pdev->mon_lock);
+
+	if (mvdev)
+		dp_rx_mon_deliver_2_0(soc, mvdev, &deliver_q);
+
 	dp_mon_info("mac_id: %d, work_done:%d", mac_id, work_done);
 	return work_done;
 }
@@ -114,6 +208,185 @@ dp_rx_mon_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
 	return work_done;
 }
 
+#ifdef WLAN_DP_RX_MON_2_0_REPLAY
+/* 802.11 header plus the leading payload carried by the RX_HEADER TLV */
+#define DP_RX_MON_REPLAY_HDR_LEN 64
+/* RX_HEADER TLV payload starts with the PHY PPDU id */
+#define DP_RX_MON_REPLAY_HDR_RSVD 4
+#define DP_RX_MON_REPLAY_MPDU_LEN 1500
+
+/**
+ * dp_rx_mon_replay_put_tlv() - Append a TLV to a replay status buffer
+ * @buf: write position in the status buffer
+ * @tag: TLV tag
+ * @user_id: user id
+ * @len: TLV payload length, the payload is zeroed
+ *
+ * Return: payload of the TLV
+ */
+static uint8_t *dp_rx_mon_replay_put_tlv(uint8_t **buf, uint32_t tag,
+					 uint32_t user_id, uint32_t len)
+{
+	uint8_t *tlv = *buf;
+
+	*(uint64_t *)tlv =
+		(((uint64_t)tag << HAL_RX_USER_TLV64_TYPE_LSB) &
+		 HAL_RX_USER_TLV64_TYPE_MASK) |
+		(((uint64_t)len << HAL_RX_USER_TLV64_LEN_LSB) &
+		 HAL_RX_USER_TLV64_LEN_MASK) |
+		(((uint64_t)user_id << HAL_RX_USER_TLV64_USERID_LSB) &
+		 HAL_RX_USER_TLV64_USERID_MASK);
+	qdf_mem_zero(tlv + HAL_RX_TLV64_HDR_SIZE, len);
+
+	*buf = hal_rx_status_get_next_tlv(tlv, true);
+
+	return tlv + HAL_RX_TLV64_HDR_SIZE;
+}
+
+/**
+ * dp_rx_mon_replay_status_buf() - Process a replay status buffer
+ * @soc: DP soc handle
+ * @pdev: DP pdev handle
+ * @status_frag: status buffer
+ * @end: end of the TLVs written to @status_frag
+ *
+ * Return: None
+ */
+static void dp_rx_mon_replay_status_buf(struct dp_soc *soc,
+					struct dp_pdev *pdev,
+					qdf_frag_t status_frag, uint8_t *end)
+{
+	union dp_mon_desc_list_elem_t *desc_list = NULL;
+	union dp_mon_desc_list_elem_t *tail = NULL;
+	struct hal_mon_desc hal_mon_rx_desc = {0};
+
+	hal_mon_rx_desc.end_offset = end - (uint8_t *)status_frag;
+
+	/* replay descriptors are not part of the ring pool, drop the list */
+	dp_rx_mon_process_status_tlv(soc, pdev, &hal_mon_rx_desc,
+				     status_frag, &desc_list, &tail);
+	qdf_frag_free(status_frag);
+}
+
+void dp_rx_mon_replay_2_0(struct dp_soc *soc, struct dp_pdev *pdev,
+			  uint32_t num_ppdus, uint8_t num_mpdus)
+{
+	struct dp_mon_pdev *mon_pdev = pdev->monitor_pdev;
+	struct dp_mon_pdev_be *mon_pdev_be =
+			dp_get_be_pdev_from_dp_pdev(pdev)->monitor_pdev_be;
+	struct dp_rx_mon_be_stats stats;
+	struct dp_mon_desc *pkt_desc;
+	struct mon_buffer_addr *addr;
+	struct rx_ppdu_start *ppdu_start;
+	qdf_frag_t status_frag = NULL;
+	qdf_nbuf_queue_t deliver_q;
+	uint8_t *buf = NULL;
+	uint32_t ppdu, mpdu, status_bufs = 0;
+	uint32_t mpdu_tlv_len;
+	uint64_t start, elapsed_us;
+
+	if (!mon_pdev_be || !num_ppdus || !num_mpdus)
+		return;
+
+	/* one packet buffer descriptor per MPDU, reused every PPDU */
+	pkt_desc = qdf_mem_malloc(num_mpdus * sizeof(*pkt_desc));
+	if (!pkt_desc)
+		return;
+
+	mpdu_tlv_len = 4 * HAL_RX_TLV64_HDR_SIZE +
+		       sizeof(hal_rx_mon_mpdu_start_t) +
+		       DP_RX_MON_REPLAY_HDR_RSVD + DP_RX_MON_REPLAY_HDR_LEN +
+		       sizeof(struct mon_buffer_addr) +
+		       sizeof(struct rx_mpdu_end) + 4 * HAL_RX_TLV64_HDR_SIZE;
+
+	qdf_spin_lock_bh(&mon_pdev->mon_lock);
+	mon_pdev_be->rx_mon_replay = true;
+	stats = mon_pdev_be->rx_mon_stats;
+
+	start = qdf_get_monotonic_boottime();
+	for (ppdu = 0; ppdu < num_ppdus; ppdu++) {
+		status_frag = qdf_frag_alloc(DP_MON_DATA_BUFFER_SIZE);
+		if (!status_frag)
+			break;
+		status_bufs++;
+
+		buf = status_frag;
+		ppdu_start = (struct rx_ppdu_start *)
+			dp_rx_mon_replay_put_tlv(&buf, WIFIRX_PPDU_START_E, 0,
+						 sizeof(struct rx_ppdu_start));
+		ppdu_start->phy_ppdu_id = ppdu + 1;
+
+		for (mpdu = 0; mpdu < num_mpdus; mpdu++) {
+			/* a PPDU spans as many status buffers as it needs */
+			if (buf + mpdu_tlv_len + HAL_RX_TLV64_HDR_SIZE >
+			    (uint8_t *)status_frag + DP_MON_DATA_BUFFER_SIZE) {
+				dp_rx_mon_replay_status_buf(soc, pdev,
+							    status_frag, buf);
+				status_frag =
+					qdf_frag_alloc(DP_MON_DATA_BUFFER_SIZE);
+				if (!status_frag)
+					goto out;
+				status_bufs++;
+				buf = status_frag;
+			}
+
+			pkt_desc[mpdu].buf_addr =
+				qdf_frag_alloc(DP_MON_DATA_BUFFER_SIZE);
+			if (!pkt_desc[mpdu].buf_addr)
+				break;
+			pkt_desc[mpdu].unmapped = 1;
+
+			dp_rx_mon_replay_put_tlv(&buf, WIFIRX_MPDU_START_E, 0,
+						 sizeof(hal_rx_mon_mpdu_start_t));
+			dp_rx_mon_replay_put_tlv(&buf, WIFIRX_HEADER_E, 0,
+						 DP_RX_MON_REPLAY_HDR_RSVD +
+						 DP_RX_MON_REPLAY_HDR_LEN);
+			addr = (struct mon_buffer_addr *)
+				dp_rx_mon_replay_put_tlv(&buf,
+						WIFIMON_BUFFER_ADDR_E, 0,
+						sizeof(struct mon_buffer_addr));
+			addr->buffer_virt_addr_31_0 =
+				(uint64_t)(uintptr_t)&pkt_desc[mpdu] &
+				0xffffffff;
+			addr->buffer_virt_addr_63_32 =
+				(uint64_t)(uintptr_t)&pkt_desc[mpdu] >> 32;
+			addr->dma_length = DP_RX_MON_REPLAY_MPDU_LEN;
+			dp_rx_mon_replay_put_tlv(&buf, WIFIRX_MPDU_END_E, 0,
+						 sizeof(struct rx_mpdu_end));
+		}
+		dp_rx_mon_replay_put_tlv(&buf, WIFIRX_PPDU_END_STATUS_DONE_E,
+					 0, 0);
+		dp_rx_mon_replay_status_buf(soc, pdev, status_frag, buf);
+		/* nothing is delivered while rx_mon_replay is set */
+		dp_rx_mon_deliver_take_2_0(pdev, &deliver_q);
+	}
+out:
+	elapsed_us = qdf_get_monotonic_boottime() - start;
+
+	/* drop a PPDU cut short by an allocation failure */
+	dp_rx_mon_ppdu_flush(pdev, &mon_pdev->ppdu_info, false);
+	mon_pdev_be->rx_mon_replay = false;
+	stats.ppdu_done = mon_pdev_be->rx_mon_stats.ppdu_done -
+			  stats.ppdu_done;
+	stats.mpdu_built = mon_pdev_be->rx_mon_stats.mpdu_built -
+			   stats.mpdu_built;
+	stats.nbuf_alloc_fail = mon_pdev_be->rx_mon_stats.nbuf_alloc_fail -
+				stats.nbuf_alloc_fail;
+	qdf_spin_unlock_bh(&mon_pdev->mon_lock);
+
+	qdf_mem_free(pkt_desc);
+
+	qdf_nofl_info("RxMon replay: %u PPDUs x %u MPDUs, %u status buffers in %llu us (%llu PPDU/s), %u PPDUs done, %u MPDUs built, %u alloc failures",
+		      ppdu, num_mpdus, status_bufs, elapsed_us,
+		      elapsed_us ? qdf_do_div((uint64_t)ppdu * 1000000,
+					      elapsed_us) : 0,
+		      stats.ppdu_done, stats.mpdu_built,
+		      stats.nbuf_alloc_fail);
+}
+
+qdf_export_symbol(dp_rx_mon_replay_2_0);
+#endif
+
 void
 dp_rx_mon_buf_desc_pool_deinit(struct dp_soc *soc)
 {
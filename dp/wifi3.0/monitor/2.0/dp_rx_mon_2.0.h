@@ -73,17 +73,83 @@ void dp_rx_mon_buf_desc_pool_free(struct dp_soc *soc);
 QDF_STATUS
 dp_rx_mon_buf_desc_pool_alloc(struct dp_soc *soc);
 
+union dp_mon_desc_list_elem_t;
+
 /*
  * dp_rx_mon_process_status_tlv() - process status tlv
  * @soc: dp soc handle
  * @pdev: dp pdev handle
  * @mon_ring_desc: HAL monitor ring descriptor
- * @frag_addr: frag address
+ * @status_frag: status buffer, already unmapped
+ * @desc_list: list the consumed packet buffer descriptors are added to
+ * @tail: tail of @desc_list
+ *
+ * TLVs are parsed in place in the status buffer. MPDUs are assembled as
+ * frag chains referencing the RX_HEADER TLV and the packet buffers, and
+ * the MPDUs of a completed PPDU are queued for delivery with the radiotap
+ * header already pushed.
+ *
+ * Return: number of packet buffer descriptors added to @desc_list
+ */
+uint32_t
+dp_rx_mon_process_status_tlv(struct dp_soc *soc,
+			     struct dp_pdev *pdev,
+			     struct hal_mon_desc *mon_ring_desc,
+			     qdf_frag_t status_frag,
+			     union dp_mon_desc_list_elem_t **desc_list,
+			     union dp_mon_desc_list_elem_t **tail);
+
+/*
+ * dp_rx_mon_ppdu_flush() - release the MPDUs of a PPDU
+ * @pdev: dp pdev handle
+ * @ppdu_info: PPDU info
+ * @deliver: queue completed MPDUs for delivery, otherwise drop them
+ *
+ * Return: None
+ */
+void dp_rx_mon_ppdu_flush(struct dp_pdev *pdev,
+			  struct hal_rx_ppdu_info *ppdu_info,
+			  bool deliver);
+
+/*
+ * dp_rx_mon_process_2_0() - reap and process the rx monitor destination ring
+ * @soc: dp soc handle
+ * @int_ctx: interrupt context
+ * @mac_id: lmac id
+ * @quota: number of ring entries to reap
+ *
+ * Return: number of ring entries reaped
+ */
+#ifndef DISABLE_MON_CONFIG
+uint32_t
+dp_rx_mon_process_2_0(struct dp_soc *soc, struct dp_intr *int_ctx,
+		      uint32_t mac_id, uint32_t quota);
+#endif
+
+#ifdef WLAN_DP_RX_MON_2_0_REPLAY
+/*
+ * dp_rx_mon_replay_2_0() - replay synthetic monitor ring entries
+ * @soc: dp soc handle
+ * @pdev: dp pdev handle
+ * @num_ppdus: number of PPDUs to replay
+ * @num_mpdus: MPDUs per PPDU
+ *
+ * Feeds status buffers laid out the way the monitor destination ring
+ * delivers them, each PPDU with @num_mpdus MPDUs backed by one packet
+ * buffer, through the same TLV processing as the ring. The assembled
+ * MPDUs are dropped instead of being delivered and the PPDU rate is
+ * logged.
  *
+ * Return: None
  */
-void dp_rx_mon_process_status_tlv(struct dp_soc *soc,
-				  struct dp_pdev *pdev,
-				  struct hal_mon_desc *mon_ring_desc,
-				  qdf_dma_addr_t addr);
+void dp_rx_mon_replay_2_0(struct dp_soc *soc, struct dp_pdev *pdev,
+			  uint32_t num_ppdus, uint8_t num_mpdus);
+#else
+static inline
+void dp_rx_mon_replay_2_0(struct dp_soc *soc, struct dp_pdev *pdev,
+			  uint32_t num_ppdus, uint8_t num_mpdus)
+{
+}
+#endif
 
 #endif /* _DP_RX_MON_2_0_H_ */
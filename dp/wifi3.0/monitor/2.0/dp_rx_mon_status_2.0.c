@@ -22,13 +22,351 @@
 #include <dp_mon.h>
 #include <dp_mon_2.0.h>
 #include <dp_rx_mon_2.0.h>
+#include <dp_be.h>
 
-void dp_rx_mon_process_status_tlv(struct dp_soc *soc,
-				  struct dp_pdev *pdev,
-				  struct hal_mon_desc *mon_ring_desc,
-				  qdf_dma_addr_t addr)
+/**
+ * dp_rx_mon_mpdu_drop() - Drop the MPDU being assembled for a user
+ * @mon_pdev_be: BE monitor pdev
+ * @ppdu_info: PPDU info
+ * @user_id: user id
+ *
+ * Remaining packet buffers of the MPDU are freed as they are reaped.
+ *
+ * Return: None
+ */
+static void dp_rx_mon_mpdu_drop(struct dp_mon_pdev_be *mon_pdev_be,
+				struct hal_rx_ppdu_info *ppdu_info,
+				uint32_t user_id)
+{
+	uint16_t idx = ppdu_info->mpdu_count[user_id];
+
+	if (ppdu_info->mpdu_q[user_id][idx]) {
+		qdf_nbuf_free(ppdu_info->mpdu_q[user_id][idx]);
+		ppdu_info->mpdu_q[user_id][idx] = NULL;
+		mon_pdev_be->rx_mon_stats.mpdu_drop++;
+	}
+	ppdu_info->mpdu_info[user_id].overflow_err = true;
+}
+
+/**
+ * dp_rx_mon_mpdu_get() - Get the MPDU being assembled for a user
+ * @soc: DP soc handle
+ * @mon_pdev_be: BE monitor pdev
+ * @ppdu_info: PPDU info
+ * @user_id: user id
+ *
+ * The MPDU head nbuf carries no data of its own. Its linear area is the
+ * headroom for the radiotap header and the MPDU itself is a chain of frags
+ * pointing into the status and packet buffers.
+ *
+ * Return: MPDU nbuf, NULL if the MPDU is not being assembled
+ */
+static qdf_nbuf_t dp_rx_mon_mpdu_get(struct dp_soc *soc,
+				     struct dp_mon_pdev_be *mon_pdev_be,
+				     struct hal_rx_ppdu_info *ppdu_info,
+				     uint32_t user_id)
 {
-	/* API to process status tlv */
+	uint16_t idx = ppdu_info->mpdu_count[user_id];
+	qdf_nbuf_t nbuf;
+
+	if (qdf_unlikely(user_id >= HAL_MAX_UL_MU_USERS ||
+			 idx >= HAL_RX_MAX_MPDU))
+		return NULL;
+
+	if (ppdu_info->mpdu_info[user_id].overflow_err)
+		return NULL;
+
+	nbuf = ppdu_info->mpdu_q[user_id][idx];
+	if (nbuf)
+		return nbuf;
+
+	nbuf = qdf_nbuf_alloc(soc->osdev, RADIOTAP_HEADER_LEN,
+			      RADIOTAP_HEADER_LEN, 4, FALSE);
+	if (qdf_unlikely(!nbuf)) {
+		mon_pdev_be->rx_mon_stats.nbuf_alloc_fail++;
+		ppdu_info->mpdu_info[user_id].overflow_err = true;
+		return NULL;
+	}
+
+	ppdu_info->mpdu_q[user_id][idx] = nbuf;
+	ppdu_info->msdu[user_id].first_buffer = 0;
+	ppdu_info->msdu[user_id].frag_len = 0;
+
+	return nbuf;
+}
+
+/**
+ * dp_rx_mon_add_hdr_frag() - Attach the RX_HEADER TLV to the MPDU
+ * @soc: DP soc handle
+ * @mon_pdev_be: BE monitor pdev
+ * @ppdu_info: PPDU info
+ * @status_frag: status buffer holding the RX_HEADER TLV
+ *
+ * The header is referenced in place in the status buffer. It only starts
+ * an MPDU, later RX_HEADER TLVs of the same MPDU are ignored.
+ *
+ * Return: None
+ */
+static void dp_rx_mon_add_hdr_frag(struct dp_soc *soc,
+				   struct dp_mon_pdev_be *mon_pdev_be,
+				   struct hal_rx_ppdu_info *ppdu_info,
+				   qdf_frag_t status_frag)
+{
+	uint32_t user_id = ppdu_info->user_id;
+	uint32_t hdr_len;
+	qdf_nbuf_t nbuf;
+
+	nbuf = dp_rx_mon_mpdu_get(soc, mon_pdev_be, ppdu_info, user_id);
+	if (!nbuf || qdf_nbuf_get_nr_frags(nbuf))
+		return;
+
+	hdr_len = ppdu_info->hdr_len -
+		  (ppdu_info->data - ppdu_info->msdu_info.first_msdu_payload);
+
+	qdf_nbuf_add_rx_frag(status_frag, nbuf,
+			     ppdu_info->data - (unsigned char *)status_frag,
+			     hdr_len, hdr_len, true);
+
+	/* the first packet buffer repeats the header bytes */
+	ppdu_info->msdu[user_id].first_buffer = 1;
+	ppdu_info->msdu[user_id].frag_len = hdr_len;
+}
+
+/**
+ * dp_rx_mon_add_pkt_frag() - Attach a packet buffer to the MPDU
+ * @soc: DP soc handle
+ * @mon_pdev_be: BE monitor pdev
+ * @ppdu_info: PPDU info holding the MON_BUFFER_ADDR info
+ * @assemble: assemble MPDUs, otherwise the buffer is only recycled
+ *
+ * The packet buffer is handed over to the MPDU nbuf as is, no data is
+ * copied. If it cannot be attached it is freed. A TLV without a buffer
+ * descriptor is counted and the MPDU it belongs to is dropped.
+ *
+ * Return: descriptor of the packet buffer, NULL if the TLV carries none
+ */
+static struct dp_mon_desc *
+dp_rx_mon_add_pkt_frag(struct dp_soc *soc,
+		       struct dp_mon_pdev_be *mon_pdev_be,
+		       struct hal_rx_ppdu_info *ppdu_info,
+		       bool assemble)
+{
+	struct dp_soc_be *be_soc = dp_get_be_soc_from_dp_soc(soc);
+	struct dp_mon_desc_pool *rx_desc_pool =
+				&be_soc->monitor_soc_be->rx_desc_mon;
+	struct hal_mon_packet_info *packet_info = &ppdu_info->packet_info;
+	uint32_t user_id = ppdu_info->user_id;
+	struct dp_mon_desc *mon_desc;
+	uint16_t offset = 0;
+	uint16_t len = packet_info->dma_length;
+	qdf_nbuf_t nbuf = NULL;
+
+	mon_desc = (struct dp_mon_desc *)(uintptr_t)packet_info->sw_cookie;
+	if (qdf_unlikely(!mon_desc)) {
+		mon_pdev_be->rx_mon_stats.invalid_cookie++;
+		if (assemble && user_id < HAL_MAX_UL_MU_USERS &&
+		    ppdu_info->mpdu_count[user_id] < HAL_RX_MAX_MPDU)
+			dp_rx_mon_mpdu_drop(mon_pdev_be, ppdu_info, user_id);
+		return NULL;
+	}
+
+	if (!mon_desc->unmapped) {
+		qdf_mem_unmap_page(soc->osdev, mon_desc->paddr,
+				   QDF_DMA_FROM_DEVICE,
+				   rx_desc_pool->buf_size);
+		mon_desc->unmapped = 1;
+	}
+	mon_pdev_be->rx_mon_stats.pkt_buf++;
+
+	if (assemble)
+		nbuf = dp_rx_mon_mpdu_get(soc, mon_pdev_be, ppdu_info,
+					  user_id);
+
+	if (nbuf && ppdu_info->msdu[user_id].first_buffer) {
+		offset = ppdu_info->msdu[user_id].frag_len;
+		ppdu_info->msdu[user_id].first_buffer = 0;
+		if (len <= offset) {
+			qdf_frag_free(mon_desc->buf_addr);
+			return mon_desc;
+		}
+		len -= offset;
+	}
+
+	if (nbuf && qdf_nbuf_get_nr_frags(nbuf) >= QDF_NBUF_MAX_FRAGS) {
+		dp_rx_mon_mpdu_drop(mon_pdev_be, ppdu_info, user_id);
+		nbuf = NULL;
+	}
+
+	if (!nbuf) {
+		qdf_frag_free(mon_desc->buf_addr);
+		return mon_desc;
+	}
+
+	qdf_nbuf_add_rx_frag(mon_desc->buf_addr, nbuf, offset, len,
+			     rx_desc_pool->buf_size, false);
+
+	return mon_desc;
+}
+
+/**
+ * dp_rx_mon_mpdu_end() - Close the MPDU of the current user
+ * @mon_pdev_be: BE monitor pdev
+ * @ppdu_info: PPDU info
+ *
+ * Return: None
+ */
+static void dp_rx_mon_mpdu_end(struct dp_mon_pdev_be *mon_pdev_be,
+			       struct hal_rx_ppdu_info *ppdu_info)
+{
+	uint32_t user_id = ppdu_info->user_id;
+	uint16_t idx;
+
+	if (qdf_unlikely(user_id >= HAL_MAX_UL_MU_USERS))
+		return;
+
+	idx = ppdu_info->mpdu_count[user_id];
+	if (idx >= HAL_RX_MAX_MPDU)
+		return;
+
+	if (ppdu_info->fcs_err)
+		dp_rx_mon_mpdu_drop(mon_pdev_be, ppdu_info, user_id);
+
+	if (ppdu_info->mpdu_q[user_id][idx]) {
+		mon_pdev_be->rx_mon_stats.mpdu_built++;
+		ppdu_info->mpdu_count[user_id]++;
+	}
+	ppdu_info->mpdu_info[user_id].overflow_err = false;
+	ppdu_info->msdu[user_id].first_buffer = 0;
+}
+
+void dp_rx_mon_ppdu_flush(struct dp_pdev *pdev,
+			  struct hal_rx_ppdu_info *ppdu_info,
+			  bool deliver)
+{
+	struct dp_mon_pdev_be *mon_pdev_be =
+			dp_get_be_pdev_from_dp_pdev(pdev)->monitor_pdev_be;
+	uint32_t user_id;
+	uint16_t idx;
+	qdf_nbuf_t nbuf;
+
+	if (deliver) {
+		ppdu_info->rx_status.ppdu_id = ppdu_info->com_info.ppdu_id;
+		ppdu_info->rx_status.device_id = pdev->soc->device_id;
+		ppdu_info->rx_status.chan_noise_floor = pdev->chan_noise_floor;
+	}
+
+	for (user_id = 0; user_id < HAL_MAX_UL_MU_USERS; user_id++) {
+		/* an MPDU still open when the PPDU ends was cut short */
+		idx = ppdu_info->mpdu_count[user_id];
+		if (idx < HAL_RX_MAX_MPDU && ppdu_info->mpdu_q[user_id][idx])
+			dp_rx_mon_mpdu_drop(mon_pdev_be, ppdu_info, user_id);
+
+		for (idx = 0; idx < ppdu_info->mpdu_count[user_id]; idx++) {
+			nbuf = ppdu_info->mpdu_q[user_id][idx];
+			if (!nbuf)
+				continue;
+			ppdu_info->mpdu_q[user_id][idx] = NULL;
+
+			if (!deliver) {
+				qdf_nbuf_free(nbuf);
+				mon_pdev_be->rx_mon_stats.mpdu_drop++;
+				continue;
+			}
+
+			if (!qdf_nbuf_update_radiotap(&ppdu_info->rx_status,
+						      nbuf,
+						      qdf_nbuf_headroom(nbuf))) {
+				qdf_nbuf_free(nbuf);
+				mon_pdev_be->rx_mon_stats.radiotap_fail++;
+				DP_STATS_INC(pdev,
+					     dropped.mon_radiotap_update_err, 1);
+				continue;
+			}
+
+			qdf_nbuf_queue_add(&mon_pdev_be->rx_mon_deliver_q,
+					   nbuf);
+		}
+		ppdu_info->mpdu_count[user_id] = 0;
+	}
+
+	ppdu_info->rx_status.monitor_direct_used = 0;
+}
+
+uint32_t
+dp_rx_mon_process_status_tlv(struct dp_soc *soc,
+			     struct dp_pdev *pdev,
+			     struct hal_mon_desc *mon_ring_desc,
+			     qdf_frag_t status_frag,
+			     union dp_mon_desc_list_elem_t **desc_list,
+			     union dp_mon_desc_list_elem_t **tail)
+{
+	struct dp_mon_pdev *mon_pdev = pdev->monitor_pdev;
+	struct dp_mon_pdev_be *mon_pdev_be =
+			dp_get_be_pdev_from_dp_pdev(pdev)->monitor_pdev_be;
+	struct hal_rx_ppdu_info *ppdu_info = &mon_pdev->ppdu_info;
+	struct dp_mon_desc *mon_desc;
+	uint8_t *rx_tlv = status_frag;
+	uint8_t *rx_tlv_end;
+	uint32_t tlv_status;
+	uint32_t num_pkt_desc = 0;
+	bool assemble;
+
+	mon_pdev_be->rx_mon_stats.status_buf++;
+
+	/* frames are only built when someone is going to consume them */
+	assemble = (mon_pdev->mvdev || mon_pdev_be->rx_mon_replay);
+
+	if (mon_ring_desc->end_offset &&
+	    mon_ring_desc->end_offset < DP_MON_DATA_BUFFER_SIZE)
+		rx_tlv_end = rx_tlv + mon_ring_desc->end_offset;
+	else
+		rx_tlv_end = rx_tlv + DP_MON_DATA_BUFFER_SIZE;
+
+	do {
+		/*
+		 * PPDU_START wipes ppdu_info, release whatever the previous
+		 * PPDU left behind if its end was not seen.
+		 */
+		if (HAL_RX_GET_USER_TLV64_TYPE(rx_tlv) == WIFIRX_PPDU_START_E)
+			dp_rx_mon_ppdu_flush(pdev, ppdu_info, false);
+
+		tlv_status = hal_rx_status_get_tlv_info(rx_tlv, ppdu_info,
+							soc->hal_soc, NULL);
+
+		switch (tlv_status) {
+		case HAL_TLV_STATUS_HEADER:
+			if (assemble)
+				dp_rx_mon_add_hdr_frag(soc, mon_pdev_be,
+						       ppdu_info, status_frag);
+			break;
+		case HAL_TLV_STATUS_MON_BUF_ADDR:
+			mon_desc = dp_rx_mon_add_pkt_frag(soc, mon_pdev_be,
+							  ppdu_info, assemble);
+			if (!mon_desc)
+				break;
+			dp_mon_add_to_free_desc_list(desc_list, tail,
+						     mon_desc);
+			num_pkt_desc++;
+			break;
+		case HAL_TLV_STATUS_MPDU_END:
+			if (assemble)
+				dp_rx_mon_mpdu_end(mon_pdev_be, ppdu_info);
+			break;
+		case HAL_TLV_STATUS_PPDU_DONE:
+			mon_pdev_be->rx_mon_stats.ppdu_done++;
+			dp_rx_mon_ppdu_flush(pdev, ppdu_info, assemble);
+			break;
+		default:
+			break;
+		}
+
+		rx_tlv = hal_rx_status_get_next_tlv(rx_tlv,
+						    mon_pdev->is_tlv_hdr_64_bit);
+	} while (tlv_status != HAL_TLV_STATUS_PPDU_DONE &&
+		 tlv_status != HAL_TLV_STATUS_BUF_DONE &&
+		 rx_tlv < rx_tlv_end);
+
+	return num_pkt_desc;
 }
 
 static inline void
@@ -1934,6 +1934,7 @@ dp_peer_cal_clients_stats_update(struct dp_soc *soc,
 				 struct dp_peer *peer,
 				 void *arg)
 {
+	dp_peer_stats_shards_fold(peer);
 	dp_cal_client_update_peer_stats(&peer->stats);
 }
 
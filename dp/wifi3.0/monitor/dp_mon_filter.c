@@ -279,13 +279,117 @@ void dp_mon_filter_reset_pktlog_hybrid(struct dp_pdev *pdev)
 #endif
 #endif /* WDI_EVENT_ENABLE */
 
+/**
+ * dp_mon_filter_mode_status_tlv_classes() - Status TLV classes a mode uses
+ * @mode: monitor filter mode
+ *
+ * Return: bitmap of HAL_RX_TLV_CLASS_BIT() the mode consumes
+ */
+static uint32_t
+dp_mon_filter_mode_status_tlv_classes(enum dp_mon_filter_mode mode)
+{
+	uint32_t classes = HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_PPDU) |
+			   HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_PHY) |
+			   HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_MPDU);
+
+	switch (mode) {
+#ifdef QCA_ENHANCED_STATS_SUPPORT
+	case DP_MON_FILTER_ENHACHED_STATS_MODE:
+		break;
+#endif
+#ifdef QCA_MCOPY_SUPPORT
+	case DP_MON_FILTER_MCOPY_MODE:
+		classes |= HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_HEADER);
+		break;
+#endif
+#if defined(ATH_SUPPORT_NAC_RSSI) || defined(ATH_SUPPORT_NAC)
+	case DP_MON_FILTER_SMART_MONITOR_MODE:
+		classes |= HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_HEADER);
+		break;
+#endif
+#ifdef WDI_EVENT_ENABLE
+	case DP_MON_FILTER_PKT_LOG_CBF_MODE:
+		classes |= HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_LOCATION);
+		/* fallthrough */
+	case DP_MON_FILTER_PKT_LOG_FULL_MODE:
+	case DP_MON_FILTER_PKT_LOG_LITE_MODE:
+		classes |= HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_HEADER);
+		break;
+#endif
+	default:
+		/* monitor mode, rx capture and anything unknown take all */
+		classes = (1 << HAL_RX_TLV_CLASS_MAX) - 1;
+		break;
+	}
+
+	return classes;
+}
+
+/**
+ * dp_mon_filter_update_status_tlv_skip() - Skip status TLVs nobody uses
+ * @soc: DP soc handle
+ *
+ * The HAL soc is shared by all pdevs, so only the TLV classes that no
+ * valid filter mode of any pdev consumes are skipped. With no mode
+ * active everything is decoded.
+ *
+ * Return: None
+ */
+static void dp_mon_filter_update_status_tlv_skip(struct dp_soc *soc)
+{
+	uint32_t all = (1 << HAL_RX_TLV_CLASS_MAX) - 1;
+	uint32_t used = 0;
+	struct dp_mon_pdev *mon_pdev;
+	struct dp_pdev *pdev;
+	enum dp_mon_filter_mode mode;
+	enum dp_mon_filter_srng_type srng_type;
+	uint8_t i;
+
+	for (i = 0; i < MAX_PDEV_CNT; i++) {
+		pdev = soc->pdev_list[i];
+		if (!pdev || !pdev->monitor_pdev ||
+		    !pdev->monitor_pdev->filter)
+			continue;
+
+		mon_pdev = pdev->monitor_pdev;
+		for (mode = 0; mode < DP_MON_FILTER_MAX_MODE; mode++) {
+			for (srng_type = 0;
+			     srng_type < DP_MON_FILTER_SRNG_TYPE_MAX;
+			     srng_type++) {
+				if (!mon_pdev->filter[mode][srng_type].valid)
+					continue;
+
+				used |= dp_mon_filter_mode_status_tlv_classes(
+									mode);
+				break;
+			}
+		}
+	}
+
+#if defined(WLAN_CFR_ENABLE) && defined(WLAN_ENH_CFR_ENABLE)
+	/* CFR RCC consumes location TLVs without a filter mode of its own */
+	used |= HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_LOCATION);
+#endif
+
+	if (!(used & ~HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_PPDU)))
+		used = all;
+
+	hal_rx_status_tlv_skip_set(soc->hal_soc, all & ~used);
+}
+
 QDF_STATUS dp_mon_filter_update(struct dp_pdev *pdev)
 {
 	struct dp_mon_ops *mon_ops = NULL;
+	QDF_STATUS status;
 
 	mon_ops = dp_mon_ops_get(pdev->soc);
-	if (mon_ops && mon_ops->mon_filter_update)
-		return mon_ops->mon_filter_update(pdev);
+	if (mon_ops && mon_ops->mon_filter_update) {
+		status = mon_ops->mon_filter_update(pdev);
+		if (QDF_IS_STATUS_SUCCESS(status))
+			dp_mon_filter_update_status_tlv_skip(pdev->soc);
+
+		return status;
+	}
 
 	return QDF_STATUS_E_FAILURE;
 }
@@ -917,6 +917,7 @@ static void dp_rx_stats_update(struct dp_pdev *pdev,
 			dp_rx_rate_stats_update(peer, ppdu, i);
 
 #if defined(FEATURE_PERPKT_INFO) && WDI_EVENT_ENABLE
+		dp_peer_stats_shards_fold(peer);
 		dp_wdi_event_handler(WDI_EVENT_UPDATE_DP_STATS, pdev->soc,
 				     &peer->stats, ppdu->peer_id,
 				     UPDATE_PEER_STATS, pdev->pdev_id);
@@ -1034,6 +1034,30 @@ hal_rx_parse_receive_user_info(struct hal_soc *hal_soc, uint8_t *tlv,
 	return HAL_TLV_STATUS_PPDU_NOT_DONE;
 }
 
+/**
+ * hal_rx_status_get_mon_buf_addr() - Extract packet buffer from MON_BUFFER_ADDR
+ * @rx_tlv: MON_BUFFER_ADDR TLV payload
+ * @ppdu_info: PPDU info the packet buffer is recorded in
+ *
+ * The status buffer only points at the packet buffer, so the MPDU payload
+ * can be attached to the MPDU nbuf as a frag without being copied.
+ *
+ * Return: None
+ */
+static inline void
+hal_rx_status_get_mon_buf_addr(void *rx_tlv,
+			       struct hal_rx_ppdu_info *ppdu_info)
+{
+	struct mon_buffer_addr *addr = (struct mon_buffer_addr *)rx_tlv;
+
+	ppdu_info->packet_info.sw_cookie =
+		((uint64_t)addr->buffer_virt_addr_63_32 << 32) |
+		addr->buffer_virt_addr_31_0;
+	ppdu_info->packet_info.dma_length = addr->dma_length;
+	ppdu_info->packet_info.msdu_continuation = addr->msdu_continuation;
+	ppdu_info->packet_info.truncated = addr->truncated;
+}
+
 /**
  * hal_rx_status_get_tlv_info() - process receive info TLV
  * @rx_tlv_hdr: pointer to TLV header
@@ -1046,6 +1070,104 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 				      hal_soc_handle_t hal_soc_hdl,
 				      qdf_nbuf_t nbuf)
 {
+	static const struct hal_rx_status_tlv_field end_info_fields[] = {
+		HAL_RX_TLV_FIELD_64(RXPCU_PPDU_END_INFO, RX_ANTENNA,
+				    rx_status.rx_antenna),
+		HAL_RX_TLV_FIELD_64(UNIFIED_RXPCU_PPDU_END_INFO_8,
+				    RX_PPDU_DURATION, rx_status.duration),
+	};
+	static const struct hal_rx_status_tlv_field user_stats_fields[] = {
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS, AST_INDEX,
+				    rx_status.ast_index),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS, UDP_MSDU_COUNT,
+				    rx_status.udp_msdu_count),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS, OTHER_MSDU_COUNT,
+				    rx_status.other_msdu_count),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS, MPDU_CNT_FCS_OK,
+				    com_info.mpdu_cnt_fcs_ok),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS, MPDU_CNT_FCS_ERR,
+				    com_info.mpdu_cnt_fcs_err),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS, FCS_OK_BITMAP_31_0,
+				    com_info.mpdu_fcs_ok_bitmap[0]),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS,
+				    FCS_OK_BITMAP_63_32,
+				    com_info.mpdu_fcs_ok_bitmap[1]),
+	};
+	static const struct hal_rx_status_tlv_field user_stats_ext_fields[] = {
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS_EXT,
+				    FCS_OK_BITMAP_95_64,
+				    com_info.mpdu_fcs_ok_bitmap[2]),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS_EXT,
+				    FCS_OK_BITMAP_127_96,
+				    com_info.mpdu_fcs_ok_bitmap[3]),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS_EXT,
+				    FCS_OK_BITMAP_159_128,
+				    com_info.mpdu_fcs_ok_bitmap[4]),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS_EXT,
+				    FCS_OK_BITMAP_191_160,
+				    com_info.mpdu_fcs_ok_bitmap[5]),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS_EXT,
+				    FCS_OK_BITMAP_223_192,
+				    com_info.mpdu_fcs_ok_bitmap[6]),
+		HAL_RX_TLV_FIELD_64(RX_PPDU_END_USER_STATS_EXT,
+				    FCS_OK_BITMAP_255_224,
+				    com_info.mpdu_fcs_ok_bitmap[7]),
+	};
+	static const struct hal_rx_status_tlv_desc descs[HAL_RX_TLV_DESC_MAX] = {
+		[HAL_RX_TLV_DESC_DEFAULT] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_PPDU),
+		[HAL_RX_TLV_DESC_PHY] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_PHY),
+		[HAL_RX_TLV_DESC_MPDU] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_MPDU),
+		[HAL_RX_TLV_DESC_HEADER] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_HEADER),
+		[HAL_RX_TLV_DESC_LOCATION] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_LOCATION),
+		[HAL_RX_TLV_DESC_PPDU_END_INFO] =
+			HAL_RX_TLV_DESC(HAL_RX_TLV_CLASS_PPDU, end_info_fields,
+					HAL_TLV_STATUS_PPDU_NOT_DONE, 1),
+		[HAL_RX_TLV_DESC_USER_STATS] =
+			HAL_RX_TLV_DESC(HAL_RX_TLV_CLASS_PPDU,
+					user_stats_fields,
+					HAL_TLV_STATUS_PPDU_NOT_DONE, 1),
+		[HAL_RX_TLV_DESC_USER_STATS_EXT] =
+			HAL_RX_TLV_DESC(HAL_RX_TLV_CLASS_PPDU,
+					user_stats_ext_fields,
+					HAL_TLV_STATUS_PPDU_NOT_DONE, 0),
+		[HAL_RX_TLV_DESC_STATUS_DONE] =
+			HAL_RX_TLV_DESC_STATUS(HAL_TLV_STATUS_PPDU_DONE),
+	};
+	/*
+	 * DUMMY carries the packet buffer address; it is not listed so it
+	 * maps to HAL_RX_TLV_DESC_DEFAULT and its handler returns BUF_DONE
+	 */
+	static const uint8_t tag_map[HAL_RX_STATUS_TLV_TAG_MAX] = {
+		[WIFIRXPCU_PPDU_END_INFO_E] = HAL_RX_TLV_DESC_PPDU_END_INFO,
+		[WIFIRX_PPDU_END_USER_STATS_E] = HAL_RX_TLV_DESC_USER_STATS,
+		[WIFIRX_PPDU_END_USER_STATS_EXT_E] =
+					HAL_RX_TLV_DESC_USER_STATS_EXT,
+		[WIFIRX_PPDU_END_STATUS_DONE_E] = HAL_RX_TLV_DESC_STATUS_DONE,
+		[WIFIPHYRX_LOCATION_E] = HAL_RX_TLV_DESC_LOCATION,
+		[WIFIPHYRX_HT_SIG_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_L_SIG_B_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_L_SIG_A_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_VHT_SIG_A_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_A_SU_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_A_MU_DL_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_B1_MU_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_B2_MU_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_B2_OFDMA_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_RSSI_LEGACY_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_OTHER_RECEIVE_INFO_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_GENERIC_U_SIG_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_COMMON_USER_INFO_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIRX_HEADER_E] = HAL_RX_TLV_DESC_HEADER,
+		[WIFIRX_MPDU_START_E] = HAL_RX_TLV_DESC_MPDU,
+		[WIFIRX_MPDU_END_E] = HAL_RX_TLV_DESC_MPDU,
+		[WIFIRX_MSDU_END_E] = HAL_RX_TLV_DESC_MPDU,
+	};
+	const struct hal_rx_status_tlv_desc *desc;
 	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
 	uint32_t tlv_tag, user_id, tlv_len, value;
 	uint8_t group_id = 0;
@@ -1064,9 +1186,20 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 
 	rx_tlv = (uint8_t *)rx_tlv_hdr + HAL_RX_TLV64_HDR_SIZE;
 
+	desc = hal_rx_status_tlv_lookup(hal, tag_map, descs, tlv_tag);
+	if (!desc)
+		return HAL_TLV_STATUS_PPDU_NOT_DONE;
+
 	qdf_trace_hex_dump(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_DEBUG,
 			   rx_tlv, tlv_len);
 
+	/* fields copied straight into ppdu_info come from the table, the
+	 * handlers below only deal with what needs computing
+	 */
+	hal_rx_status_tlv_decode_fields(desc, rx_tlv, ppdu_info);
+	if (!desc->decode_more)
+		return desc->status;
+
 	switch (tlv_tag) {
 	case WIFIRX_PPDU_START_E:
 	{
@@ -1126,17 +1259,12 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 		break;
 
 	case WIFIRXPCU_PPDU_END_INFO_E:
-		ppdu_info->rx_status.rx_antenna =
-			HAL_RX_GET_64(rx_tlv, RXPCU_PPDU_END_INFO, RX_ANTENNA);
 		ppdu_info->rx_status.tsft =
 			HAL_RX_GET_64(rx_tlv, RXPCU_PPDU_END_INFO,
 				      WB_TIMESTAMP_UPPER_32);
 		ppdu_info->rx_status.tsft = (ppdu_info->rx_status.tsft << 32) |
 			HAL_RX_GET_64(rx_tlv, RXPCU_PPDU_END_INFO,
 				      WB_TIMESTAMP_LOWER_32);
-		ppdu_info->rx_status.duration =
-			HAL_RX_GET_64(rx_tlv, UNIFIED_RXPCU_PPDU_END_INFO_8,
-				      RX_PPDU_DURATION);
 		hal_rx_get_bb_info(hal_soc_hdl, rx_tlv, ppdu_info);
 		break;
 
@@ -1149,10 +1277,6 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 		unsigned long tid = 0;
 		uint16_t seq = 0;
 
-		ppdu_info->rx_status.ast_index =
-				HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
-					      AST_INDEX);
-
 		tid = HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
 				    RECEIVED_QOS_DATA_TID_BITMAP);
 		ppdu_info->rx_status.tid = qdf_find_first_bit(&tid,
@@ -1166,12 +1290,6 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 				      TCP_MSDU_COUNT) +
 			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
 				      TCP_ACK_MSDU_COUNT);
-		ppdu_info->rx_status.udp_msdu_count =
-			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
-				      UDP_MSDU_COUNT);
-		ppdu_info->rx_status.other_msdu_count =
-			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
-				      OTHER_MSDU_COUNT);
 
 		if (ppdu_info->sw_frame_group_id
 		    != HAL_MPDU_SW_FRAME_GROUP_NULL_DATA) {
@@ -1215,12 +1333,6 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 			break;
 		}
 
-		ppdu_info->com_info.mpdu_cnt_fcs_ok =
-			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
-				      MPDU_CNT_FCS_OK);
-		ppdu_info->com_info.mpdu_cnt_fcs_err =
-			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
-				      MPDU_CNT_FCS_ERR);
 		if ((ppdu_info->com_info.mpdu_cnt_fcs_ok |
 			ppdu_info->com_info.mpdu_cnt_fcs_err) > 1)
 			ppdu_info->rx_status.rs_flags |= IEEE80211_AMPDU_FLAG;
@@ -1228,14 +1340,6 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 			ppdu_info->rx_status.rs_flags &=
 				(~IEEE80211_AMPDU_FLAG);
 
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[0] =
-				HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
-					      FCS_OK_BITMAP_31_0);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[1] =
-				HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS,
-					      FCS_OK_BITMAP_63_32);
-
 		if (user_id < HAL_MAX_UL_MU_USERS) {
 			mon_rx_user_status =
 				&ppdu_info->rx_user_status[user_id];
@@ -1251,35 +1355,6 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 		break;
 	}
 
-	case WIFIRX_PPDU_END_USER_STATS_EXT_E:
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[2] =
-			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS_EXT,
-				      FCS_OK_BITMAP_95_64);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[3] =
-			 HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS_EXT,
-				       FCS_OK_BITMAP_127_96);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[4] =
-			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS_EXT,
-				      FCS_OK_BITMAP_159_128);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[5] =
-			 HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS_EXT,
-				       FCS_OK_BITMAP_191_160);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[6] =
-			HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS_EXT,
-				      FCS_OK_BITMAP_223_192);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[7] =
-			 HAL_RX_GET_64(rx_tlv, RX_PPDU_END_USER_STATS_EXT,
-				       FCS_OK_BITMAP_255_224);
-		break;
-
-	case WIFIRX_PPDU_END_STATUS_DONE_E:
-		return HAL_TLV_STATUS_PPDU_DONE;
-
 	case WIFIPHYRX_PKT_END_E:
 		break;
 
@@ -2154,6 +2229,8 @@ hal_rx_status_get_tlv_info_generic_be(void *rx_tlv_hdr, void *ppduinfo,
 		}
 	case WIFIMON_BUFFER_ADDR_E:
 	{
+		ppdu_info->user_id = user_id;
+		hal_rx_status_get_mon_buf_addr(rx_tlv, ppdu_info);
 		return HAL_TLV_STATUS_MON_BUF_ADDR;
 	}
 	case 0:
@@ -27,6 +27,7 @@
 #include "hif.h"
 #include "hif_io32.h"
 #include "qdf_platform.h"
+#include "qdf_func_tracker.h"
 
 #ifdef DUMP_REO_QUEUE_INFO_IN_DDR
 #include "hal_hw_headers.h"
@@ -2135,6 +2136,7 @@ static inline void
 hal_srng_access_end_unlocked(void *hal_soc, hal_ring_handle_t hal_ring_hdl)
 {
 	struct hal_srng *srng = (struct hal_srng *)hal_ring_hdl;
+	qdf_prof_ts_t prof_ts = qdf_prof_start();
 
 	/* TODO: See if we need a write memory barrier here */
 	if (srng->flags & HAL_SRNG_LMAC_RING) {
@@ -2160,6 +2162,8 @@ hal_srng_access_end_unlocked(void *hal_soc, hal_ring_handle_t hal_ring_hdl)
 						     srng->u.dst_ring.tp_addr,
 						     srng->u.dst_ring.tp);
 	}
+
+	qdf_prof_end(QDF_PROF_HAL_SRNG_ACCESS_END, prof_ts);
 }
 
 /* hal_srng_access_end_unlocked already handles endianness conversion,
@@ -1264,6 +1264,234 @@ hal_rx_status_get_next_tlv(uint8_t *rx_tlv, bool is_tlv_hdr_64_bit) {
 					       tlv_hdr_size);
 }
 
+/* TLV tags are 9 bits wide in both the 32 and the 64 bit TLV header */
+#define HAL_RX_STATUS_TLV_TAG_MAX 512
+
+/**
+ * enum hal_rx_status_tlv_class - Status TLV classes that can be skipped
+ * @HAL_RX_TLV_CLASS_PPDU: PPDU start/end and user stats, never skipped
+ * @HAL_RX_TLV_CLASS_PHY: L-SIG/HT/VHT/HE/EHT SIG and RSSI TLVs
+ * @HAL_RX_TLV_CLASS_MPDU: MPDU start/end and MSDU end TLVs
+ * @HAL_RX_TLV_CLASS_HEADER: RX_HEADER TLV carrying the 802.11 header
+ * @HAL_RX_TLV_CLASS_LOCATION: RTT/CFR location TLV, PHYRX_LOCATION on BE
+ *			       and PHYRX_PKT_END on LI
+ * @HAL_RX_TLV_CLASS_MAX: number of classes
+ */
+enum hal_rx_status_tlv_class {
+	HAL_RX_TLV_CLASS_PPDU,
+	HAL_RX_TLV_CLASS_PHY,
+	HAL_RX_TLV_CLASS_MPDU,
+	HAL_RX_TLV_CLASS_HEADER,
+	HAL_RX_TLV_CLASS_LOCATION,
+	HAL_RX_TLV_CLASS_MAX,
+};
+
+#define HAL_RX_TLV_CLASS_BIT(_class) (1 << (_class))
+
+/**
+ * enum hal_rx_status_tlv_desc_idx - Index into the per-chip descriptors
+ * @HAL_RX_TLV_DESC_DEFAULT: PPDU class tag decoded by its handler only
+ * @HAL_RX_TLV_DESC_PHY: PHY class tag decoded by its handler only
+ * @HAL_RX_TLV_DESC_MPDU: MPDU class tag decoded by its handler only
+ * @HAL_RX_TLV_DESC_HEADER: RX_HEADER
+ * @HAL_RX_TLV_DESC_LOCATION: RTT/CFR location tag
+ * @HAL_RX_TLV_DESC_PPDU_END_INFO: RXPCU_PPDU_END_INFO
+ * @HAL_RX_TLV_DESC_USER_STATS: RX_PPDU_END_USER_STATS
+ * @HAL_RX_TLV_DESC_USER_STATS_EXT: RX_PPDU_END_USER_STATS_EXT
+ * @HAL_RX_TLV_DESC_STATUS_DONE: RX_PPDU_END_STATUS_DONE
+ * @HAL_RX_TLV_DESC_BUF_DONE: TLV closing the status buffer
+ * @HAL_RX_TLV_DESC_MAX: number of descriptors
+ */
+enum hal_rx_status_tlv_desc_idx {
+	HAL_RX_TLV_DESC_DEFAULT,
+	HAL_RX_TLV_DESC_PHY,
+	HAL_RX_TLV_DESC_MPDU,
+	HAL_RX_TLV_DESC_HEADER,
+	HAL_RX_TLV_DESC_LOCATION,
+	HAL_RX_TLV_DESC_PPDU_END_INFO,
+	HAL_RX_TLV_DESC_USER_STATS,
+	HAL_RX_TLV_DESC_USER_STATS_EXT,
+	HAL_RX_TLV_DESC_STATUS_DONE,
+	HAL_RX_TLV_DESC_BUF_DONE,
+	HAL_RX_TLV_DESC_MAX,
+};
+
+/**
+ * struct hal_rx_status_tlv_field - One status TLV field copied by table
+ * @mask: mask of the field within the TLV word
+ * @dst: offset of the destination member in struct hal_rx_ppdu_info
+ * @word: index of the TLV word holding the field
+ * @lsb: shift of the field within the TLV word
+ * @size: size of the destination member, 1, 2 or 4 bytes
+ * @wide: TLV word is 64 bits wide
+ */
+struct hal_rx_status_tlv_field {
+	uint64_t mask;
+	uint32_t dst;
+	uint16_t word;
+	uint8_t lsb;
+	uint8_t size:4,
+		wide:1;
+};
+
+#define HAL_RX_TLV_FIELD_DST(_member) \
+	.dst = offsetof(struct hal_rx_ppdu_info, _member), \
+	.size = sizeof(((struct hal_rx_ppdu_info *)0)->_member)
+
+/* field of a TLV laid out in 32 bit words, read as HAL_RX_GET() would */
+#define HAL_RX_TLV_FIELD(_block, _field, _member) \
+	{ .mask = HAL_RX_MASK(_block, _field), \
+	  .word = HAL_RX_OFFSET(_block, _field) >> 2, \
+	  .lsb = HAL_RX_LSB(_block, _field), \
+	  .wide = 0, \
+	  HAL_RX_TLV_FIELD_DST(_member) }
+
+/* field of a TLV laid out in 64 bit words, read as HAL_RX_GET_64() would */
+#define HAL_RX_TLV_FIELD_64(_block, _field, _member) \
+	{ .mask = HAL_RX_MASK(_block, _field), \
+	  .word = HAL_RX_OFFSET(_block, _field) >> 3, \
+	  .lsb = HAL_RX_LSB(_block, _field), \
+	  .wide = 1, \
+	  HAL_RX_TLV_FIELD_DST(_member) }
+
+/**
+ * struct hal_rx_status_tlv_desc - Decode descriptor of a status TLV tag
+ * @fields: fields copied straight into struct hal_rx_ppdu_info
+ * @num_fields: number of entries in @fields
+ * @tlv_class: enum hal_rx_status_tlv_class of the tag
+ * @status: HAL_TLV_STATUS_* returned once the fields are copied
+ * @decode_more: tag still needs its per-tag handler after the fields
+ *
+ * The per-chip decoder maps a TLV tag to one of these through a sparse
+ * tag index table; index 0 is the default descriptor for tags that only
+ * have a handler.
+ */
+struct hal_rx_status_tlv_desc {
+	const struct hal_rx_status_tlv_field *fields;
+	uint8_t num_fields;
+	uint8_t tlv_class;
+	uint8_t status;
+	uint8_t decode_more;
+};
+
+#define HAL_RX_TLV_DESC(_class, _fields, _status, _more) \
+	{ .fields = _fields, \
+	  .num_fields = sizeof(_fields) / sizeof((_fields)[0]), \
+	  .tlv_class = _class, \
+	  .status = _status, \
+	  .decode_more = _more }
+
+#define HAL_RX_TLV_DESC_HANDLER(_class) \
+	{ .fields = NULL, \
+	  .num_fields = 0, \
+	  .tlv_class = _class, \
+	  .status = HAL_TLV_STATUS_PPDU_NOT_DONE, \
+	  .decode_more = 1 }
+
+#define HAL_RX_TLV_DESC_STATUS(_status) \
+	{ .fields = NULL, \
+	  .num_fields = 0, \
+	  .tlv_class = HAL_RX_TLV_CLASS_PPDU, \
+	  .status = _status, \
+	  .decode_more = 0 }
+
+/**
+ * hal_rx_status_tlv_decode_fields() - Copy the table fields of a TLV
+ * @desc: decode descriptor of the TLV tag
+ * @rx_tlv: TLV payload
+ * @ppdu_info: PPDU info to fill
+ *
+ * Return: None
+ */
+static inline void
+hal_rx_status_tlv_decode_fields(const struct hal_rx_status_tlv_desc *desc,
+				void *rx_tlv,
+				struct hal_rx_ppdu_info *ppdu_info)
+{
+	const struct hal_rx_status_tlv_field *field = desc->fields;
+	uint8_t *base = (uint8_t *)ppdu_info;
+	uint64_t value;
+	uint8_t i;
+
+	for (i = 0; i < desc->num_fields; i++, field++) {
+		if (field->wide)
+			value = *((uint64_t *)rx_tlv + field->word);
+		else
+			value = *((uint32_t *)rx_tlv + field->word);
+
+		value = (value & field->mask) >> field->lsb;
+
+		switch (field->size) {
+		case 1:
+			*(uint8_t *)(base + field->dst) = value;
+			break;
+		case 2:
+			*(uint16_t *)(base + field->dst) = value;
+			break;
+		default:
+			*(uint32_t *)(base + field->dst) = value;
+			break;
+		}
+	}
+}
+
+/**
+ * hal_rx_status_tlv_lookup() - Find the decode descriptor of a TLV tag
+ * @hal_soc: HAL soc
+ * @tag_map: per-chip tag to descriptor index table
+ * @descs: per-chip descriptor table, entry 0 is the default
+ * @tlv_tag: TLV tag
+ *
+ * Return: descriptor, or NULL if the tag belongs to a skipped class
+ */
+static inline const struct hal_rx_status_tlv_desc *
+hal_rx_status_tlv_lookup(struct hal_soc *hal_soc, const uint8_t *tag_map,
+			 const struct hal_rx_status_tlv_desc *descs,
+			 uint32_t tlv_tag)
+{
+	const struct hal_rx_status_tlv_desc *desc;
+
+	desc = &descs[tag_map[tlv_tag & (HAL_RX_STATUS_TLV_TAG_MAX - 1)]];
+	if (qdf_unlikely(hal_soc->rx_status_tlv_skip &
+			 HAL_RX_TLV_CLASS_BIT(desc->tlv_class)))
+		return NULL;
+
+	return desc;
+}
+
+/**
+ * hal_rx_status_tlv_skip_set() - Set the status TLV classes not decoded
+ * @hal_soc_hdl: HAL soc handle
+ * @skip: bitmap of HAL_RX_TLV_CLASS_BIT() of the classes to skip
+ *
+ * Set by DP from the active monitor filters; PPDU class TLVs are always
+ * decoded.
+ *
+ * Return: None
+ */
+static inline void
+hal_rx_status_tlv_skip_set(hal_soc_handle_t hal_soc_hdl, uint32_t skip)
+{
+	struct hal_soc *hal_soc = (struct hal_soc *)hal_soc_hdl;
+
+	hal_soc->rx_status_tlv_skip =
+		skip & ~HAL_RX_TLV_CLASS_BIT(HAL_RX_TLV_CLASS_PPDU);
+}
+
+/**
+ * hal_rx_status_tlv_skip_get() - Get the status TLV classes not decoded
+ * @hal_soc_hdl: HAL soc handle
+ *
+ * Return: bitmap of HAL_RX_TLV_CLASS_BIT() of the skipped classes
+ */
+static inline uint32_t
+hal_rx_status_tlv_skip_get(hal_soc_handle_t hal_soc_hdl)
+{
+	struct hal_soc *hal_soc = (struct hal_soc *)hal_soc_hdl;
+
+	return hal_soc->rx_status_tlv_skip;
+}
+
 /**
  * hal_rx_proc_phyrx_other_receive_info_tlv()
  *				    - process other receive info TLV
@@ -1304,6 +1532,33 @@ hal_rx_status_get_tlv_info(void *rx_tlv_hdr, void *ppdu_info,
 						nbuf);
 }
 
+#ifdef WLAN_HAL_RX_STATUS_TLV_BENCHMARK
+/**
+ * hal_rx_status_tlv_benchmark() - Time the status TLV decoder
+ * @hal_soc_hdl: HAL soc handle
+ * @bufs: captured status buffers, each hal_get_rx_status_buf_size() long
+ * @num_bufs: number of buffers in @bufs
+ * @is_tlv_hdr_64_bit: status buffers use the 64 bit TLV header
+ * @rounds: number of times the buffers are replayed
+ *
+ * Replays the buffers through hal_rx_status_get_tlv_info() once with
+ * every TLV class decoded and once with the skip mask set from the
+ * active monitor filters, and logs the TLV rate of each pass.
+ *
+ * Return: None
+ */
+void hal_rx_status_tlv_benchmark(hal_soc_handle_t hal_soc_hdl,
+				 uint8_t **bufs, uint32_t num_bufs,
+				 bool is_tlv_hdr_64_bit, uint32_t rounds);
+#else
+static inline
+void hal_rx_status_tlv_benchmark(hal_soc_handle_t hal_soc_hdl,
+				 uint8_t **bufs, uint32_t num_bufs,
+				 bool is_tlv_hdr_64_bit, uint32_t rounds)
+{
+}
+#endif
+
 static inline
 uint32_t hal_get_rx_status_done_tlv_size(hal_soc_handle_t hal_soc_hdl)
 {
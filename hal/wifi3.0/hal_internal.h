@@ -1158,6 +1158,8 @@ struct hal_soc {
 #endif
 	/* flag to indicate cmn dmac rings in berryllium */
 	bool dmac_cmn_src_rxbuf_ring;
+	/* status TLV classes not decoded, see hal_rx_status_tlv_skip_set */
+	uint32_t rx_status_tlv_skip;
 };
 
 #if defined(FEATURE_HAL_DELAYED_REG_WRITE)
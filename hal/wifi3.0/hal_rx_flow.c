@@ -18,6 +18,7 @@
 #include "qdf_module.h"
 #include "dp_types.h"
 #include "hal_rx_flow.h"
+#include "hal_rx_hw_defines.h"
 
 /**
  * hal_rx_flow_get_cmem_fse() - Get FSE from CMEM
@@ -136,6 +137,159 @@ void hal_rx_dump_cmem_fse(hal_soc_handle_t hal_soc_hdl, uint32_t fse_offset,
 }
 #endif
 
+/* number of FST entries tracked by one word of the occupancy bitmap */
+#define HAL_RX_FST_OCCUPANCY_BITS (sizeof(unsigned long) * 8)
+
+/**
+ * hal_rx_flow_fingerprint() - Compute a 32-bit fingerprint of a flow tuple
+ * @tuple: flow tuple
+ *
+ * The fingerprint is only used to reject non-matching shadow entries
+ * without comparing the full tuple; equal fingerprints are always confirmed
+ * by hal_rx_flow_tuple_equal().
+ *
+ * Return: fingerprint
+ */
+static inline uint32_t
+hal_rx_flow_fingerprint(struct hal_flow_tuple_info *tuple)
+{
+	uint32_t words[] = {
+		tuple->dest_ip_127_96, tuple->dest_ip_95_64,
+		tuple->dest_ip_63_32, tuple->dest_ip_31_0,
+		tuple->src_ip_127_96, tuple->src_ip_95_64,
+		tuple->src_ip_63_32, tuple->src_ip_31_0,
+		((uint32_t)tuple->dest_port << 16) | tuple->src_port,
+		tuple->l4_protocol,
+	};
+	uint32_t fp = 0x811c9dc5;
+	int i;
+
+	for (i = 0; i < QDF_ARRAY_SIZE(words); i++) {
+		fp ^= words[i];
+		fp *= 0x9e3779b1;
+		fp ^= fp >> 15;
+	}
+
+	return fp;
+}
+
+/**
+ * hal_rx_flow_tuple_equal() - Compare two flow tuples field by field
+ * @a: first tuple
+ * @b: second tuple
+ *
+ * Return: true if all 5-tuple fields match
+ */
+static inline bool
+hal_rx_flow_tuple_equal(struct hal_flow_tuple_info *a,
+			struct hal_flow_tuple_info *b)
+{
+	return a->dest_ip_127_96 == b->dest_ip_127_96 &&
+	       a->dest_ip_95_64 == b->dest_ip_95_64 &&
+	       a->dest_ip_63_32 == b->dest_ip_63_32 &&
+	       a->dest_ip_31_0 == b->dest_ip_31_0 &&
+	       a->src_ip_127_96 == b->src_ip_127_96 &&
+	       a->src_ip_95_64 == b->src_ip_95_64 &&
+	       a->src_ip_63_32 == b->src_ip_63_32 &&
+	       a->src_ip_31_0 == b->src_ip_31_0 &&
+	       a->dest_port == b->dest_port &&
+	       a->src_port == b->src_port &&
+	       a->l4_protocol == b->l4_protocol;
+}
+
+/**
+ * hal_rx_fst_shadow_set() - Record a newly programmed FST entry in the shadow
+ * @fst: Pointer to the Rx Flow Search Table
+ * @idx: index of the entry in the FST
+ * @tuple: tuple programmed at @idx
+ *
+ * Return: None
+ */
+static void hal_rx_fst_shadow_set(struct hal_rx_fst *fst, uint32_t idx,
+				  struct hal_flow_tuple_info *tuple)
+{
+	if (qdf_unlikely(idx >= fst->max_entries))
+		return;
+
+	fst->shadow_tuple[idx] = *tuple;
+	fst->shadow_fp[idx] = hal_rx_flow_fingerprint(tuple);
+	qdf_set_bit(idx, fst->shadow_occupancy);
+}
+
+/**
+ * hal_rx_fst_shadow_clear() - Drop a deleted FST entry from the shadow
+ * @fst: Pointer to the Rx Flow Search Table
+ * @idx: index of the entry in the FST
+ *
+ * Return: None
+ */
+static void hal_rx_fst_shadow_clear(struct hal_rx_fst *fst, uint32_t idx)
+{
+	if (qdf_unlikely(idx >= fst->max_entries))
+		return;
+
+	qdf_clear_bit(idx, fst->shadow_occupancy);
+}
+
+/**
+ * hal_rx_fst_shadow_match() - Check a shadow entry against a flow tuple
+ * @fst: Pointer to the Rx Flow Search Table
+ * @idx: index of the entry in the FST
+ * @tuple: tuple to match
+ * @fp: fingerprint of @tuple
+ *
+ * Return: true if the entry is valid and holds @tuple
+ */
+static inline bool
+hal_rx_fst_shadow_match(struct hal_rx_fst *fst, uint32_t idx,
+			struct hal_flow_tuple_info *tuple, uint32_t fp)
+{
+	return fst->shadow_fp[idx] == fp &&
+	       hal_rx_flow_tuple_equal(&fst->shadow_tuple[idx], tuple);
+}
+
+/**
+ * hal_rx_fst_shadow_alloc() - Allocate the cached shadow of the FST
+ * @fst: Pointer to the Rx Flow Search Table
+ *
+ * Return: QDF_STATUS_SUCCESS or QDF_STATUS_E_NOMEM
+ */
+static QDF_STATUS hal_rx_fst_shadow_alloc(struct hal_rx_fst *fst)
+{
+	uint32_t words = (fst->max_entries + HAL_RX_FST_OCCUPANCY_BITS - 1) /
+			 HAL_RX_FST_OCCUPANCY_BITS;
+
+	fst->shadow_fp = qdf_mem_malloc(fst->max_entries * sizeof(uint32_t));
+	fst->shadow_tuple = qdf_mem_valloc(fst->max_entries *
+					   sizeof(struct hal_flow_tuple_info));
+	fst->shadow_occupancy = qdf_mem_malloc(words * sizeof(unsigned long));
+
+	if (!fst->shadow_fp || !fst->shadow_tuple || !fst->shadow_occupancy)
+		return QDF_STATUS_E_NOMEM;
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * hal_rx_fst_shadow_free() - Free the cached shadow of the FST
+ * @fst: Pointer to the Rx Flow Search Table
+ *
+ * Return: None
+ */
+static void hal_rx_fst_shadow_free(struct hal_rx_fst *fst)
+{
+	if (fst->shadow_occupancy)
+		qdf_mem_free(fst->shadow_occupancy);
+	if (fst->shadow_tuple)
+		qdf_mem_vfree(fst->shadow_tuple);
+	if (fst->shadow_fp)
+		qdf_mem_free(fst->shadow_fp);
+
+	fst->shadow_occupancy = NULL;
+	fst->shadow_tuple = NULL;
+	fst->shadow_fp = NULL;
+}
+
 /**
  * hal_rx_flow_setup_fse() - Setup a flow search entry in HW FST
  * @fst: Pointer to the Rx Flow Search Table
@@ -150,14 +304,18 @@ hal_rx_flow_setup_fse(hal_soc_handle_t hal_soc_hdl,
 		      struct hal_rx_flow *flow)
 {
 	struct hal_soc *hal_soc = (struct hal_soc *)hal_soc_hdl;
+	void *fse;
 
-	if (hal_soc->ops->hal_rx_flow_setup_fse) {
-		return hal_soc->ops->hal_rx_flow_setup_fse((uint8_t *)fst,
-							   table_offset,
-							   (uint8_t *)flow);
-	}
+	if (!hal_soc->ops->hal_rx_flow_setup_fse)
+		return NULL;
 
-	return NULL;
+	fse = hal_soc->ops->hal_rx_flow_setup_fse((uint8_t *)fst,
+						  table_offset,
+						  (uint8_t *)flow);
+	if (fse)
+		hal_rx_fst_shadow_set(fst, table_offset, &flow->tuple_info);
+
+	return fse;
 }
 qdf_export_symbol(hal_rx_flow_setup_fse);
 
@@ -186,6 +344,37 @@ hal_rx_flow_setup_cmem_fse(hal_soc_handle_t hal_soc_hdl, uint32_t cmem_ba,
 }
 qdf_export_symbol(hal_rx_flow_setup_cmem_fse);
 
+/**
+ * hal_rx_flow_setup_cmem_fse_shadow() - Setup a flow search entry in HW
+ *					 CMEM FST and record it in the shadow
+ * @hal_soc_hdl: HAL SOC handle
+ * @fst: Pointer to the Rx Flow Search Table whose shadow tracks the CMEM FST
+ * @cmem_ba: CMEM base address
+ * @table_offset: offset into the table where the flow is to be setup
+ * @flow: Flow Parameters
+ *
+ * CMEM entries are replaced in place by setting up another flow at the
+ * same offset, which overwrites the shadow entry as well.
+ *
+ * Return: Success/Failure
+ */
+uint32_t
+hal_rx_flow_setup_cmem_fse_shadow(hal_soc_handle_t hal_soc_hdl,
+				  struct hal_rx_fst *fst, uint32_t cmem_ba,
+				  uint32_t table_offset,
+				  struct hal_rx_flow *flow)
+{
+	uint32_t fse_offset;
+
+	fse_offset = hal_rx_flow_setup_cmem_fse(hal_soc_hdl, cmem_ba,
+						table_offset, flow);
+	if (fse_offset)
+		hal_rx_fst_shadow_set(fst, table_offset, &flow->tuple_info);
+
+	return fse_offset;
+}
+qdf_export_symbol(hal_rx_flow_setup_cmem_fse_shadow);
+
 /**
  * hal_rx_flow_get_cmem_fse_timestamp() - Get timestamp field from CMEM FSE
  * @hal_soc_hdl: HAL SOC handle
@@ -224,6 +413,11 @@ hal_rx_flow_delete_entry(struct hal_rx_fst *fst, void *hal_rx_fse)
 
 	HAL_CLR_FLD(fse, HAL_RX_FLOW_SEARCH_ENTRY, VALID);
 
+	if (fst && fse >= fst->base_vaddr &&
+	    fse < fst->base_vaddr + fst->max_entries * HAL_RX_FST_ENTRY_SIZE)
+		hal_rx_fst_shadow_clear(fst, (fse - fst->base_vaddr) /
+					     HAL_RX_FST_ENTRY_SIZE);
+
 	return QDF_STATUS_SUCCESS;
 }
 qdf_export_symbol(hal_rx_flow_delete_entry);
@@ -464,6 +658,18 @@ hal_rx_fst_attach(qdf_device_t qdf_dev,
 	qdf_mem_set((uint8_t *)fst->base_vaddr,
 		    (fst->max_entries * HAL_RX_FST_ENTRY_SIZE), 0);
 
+	if (QDF_IS_STATUS_ERROR(hal_rx_fst_shadow_alloc(fst))) {
+		QDF_TRACE(QDF_MODULE_ID_TXRX, QDF_TRACE_LEVEL_ERROR,
+			  FL("hal fst shadow allocation failed"));
+		hal_rx_fst_shadow_free(fst);
+		qdf_mem_free_consistent(qdf_dev, qdf_dev->dev,
+					fst->max_entries *
+					HAL_RX_FST_ENTRY_SIZE,
+					fst->base_vaddr, fst->base_paddr, 0);
+		qdf_mem_free(fst);
+		return NULL;
+	}
+
 	hal_rx_fst_key_configure(fst);
 	hal_flow_toeplitz_create_cache(fst);
 	*hal_fst_base_paddr = (uint64_t)fst->base_paddr;
@@ -485,6 +691,8 @@ void hal_rx_fst_detach(struct hal_rx_fst *rx_fst,
 	if (!rx_fst || !qdf_dev)
 		return;
 
+	hal_rx_fst_shadow_free(rx_fst);
+
 	qdf_mem_free_consistent(qdf_dev, qdf_dev->dev,
 				rx_fst->max_entries * HAL_RX_FST_ENTRY_SIZE,
 				rx_fst->base_vaddr, rx_fst->base_paddr, 0);
@@ -494,6 +702,51 @@ void hal_rx_fst_detach(struct hal_rx_fst *rx_fst,
 qdf_export_symbol(hal_rx_fst_detach);
 
 #ifndef WLAN_SUPPORT_RX_FISA
+/* number of tuples hashed together by the batched Toeplitz kernel */
+#define HAL_FLOW_TOEPLITZ_BATCH 4
+
+/**
+ * hal_flow_toeplitz_input() - Lay out a flow tuple as Toeplitz hash input
+ * @tuple_info: flow tuple
+ * @input: HAL_FST_HASH_KEY_SIZE_WORDS words of hash input
+ *
+ * Only the first HAL_FST_HASH_DATA_SIZE bytes of @input are consumed by the
+ * hash, so the tail of the last word is left as is.
+ *
+ * Return: None
+ */
+static inline void
+hal_flow_toeplitz_input(struct hal_flow_tuple_info *tuple_info,
+			uint32_t *input)
+{
+	input[0] = qdf_htonl(tuple_info->src_ip_127_96);
+	input[1] = qdf_htonl(tuple_info->src_ip_95_64);
+	input[2] = qdf_htonl(tuple_info->src_ip_63_32);
+	input[3] = qdf_htonl(tuple_info->src_ip_31_0);
+	input[4] = qdf_htonl(tuple_info->dest_ip_127_96);
+	input[5] = qdf_htonl(tuple_info->dest_ip_95_64);
+	input[6] = qdf_htonl(tuple_info->dest_ip_63_32);
+	input[7] = qdf_htonl(tuple_info->dest_ip_31_0);
+	input[8] = (tuple_info->dest_port << 16) | (tuple_info->src_port);
+	input[9] = tuple_info->l4_protocol;
+}
+
+/**
+ * hal_flow_toeplitz_fold() - Truncate a Toeplitz hash to a FST index
+ * @fst: FST Handle
+ * @hash: full 32-bit Toeplitz hash
+ *
+ * Return: hash index
+ */
+static inline uint32_t hal_flow_toeplitz_fold(struct hal_rx_fst *fst,
+					      uint32_t hash)
+{
+	hash >>= 12;
+	hash &= (fst->max_entries - 1);
+
+	return hash;
+}
+
 /**
  * hal_flow_toeplitz_hash() - Calculate Toeplitz hash by using the cached key
  *
@@ -505,41 +758,85 @@ qdf_export_symbol(hal_rx_fst_detach);
 uint32_t
 hal_flow_toeplitz_hash(void *hal_fst, struct hal_rx_flow *flow)
 {
-	int i, j;
+	int i;
 	uint32_t hash = 0;
 	struct hal_rx_fst *fst = (struct hal_rx_fst *)hal_fst;
 	uint32_t input[HAL_FST_HASH_KEY_SIZE_WORDS];
-	uint8_t *tuple;
+	uint8_t *tuple = (uint8_t *)input;
 
-	qdf_mem_zero(input, HAL_FST_HASH_KEY_SIZE_BYTES);
-	*(uint32_t *)&input[0] = qdf_htonl(flow->tuple_info.src_ip_127_96);
-	*(uint32_t *)&input[1] = qdf_htonl(flow->tuple_info.src_ip_95_64);
-	*(uint32_t *)&input[2] = qdf_htonl(flow->tuple_info.src_ip_63_32);
-	*(uint32_t *)&input[3] = qdf_htonl(flow->tuple_info.src_ip_31_0);
-	*(uint32_t *)&input[4] = qdf_htonl(flow->tuple_info.dest_ip_127_96);
-	*(uint32_t *)&input[5] = qdf_htonl(flow->tuple_info.dest_ip_95_64);
-	*(uint32_t *)&input[6] = qdf_htonl(flow->tuple_info.dest_ip_63_32);
-	*(uint32_t *)&input[7] = qdf_htonl(flow->tuple_info.dest_ip_31_0);
-	*(uint32_t *)&input[8] = (flow->tuple_info.dest_port << 16) |
-				 (flow->tuple_info.src_port);
-	*(uint32_t *)&input[9] = flow->tuple_info.l4_protocol;
+	hal_flow_toeplitz_input(&flow->tuple_info, input);
 
-	tuple = (uint8_t *)input;
-	QDF_TRACE_HEX_DUMP(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_DEBUG,
-			   tuple, sizeof(input));
-	for (i = 0, j = HAL_FST_HASH_DATA_SIZE - 1;
-	     i < HAL_FST_HASH_KEY_SIZE_BYTES && j >= 0; i++, j--) {
-		hash ^= fst->key_cache[i][tuple[j]];
+	for (i = 0; i < HAL_FST_HASH_DATA_SIZE; i++)
+		hash ^= fst->key_cache[i][tuple[HAL_FST_HASH_DATA_SIZE - 1 - i]];
+
+	return hal_flow_toeplitz_fold(fst, hash);
+}
+
+/**
+ * hal_flow_toeplitz_hash_batch() - Calculate Toeplitz hashes of many tuples
+ * @hal_fst: FST Handle
+ * @tuple_info: array of @num flow tuples
+ * @num: number of tuples
+ * @hashes: array of @num hash indices returned to the caller
+ *
+ * Tuples are hashed HAL_FLOW_TOEPLITZ_BATCH at a time with independent
+ * accumulators, walking the key cache one row at a time. Each 1KB row is
+ * then reused by the whole group instead of the 40KB cache being streamed
+ * once per tuple, and the independent lookups overlap in the pipeline.
+ * Results are identical to hal_flow_toeplitz_hash().
+ *
+ * Return: None
+ */
+void hal_flow_toeplitz_hash_batch(void *hal_fst,
+				  struct hal_flow_tuple_info *tuple_info,
+				  uint32_t num, uint32_t *hashes)
+{
+	struct hal_rx_fst *fst = (struct hal_rx_fst *)hal_fst;
+	uint32_t input[HAL_FLOW_TOEPLITZ_BATCH][HAL_FST_HASH_KEY_SIZE_WORDS];
+	uint8_t *t0 = (uint8_t *)input[0];
+	uint8_t *t1 = (uint8_t *)input[1];
+	uint8_t *t2 = (uint8_t *)input[2];
+	uint8_t *t3 = (uint8_t *)input[3];
+	uint32_t h0, h1, h2, h3;
+	uint32_t *row;
+	uint32_t n = 0;
+	int i, j;
+
+	for (; n + HAL_FLOW_TOEPLITZ_BATCH <= num;
+	     n += HAL_FLOW_TOEPLITZ_BATCH) {
+		hal_flow_toeplitz_input(&tuple_info[n], input[0]);
+		hal_flow_toeplitz_input(&tuple_info[n + 1], input[1]);
+		hal_flow_toeplitz_input(&tuple_info[n + 2], input[2]);
+		hal_flow_toeplitz_input(&tuple_info[n + 3], input[3]);
+
+		h0 = 0;
+		h1 = 0;
+		h2 = 0;
+		h3 = 0;
+		for (i = 0; i < HAL_FST_HASH_DATA_SIZE; i++) {
+			j = HAL_FST_HASH_DATA_SIZE - 1 - i;
+			row = fst->key_cache[i];
+			h0 ^= row[t0[j]];
+			h1 ^= row[t1[j]];
+			h2 ^= row[t2[j]];
+			h3 ^= row[t3[j]];
+		}
+
+		hashes[n] = hal_flow_toeplitz_fold(fst, h0);
+		hashes[n + 1] = hal_flow_toeplitz_fold(fst, h1);
+		hashes[n + 2] = hal_flow_toeplitz_fold(fst, h2);
+		hashes[n + 3] = hal_flow_toeplitz_fold(fst, h3);
 	}
 
-	QDF_TRACE(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_INFO_LOW,
-		  "Hash value %u %u truncated hash %u\n", hash,
-		  (hash >> 12), (hash >> 12) % (fst->max_entries));
+	for (; n < num; n++) {
+		hal_flow_toeplitz_input(&tuple_info[n], input[0]);
 
-	hash >>= 12;
-	hash &= (fst->max_entries - 1);
+		h0 = 0;
+		for (i = 0; i < HAL_FST_HASH_DATA_SIZE; i++)
+			h0 ^= fst->key_cache[i][t0[HAL_FST_HASH_DATA_SIZE - 1 - i]];
 
-	return hash;
+		hashes[n] = hal_flow_toeplitz_fold(fst, h0);
+	}
 }
 #else
 uint32_t
@@ -547,8 +844,16 @@ hal_flow_toeplitz_hash(void *hal_fst, struct hal_rx_flow *flow)
 {
 	return 0;
 }
+
+void hal_flow_toeplitz_hash_batch(void *hal_fst,
+				  struct hal_flow_tuple_info *tuple_info,
+				  uint32_t num, uint32_t *hashes)
+{
+	qdf_mem_zero(hashes, num * sizeof(*hashes));
+}
 #endif
 qdf_export_symbol(hal_flow_toeplitz_hash);
+qdf_export_symbol(hal_flow_toeplitz_hash_batch);
 
 /**
  * hal_rx_get_hal_hash() - Retrieve hash index of a flow in the FST table
@@ -584,23 +889,17 @@ hal_rx_insert_flow_entry(struct hal_rx_fst *fst, uint32_t flow_hash,
 			 void *flow_tuple_info, uint32_t *flow_idx)
 {
 	int i;
-	void *hal_fse = NULL;
 	uint32_t hal_hash = 0;
-	struct hal_flow_tuple_info hal_tuple_info = { 0 };
-	QDF_STATUS status;
+	struct hal_flow_tuple_info *tuple = flow_tuple_info;
+	uint32_t fp = hal_rx_flow_fingerprint(tuple);
 
 	for (i = 0; i < fst->max_skid_length; i++) {
 		hal_hash = hal_rx_get_hal_hash(fst, (flow_hash + i));
-		hal_fse = (uint8_t *)fst->base_vaddr +
-			(hal_hash * HAL_RX_FST_ENTRY_SIZE);
-		status = hal_rx_flow_get_tuple_info(hal_fse, &hal_tuple_info);
-		if (status == QDF_STATUS_E_NOENT)
+		if (!qdf_test_bit(hal_hash, fst->shadow_occupancy))
 			break;
 
-		/* Find the matching flow entry in HW FST */
-		if (!qdf_mem_cmp(&hal_tuple_info,
-				 flow_tuple_info,
-				 sizeof(struct hal_flow_tuple_info))) {
+		/* Find the matching flow entry in the FST shadow */
+		if (hal_rx_fst_shadow_match(fst, hal_hash, tuple, fp)) {
 			dp_err("Duplicate flow entry in FST %u at skid %u ",
 			       hal_hash, i);
 			return QDF_STATUS_E_EXISTS;
@@ -611,8 +910,8 @@ hal_rx_insert_flow_entry(struct hal_rx_fst *fst, uint32_t flow_hash,
 		return QDF_STATUS_E_RANGE;
 	}
 	*flow_idx = hal_hash;
-	dp_info("flow_hash = %u, skid_entry = %d, flow_addr = %pK flow_idx = %d",
-		flow_hash, i, hal_fse, *flow_idx);
+	dp_info("flow_hash = %u, skid_entry = %d, flow_idx = %d",
+		flow_hash, i, *flow_idx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -633,25 +932,18 @@ hal_rx_find_flow_from_tuple(struct hal_rx_fst *fst, uint32_t flow_hash,
 			    void *flow_tuple_info, uint32_t *flow_idx)
 {
 	int i;
-	void *hal_fse = NULL;
 	uint32_t hal_hash = 0;
-	struct hal_flow_tuple_info hal_tuple_info = { 0 };
-	QDF_STATUS status;
+	struct hal_flow_tuple_info *tuple = flow_tuple_info;
+	uint32_t fp = hal_rx_flow_fingerprint(tuple);
 
 	for (i = 0; i < fst->max_skid_length; i++) {
 		hal_hash = hal_rx_get_hal_hash(fst, (flow_hash + i));
-		hal_fse = (uint8_t *)fst->base_vaddr +
-			(hal_hash * HAL_RX_FST_ENTRY_SIZE);
-		status = hal_rx_flow_get_tuple_info(hal_fse, &hal_tuple_info);
-		if (status != QDF_STATUS_SUCCESS)
+		if (!qdf_test_bit(hal_hash, fst->shadow_occupancy))
 			continue;
 
-		/* Find the matching flow entry in HW FST */
-		if (!qdf_mem_cmp(&hal_tuple_info,
-				 flow_tuple_info,
-				 sizeof(struct hal_flow_tuple_info))) {
+		/* Find the matching flow entry in the FST shadow */
+		if (hal_rx_fst_shadow_match(fst, hal_hash, tuple, fp))
 			break;
-		}
 	}
 
 	if (i == fst->max_skid_length) {
@@ -660,9 +952,261 @@ hal_rx_find_flow_from_tuple(struct hal_rx_fst *fst, uint32_t flow_hash,
 	}
 
 	*flow_idx = hal_hash;
-	dp_info("flow_hash = %u, skid_entry = %d, flow_addr = %pK flow_idx = %d",
-		flow_hash, i, hal_fse, *flow_idx);
+	dp_info("flow_hash = %u, skid_entry = %d, flow_idx = %d",
+		flow_hash, i, *flow_idx);
 
 	return QDF_STATUS_SUCCESS;
 }
 qdf_export_symbol(hal_rx_find_flow_from_tuple);
+
+#ifdef WLAN_HAL_RX_FST_BENCHMARK
+/**
+ * hal_rx_fst_bench_tuple() - Generate a deterministic tuple for a flow id
+ * @id: flow id
+ * @tuple: tuple to fill
+ *
+ * Return: None
+ */
+static void hal_rx_fst_bench_tuple(uint32_t id,
+				   struct hal_flow_tuple_info *tuple)
+{
+	qdf_mem_zero(tuple, sizeof(*tuple));
+	tuple->src_ip_31_0 = 0x0a000000 | (id & 0xffffff);
+	tuple->dest_ip_31_0 = 0xc0a80101;
+	tuple->src_port = 1024 + (id % 60000);
+	tuple->dest_port = 5001;
+	tuple->l4_protocol = (id & 1) ? 6 : 17;
+}
+
+/**
+ * hal_rx_fst_bench_hash() - Spread flow ids over the FST
+ * @id: flow id
+ *
+ * The benchmark measures table operations, not the Toeplitz hash, so a
+ * cheap integer mix stands in for the flow hash.
+ *
+ * Return: flow hash
+ */
+static uint32_t hal_rx_fst_bench_hash(uint32_t id)
+{
+	id ^= id >> 16;
+	id *= 0x7feb352d;
+	id ^= id >> 15;
+
+	return id;
+}
+
+void hal_rx_fst_churn_benchmark(hal_soc_handle_t hal_soc_hdl,
+				qdf_device_t qdf_dev, uint16_t max_entries,
+				uint16_t max_search, uint32_t rounds)
+{
+	uint8_t key[HAL_FST_HASH_KEY_SIZE_BYTES] = { 0 };
+	struct hal_rx_fst *fst;
+	struct hal_rx_flow flow = { 0 };
+	uint64_t paddr;
+	uint32_t *slot;
+	uint32_t num_flows = max_entries / 2;
+	uint32_t inserts = 0, lookups = 0, misses = 0;
+	uint32_t r, id, idx;
+	uint64_t insert_us = 0, lookup_us = 0;
+	uint64_t start;
+
+	fst = hal_rx_fst_attach(qdf_dev, &paddr, max_entries, max_search, key);
+	if (!fst)
+		return;
+
+	slot = qdf_mem_malloc(num_flows * sizeof(*slot));
+	if (!slot)
+		goto detach;
+
+	for (r = 0; r < rounds; r++) {
+		/* churn: the flow id window moves by one table half per round */
+		start = qdf_get_monotonic_boottime();
+		for (id = 0; id < num_flows; id++) {
+			hal_rx_fst_bench_tuple(r * num_flows + id,
+					       &flow.tuple_info);
+			slot[id] = max_entries;
+			if (hal_rx_insert_flow_entry(fst,
+					hal_rx_fst_bench_hash(r * num_flows + id),
+					&flow.tuple_info, &idx) !=
+			    QDF_STATUS_SUCCESS)
+				continue;
+			if (!hal_rx_flow_setup_fse(hal_soc_hdl, fst, idx, &flow))
+				continue;
+			slot[id] = idx;
+			inserts++;
+		}
+		insert_us += qdf_get_monotonic_boottime() - start;
+
+		start = qdf_get_monotonic_boottime();
+		for (id = 0; id < num_flows; id++) {
+			hal_rx_fst_bench_tuple(r * num_flows + id,
+					       &flow.tuple_info);
+			if (hal_rx_find_flow_from_tuple(fst,
+					hal_rx_fst_bench_hash(r * num_flows + id),
+					&flow.tuple_info, &idx) !=
+			    QDF_STATUS_SUCCESS) {
+				misses++;
+				continue;
+			}
+			lookups++;
+		}
+		lookup_us += qdf_get_monotonic_boottime() - start;
+
+		for (id = 0; id < num_flows; id++) {
+			if (slot[id] == max_entries)
+				continue;
+			hal_rx_flow_delete_entry(fst, fst->base_vaddr +
+						 slot[id] *
+						 HAL_RX_FST_ENTRY_SIZE);
+		}
+	}
+
+	qdf_nofl_info("FST churn: %u entries skid %u rounds %u: %u inserts in %llu us (%llu/s), %u lookups in %llu us (%llu/s), %u misses",
+		      max_entries, max_search, rounds,
+		      inserts, insert_us,
+		      insert_us ? qdf_do_div((uint64_t)inserts * 1000000,
+					     insert_us) : 0,
+		      lookups, lookup_us,
+		      lookup_us ? qdf_do_div((uint64_t)lookups * 1000000,
+					     lookup_us) : 0,
+		      misses);
+
+	qdf_mem_free(slot);
+detach:
+	hal_rx_fst_detach(fst, qdf_dev);
+}
+qdf_export_symbol(hal_rx_fst_churn_benchmark);
+
+#ifndef WLAN_SUPPORT_RX_FISA
+/**
+ * hal_flow_toeplitz_hash_ref() - Byte-wise reference Toeplitz hash
+ * @fst: FST Handle
+ * @tuple_info: flow tuple
+ *
+ * Kept as it was before the batched kernel so that the benchmark can
+ * check hal_flow_toeplitz_hash() and hal_flow_toeplitz_hash_batch()
+ * against it.
+ *
+ * Return: hash index
+ */
+static uint32_t
+hal_flow_toeplitz_hash_ref(struct hal_rx_fst *fst,
+			   struct hal_flow_tuple_info *tuple_info)
+{
+	int i, j;
+	uint32_t hash = 0;
+	uint32_t input[HAL_FST_HASH_KEY_SIZE_WORDS];
+	uint8_t *tuple;
+
+	qdf_mem_zero(input, HAL_FST_HASH_KEY_SIZE_BYTES);
+	input[0] = qdf_htonl(tuple_info->src_ip_127_96);
+	input[1] = qdf_htonl(tuple_info->src_ip_95_64);
+	input[2] = qdf_htonl(tuple_info->src_ip_63_32);
+	input[3] = qdf_htonl(tuple_info->src_ip_31_0);
+	input[4] = qdf_htonl(tuple_info->dest_ip_127_96);
+	input[5] = qdf_htonl(tuple_info->dest_ip_95_64);
+	input[6] = qdf_htonl(tuple_info->dest_ip_63_32);
+	input[7] = qdf_htonl(tuple_info->dest_ip_31_0);
+	input[8] = (tuple_info->dest_port << 16) | (tuple_info->src_port);
+	input[9] = tuple_info->l4_protocol;
+
+	tuple = (uint8_t *)input;
+	for (i = 0, j = HAL_FST_HASH_DATA_SIZE - 1;
+	     i < HAL_FST_HASH_KEY_SIZE_BYTES && j >= 0; i++, j--)
+		hash ^= fst->key_cache[i][tuple[j]];
+
+	hash >>= 12;
+	hash &= (fst->max_entries - 1);
+
+	return hash;
+}
+
+void hal_flow_toeplitz_hash_benchmark(qdf_device_t qdf_dev,
+				      uint16_t max_entries,
+				      uint32_t num_tuples)
+{
+	uint8_t key[HAL_FST_HASH_KEY_SIZE_BYTES];
+	struct hal_rx_fst *fst;
+	struct hal_rx_flow flow;
+	struct hal_flow_tuple_info *tuples;
+	uint32_t *ref, *hashes;
+	uint32_t n, mismatch = 0;
+	uint64_t ref_us, single_us, batch_us;
+	uint64_t start;
+	uint64_t paddr;
+
+	if (!num_tuples)
+		return;
+
+	qdf_get_random_bytes(key, sizeof(key));
+	fst = hal_rx_fst_attach(qdf_dev, &paddr, max_entries, 1, key);
+	if (!fst)
+		return;
+
+	tuples = qdf_mem_valloc(num_tuples * sizeof(*tuples));
+	ref = qdf_mem_valloc(num_tuples * sizeof(*ref));
+	hashes = qdf_mem_valloc(num_tuples * sizeof(*hashes));
+	if (!tuples || !ref || !hashes)
+		goto free;
+
+	/* random IPv6-sized tuples so every key cache row sees every byte */
+	qdf_get_random_bytes(tuples, num_tuples * sizeof(*tuples));
+
+	start = qdf_get_monotonic_boottime();
+	for (n = 0; n < num_tuples; n++)
+		ref[n] = hal_flow_toeplitz_hash_ref(fst, &tuples[n]);
+	ref_us = qdf_get_monotonic_boottime() - start;
+
+	start = qdf_get_monotonic_boottime();
+	for (n = 0; n < num_tuples; n++) {
+		flow.tuple_info = tuples[n];
+		hashes[n] = hal_flow_toeplitz_hash(fst, &flow);
+	}
+	single_us = qdf_get_monotonic_boottime() - start;
+
+	for (n = 0; n < num_tuples; n++)
+		if (hashes[n] != ref[n])
+			mismatch++;
+
+	qdf_mem_zero(hashes, num_tuples * sizeof(*hashes));
+	start = qdf_get_monotonic_boottime();
+	hal_flow_toeplitz_hash_batch(fst, tuples, num_tuples, hashes);
+	batch_us = qdf_get_monotonic_boottime() - start;
+
+	for (n = 0; n < num_tuples; n++)
+		if (hashes[n] != ref[n])
+			mismatch++;
+
+	qdf_nofl_info("Toeplitz: %u tuples: ref %llu us (%llu/s), single %llu us (%llu/s), batch %llu us (%llu/s), %u mismatches",
+		      num_tuples,
+		      ref_us,
+		      ref_us ? qdf_do_div((uint64_t)num_tuples * 1000000,
+					  ref_us) : 0,
+		      single_us,
+		      single_us ? qdf_do_div((uint64_t)num_tuples * 1000000,
+					     single_us) : 0,
+		      batch_us,
+		      batch_us ? qdf_do_div((uint64_t)num_tuples * 1000000,
+					    batch_us) : 0,
+		      mismatch);
+	QDF_BUG(!mismatch);
+
+free:
+	if (hashes)
+		qdf_mem_vfree(hashes);
+	if (ref)
+		qdf_mem_vfree(ref);
+	if (tuples)
+		qdf_mem_vfree(tuples);
+	hal_rx_fst_detach(fst, qdf_dev);
+}
+#else
+void hal_flow_toeplitz_hash_benchmark(qdf_device_t qdf_dev,
+				      uint16_t max_entries,
+				      uint32_t num_tuples)
+{
+}
+#endif
+qdf_export_symbol(hal_flow_toeplitz_hash_benchmark);
+#endif /* WLAN_HAL_RX_FST_BENCHMARK */
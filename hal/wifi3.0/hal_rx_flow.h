@@ -91,6 +91,23 @@ uint32_t
 hal_rx_flow_setup_cmem_fse(hal_soc_handle_t hal_soc_hdl, uint32_t cmem_ba,
 			   uint32_t table_offset, struct hal_rx_flow *flow);
 
+/**
+ * hal_rx_flow_setup_cmem_fse_shadow() - Setup a flow search entry in HW
+ *					 CMEM FST and record it in the shadow
+ * @hal_soc_hdl: HAL SOC handle
+ * @fst: Pointer to the Rx Flow Search Table whose shadow tracks the CMEM FST
+ * @cmem_ba: CMEM base address
+ * @table_offset: offset into the table where the flow is to be setup
+ * @flow: Flow Parameters
+ *
+ * Return: Success/Failure
+ */
+uint32_t
+hal_rx_flow_setup_cmem_fse_shadow(hal_soc_handle_t hal_soc_hdl,
+				  struct hal_rx_fst *fst, uint32_t cmem_ba,
+				  uint32_t table_offset,
+				  struct hal_rx_flow *flow);
+
 /**
  * hal_rx_flow_get_cmem_fse_timestamp() - Get timestamp field from CMEM FSE
  * @hal_soc_hdl: HAL SOC handle
@@ -197,6 +214,22 @@ uint32_t hal_rx_get_hal_hash(struct hal_rx_fst *hal_fst, uint32_t flow_hash);
 uint32_t
 hal_flow_toeplitz_hash(void *hal_fst, struct hal_rx_flow *flow);
 
+/**
+ * hal_flow_toeplitz_hash_batch() - Calculate Toeplitz hashes of many tuples
+ * @hal_fst: FST Handle
+ * @tuple_info: array of @num flow tuples
+ * @num: number of tuples
+ * @hashes: array of @num hash indices returned to the caller
+ *
+ * Bit-exact with hal_flow_toeplitz_hash() for every tuple, but amortizes
+ * the key cache walk over groups of tuples.
+ *
+ * Return: None
+ */
+void hal_flow_toeplitz_hash_batch(void *hal_fst,
+				  struct hal_flow_tuple_info *tuple_info,
+				  uint32_t num, uint32_t *hashes);
+
 void hal_rx_dump_fse_table(struct hal_rx_fst *fst);
 
 /**
@@ -209,4 +242,54 @@ void hal_rx_dump_fse_table(struct hal_rx_fst *fst);
  */
 void hal_rx_dump_cmem_fse(hal_soc_handle_t hal_soc_hdl, uint32_t fse_offset,
 			  int index);
+
+#ifdef WLAN_HAL_RX_FST_BENCHMARK
+/**
+ * hal_rx_fst_churn_benchmark() - Measure FST insert and lookup rates
+ * @hal_soc_hdl: HAL SOC handle
+ * @qdf_dev: QDF device handle
+ * @max_entries: number of entries of the scratch FST, power of 2
+ * @max_search: skid length of the scratch FST
+ * @rounds: number of churn rounds
+ *
+ * Attaches a scratch FST that is never handed to the target. Each round
+ * inserts a fresh set of flows filling half of the table, looks all of
+ * them up and deletes them again; the insert and lookup rates are logged.
+ *
+ * Return: None
+ */
+void hal_rx_fst_churn_benchmark(hal_soc_handle_t hal_soc_hdl,
+				qdf_device_t qdf_dev, uint16_t max_entries,
+				uint16_t max_search, uint32_t rounds);
+
+/**
+ * hal_flow_toeplitz_hash_benchmark() - Verify and time the Toeplitz kernels
+ * @qdf_dev: QDF device handle
+ * @max_entries: number of entries of the scratch FST, power of 2
+ * @num_tuples: number of random tuples to hash
+ *
+ * Hashes random tuples under a random key with the byte-wise reference,
+ * hal_flow_toeplitz_hash() and hal_flow_toeplitz_hash_batch(), logs the
+ * rate of each and asserts that all three agree bit for bit.
+ *
+ * Return: None
+ */
+void hal_flow_toeplitz_hash_benchmark(qdf_device_t qdf_dev,
+				      uint16_t max_entries,
+				      uint32_t num_tuples);
+#else
+static inline
+void hal_rx_fst_churn_benchmark(hal_soc_handle_t hal_soc_hdl,
+				qdf_device_t qdf_dev, uint16_t max_entries,
+				uint16_t max_search, uint32_t rounds)
+{
+}
+
+static inline
+void hal_flow_toeplitz_hash_benchmark(qdf_device_t qdf_dev,
+				      uint16_t max_entries,
+				      uint32_t num_tuples)
+{
+}
+#endif
 #endif /* HAL_RX_FLOW_H */
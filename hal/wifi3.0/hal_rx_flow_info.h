@@ -52,6 +52,15 @@ struct hal_rx_flow {
  * @key_cache: Toepliz Key Cache configured key
  * @add_flow_count: Add flow count
  * @del_flow_count: Delete flow count
+ * @shadow_fp: per entry fingerprint of the tuple programmed in the FST
+ * @shadow_tuple: per entry copy of the tuple programmed in the FST
+ * @shadow_occupancy: bitmap of valid FST entries
+ *
+ * The shadow arrays mirror the valid bit and tuple of every entry in the
+ * FST, whether in DMA-coherent memory or in CMEM, in cached memory. Flow
+ * insert and lookup only consult the shadow; it is kept coherent by
+ * hal_rx_flow_setup_fse() and hal_rx_flow_delete_entry() for the DDR FST,
+ * and by hal_rx_flow_setup_cmem_fse_shadow() for the CMEM FST.
  */
 struct hal_rx_fst {
 	uint8_t *base_vaddr;
@@ -66,6 +75,9 @@ struct hal_rx_fst {
 	uint16_t hash_mask;
 	uint32_t add_flow_count;
 	uint32_t del_flow_count;
+	uint32_t *shadow_fp;
+	struct hal_flow_tuple_info *shadow_tuple;
+	unsigned long *shadow_occupancy;
 };
 
 #endif /* HAL_RX_FLOW_DEFINES_H */
@@ -20,6 +20,7 @@
 #include "hal_hw_headers.h"
 #include "hal_api.h"
 #include "hal_reo.h"
+#include "hal_api_mon.h"
 #include "target_type.h"
 #include "qdf_module.h"
 #include "wcss_version.h"
@@ -1765,3 +1766,89 @@ void hal_set_init_phase(hal_soc_handle_t soc, bool init_phase)
 	hal_soc->init_phase = init_phase;
 }
 #endif /* FORCE_WAKE */
+
+#ifdef WLAN_HAL_RX_STATUS_TLV_BENCHMARK
+/**
+ * hal_rx_status_tlv_bench_pass() - Decode every TLV of the status buffers
+ * @hal_soc_hdl: HAL soc handle
+ * @ppdu_info: scratch PPDU info
+ * @bufs: captured status buffers
+ * @num_bufs: number of buffers in @bufs
+ * @is_tlv_hdr_64_bit: status buffers use the 64 bit TLV header
+ * @rounds: number of times the buffers are replayed
+ * @num_tlvs: number of TLVs walked
+ *
+ * Return: time taken in us
+ */
+static uint64_t
+hal_rx_status_tlv_bench_pass(hal_soc_handle_t hal_soc_hdl,
+			     struct hal_rx_ppdu_info *ppdu_info,
+			     uint8_t **bufs, uint32_t num_bufs,
+			     bool is_tlv_hdr_64_bit, uint32_t rounds,
+			     uint64_t *num_tlvs)
+{
+	uint32_t buf_size = hal_get_rx_status_buf_size();
+	uint32_t tlv_status;
+	uint8_t *rx_tlv;
+	uint64_t start;
+	uint32_t r, i;
+
+	*num_tlvs = 0;
+	start = qdf_get_monotonic_boottime();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < num_bufs; i++) {
+			rx_tlv = bufs[i];
+			do {
+				tlv_status = hal_rx_status_get_tlv_info(rx_tlv,
+							ppdu_info,
+							hal_soc_hdl, NULL);
+				(*num_tlvs)++;
+				rx_tlv = hal_rx_status_get_next_tlv(rx_tlv,
+							is_tlv_hdr_64_bit);
+				if ((rx_tlv - bufs[i]) >= buf_size)
+					break;
+			} while (tlv_status != HAL_TLV_STATUS_PPDU_DONE &&
+				 tlv_status != HAL_TLV_STATUS_BUF_DONE);
+		}
+	}
+
+	return qdf_get_monotonic_boottime() - start;
+}
+
+void hal_rx_status_tlv_benchmark(hal_soc_handle_t hal_soc_hdl,
+				 uint8_t **bufs, uint32_t num_bufs,
+				 bool is_tlv_hdr_64_bit, uint32_t rounds)
+{
+	struct hal_rx_ppdu_info *ppdu_info;
+	uint32_t skip = hal_rx_status_tlv_skip_get(hal_soc_hdl);
+	uint64_t full_tlvs, skip_tlvs;
+	uint64_t full_us, skip_us;
+
+	if (!num_bufs || !rounds)
+		return;
+
+	ppdu_info = qdf_mem_malloc(sizeof(*ppdu_info));
+	if (!ppdu_info)
+		return;
+
+	hal_rx_status_tlv_skip_set(hal_soc_hdl, 0);
+	full_us = hal_rx_status_tlv_bench_pass(hal_soc_hdl, ppdu_info, bufs,
+					       num_bufs, is_tlv_hdr_64_bit,
+					       rounds, &full_tlvs);
+
+	hal_rx_status_tlv_skip_set(hal_soc_hdl, skip);
+	skip_us = hal_rx_status_tlv_bench_pass(hal_soc_hdl, ppdu_info, bufs,
+					       num_bufs, is_tlv_hdr_64_bit,
+					       rounds, &skip_tlvs);
+
+	qdf_nofl_info("status TLV decode: %u bufs x %u rounds: all classes %llu TLVs in %llu us (%llu/s), skip 0x%x %llu TLVs in %llu us (%llu/s)",
+		      num_bufs, rounds,
+		      full_tlvs, full_us,
+		      full_us ? qdf_do_div(full_tlvs * 1000000, full_us) : 0,
+		      skip, skip_tlvs, skip_us,
+		      skip_us ? qdf_do_div(skip_tlvs * 1000000, skip_us) : 0);
+
+	qdf_mem_free(ppdu_info);
+}
+qdf_export_symbol(hal_rx_status_tlv_benchmark);
+#endif /* WLAN_HAL_RX_STATUS_TLV_BENCHMARK */
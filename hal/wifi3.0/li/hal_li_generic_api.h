@@ -529,6 +529,100 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 				      hal_soc_handle_t hal_soc_hdl,
 				      qdf_nbuf_t nbuf)
 {
+	static const struct hal_rx_status_tlv_field end_info_fields[] = {
+		HAL_RX_TLV_FIELD(RXPCU_PPDU_END_INFO_2, RX_ANTENNA,
+				 rx_status.rx_antenna),
+		HAL_RX_TLV_FIELD(UNIFIED_RXPCU_PPDU_END_INFO_8,
+				 RX_PPDU_DURATION, rx_status.duration),
+	};
+	static const struct hal_rx_status_tlv_field user_stats_fields[] = {
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_4, AST_INDEX,
+				 rx_status.ast_index),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_9, UDP_MSDU_COUNT,
+				 rx_status.udp_msdu_count),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_10, OTHER_MSDU_COUNT,
+				 rx_status.other_msdu_count),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_3, MPDU_CNT_FCS_OK,
+				 com_info.mpdu_cnt_fcs_ok),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_2, MPDU_CNT_FCS_ERR,
+				 com_info.mpdu_cnt_fcs_err),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_7, FCS_OK_BITMAP_31_0,
+				 com_info.mpdu_fcs_ok_bitmap[0]),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_8, FCS_OK_BITMAP_63_32,
+				 com_info.mpdu_fcs_ok_bitmap[1]),
+	};
+	static const struct hal_rx_status_tlv_field user_stats_ext_fields[] = {
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_EXT_1,
+				 FCS_OK_BITMAP_95_64,
+				 com_info.mpdu_fcs_ok_bitmap[2]),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_EXT_2,
+				 FCS_OK_BITMAP_127_96,
+				 com_info.mpdu_fcs_ok_bitmap[3]),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_EXT_3,
+				 FCS_OK_BITMAP_159_128,
+				 com_info.mpdu_fcs_ok_bitmap[4]),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_EXT_4,
+				 FCS_OK_BITMAP_191_160,
+				 com_info.mpdu_fcs_ok_bitmap[5]),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_EXT_5,
+				 FCS_OK_BITMAP_223_192,
+				 com_info.mpdu_fcs_ok_bitmap[6]),
+		HAL_RX_TLV_FIELD(RX_PPDU_END_USER_STATS_EXT_6,
+				 FCS_OK_BITMAP_255_224,
+				 com_info.mpdu_fcs_ok_bitmap[7]),
+	};
+	static const struct hal_rx_status_tlv_desc descs[HAL_RX_TLV_DESC_MAX] = {
+		[HAL_RX_TLV_DESC_DEFAULT] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_PPDU),
+		[HAL_RX_TLV_DESC_PHY] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_PHY),
+		[HAL_RX_TLV_DESC_MPDU] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_MPDU),
+		[HAL_RX_TLV_DESC_HEADER] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_HEADER),
+		[HAL_RX_TLV_DESC_LOCATION] =
+			HAL_RX_TLV_DESC_HANDLER(HAL_RX_TLV_CLASS_LOCATION),
+		[HAL_RX_TLV_DESC_PPDU_END_INFO] =
+			HAL_RX_TLV_DESC(HAL_RX_TLV_CLASS_PPDU, end_info_fields,
+					HAL_TLV_STATUS_PPDU_NOT_DONE, 1),
+		[HAL_RX_TLV_DESC_USER_STATS] =
+			HAL_RX_TLV_DESC(HAL_RX_TLV_CLASS_PPDU,
+					user_stats_fields,
+					HAL_TLV_STATUS_PPDU_NOT_DONE, 1),
+		[HAL_RX_TLV_DESC_USER_STATS_EXT] =
+			HAL_RX_TLV_DESC(HAL_RX_TLV_CLASS_PPDU,
+					user_stats_ext_fields,
+					HAL_TLV_STATUS_PPDU_NOT_DONE, 0),
+		[HAL_RX_TLV_DESC_STATUS_DONE] =
+			HAL_RX_TLV_DESC_STATUS(HAL_TLV_STATUS_PPDU_DONE),
+		[HAL_RX_TLV_DESC_BUF_DONE] =
+			HAL_RX_TLV_DESC_STATUS(HAL_TLV_STATUS_BUF_DONE),
+	};
+	static const uint8_t tag_map[HAL_RX_STATUS_TLV_TAG_MAX] = {
+		[WIFIRXPCU_PPDU_END_INFO_E] = HAL_RX_TLV_DESC_PPDU_END_INFO,
+		[WIFIRX_PPDU_END_USER_STATS_E] = HAL_RX_TLV_DESC_USER_STATS,
+		[WIFIRX_PPDU_END_USER_STATS_EXT_E] =
+					HAL_RX_TLV_DESC_USER_STATS_EXT,
+		[WIFIRX_PPDU_END_STATUS_DONE_E] = HAL_RX_TLV_DESC_STATUS_DONE,
+		[WIFIDUMMY_E] = HAL_RX_TLV_DESC_BUF_DONE,
+		[WIFIPHYRX_PKT_END_E] = HAL_RX_TLV_DESC_LOCATION,
+		[WIFIPHYRX_HT_SIG_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_L_SIG_B_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_L_SIG_A_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_VHT_SIG_A_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_A_SU_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_A_MU_DL_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_B1_MU_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_B2_MU_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_HE_SIG_B2_OFDMA_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_RSSI_LEGACY_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIPHYRX_OTHER_RECEIVE_INFO_E] = HAL_RX_TLV_DESC_PHY,
+		[WIFIRX_HEADER_E] = HAL_RX_TLV_DESC_HEADER,
+		[WIFIRX_MPDU_START_E] = HAL_RX_TLV_DESC_MPDU,
+		[WIFIRX_MPDU_END_E] = HAL_RX_TLV_DESC_MPDU,
+		[WIFIRX_MSDU_END_E] = HAL_RX_TLV_DESC_MPDU,
+	};
+	const struct hal_rx_status_tlv_desc *desc;
 	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
 	uint32_t tlv_tag, user_id, tlv_len, value;
 	uint8_t group_id = 0;
@@ -548,9 +642,20 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 
 	rx_tlv = (uint8_t *)rx_tlv_hdr + HAL_RX_TLV32_HDR_SIZE;
 
+	desc = hal_rx_status_tlv_lookup(hal, tag_map, descs, tlv_tag);
+	if (!desc)
+		return HAL_TLV_STATUS_PPDU_NOT_DONE;
+
 	qdf_trace_hex_dump(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_DEBUG,
 			   rx_tlv, tlv_len);
 
+	/* fields copied straight into ppdu_info come from the table, the
+	 * handlers below only deal with what needs computing
+	 */
+	hal_rx_status_tlv_decode_fields(desc, rx_tlv, ppdu_info);
+	if (!desc->decode_more)
+		return desc->status;
+
 	switch (tlv_tag) {
 	case WIFIRX_PPDU_START_E:
 	{
@@ -606,17 +711,12 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 		break;
 
 	case WIFIRXPCU_PPDU_END_INFO_E:
-		ppdu_info->rx_status.rx_antenna =
-			HAL_RX_GET(rx_tlv, RXPCU_PPDU_END_INFO_2, RX_ANTENNA);
 		ppdu_info->rx_status.tsft =
 			HAL_RX_GET(rx_tlv, RXPCU_PPDU_END_INFO_1,
 				WB_TIMESTAMP_UPPER_32);
 		ppdu_info->rx_status.tsft = (ppdu_info->rx_status.tsft << 32) |
 			HAL_RX_GET(rx_tlv, RXPCU_PPDU_END_INFO_0,
 				WB_TIMESTAMP_LOWER_32);
-		ppdu_info->rx_status.duration =
-			HAL_RX_GET(rx_tlv, UNIFIED_RXPCU_PPDU_END_INFO_8,
-				RX_PPDU_DURATION);
 		hal_rx_get_bb_info(hal_soc_hdl, rx_tlv, ppdu_info);
 		break;
 
@@ -629,10 +729,6 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 		unsigned long tid = 0;
 		uint16_t seq = 0;
 
-		ppdu_info->rx_status.ast_index =
-				HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_4,
-						AST_INDEX);
-
 		tid = HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_12,
 				RECEIVED_QOS_DATA_TID_BITMAP);
 		ppdu_info->rx_status.tid = qdf_find_first_bit(&tid,
@@ -646,12 +742,6 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 					TCP_MSDU_COUNT) +
 			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_10,
 					TCP_ACK_MSDU_COUNT);
-		ppdu_info->rx_status.udp_msdu_count =
-			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_9,
-						UDP_MSDU_COUNT);
-		ppdu_info->rx_status.other_msdu_count =
-			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_10,
-					OTHER_MSDU_COUNT);
 
 		if (ppdu_info->sw_frame_group_id
 		    != HAL_MPDU_SW_FRAME_GROUP_NULL_DATA) {
@@ -695,12 +785,6 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 			break;
 		}
 
-		ppdu_info->com_info.mpdu_cnt_fcs_ok =
-			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_3,
-					MPDU_CNT_FCS_OK);
-		ppdu_info->com_info.mpdu_cnt_fcs_err =
-			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_2,
-					MPDU_CNT_FCS_ERR);
 		if ((ppdu_info->com_info.mpdu_cnt_fcs_ok |
 			ppdu_info->com_info.mpdu_cnt_fcs_err) > 1)
 			ppdu_info->rx_status.rs_flags |= IEEE80211_AMPDU_FLAG;
@@ -708,14 +792,6 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 			ppdu_info->rx_status.rs_flags &=
 				(~IEEE80211_AMPDU_FLAG);
 
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[0] =
-				HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_7,
-					   FCS_OK_BITMAP_31_0);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[1] =
-				HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_8,
-					   FCS_OK_BITMAP_63_32);
-
 		if (user_id < HAL_MAX_UL_MU_USERS) {
 			mon_rx_user_status =
 				&ppdu_info->rx_user_status[user_id];
@@ -731,38 +807,6 @@ hal_rx_status_get_tlv_info_generic_li(void *rx_tlv_hdr, void *ppduinfo,
 		break;
 	}
 
-	case WIFIRX_PPDU_END_USER_STATS_EXT_E:
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[2] =
-			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_EXT_1,
-				   FCS_OK_BITMAP_95_64);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[3] =
-			 HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_EXT_2,
-				    FCS_OK_BITMAP_127_96);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[4] =
-			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_EXT_3,
-				   FCS_OK_BITMAP_159_128);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[5] =
-			 HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_EXT_4,
-				    FCS_OK_BITMAP_191_160);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[6] =
-			HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_EXT_5,
-				   FCS_OK_BITMAP_223_192);
-
-		ppdu_info->com_info.mpdu_fcs_ok_bitmap[7] =
-			 HAL_RX_GET(rx_tlv, RX_PPDU_END_USER_STATS_EXT_6,
-				    FCS_OK_BITMAP_255_224);
-		break;
-
-	case WIFIRX_PPDU_END_STATUS_DONE_E:
-		return HAL_TLV_STATUS_PPDU_DONE;
-
-	case WIFIDUMMY_E:
-		return HAL_TLV_STATUS_BUF_DONE;
-
 	case WIFIPHYRX_HT_SIG_E:
 	{
 		uint8_t *ht_sig_info = (uint8_t *)rx_tlv +
@@ -155,6 +155,9 @@ struct ce_tasklet_entry {
 	bool inited;
 	bool hi_tasklet_ce;
 	void *hif_ce_state;
+#ifdef QDF_LATENCY_PROFILE
+	qdf_prof_ts_t prof_sched_ts;
+#endif
 };
 
 static inline bool hif_dummy_grp_done(struct hif_exec_context *grp_entry, int
@@ -49,6 +49,43 @@ struct tasklet_work {
 };
 
 
+#ifdef QDF_LATENCY_PROFILE
+/**
+ * ce_tasklet_prof_sched() - stamp tasklet scheduling for the latency profiler
+ * @tasklet_entry: ce tasklet entry
+ *
+ * Return: None
+ */
+static inline void
+ce_tasklet_prof_sched(struct ce_tasklet_entry *tasklet_entry)
+{
+	tasklet_entry->prof_sched_ts = qdf_prof_start();
+}
+
+/**
+ * ce_tasklet_prof_entry() - account schedule to entry latency of a tasklet
+ * @tasklet_entry: ce tasklet entry
+ *
+ * Return: None
+ */
+static inline void
+ce_tasklet_prof_entry(struct ce_tasklet_entry *tasklet_entry)
+{
+	qdf_prof_end(QDF_PROF_CE_TASKLET_SCHED, tasklet_entry->prof_sched_ts);
+	tasklet_entry->prof_sched_ts = 0;
+}
+#else
+static inline void
+ce_tasklet_prof_sched(struct ce_tasklet_entry *tasklet_entry)
+{
+}
+
+static inline void
+ce_tasklet_prof_entry(struct ce_tasklet_entry *tasklet_entry)
+{
+}
+#endif
+
 /**
  * ce_tasklet_schedule() - schedule CE tasklet
  * @tasklet_entry: ce tasklet entry
@@ -57,6 +94,8 @@ struct tasklet_work {
  */
 static inline void ce_tasklet_schedule(struct ce_tasklet_entry *tasklet_entry)
 {
+	ce_tasklet_prof_sched(tasklet_entry);
+
 	if (tasklet_entry->hi_tasklet_ce)
 		tasklet_hi_schedule(&tasklet_entry->intr_tq);
 	else
@@ -391,6 +430,9 @@ static void ce_tasklet(unsigned long data)
 	struct HIF_CE_state *hif_ce_state = tasklet_entry->hif_ce_state;
 	struct hif_softc *scn = HIF_GET_SOFTC(hif_ce_state);
 	struct CE_state *CE_state = scn->ce_id_to_state[tasklet_entry->ce_id];
+	qdf_prof_ts_t prof_ts;
+
+	ce_tasklet_prof_entry(tasklet_entry);
 
 	hif_record_ce_desc_event(scn, tasklet_entry->ce_id,
 				 HIF_CE_TASKLET_ENTRY, NULL, NULL, -1, 0);
@@ -406,7 +448,9 @@ static void ce_tasklet(unsigned long data)
 		QDF_BUG(0);
 	}
 
+	prof_ts = qdf_prof_start();
 	ce_per_engine_service(scn, tasklet_entry->ce_id);
+	qdf_prof_end(QDF_PROF_CE_TASKLET_EXEC, prof_ts);
 
 	if (ce_check_rx_pending(CE_state) && tasklet_entry->inited) {
 		/*
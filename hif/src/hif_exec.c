@@ -529,6 +529,42 @@ static void hif_exec_tasklet_fn(unsigned long data)
 	}
 }
 
+#ifdef QDF_LATENCY_PROFILE
+/**
+ * hif_exec_prof_irq() - stamp the group IRQ for the latency profiler
+ * @hif_ext_group: hif exec context
+ *
+ * return: None
+ */
+static inline void hif_exec_prof_irq(struct hif_exec_context *hif_ext_group)
+{
+	hif_ext_group->prof_irq_ts = qdf_prof_start();
+}
+
+/**
+ * hif_exec_prof_poll() - account IRQ to poll latency in the profiler
+ * @hif_ext_group: hif exec context
+ *
+ * The stamp is consumed so that rescheduled polls without a new IRQ are
+ * not accounted again.
+ *
+ * return: None
+ */
+static inline void hif_exec_prof_poll(struct hif_exec_context *hif_ext_group)
+{
+	qdf_prof_end(QDF_PROF_HIF_IRQ_TO_POLL, hif_ext_group->prof_irq_ts);
+	hif_ext_group->prof_irq_ts = 0;
+}
+#else
+static inline void hif_exec_prof_irq(struct hif_exec_context *hif_ext_group)
+{
+}
+
+static inline void hif_exec_prof_poll(struct hif_exec_context *hif_ext_group)
+{
+}
+#endif
+
 /**
  * hif_latency_profile_measure() - calculate latency and update histogram
  * hif_ext_group: hif exec context
@@ -550,6 +586,8 @@ static void hif_latency_profile_measure(struct hif_exec_context *hif_ext_group)
 
 	hif_ext_group->tstamp = cur_tstamp;
 
+	hif_exec_prof_poll(hif_ext_group);
+
 	if (time_elapsed <= HIF_SCHED_LATENCY_BUCKET_0_2)
 		hif_ext_group->sched_latency_stats[0]++;
 	else if (time_elapsed <= HIF_SCHED_LATENCY_BUCKET_3_10)
@@ -571,6 +609,7 @@ static void hif_latency_profile_measure(struct hif_exec_context *hif_ext_group)
 static inline
 void hif_latency_profile_measure(struct hif_exec_context *hif_ext_group)
 {
+	hif_exec_prof_poll(hif_ext_group);
 }
 #endif
 
@@ -584,11 +623,13 @@ void hif_latency_profile_measure(struct hif_exec_context *hif_ext_group)
 static void hif_latency_profile_start(struct hif_exec_context *hif_ext_group)
 {
 	hif_ext_group->tstamp = qdf_ktime_to_ms(qdf_ktime_get());
+	hif_exec_prof_irq(hif_ext_group);
 }
 #else
 static inline
 void hif_latency_profile_start(struct hif_exec_context *hif_ext_group)
 {
+	hif_exec_prof_irq(hif_ext_group);
 }
 #endif
 
@@ -625,6 +666,7 @@ static int hif_exec_poll(struct napi_struct *napi, int budget)
 	int actual_dones;
 	int shift = hif_ext_group->scale_bin_shift;
 	int cpu = smp_processor_id();
+	qdf_prof_ts_t prof_ts;
 
 	hif_record_event(hif_ext_group->hif, hif_ext_group->grp_id,
 			 0, 0, 0, HIF_EVENT_BH_SCHED);
@@ -637,8 +679,10 @@ static int hif_exec_poll(struct napi_struct *napi, int budget)
 
 	hif_latency_profile_measure(hif_ext_group);
 
+	prof_ts = qdf_prof_start();
 	work_done = hif_ext_group->handler(hif_ext_group->context,
 					   normalized_budget);
+	qdf_prof_end(QDF_PROF_HIF_EXEC_POLL, prof_ts);
 
 	actual_dones = work_done;
 
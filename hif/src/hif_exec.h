@@ -23,6 +23,7 @@
 #include <hif.h>
 #include <hif_irq_affinity.h>
 #include <linux/cpumask.h>
+#include <qdf_func_tracker.h>
 /*Number of buckets for latency*/
 #define HIF_SCHED_LATENCY_BUCKETS 8
 
@@ -67,6 +68,7 @@ struct hif_execution_ops {
  *
  * @sched_latency_stats: schdule latency stats for different latency buckets
  * @tstamp: timestamp when napi poll happens
+ * @prof_irq_ts: latency profiler timestamp of the last group IRQ
  * @irq_disable: called before scheduling the context.
  * @irq_enable: called when the context leaves polling mode
  * @irq_name: pointer to function to return irq name/string mapped to irq number
@@ -97,6 +99,9 @@ struct hif_exec_context {
 	const char* (*irq_name)(int irq_no);
 	uint64_t sched_latency_stats[HIF_SCHED_LATENCY_BUCKETS];
 	uint64_t tstamp;
+#ifdef QDF_LATENCY_PROFILE
+	qdf_prof_ts_t prof_irq_ts;
+#endif
 
 	uint8_t cpu;
 	struct qca_napi_stat stats[NR_CPUS];
@@ -1009,7 +1009,7 @@ uint32_t wlan_scan_get_bss_count_for_scan(struct wlan_objmgr_pdev *pdev,
 					  qdf_time_t scan_start_ts)
 {
 	struct scan_filter *filter;
-	qdf_list_t *list = NULL;
+	struct scan_snapshot *snap;
 	uint32_t count = 0;
 
 	if (!scan_start_ts)
@@ -1022,13 +1022,13 @@ uint32_t wlan_scan_get_bss_count_for_scan(struct wlan_objmgr_pdev *pdev,
 	filter->ignore_auth_enc_type = true;
 	filter->age_threshold = qdf_get_time_of_the_day_ms() - scan_start_ts;
 
-	list = ucfg_scan_get_result(pdev, filter);
+	snap = ucfg_scan_get_snapshot(pdev, filter);
 
 	qdf_mem_free(filter);
 
-	if (list) {
-		count = qdf_list_size(list);
-		ucfg_scan_purge_results(list);
+	if (snap) {
+		count = snap->num_entries;
+		ucfg_scan_put_snapshot(snap);
 	}
 
 	return count;
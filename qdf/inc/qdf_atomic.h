@@ -165,6 +165,37 @@ static inline int32_t qdf_atomic_inc_not_zero(qdf_atomic_t *v)
 	return __qdf_atomic_inc_not_zero(v);
 }
 
+/**
+ * qdf_atomic_cmpxchg() - compare and exchange the value of an atomic variable
+ * @v: A pointer to an opaque atomic variable
+ * @old: Expected current value
+ * @new: Value to be stored if the current value is @old
+ *
+ * The operation is fully ordered.
+ *
+ * Return: The value of the variable before the operation; the exchange took
+ *	place if it is equal to @old
+ */
+static inline int32_t qdf_atomic_cmpxchg(qdf_atomic_t *v, int32_t old,
+					 int32_t new)
+{
+	return __qdf_atomic_cmpxchg(v, old, new);
+}
+
+/**
+ * qdf_atomic_xchg() - exchange the value of an atomic variable
+ * @v: A pointer to an opaque atomic variable
+ * @new: Value to be stored
+ *
+ * The operation is fully ordered.
+ *
+ * Return: The value of the variable before the operation
+ */
+static inline int32_t qdf_atomic_xchg(qdf_atomic_t *v, int32_t new)
+{
+	return __qdf_atomic_xchg(v, new);
+}
+
 /**
  * qdf_atomic_set_bit - Atomically set a bit in memory
  * @nr: bit to set
@@ -199,6 +199,121 @@ int qdf_crypto_aes_gmac(const uint8_t *key, uint16_t key_length,
 int qdf_crypto_aes_128_cmac(const uint8_t *key, const uint8_t *data,
 			    uint16_t len, uint8_t *mic);
 
+/**
+ * struct qdf_crypto_cmac_ctx - Opaque keyed AES 128 CMAC context. It holds
+ * the expanded key and the CMAC subkeys K1 and K2, so that MICs can be
+ * calculated without setting up the cipher for every frame.
+ */
+struct qdf_crypto_cmac_ctx;
+
+/**
+ * struct qdf_crypto_gmac_ctx - Opaque keyed AES GMAC context. It holds the
+ * AEAD transform with the key and the authentication size already set.
+ */
+struct qdf_crypto_gmac_ctx;
+
+/**
+ * struct qdf_crypto_cmac_req - One MIC calculation of a batch
+ * @ctx: Keyed CMAC context of the key to be used
+ * @data: Pointer to data
+ * @len: Length of data
+ * @mic: Pointer to MIC, CMAC_TLEN bytes
+ */
+struct qdf_crypto_cmac_req {
+	const struct qdf_crypto_cmac_ctx *ctx;
+	const uint8_t *data;
+	uint16_t len;
+	uint8_t *mic;
+};
+
+/**
+ * qdf_crypto_aes_128_cmac_ctx_create: This API creates a keyed AES 128 CMAC
+ * context
+ * @key: key used for operation, AES 128 key size
+ *
+ * The context has to be destroyed using qdf_crypto_aes_128_cmac_ctx_destroy()
+ * when the key is deleted.
+ *
+ * Return: Pointer to the context if success else NULL
+ */
+struct qdf_crypto_cmac_ctx *
+qdf_crypto_aes_128_cmac_ctx_create(const uint8_t *key);
+
+/**
+ * qdf_crypto_aes_128_cmac_ctx_destroy: This API destroys a keyed AES 128 CMAC
+ * context and clears the key material held by it
+ * @ctx: keyed CMAC context
+ *
+ * Return: None
+ */
+void qdf_crypto_aes_128_cmac_ctx_destroy(struct qdf_crypto_cmac_ctx *ctx);
+
+/**
+ * qdf_crypto_aes_128_cmac_keyed: This API calculates MIC for AES 128 CMAC
+ * using a keyed context
+ * @ctx: keyed CMAC context
+ * @data: Pointer to data
+ * @len: Length of data
+ * @mic: Pointer to MIC
+ *
+ * Return: 0 if success else Error number
+ */
+int qdf_crypto_aes_128_cmac_keyed(const struct qdf_crypto_cmac_ctx *ctx,
+				  const uint8_t *data, uint16_t len,
+				  uint8_t *mic);
+
+/**
+ * qdf_crypto_aes_128_cmac_batch: This API calculates AES 128 CMAC MICs for a
+ * batch of requests, for example the beacons of several vdevs
+ * @reqs: array of requests
+ * @num_reqs: number of requests
+ *
+ * All the requests are processed even if some of them fail.
+ *
+ * Return: 0 if all the requests succeed else Error number of the first
+ * failed request
+ */
+int qdf_crypto_aes_128_cmac_batch(const struct qdf_crypto_cmac_req *reqs,
+				  uint32_t num_reqs);
+
+/**
+ * qdf_crypto_aes_gmac_ctx_create: This API creates a keyed AES GMAC context
+ * @key: key used for operation
+ * @key_length: key length
+ *
+ * The context has to be destroyed using qdf_crypto_aes_gmac_ctx_destroy()
+ * when the key is deleted.
+ *
+ * Return: Pointer to the context if success else NULL
+ */
+struct qdf_crypto_gmac_ctx *
+qdf_crypto_aes_gmac_ctx_create(const uint8_t *key, uint16_t key_length);
+
+/**
+ * qdf_crypto_aes_gmac_ctx_destroy: This API destroys a keyed AES GMAC context
+ * @ctx: keyed GMAC context
+ *
+ * Return: None
+ */
+void qdf_crypto_aes_gmac_ctx_destroy(struct qdf_crypto_gmac_ctx *ctx);
+
+/**
+ * qdf_crypto_aes_gmac_keyed: This API calculates MIC for GMAC using a keyed
+ * context
+ * @ctx: keyed GMAC context
+ * @iv: Initialization vector
+ * @aad: Additional authentication data
+ * @data: Pointer to data
+ * @data_len: Length of data
+ * @mic: Pointer to MIC
+ *
+ * Return: 0 if success else Error number
+ */
+int qdf_crypto_aes_gmac_keyed(struct qdf_crypto_gmac_ctx *ctx,
+			      uint8_t *iv, const uint8_t *aad,
+			      const uint8_t *data, uint16_t data_len,
+			      uint8_t *mic);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
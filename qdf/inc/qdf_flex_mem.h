@@ -29,6 +29,11 @@
  * are all of a uniform size. Segments are groups of items, representing the
  * smallest amount of memory that can be dynamically allocated or freed. A pool
  * is simply a collection of segments.
+ *
+ * To keep concurrent users off the pool lock, each CPU slot of the pool may own
+ * one segment. Items are claimed from and returned to the owned segment with
+ * atomic bitmap operations only; the pool lock is taken when the owned segment
+ * is full, or when an item is freed on a CPU which does not own its segment.
  */
 
 #ifndef __QDF_FLEX_MEM_H
@@ -36,34 +41,55 @@
 
 #include "qdf_list.h"
 #include "qdf_lock.h"
+#include "qdf_types.h"
 
-#define QDF_FM_BITMAP uint32_t
+#define QDF_FM_BITMAP unsigned long
 #define QDF_FM_BITMAP_BITS (sizeof(QDF_FM_BITMAP) * 8)
 
+/* number of per-CPU segment owner slots in each pool */
+#define QDF_FM_CPU_SLOTS 8
+
+/**
+ * qdf_flex_mem_cpu_slot - per-CPU segment ownership slot
+ * @busy: bit 0 is set while a context is using this slot
+ * @seg: the segment currently owned by this slot, if any
+ */
+struct qdf_flex_mem_cpu_slot {
+	QDF_FM_BITMAP busy;
+	struct qdf_flex_mem_segment *seg;
+} qdf_cacheline_aligned;
+
 /**
  * qdf_flex_mem_pool - a pool of memory segments
  * @seg_list: the list containing the memory segments
  * @lock: spinlock for protecting internal data structures
  * @reduction_limit: the minimum number of segments to keep during reduction
  * @item_size: the size of the items the pool will allocate
+ * @locked_only: bypass the per-CPU fast path and always take @lock
+ * @slots: per-CPU segment ownership slots
  */
 struct qdf_flex_mem_pool {
 	qdf_list_t seg_list;
 	struct qdf_spinlock lock;
 	uint16_t reduction_limit;
 	uint16_t item_size;
+	bool locked_only;
+	struct qdf_flex_mem_cpu_slot slots[QDF_FM_CPU_SLOTS];
 };
 
 /**
  * qdf_flex_mem_segment - a memory pool segment
  * @node: the list node for membership in the memory pool
  * @dynamic: true if this segment was dynamically allocated
- * @used_bitmap: bitmap for tracking which items in the segment are in use
+ * @owned: true if this segment is owned by one of the pool's CPU slots
+ * @used_bitmap: bitmap for tracking which items in the segment are in use,
+ *	only ever modified with atomic bit operations
  * @bytes: raw memory for allocating items from
  */
 struct qdf_flex_mem_segment {
 	qdf_list_node_t node;
 	bool dynamic;
+	bool owned;
 	QDF_FM_BITMAP used_bitmap;
 	uint8_t *bytes;
 };
@@ -108,9 +134,11 @@ void qdf_flex_mem_deinit(struct qdf_flex_mem_pool *pool);
  * qdf_flex_mem_alloc() - logically allocate memory from the pool
  * @pool: the pool to allocate from
  *
- * This function returns any unused item from any existing segment in the pool.
- * If there are no unused items in the pool, a new segment is dynamically
- * allocated to service the request. The size of the allocated memory is the
+ * This function returns an unused item from the segment owned by the calling
+ * CPU if possible, without taking the pool lock. Otherwise it returns any
+ * unused item from any existing segment in the pool. If there are no unused
+ * items in the pool, a new segment is dynamically allocated to service the
+ * request. The size of the allocated memory is the
  * size originally used to create the pool.
  *
  * Return: Point to newly allocated memory, NULL on failure
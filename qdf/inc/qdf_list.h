@@ -110,6 +110,18 @@ static inline void qdf_list_create(__qdf_list_t *list, uint32_t max_size)
 #define qdf_list_first_entry_or_null(list_ptr, type, node_field) \
 	__qdf_list_first_entry_or_null(list_ptr, type, node_field)
 
+/**
+ * qdf_list_for_each_rcu() - iterate an RCU protected list
+ * @list_ptr: pointer to the list
+ * @cursor: entry pointer used as the loop cursor
+ * @node_field: name of the qdf_list_node_t member in the entry
+ *
+ * Must be used inside qdf_rcu_read_lock()/qdf_rcu_read_unlock(), on a list
+ * updated with qdf_list_insert_back_rcu() and qdf_list_remove_node_rcu().
+ */
+#define qdf_list_for_each_rcu(list_ptr, cursor, node_field) \
+	__qdf_list_for_each_rcu(list_ptr, cursor, node_field)
+
 /**
  * qdf_init_list_head() - initialize list head
  * @list_head: pointer to list head
@@ -158,6 +170,8 @@ static inline uint32_t qdf_list_max_size(qdf_list_t *list)
 
 QDF_STATUS qdf_list_insert_back(qdf_list_t *list, qdf_list_node_t *node);
 
+QDF_STATUS qdf_list_insert_back_rcu(qdf_list_t *list, qdf_list_node_t *node);
+
 QDF_STATUS qdf_list_remove_back(qdf_list_t *list, qdf_list_node_t **node1);
 
 QDF_STATUS qdf_list_peek_front(qdf_list_t *list, qdf_list_node_t **node1);
@@ -165,6 +179,9 @@ QDF_STATUS qdf_list_peek_front(qdf_list_t *list, qdf_list_node_t **node1);
 QDF_STATUS qdf_list_remove_node(qdf_list_t *list,
 				qdf_list_node_t *node_to_remove);
 
+QDF_STATUS qdf_list_remove_node_rcu(qdf_list_t *list,
+				    qdf_list_node_t *node_to_remove);
+
 bool qdf_list_empty(qdf_list_t *list);
 
 /**
@@ -616,6 +616,52 @@ static inline void qdf_mempool_free(qdf_device_t osdev, qdf_mempool_t pool,
 	__qdf_mempool_free(osdev, pool, buf);
 }
 
+/**
+ * qdf_mempool_alloc_bulk() - Allocate multiple elements from memory pool
+ * @osdev: platform device object
+ * @pool: Handle to memory pool
+ * @bufs: array to be filled with the allocated elements
+ * @num: number of elements requested
+ *
+ * Return: number of elements allocated, which may be less than @num
+ */
+static inline int qdf_mempool_alloc_bulk(qdf_device_t osdev,
+					 qdf_mempool_t pool,
+					 void **bufs, int num)
+{
+	return __qdf_mempool_alloc_bulk(osdev, pool, bufs, num);
+}
+
+/**
+ * qdf_mempool_free_bulk() - Free multiple memory pool elements
+ * @osdev: platform device object
+ * @pool: Handle to memory pool
+ * @bufs: elements to be freed
+ * @num: number of elements in @bufs
+ *
+ * Return: none
+ */
+static inline void qdf_mempool_free_bulk(qdf_device_t osdev,
+					 qdf_mempool_t pool,
+					 void **bufs, int num)
+{
+	__qdf_mempool_free_bulk(osdev, pool, bufs, num);
+}
+
+/**
+ * qdf_mempool_stats_print() - print usage of all preallocated mempools
+ * @print: the print adapter function
+ * @print_priv: the private data to be consumed by @print
+ *
+ * For each pool this prints the free count, the number of elements parked
+ * in per-CPU caches, the high watermark of elements handed out to callers
+ * and the per-CPU cache hit rate.
+ *
+ * Return: none
+ */
+void qdf_mempool_stats_print(int (*print)(void *priv, const char *fmt, ...),
+			     void *print_priv);
+
 void qdf_mem_dma_sync_single_for_device(qdf_device_t osdev,
 					qdf_dma_addr_t bus_addr,
 					qdf_size_t size,
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+/**
+ * DOC: qdf_rcu.h
+ * This file provides OS abstraction for read-copy-update (RCU) APIs.
+ *
+ * Readers walk RCU protected data inside qdf_rcu_read_lock() and
+ * qdf_rcu_read_unlock() without taking a lock. Writers still serialize among
+ * themselves and must not free what they unpublished before a grace period
+ * has elapsed, see qdf_call_rcu() and qdf_synchronize_rcu(). Callbacks queued
+ * by qdf_call_rcu() must be flushed with qdf_rcu_barrier() before teardown.
+ */
+
+#ifndef _QDF_RCU_H
+#define _QDF_RCU_H
+
+#include <i_qdf_rcu.h>
+
+/**
+ * typedef qdf_rcu_head_t - RCU callback head, embedded in the object to be
+ *	freed after a grace period
+ */
+typedef __qdf_rcu_head_t qdf_rcu_head_t;
+
+/**
+ * typedef qdf_rcu_cb - RCU callback
+ * @head: RCU callback head of the object
+ */
+typedef void (*qdf_rcu_cb)(qdf_rcu_head_t *head);
+
+/**
+ * qdf_rcu_read_lock() - Mark the beginning of an RCU read-side section
+ *
+ * The section must not sleep.
+ *
+ * Return: None
+ */
+static inline void qdf_rcu_read_lock(void)
+{
+	__qdf_rcu_read_lock();
+}
+
+/**
+ * qdf_rcu_read_unlock() - Mark the end of an RCU read-side section
+ *
+ * Return: None
+ */
+static inline void qdf_rcu_read_unlock(void)
+{
+	__qdf_rcu_read_unlock();
+}
+
+/**
+ * qdf_call_rcu() - Invoke a callback once all current readers are done
+ * @head: RCU callback head embedded in the object
+ * @func: callback, typically freeing the object
+ *
+ * Can be called from atomic context. The callback runs in softirq context.
+ *
+ * Return: None
+ */
+static inline void qdf_call_rcu(qdf_rcu_head_t *head, qdf_rcu_cb func)
+{
+	__qdf_call_rcu(head, func);
+}
+
+/**
+ * qdf_synchronize_rcu() - Wait until all current readers are done
+ *
+ * Sleeps, must be called from process context.
+ *
+ * Return: None
+ */
+static inline void qdf_synchronize_rcu(void)
+{
+	__qdf_synchronize_rcu();
+}
+
+/**
+ * qdf_rcu_barrier() - Wait until all queued RCU callbacks have run
+ *
+ * Call this before the memory or code the callbacks use goes away, e.g.
+ * before memory leak checks or module unload. Sleeps, must be called from
+ * process context.
+ *
+ * Return: None
+ */
+static inline void qdf_rcu_barrier(void)
+{
+	__qdf_rcu_barrier();
+}
+
+#endif /* _QDF_RCU_H */
@@ -283,4 +283,189 @@ qdf_trace_dp_ce_tasklet_sched_latency(uint8_t ce_id, uint64_t sched_latency)
 {
 	__qdf_trace_dp_ce_tasklet_sched_latency(ce_id, sched_latency);
 }
+
+/**
+ * qdf_trace_dp_rx_msdu_enabled() - Get the dp_rx_msdu tracepoint
+ *  enabled or disabled state
+ *
+ * Return: True if the tracepoint is enabled else false
+ */
+static inline
+bool qdf_trace_dp_rx_msdu_enabled(void)
+{
+	return __qdf_trace_dp_rx_msdu_enabled();
+}
+
+/**
+ * qdf_trace_dp_rx_msdu() - Trace one msdu reaped from a REO ring
+ * @ring_id: ring id
+ * @vdev_id: vdev id
+ * @peer_id: peer id
+ * @tid: tid
+ * @len: msdu length
+ * @status: completion status, 0 where not applicable
+ * @latency: latency in milliseconds, 0 where not applicable
+ *
+ * Return: None
+ */
+static inline
+void qdf_trace_dp_rx_msdu(uint8_t ring_id, uint8_t vdev_id, uint16_t peer_id,
+			  uint8_t tid, uint16_t len, uint8_t status,
+			  uint32_t latency)
+{
+	__qdf_trace_dp_rx_msdu(ring_id, vdev_id, peer_id, tid, len, status,
+			       latency);
+}
+
+/**
+ * qdf_trace_dp_tx_send_msdu_enabled() - Get the dp_tx_send_msdu tracepoint
+ *  enabled or disabled state
+ *
+ * Return: True if the tracepoint is enabled else false
+ */
+static inline
+bool qdf_trace_dp_tx_send_msdu_enabled(void)
+{
+	return __qdf_trace_dp_tx_send_msdu_enabled();
+}
+
+/**
+ * qdf_trace_dp_tx_send_msdu() - Trace one msdu enqueued to a TCL ring
+ * @ring_id: ring id
+ * @vdev_id: vdev id
+ * @peer_id: peer id
+ * @tid: tid
+ * @len: msdu length
+ * @status: completion status, 0 where not applicable
+ * @latency: latency in milliseconds, 0 where not applicable
+ *
+ * Return: None
+ */
+static inline
+void qdf_trace_dp_tx_send_msdu(uint8_t ring_id, uint8_t vdev_id,
+			       uint16_t peer_id, uint8_t tid, uint16_t len,
+			       uint8_t status, uint32_t latency)
+{
+	__qdf_trace_dp_tx_send_msdu(ring_id, vdev_id, peer_id, tid, len, status,
+				    latency);
+}
+
+/**
+ * qdf_trace_dp_tx_comp_msdu_enabled() - Get the dp_tx_comp_msdu tracepoint
+ *  enabled or disabled state
+ *
+ * Return: True if the tracepoint is enabled else false
+ */
+static inline
+bool qdf_trace_dp_tx_comp_msdu_enabled(void)
+{
+	return __qdf_trace_dp_tx_comp_msdu_enabled();
+}
+
+/**
+ * qdf_trace_dp_tx_comp_msdu() - Trace one msdu completed on a WBM ring
+ * @ring_id: ring id
+ * @vdev_id: vdev id
+ * @peer_id: peer id
+ * @tid: tid
+ * @len: msdu length
+ * @status: completion status, 0 where not applicable
+ * @latency: latency in milliseconds, 0 where not applicable
+ *
+ * Return: None
+ */
+static inline
+void qdf_trace_dp_tx_comp_msdu(uint8_t ring_id, uint8_t vdev_id,
+			       uint16_t peer_id, uint8_t tid, uint16_t len,
+			       uint8_t status, uint32_t latency)
+{
+	__qdf_trace_dp_tx_comp_msdu(ring_id, vdev_id, peer_id, tid, len, status,
+				    latency);
+}
+
+/**
+ * qdf_trace_dp_rx_ring_reap_enabled() - Get the dp_rx_ring_reap tracepoint
+ *  enabled or disabled state
+ *
+ * Return: True if the tracepoint is enabled else false
+ */
+static inline
+bool qdf_trace_dp_rx_ring_reap_enabled(void)
+{
+	return __qdf_trace_dp_rx_ring_reap_enabled();
+}
+
+/**
+ * qdf_trace_dp_rx_ring_reap() - Trace one REO destination ring reap
+ * @ring_id: ring id
+ * @hp: ring head pointer
+ * @tp: ring tail pointer
+ * @num_reaped: number of entries reaped
+ * @quota: quota available for the reap
+ *
+ * Return: None
+ */
+static inline
+void qdf_trace_dp_rx_ring_reap(uint8_t ring_id, uint32_t hp, uint32_t tp,
+			       uint32_t num_reaped, uint32_t quota)
+{
+	__qdf_trace_dp_rx_ring_reap(ring_id, hp, tp, num_reaped, quota);
+}
+
+/**
+ * qdf_trace_dp_tx_comp_ring_reap_enabled() - Get the dp_tx_comp_ring_reap
+ *  tracepoint enabled or disabled state
+ *
+ * Return: True if the tracepoint is enabled else false
+ */
+static inline
+bool qdf_trace_dp_tx_comp_ring_reap_enabled(void)
+{
+	return __qdf_trace_dp_tx_comp_ring_reap_enabled();
+}
+
+/**
+ * qdf_trace_dp_tx_comp_ring_reap() - Trace one tx completion ring reap
+ * @ring_id: ring id
+ * @hp: ring head pointer
+ * @tp: ring tail pointer
+ * @num_reaped: number of entries reaped
+ * @quota: quota available for the reap
+ *
+ * Return: None
+ */
+static inline
+void qdf_trace_dp_tx_comp_ring_reap(uint8_t ring_id, uint32_t hp, uint32_t tp,
+				    uint32_t num_reaped, uint32_t quota)
+{
+	__qdf_trace_dp_tx_comp_ring_reap(ring_id, hp, tp, num_reaped, quota);
+}
+
+/**
+ * qdf_trace_dp_rx_peer_deliver_enabled() - Get the dp_rx_peer_deliver
+ *  tracepoint enabled or disabled state
+ *
+ * Return: True if the tracepoint is enabled else false
+ */
+static inline
+bool qdf_trace_dp_rx_peer_deliver_enabled(void)
+{
+	return __qdf_trace_dp_rx_peer_deliver_enabled();
+}
+
+/**
+ * qdf_trace_dp_rx_peer_deliver() - Trace a per-peer list delivered to the stack
+ * @vdev_id: vdev id
+ * @peer_id: peer id
+ * @num_msdus: number of msdus in the list
+ * @num_bytes: number of bytes in the list
+ *
+ * Return: None
+ */
+static inline
+void qdf_trace_dp_rx_peer_deliver(uint8_t vdev_id, uint16_t peer_id,
+				  uint32_t num_msdus, uint32_t num_bytes)
+{
+	__qdf_trace_dp_rx_peer_deliver(vdev_id, peer_id, num_msdus, num_bytes);
+}
 #endif /* _QDF_TRACEPOINT_H */
@@ -90,6 +90,12 @@ typedef struct qdf_sglist {
  */
 #define qdf_packed __qdf_packed
 
+/**
+ * qdf_cacheline_aligned - denotes structure is aligned to a cache line, to
+ *	avoid false sharing between CPUs
+ */
+#define qdf_cacheline_aligned __qdf_cacheline_aligned
+
 /**
  * qdf_toupper - char lower to upper.
  */
@@ -25,6 +25,7 @@
 #define __I_QDF_LIST_H
 
 #include <linux/list.h>
+#include <linux/rculist.h>
 
 /* Type declarations */
 typedef struct list_head __qdf_list_node_t;
@@ -100,6 +101,9 @@ static inline uint32_t __qdf_list_max_size(__qdf_list_t *list)
 #define  __qdf_list_first_entry_or_null(list_ptr, type, node_field) \
 	list_first_entry_or_null(&(list_ptr)->anchor, type, node_field)
 
+#define __qdf_list_for_each_rcu(list_ptr, cursor, node_field) \
+	list_for_each_entry_rcu(cursor, &(list_ptr)->anchor, node_field)
+
 /**
  * __qdf_init_list_head() - initialize list head
  * @list_head: pointer to list head
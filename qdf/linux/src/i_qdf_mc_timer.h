@@ -31,6 +31,7 @@
 #include <linux/time.h>
 #include <linux/jiffies.h>
 #include <linux/rtc.h>
+#include <linux/list.h>
 
 /* Preprocessor definitions and constants */
 
@@ -39,12 +40,30 @@ extern "C" {
 #endif /* __cplusplus */
 /* Type declarations */
 
+#ifdef QDF_MC_TIMER_WHEEL
+/**
+ * typedef qdf_mc_timer_platform_t - platform part of a QDF MC timer
+ * @wheel_node: list node for the timer wheel slot or expired list
+ * @wheel_expires: expiry time in timer wheel ticks
+ * @thread_id: pid of the thread which last started the timer
+ * @cookie: initialization cookie
+ * @spinlock: lock protecting the timer state
+ */
+typedef struct qdf_mc_timer_platform_s {
+	struct list_head wheel_node;
+	unsigned long wheel_expires;
+	int thread_id;
+	uint32_t cookie;
+	qdf_spinlock_t spinlock;
+} qdf_mc_timer_platform_t;
+#else
 typedef struct qdf_mc_timer_platform_s {
 	struct timer_list timer;
 	int thread_id;
 	uint32_t cookie;
 	qdf_spinlock_t spinlock;
 } qdf_mc_timer_platform_t;
+#endif /* QDF_MC_TIMER_WHEEL */
 
 #ifdef __cplusplus
 }
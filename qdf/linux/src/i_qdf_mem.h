@@ -38,6 +38,8 @@
 #include <linux/vmalloc.h>
 #include <linux/pci.h> /* pci_alloc_consistent */
 #include <linux/cache.h> /* L1_CACHE_BYTES */
+#include <linux/percpu.h>
+#include <linux/list.h>
 
 #define __qdf_cache_line_sz L1_CACHE_BYTES
 #include "queue.h"
@@ -77,6 +79,31 @@ typedef struct mempool_elem {
 	STAILQ_ENTRY(mempool_elem) mempool_entry;
 } mempool_elem_t;
 
+/* Number of free elements each CPU may hold in front of the shared list */
+#define __QDF_MEMPOOL_CPU_CACHE_SIZE 32
+/* Number of elements moved between a CPU cache and the shared list at once */
+#define __QDF_MEMPOOL_CPU_CACHE_BATCH (__QDF_MEMPOOL_CPU_CACHE_SIZE / 2)
+
+/**
+ * struct __qdf_mempool_cpu_cache - per-CPU cache of free pool elements
+ * @lock: protects @count and @objs; only contended when another CPU finds
+ *	the shared free list empty and steals from this cache
+ * @count: number of elements currently held in @objs
+ * @in_use: elements allocated minus elements freed on this CPU; the sum over
+ *	all CPUs is the number of elements handed out by the pool
+ * @hits: allocations served directly from this cache
+ * @misses: allocations which had to refill from the shared free list
+ * @objs: cached free elements, used as a LIFO stack
+ */
+struct __qdf_mempool_cpu_cache {
+	spinlock_t lock;
+	u_int32_t count;
+	int32_t in_use;
+	u_int32_t hits;
+	u_int32_t misses;
+	void *objs[__QDF_MEMPOOL_CPU_CACHE_SIZE];
+} ____cacheline_aligned_in_smp;
+
 /**
  * typedef __qdf_mempool_ctxt_t - Memory pool context
  * @pool_id: pool identifier
@@ -84,10 +111,14 @@ typedef struct mempool_elem {
  * @elem_size: size of each pool element in bytes
  * @pool_mem: pool_addr address of the pool created
  * @mem_size: Total size of the pool in bytes
+ * @cpu_cache: per-CPU element caches in front of @free_list
+ * @node: entry in the global list of pools, used for stats
  * @free_list: free pool list
  * @lock: spinlock object
  * @max_elem: Maximum number of elements in tha pool
- * @free_cnt: Number of free elements available
+ * @free_cnt: Number of free elements available in @free_list
+ * @used_max: high watermark of elements handed out by the pool, sampled
+ *	whenever @free_list is accessed
  */
 typedef struct __qdf_mempool_ctxt {
 	int pool_id;
@@ -95,11 +126,14 @@ typedef struct __qdf_mempool_ctxt {
 	size_t elem_size;
 	void *pool_mem;
 	u_int32_t mem_size;
+	struct __qdf_mempool_cpu_cache __percpu *cpu_cache;
+	struct list_head node;
 
-	STAILQ_HEAD(, mempool_elem) free_list;
+	STAILQ_HEAD(, mempool_elem) free_list ____cacheline_aligned_in_smp;
 	spinlock_t lock;
 	u_int32_t max_elem;
 	u_int32_t free_cnt;
+	u_int32_t used_max;
 } __qdf_mempool_ctxt_t;
 
 #endif /* __KERNEL__ */
@@ -210,6 +244,10 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool, int pool_cnt,
 void __qdf_mempool_destroy(qdf_device_t osdev, __qdf_mempool_t pool);
 void *__qdf_mempool_alloc(qdf_device_t osdev, __qdf_mempool_t pool);
 void __qdf_mempool_free(qdf_device_t osdev, __qdf_mempool_t pool, void *buf);
+int __qdf_mempool_alloc_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **bufs, int num);
+void __qdf_mempool_free_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **bufs, int num);
 #define QDF_RET_IP ((void *)_RET_IP_)
 
 #define __qdf_mempool_elem_size(_pool) ((_pool)->elem_size)
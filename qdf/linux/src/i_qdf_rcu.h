@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+/**
+ * DOC: i_qdf_rcu.h
+ * This file provides OS dependent RCU APIs.
+ */
+
+#ifndef _I_QDF_RCU_H
+#define _I_QDF_RCU_H
+
+#include <linux/rcupdate.h>
+
+typedef struct rcu_head __qdf_rcu_head_t;
+
+/**
+ * __qdf_rcu_read_lock() - Mark the beginning of an RCU read-side section
+ *
+ * Return: None
+ */
+static inline void __qdf_rcu_read_lock(void)
+{
+	rcu_read_lock();
+}
+
+/**
+ * __qdf_rcu_read_unlock() - Mark the end of an RCU read-side section
+ *
+ * Return: None
+ */
+static inline void __qdf_rcu_read_unlock(void)
+{
+	rcu_read_unlock();
+}
+
+/**
+ * __qdf_call_rcu() - Invoke a callback after a grace period
+ * @head: RCU callback head embedded in the object
+ * @func: callback
+ *
+ * Return: None
+ */
+static inline void __qdf_call_rcu(__qdf_rcu_head_t *head,
+				  void (*func)(__qdf_rcu_head_t *head))
+{
+	call_rcu(head, func);
+}
+
+/**
+ * __qdf_synchronize_rcu() - Wait for a grace period
+ *
+ * Return: None
+ */
+static inline void __qdf_synchronize_rcu(void)
+{
+	synchronize_rcu();
+}
+
+/**
+ * __qdf_rcu_barrier() - Wait for all queued RCU callbacks
+ *
+ * Return: None
+ */
+static inline void __qdf_rcu_barrier(void)
+{
+	rcu_barrier();
+}
+
+#endif /* _I_QDF_RCU_H */
@@ -54,6 +54,7 @@
 #include <linux/version.h>
 #include <asm/div64.h>
 #include <linux/compiler.h>
+#include <linux/cache.h>
 #include <linux/dma-mapping.h>
 #include <linux/wireless.h>
 #include <linux/if.h>
@@ -163,6 +164,7 @@ typedef enum bool {
 #endif
 
 #define __qdf_packed    __attribute__((packed))
+#define __qdf_cacheline_aligned ____cacheline_aligned_in_smp
 
 typedef int (*__qdf_os_intr)(void *);
 /**
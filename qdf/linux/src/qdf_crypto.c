@@ -249,28 +249,111 @@ static inline void padding(const uint8_t *lastb, uint8_t *pad, uint16_t length)
 	}
 }
 
+/**
+ * struct qdf_crypto_cmac_ctx - keyed AES 128 CMAC context
+ * @aes_ctx: expanded AES key
+ * @tfm: AES cipher transform with the key set
+ * @k1: CMAC subkey K1
+ * @k2: CMAC subkey K2
+ */
+struct qdf_crypto_cmac_ctx {
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 4, 0))
-int qdf_crypto_aes_128_cmac(const uint8_t *key, const uint8_t *data,
-			    uint16_t len, uint8_t *mic)
-{
-	uint8_t x[AES_BLOCK_SIZE], y[AES_BLOCK_SIZE];
-	uint8_t m_last[AES_BLOCK_SIZE], padded[AES_BLOCK_SIZE];
-	uint8_t k1[AES_KEYSIZE_128], k2[AES_KEYSIZE_128];
-	int cmp_blk;
-	int i, num_block = (len + 15) / AES_BLOCK_SIZE;
 	struct crypto_aes_ctx aes_ctx;
+#else
+	struct crypto_cipher *tfm;
+#endif
+	uint8_t k1[AES_BLOCK_SIZE];
+	uint8_t k2[AES_BLOCK_SIZE];
+};
+
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 4, 0))
+static int qdf_crypto_cmac_ctx_setkey(struct qdf_crypto_cmac_ctx *ctx,
+				      const uint8_t *key)
+{
 	int ret;
 
-	/*
-	 * Calculate MIC and then copy
-	 */
-	ret = aes_expandkey(&aes_ctx, key, AES_KEYSIZE_128);
+	ret = aes_expandkey(&ctx->aes_ctx, key, AES_KEYSIZE_128);
 	if (ret) {
 		qdf_err("aes_expandkey failed (%d)", ret);
 		return ret;
 	}
 
-	generate_subkey(&aes_ctx, k1, k2);
+	generate_subkey(&ctx->aes_ctx, ctx->k1, ctx->k2);
+
+	return 0;
+}
+
+static void qdf_crypto_cmac_ctx_clear(struct qdf_crypto_cmac_ctx *ctx)
+{
+	memzero_explicit(ctx, sizeof(*ctx));
+}
+
+static inline void
+qdf_crypto_cmac_encrypt_one(const struct qdf_crypto_cmac_ctx *ctx,
+			    uint8_t *out, const uint8_t *in)
+{
+	aes_encrypt(&ctx->aes_ctx, out, in);
+}
+#else
+static int qdf_crypto_cmac_ctx_setkey(struct qdf_crypto_cmac_ctx *ctx,
+				      const uint8_t *key)
+{
+	int ret;
+
+	ctx->tfm = crypto_alloc_cipher("aes", 0, CRYPTO_ALG_ASYNC);
+	if (IS_ERR(ctx->tfm)) {
+		ret = PTR_ERR(ctx->tfm);
+		ctx->tfm = NULL;
+		qdf_err("crypto_alloc_cipher failed (%d)", ret);
+		return ret;
+	}
+
+	ret = crypto_cipher_setkey(ctx->tfm, key, AES_KEYSIZE_128);
+	if (ret) {
+		qdf_err("crypto_cipher_setkey failed (%d)", ret);
+		crypto_free_cipher(ctx->tfm);
+		ctx->tfm = NULL;
+		return ret;
+	}
+
+	generate_subkey(ctx->tfm, ctx->k1, ctx->k2);
+
+	return 0;
+}
+
+static void qdf_crypto_cmac_ctx_clear(struct qdf_crypto_cmac_ctx *ctx)
+{
+	if (ctx->tfm)
+		crypto_free_cipher(ctx->tfm);
+
+	memzero_explicit(ctx, sizeof(*ctx));
+}
+
+static inline void
+qdf_crypto_cmac_encrypt_one(const struct qdf_crypto_cmac_ctx *ctx,
+			    uint8_t *out, const uint8_t *in)
+{
+	crypto_cipher_encrypt_one(ctx->tfm, out, in);
+}
+#endif
+
+/**
+ * qdf_crypto_cmac_calculate() - calculate AES 128 CMAC using a keyed context
+ * @ctx: keyed CMAC context with the subkeys generated
+ * @data: Pointer to data
+ * @len: Length of data
+ * @mic: Pointer to MIC
+ *
+ * Return: None
+ */
+static void qdf_crypto_cmac_calculate(const struct qdf_crypto_cmac_ctx *ctx,
+				      const uint8_t *data, uint16_t len,
+				      uint8_t *mic)
+{
+	uint8_t x[AES_BLOCK_SIZE], y[AES_BLOCK_SIZE];
+	uint8_t m_last[AES_BLOCK_SIZE], padded[AES_BLOCK_SIZE];
+	int cmp_blk;
+	int i, num_block = (len + 15) / AES_BLOCK_SIZE;
 
 	if (num_block == 0) {
 		num_block = 1;
@@ -281,12 +364,13 @@ int qdf_crypto_aes_128_cmac(const uint8_t *key, const uint8_t *data,
 
 	if (cmp_blk) {
 		/* Last block is complete block */
-		xor_128(&data[AES_BLOCK_SIZE * (num_block - 1)], k1, m_last);
+		xor_128(&data[AES_BLOCK_SIZE * (num_block - 1)], ctx->k1,
+			m_last);
 	} else {
 		/* Last block is not complete block */
 		padding(&data[AES_BLOCK_SIZE * (num_block - 1)], padded,
 			len % AES_BLOCK_SIZE);
-		xor_128(padded, k2, m_last);
+		xor_128(padded, ctx->k2, m_last);
 	}
 
 	for (i = 0; i < AES_BLOCK_SIZE; i++)
@@ -296,85 +380,104 @@ int qdf_crypto_aes_128_cmac(const uint8_t *key, const uint8_t *data,
 		/* y = Mi (+) x */
 		xor_128(x, &data[AES_BLOCK_SIZE * i], y);
 		/* x = AES-128(KEY, y) */
-		aes_encrypt(&aes_ctx, x, y);
+		qdf_crypto_cmac_encrypt_one(ctx, x, y);
 	}
 
 	xor_128(x, m_last, y);
-	aes_encrypt(&aes_ctx, x, y);
-	memzero_explicit(&aes_ctx, sizeof(aes_ctx));
+	qdf_crypto_cmac_encrypt_one(ctx, x, y);
 
 	memcpy(mic, x, CMAC_TLEN);
-
-	return 0;
 }
-#else
+
 int qdf_crypto_aes_128_cmac(const uint8_t *key, const uint8_t *data,
 			    uint16_t len, uint8_t *mic)
 {
-	uint8_t x[AES_BLOCK_SIZE], y[AES_BLOCK_SIZE];
-	uint8_t m_last[AES_BLOCK_SIZE], padded[AES_BLOCK_SIZE];
-	uint8_t k1[AES_KEYSIZE_128], k2[AES_KEYSIZE_128];
-	int cmp_blk;
-	int i, num_block = (len + 15) / AES_BLOCK_SIZE;
-	struct crypto_cipher *tfm;
+	struct qdf_crypto_cmac_ctx ctx;
 	int ret;
 
 	/*
 	 * Calculate MIC and then copy
 	 */
-	tfm = crypto_alloc_cipher("aes", 0, CRYPTO_ALG_ASYNC);
-	if (IS_ERR(tfm)) {
-		ret = PTR_ERR(tfm);
-		qdf_err("crypto_alloc_cipher failed (%d)", ret);
+	ret = qdf_crypto_cmac_ctx_setkey(&ctx, key);
+	if (ret)
 		return ret;
-	}
 
-	ret = crypto_cipher_setkey(tfm, key, AES_KEYSIZE_128);
-	if (ret) {
-		qdf_err("crypto_cipher_setkey failed (%d)", ret);
-		crypto_free_cipher(tfm);
-		return ret;
-	}
+	qdf_crypto_cmac_calculate(&ctx, data, len, mic);
+	qdf_crypto_cmac_ctx_clear(&ctx);
 
-	generate_subkey(tfm, k1, k2);
+	return 0;
+}
 
-	if (num_block == 0) {
-		num_block = 1;
-		cmp_blk = 0;
-	} else {
-		cmp_blk = ((len % AES_BLOCK_SIZE) == 0) ? 1 : 0;
-	}
+struct qdf_crypto_cmac_ctx *
+qdf_crypto_aes_128_cmac_ctx_create(const uint8_t *key)
+{
+	struct qdf_crypto_cmac_ctx *ctx;
 
-	if (cmp_blk) {
-		/* Last block is complete block */
-		xor_128(&data[AES_BLOCK_SIZE * (num_block - 1)], k1, m_last);
-	} else {
-		/* Last block is not complete block */
-		padding(&data[AES_BLOCK_SIZE * (num_block - 1)], padded,
-			len % AES_BLOCK_SIZE);
-		xor_128(padded, k2, m_last);
+	ctx = qdf_mem_malloc(sizeof(*ctx));
+	if (!ctx)
+		return NULL;
+
+	if (qdf_crypto_cmac_ctx_setkey(ctx, key)) {
+		qdf_mem_free(ctx);
+		return NULL;
 	}
 
-	for (i = 0; i < AES_BLOCK_SIZE; i++)
-		x[i] = 0;
+	return ctx;
+}
 
-	for (i = 0; i < (num_block - 1); i++) {
-		/* y = Mi (+) x */
-		xor_128(x, &data[AES_BLOCK_SIZE * i], y);
-		/* x = AES-128(KEY, y) */
-		crypto_cipher_encrypt_one(tfm, x, y);
-	}
+qdf_export_symbol(qdf_crypto_aes_128_cmac_ctx_create);
 
-	xor_128(x, m_last, y);
-	crypto_cipher_encrypt_one(tfm, x, y);
+void qdf_crypto_aes_128_cmac_ctx_destroy(struct qdf_crypto_cmac_ctx *ctx)
+{
+	if (!ctx)
+		return;
+
+	qdf_crypto_cmac_ctx_clear(ctx);
+	qdf_mem_free(ctx);
+}
 
-	crypto_free_cipher(tfm);
+qdf_export_symbol(qdf_crypto_aes_128_cmac_ctx_destroy);
 
-	memcpy(mic, x, CMAC_TLEN);
+int qdf_crypto_aes_128_cmac_keyed(const struct qdf_crypto_cmac_ctx *ctx,
+				  const uint8_t *data, uint16_t len,
+				  uint8_t *mic)
+{
+	if (!ctx || !data || !mic)
+		return -EINVAL;
+
+	qdf_crypto_cmac_calculate(ctx, data, len, mic);
 
 	return 0;
 }
-#endif
+
+qdf_export_symbol(qdf_crypto_aes_128_cmac_keyed);
+
+int qdf_crypto_aes_128_cmac_batch(const struct qdf_crypto_cmac_req *reqs,
+				  uint32_t num_reqs)
+{
+	uint32_t i;
+	int ret = 0;
+
+	if (!reqs)
+		return -EINVAL;
+
+	for (i = 0; i < num_reqs; i++) {
+		const struct qdf_crypto_cmac_req *req = &reqs[i];
+
+		if (!req->ctx || !req->data || !req->mic) {
+			if (!ret)
+				ret = -EINVAL;
+			continue;
+		}
+
+		qdf_crypto_cmac_calculate(req->ctx, req->data, req->len,
+					  req->mic);
+	}
+
+	return ret;
+}
+
+qdf_export_symbol(qdf_crypto_aes_128_cmac_batch);
 
 /**
  * set_desc_flags() - set flags variable in the shash_desc struct
@@ -660,48 +763,85 @@ int qdf_aes_ctr(const uint8_t *key, unsigned int key_len, uint8_t *siv,
 #endif
 
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(4, 4, 0))
-int qdf_crypto_aes_gmac(const uint8_t *key, uint16_t key_length,
-			uint8_t *iv, const uint8_t *aad,
-			const uint8_t *data, uint16_t data_len, uint8_t *mic)
-{
+/**
+ * struct qdf_crypto_gmac_ctx - keyed AES GMAC context
+ * @tfm: AEAD transform with the key and the authentication size set
+ */
+struct qdf_crypto_gmac_ctx {
 	struct crypto_aead *tfm;
-	int ret = 0;
-	struct scatterlist sg[4];
-	uint16_t req_size;
-	struct aead_request *req = NULL;
-	uint8_t *aad_ptr, *input;
+};
 
-	tfm = crypto_alloc_aead("gcm(aes)", 0, CRYPTO_ALG_ASYNC);
-	if (IS_ERR(tfm)) {
-		ret = PTR_ERR(tfm);
-		tfm = NULL;
+/**
+ * qdf_crypto_gmac_alloc_tfm() - allocate a keyed gcm(aes) transform
+ * @key: key used for operation
+ * @key_length: key length
+ * @tfm: Pointer to the allocated transform
+ *
+ * Return: 0 if success else Error number
+ */
+static int qdf_crypto_gmac_alloc_tfm(const uint8_t *key, uint16_t key_length,
+				     struct crypto_aead **tfm)
+{
+	int ret;
+
+	*tfm = crypto_alloc_aead("gcm(aes)", 0, CRYPTO_ALG_ASYNC);
+	if (IS_ERR(*tfm)) {
+		ret = PTR_ERR(*tfm);
+		*tfm = NULL;
 		QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_ERROR,
 			  "%s: crypto_alloc_aead failed (%d)", __func__, ret);
-		goto err_tfm;
+		return ret;
 	}
 
-	ret = crypto_aead_setkey(tfm, key, key_length);
+	ret = crypto_aead_setkey(*tfm, key, key_length);
 	if (ret) {
 		QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_ERROR,
 			  "crypto_aead_setkey failed (%d)", ret);
 		goto err_tfm;
 	}
 
-	ret = crypto_aead_setauthsize(tfm, IEEE80211_MMIE_GMAC_MICLEN);
+	ret = crypto_aead_setauthsize(*tfm, IEEE80211_MMIE_GMAC_MICLEN);
 	if (ret) {
 		QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_ERROR,
 			  "crypto_aead_setauthsize failed (%d)", ret);
 		goto err_tfm;
 	}
 
+	return 0;
+
+err_tfm:
+	crypto_free_aead(*tfm);
+	*tfm = NULL;
+
+	return ret;
+}
+
+/**
+ * qdf_crypto_gmac_calculate() - calculate GMAC MIC using a keyed transform
+ * @tfm: keyed gcm(aes) transform
+ * @iv: Initialization vector
+ * @aad: Additional authentication data
+ * @data: Pointer to data
+ * @data_len: Length of data
+ * @mic: Pointer to MIC
+ *
+ * Return: 0 if success else Error number
+ */
+static int qdf_crypto_gmac_calculate(struct crypto_aead *tfm, uint8_t *iv,
+				     const uint8_t *aad, const uint8_t *data,
+				     uint16_t data_len, uint8_t *mic)
+{
+	struct scatterlist sg[4];
+	uint16_t req_size;
+	struct aead_request *req;
+	uint8_t *aad_ptr, *input;
+
 	/* Prepare aead request */
 	req_size = sizeof(*req) + crypto_aead_reqsize(tfm) +
 			IEEE80211_MMIE_GMAC_MICLEN + AAD_LEN;
 	req = qdf_mem_malloc(req_size);
-	if (!req) {
-		ret = -ENOMEM;
-		goto err_tfm;
-	}
+	if (!req)
+		return -ENOMEM;
 
 	input = (uint8_t *)req + sizeof(*req) + crypto_aead_reqsize(tfm);
 	aad_ptr = input + IEEE80211_MMIE_GMAC_MICLEN;
@@ -720,15 +860,66 @@ int qdf_crypto_aes_gmac(const uint8_t *key, uint16_t key_length,
 			    AAD_LEN + data_len + IEEE80211_MMIE_GMAC_MICLEN);
 	crypto_aead_encrypt(req);
 
-err_tfm:
-	if (tfm)
-		crypto_free_aead(tfm);
+	qdf_mem_free(req);
+
+	return 0;
+}
 
-	if (req)
-		qdf_mem_free(req);
+int qdf_crypto_aes_gmac(const uint8_t *key, uint16_t key_length,
+			uint8_t *iv, const uint8_t *aad,
+			const uint8_t *data, uint16_t data_len, uint8_t *mic)
+{
+	struct crypto_aead *tfm;
+	int ret;
+
+	ret = qdf_crypto_gmac_alloc_tfm(key, key_length, &tfm);
+	if (ret)
+		return ret;
+
+	ret = qdf_crypto_gmac_calculate(tfm, iv, aad, data, data_len, mic);
+
+	crypto_free_aead(tfm);
 
 	return ret;
 }
+
+struct qdf_crypto_gmac_ctx *
+qdf_crypto_aes_gmac_ctx_create(const uint8_t *key, uint16_t key_length)
+{
+	struct qdf_crypto_gmac_ctx *ctx;
+
+	ctx = qdf_mem_malloc(sizeof(*ctx));
+	if (!ctx)
+		return NULL;
+
+	if (qdf_crypto_gmac_alloc_tfm(key, key_length, &ctx->tfm)) {
+		qdf_mem_free(ctx);
+		return NULL;
+	}
+
+	return ctx;
+}
+
+void qdf_crypto_aes_gmac_ctx_destroy(struct qdf_crypto_gmac_ctx *ctx)
+{
+	if (!ctx)
+		return;
+
+	crypto_free_aead(ctx->tfm);
+	qdf_mem_free(ctx);
+}
+
+int qdf_crypto_aes_gmac_keyed(struct qdf_crypto_gmac_ctx *ctx,
+			      uint8_t *iv, const uint8_t *aad,
+			      const uint8_t *data, uint16_t data_len,
+			      uint8_t *mic)
+{
+	if (!ctx)
+		return -EINVAL;
+
+	return qdf_crypto_gmac_calculate(ctx->tfm, iv, aad, data, data_len,
+					 mic);
+}
 #else
 int qdf_crypto_aes_gmac(uint8_t *key, uint16_t key_length,
 			uint8_t *iv, uint8_t *aad, uint8_t *data,
@@ -736,4 +927,26 @@ int qdf_crypto_aes_gmac(uint8_t *key, uint16_t key_length,
 {
 	return -EINVAL;
 }
+
+struct qdf_crypto_gmac_ctx *
+qdf_crypto_aes_gmac_ctx_create(const uint8_t *key, uint16_t key_length)
+{
+	return NULL;
+}
+
+void qdf_crypto_aes_gmac_ctx_destroy(struct qdf_crypto_gmac_ctx *ctx)
+{
+}
+
+int qdf_crypto_aes_gmac_keyed(struct qdf_crypto_gmac_ctx *ctx,
+			      uint8_t *iv, const uint8_t *aad,
+			      const uint8_t *data, uint16_t data_len,
+			      uint8_t *mic)
+{
+	return -EINVAL;
+}
 #endif
+
+qdf_export_symbol(qdf_crypto_aes_gmac_ctx_create);
+qdf_export_symbol(qdf_crypto_aes_gmac_ctx_destroy);
+qdf_export_symbol(qdf_crypto_aes_gmac_keyed);
@@ -17,6 +17,12 @@
  */
 
 #include <linux/string.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/delay.h>
+#include <linux/ktime.h>
+#include <linux/math64.h>
+#include <qdf_debugfs.h>
 #include <qdf_func_tracker.h>
 #include <qdf_mem.h>
 #include <qdf_module.h>
@@ -52,3 +58,212 @@ void qdf_clear_func_call_map(void)
 qdf_export_symbol(qdf_clear_func_call_map);
 
 #endif
+
+#ifdef QDF_LATENCY_PROFILE
+DEFINE_PER_CPU(struct qdf_prof_cpu_stats, qdf_prof_cpu_stats);
+EXPORT_PER_CPU_SYMBOL(qdf_prof_cpu_stats);
+
+static const char * const qdf_prof_probe_name[QDF_PROF_PROBE_MAX] = {
+	[QDF_PROF_HIF_IRQ_TO_POLL] = "hif_irq_to_poll",
+	[QDF_PROF_HIF_EXEC_POLL] = "hif_exec_poll",
+	[QDF_PROF_CE_TASKLET_SCHED] = "ce_tasklet_sched",
+	[QDF_PROF_CE_TASKLET_EXEC] = "ce_tasklet_exec",
+	[QDF_PROF_DP_RX_PROCESS] = "dp_rx_process",
+	[QDF_PROF_DP_TX_COMP] = "dp_tx_comp_handler",
+	[QDF_PROF_DP_RX_DELIVER] = "dp_rx_deliver_to_stack",
+	[QDF_PROF_HAL_SRNG_ACCESS_END] = "hal_srng_access_end",
+	[QDF_PROF_WMI_RX_EVENT] = "wmi_rx_event",
+	[QDF_PROF_SCHED_MSG] = "scheduler_msg",
+};
+
+/* cycle counter ticks per microsecond, 0 if the counter is not usable */
+static uint64_t qdf_prof_cycles_per_us;
+
+/**
+ * qdf_prof_cycles_to_ns() - convert a cycle count to nanoseconds
+ * @cycles: cycle count
+ *
+ * Return: nanoseconds, or @cycles when the counter was not calibrated
+ */
+static uint64_t qdf_prof_cycles_to_ns(uint64_t cycles)
+{
+	if (!qdf_prof_cycles_per_us)
+		return cycles;
+
+	return div64_u64(cycles * 1000, qdf_prof_cycles_per_us);
+}
+
+/**
+ * qdf_prof_calibrate() - measure the cycle counter rate against ktime
+ *
+ * Return: None
+ */
+static void qdf_prof_calibrate(void)
+{
+	cycles_t c0, c1;
+	ktime_t t0, t1;
+	int64_t us;
+
+	t0 = ktime_get();
+	c0 = get_cycles();
+	udelay(1000);
+	c1 = get_cycles();
+	t1 = ktime_get();
+
+	us = ktime_us_delta(t1, t0);
+	if (us <= 0 || c1 <= c0)
+		qdf_prof_cycles_per_us = 0;
+	else
+		qdf_prof_cycles_per_us = div64_u64(c1 - c0, us);
+}
+
+void qdf_prof_clear(void)
+{
+	int cpu;
+
+	for_each_possible_cpu(cpu)
+		memset(per_cpu_ptr(&qdf_prof_cpu_stats, cpu), 0,
+		       sizeof(struct qdf_prof_cpu_stats));
+}
+
+qdf_export_symbol(qdf_prof_clear);
+
+#ifdef WLAN_DEBUGFS
+static struct dentry *qdf_prof_dentry;
+
+/**
+ * qdf_prof_show() - dump the aggregated latency histograms
+ * @seq: seq_file handle
+ * @v: current iterator
+ *
+ * Per-CPU histograms are summed at read time; only non-empty buckets of
+ * probes that fired are printed. Bucket bounds are in nanoseconds, or in
+ * raw cycles when the counter could not be calibrated.
+ *
+ * Return: 0 - success
+ */
+static int qdf_prof_show(struct seq_file *seq, void *v)
+{
+	uint64_t hist[QDF_PROF_HIST_BUCKETS];
+	uint64_t count, total, max;
+	struct qdf_prof_cpu_stats *stats;
+	int probe, bucket, cpu;
+
+	seq_printf(seq, "cycles/us: %llu (%s)\n", qdf_prof_cycles_per_us,
+		   qdf_prof_cycles_per_us ? "ns" : "cycles");
+
+	for (probe = 0; probe < QDF_PROF_PROBE_MAX; probe++) {
+		memset(hist, 0, sizeof(hist));
+		count = 0;
+		total = 0;
+		max = 0;
+
+		for_each_possible_cpu(cpu) {
+			stats = per_cpu_ptr(&qdf_prof_cpu_stats, cpu);
+			for (bucket = 0; bucket < QDF_PROF_HIST_BUCKETS;
+			     bucket++) {
+				hist[bucket] += stats->hist[probe][bucket];
+				count += stats->hist[probe][bucket];
+			}
+			total += stats->total[probe];
+			if (stats->max[probe] > max)
+				max = stats->max[probe];
+		}
+
+		if (!count)
+			continue;
+
+		seq_printf(seq, "\n%s: count %llu avg %llu max %llu\n",
+			   qdf_prof_probe_name[probe], count,
+			   qdf_prof_cycles_to_ns(div64_u64(total, count)),
+			   qdf_prof_cycles_to_ns(max));
+
+		for (bucket = 0; bucket < QDF_PROF_HIST_BUCKETS; bucket++) {
+			if (!hist[bucket])
+				continue;
+
+			seq_printf(seq, "  < %-12llu %llu\n",
+				   qdf_prof_cycles_to_ns(1ULL << bucket),
+				   hist[bucket]);
+		}
+	}
+
+	return 0;
+}
+
+static int qdf_prof_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, qdf_prof_show, inode->i_private);
+}
+
+/**
+ * qdf_prof_write() - any write to the dump file clears the histograms
+ * @file: file handle
+ * @buf: user buffer, ignored
+ * @len: length of @buf
+ * @off: file offset, ignored
+ *
+ * Return: @len
+ */
+static ssize_t qdf_prof_write(struct file *file, const char __user *buf,
+			      size_t len, loff_t *off)
+{
+	qdf_prof_clear();
+
+	return len;
+}
+
+/* file operation table for the latency profile dump */
+static const struct file_operations fops_qdf_prof = {
+	.owner = THIS_MODULE,
+	.open = qdf_prof_open,
+	.read = seq_read,
+	.write = qdf_prof_write,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+
+static void qdf_prof_debugfs_init(void)
+{
+	struct dentry *qdf_debugfs_root = qdf_debugfs_get_root();
+
+	if (!qdf_debugfs_root)
+		return;
+
+	qdf_prof_dentry = debugfs_create_file("latency_profile",
+					      0600,
+					      qdf_debugfs_root,
+					      NULL,
+					      &fops_qdf_prof);
+}
+
+static void qdf_prof_debugfs_exit(void)
+{
+	debugfs_remove(qdf_prof_dentry);
+	qdf_prof_dentry = NULL;
+}
+#else
+static void qdf_prof_debugfs_init(void)
+{
+}
+
+static void qdf_prof_debugfs_exit(void)
+{
+}
+#endif /* WLAN_DEBUGFS */
+
+void qdf_prof_init(void)
+{
+	qdf_prof_calibrate();
+	qdf_prof_debugfs_init();
+}
+
+qdf_export_symbol(qdf_prof_init);
+
+void qdf_prof_deinit(void)
+{
+	qdf_prof_debugfs_exit();
+}
+
+qdf_export_symbol(qdf_prof_deinit);
+#endif /* QDF_LATENCY_PROFILE */
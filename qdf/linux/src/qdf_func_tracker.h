@@ -19,6 +19,8 @@
 #ifndef QDF_FUNC_TRACKER_H
 #define QDF_FUNC_TRACKER_H
 
+#include <qdf_types.h>
+
 #ifdef FUNC_CALL_MAP
 
 #define QDF_FUNCTION_CALL_MAP_BUF_LEN 4096
@@ -64,4 +66,145 @@ static inline void qdf_clear_func_call_map(void)
 }
 
 #endif
+
+/**
+ * enum qdf_prof_probe - named latency probe points
+ * @QDF_PROF_HIF_IRQ_TO_POLL: ext group hard IRQ to start of NAPI/tasklet poll
+ * @QDF_PROF_HIF_EXEC_POLL: ext group handler run time within one poll
+ * @QDF_PROF_CE_TASKLET_SCHED: CE tasklet schedule to tasklet entry
+ * @QDF_PROF_CE_TASKLET_EXEC: CE tasklet run time
+ * @QDF_PROF_DP_RX_PROCESS: dp_rx_process() run time for one reap
+ * @QDF_PROF_DP_TX_COMP: dp_tx_comp_handler() run time for one reap
+ * @QDF_PROF_DP_RX_DELIVER: hand-off of one MSDU list to the OS stack
+ * @QDF_PROF_HAL_SRNG_ACCESS_END: HAL SRNG head/tail pointer update
+ * @QDF_PROF_WMI_RX_EVENT: WMI event dispatch to the registered handler
+ * @QDF_PROF_SCHED_MSG: scheduler thread message callback run time
+ * @QDF_PROF_PROBE_MAX: number of probe points
+ */
+enum qdf_prof_probe {
+	QDF_PROF_HIF_IRQ_TO_POLL,
+	QDF_PROF_HIF_EXEC_POLL,
+	QDF_PROF_CE_TASKLET_SCHED,
+	QDF_PROF_CE_TASKLET_EXEC,
+	QDF_PROF_DP_RX_PROCESS,
+	QDF_PROF_DP_TX_COMP,
+	QDF_PROF_DP_RX_DELIVER,
+	QDF_PROF_HAL_SRNG_ACCESS_END,
+	QDF_PROF_WMI_RX_EVENT,
+	QDF_PROF_SCHED_MSG,
+	QDF_PROF_PROBE_MAX
+};
+
+#ifdef QDF_LATENCY_PROFILE
+#include <linux/percpu.h>
+#include <linux/timex.h>
+#include <linux/log2.h>
+
+/* log2 buckets of cycle counter deltas; last bucket collects the tail */
+#define QDF_PROF_HIST_BUCKETS 32
+
+typedef cycles_t qdf_prof_ts_t;
+
+/**
+ * struct qdf_prof_cpu_stats - per-CPU latency histograms
+ * @hist: per probe log2 histogram of cycle counter deltas
+ * @total: per probe sum of all deltas, in cycles
+ * @max: per probe largest delta seen on this CPU, in cycles
+ */
+struct qdf_prof_cpu_stats {
+	uint64_t hist[QDF_PROF_PROBE_MAX][QDF_PROF_HIST_BUCKETS];
+	uint64_t total[QDF_PROF_PROBE_MAX];
+	uint64_t max[QDF_PROF_PROBE_MAX];
+};
+
+DECLARE_PER_CPU(struct qdf_prof_cpu_stats, qdf_prof_cpu_stats);
+
+/**
+ * qdf_prof_start() - sample the cycle counter at the start of a probe
+ *
+ * Return: opaque timestamp to be passed to qdf_prof_end()
+ */
+static inline qdf_prof_ts_t qdf_prof_start(void)
+{
+	return get_cycles();
+}
+
+/**
+ * qdf_prof_end() - account the time elapsed since @start against @probe
+ * @probe: probe point
+ * @start: timestamp returned by qdf_prof_start(), possibly on another CPU
+ *
+ * A zero @start means the probe was never started and is ignored. The
+ * sample is accounted on the CPU that ends the probe.
+ *
+ * Return: None
+ */
+static inline void qdf_prof_end(enum qdf_prof_probe probe,
+				qdf_prof_ts_t start)
+{
+	qdf_prof_ts_t delta;
+	unsigned int bucket;
+
+	if (!start)
+		return;
+
+	delta = get_cycles() - start;
+	if ((int64_t)delta < 0)
+		return;
+
+	bucket = delta ? ilog2((uint64_t)delta) + 1 : 0;
+	if (bucket >= QDF_PROF_HIST_BUCKETS)
+		bucket = QDF_PROF_HIST_BUCKETS - 1;
+
+	this_cpu_inc(qdf_prof_cpu_stats.hist[probe][bucket]);
+	this_cpu_add(qdf_prof_cpu_stats.total[probe], delta);
+	if (delta > this_cpu_read(qdf_prof_cpu_stats.max[probe]))
+		this_cpu_write(qdf_prof_cpu_stats.max[probe], delta);
+}
+
+/**
+ * qdf_prof_init() - calibrate the cycle counter and create the debugfs dump
+ *
+ * Return: None
+ */
+void qdf_prof_init(void);
+
+/**
+ * qdf_prof_deinit() - remove the latency profile debugfs dump
+ *
+ * Return: None
+ */
+void qdf_prof_deinit(void);
+
+/**
+ * qdf_prof_clear() - reset the latency histograms on all CPUs
+ *
+ * Return: None
+ */
+void qdf_prof_clear(void);
+#else
+typedef uint8_t qdf_prof_ts_t;
+
+static inline qdf_prof_ts_t qdf_prof_start(void)
+{
+	return 0;
+}
+
+static inline void qdf_prof_end(enum qdf_prof_probe probe,
+				qdf_prof_ts_t start)
+{
+}
+
+static inline void qdf_prof_init(void)
+{
+}
+
+static inline void qdf_prof_deinit(void)
+{
+}
+
+static inline void qdf_prof_clear(void)
+{
+}
+#endif /* QDF_LATENCY_PROFILE */
 #endif
@@ -80,6 +80,24 @@ QDF_STATUS qdf_list_insert_back(qdf_list_t *list, qdf_list_node_t *node)
 }
 qdf_export_symbol(qdf_list_insert_back);
 
+/**
+ * qdf_list_insert_back_rcu() - publish input node at back of an RCU list
+ * @list: Pointer to list
+ * @node: Pointer to input node
+ *
+ * Readers may walk the list with qdf_list_for_each_rcu() concurrently.
+ * Writers are expected to be serialized by the list lock.
+ *
+ * Return: QDF status
+ */
+QDF_STATUS qdf_list_insert_back_rcu(qdf_list_t *list, qdf_list_node_t *node)
+{
+	list_add_tail_rcu(node, &list->anchor);
+	list->count++;
+	return QDF_STATUS_SUCCESS;
+}
+qdf_export_symbol(qdf_list_insert_back_rcu);
+
 /**
  * qdf_list_insert_back_size() - insert input node at back of list and save
  * list size
@@ -181,6 +199,30 @@ QDF_STATUS qdf_list_remove_node(qdf_list_t *list,
 }
 qdf_export_symbol(qdf_list_remove_node);
 
+/**
+ * qdf_list_remove_node_rcu() - unpublish input node from an RCU list
+ * @list: Pointer to list
+ * @node_to_remove: Pointer to node which needs to be removed
+ *
+ * Concurrent qdf_list_for_each_rcu() readers may still see the node, so it
+ * must not be freed or reinserted before a grace period has elapsed.
+ * It is expected that the list is locked when this function is called.
+ *
+ * Return: QDF status
+ */
+QDF_STATUS qdf_list_remove_node_rcu(qdf_list_t *list,
+				    qdf_list_node_t *node_to_remove)
+{
+	if (list_empty(&list->anchor))
+		return QDF_STATUS_E_EMPTY;
+
+	list_del_rcu(node_to_remove);
+	list->count--;
+
+	return QDF_STATUS_SUCCESS;
+}
+qdf_export_symbol(qdf_list_remove_node_rcu);
+
 /**
  * qdf_list_peek_front() - peek front node from list
  * @list: Pointer to list
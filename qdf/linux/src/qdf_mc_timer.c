@@ -69,6 +69,9 @@ void qdf_register_mc_timer_callback(void (*callback) (qdf_mc_timer_t *))
 
 qdf_export_symbol(qdf_register_mc_timer_callback);
 
+static void qdf_mc_timer_wheel_init(void);
+static void qdf_mc_timer_wheel_deinit(void);
+
 /* Function declarations and documenation */
 
 /**
@@ -141,6 +144,7 @@ void qdf_timer_module_init(void)
 	QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_INFO_HIGH,
 		  "Initializing the QDF MC timer module");
 	qdf_mutex_create(&persistent_timer_count_lock);
+	qdf_mc_timer_wheel_init();
 }
 qdf_export_symbol(qdf_timer_module_init);
 
@@ -281,6 +285,561 @@ void qdf_mc_timer_manager_exit(void)
 qdf_export_symbol(qdf_mc_timer_manager_exit);
 #endif
 
+#ifdef QDF_MC_TIMER_WHEEL
+/*
+ * Hierarchical timer wheel backend
+ *
+ * All MC timers are kept in a single wheel driven by one kernel timer, instead
+ * of one kernel timer per MC timer. Level 0 holds timers expiring within the
+ * next QDF_MC_TIMER_WHEEL_SIZE ticks, and each further level covers
+ * QDF_MC_TIMER_WHEEL_SIZE times the range of the previous one. Timers are
+ * cascaded to a lower level when the lower level wraps, so start and stop are
+ * O(1) and each timer is moved at most once per level.
+ *
+ * Timers expiring on a tick are moved to an expired list, and a single
+ * scheduler message is posted to run all of their callbacks in the MC thread.
+ *
+ * The kernel timers are armed for the next tick with work on it, i.e. the
+ * earliest level 0 expiry or higher level cascade, not for every tick, so a
+ * wheel holding only long timers does not wake the CPU every tick.
+ */
+#define QDF_MC_TIMER_WHEEL_TICK_MS 10
+#define QDF_MC_TIMER_WHEEL_BITS 6
+#define QDF_MC_TIMER_WHEEL_SIZE (1 << QDF_MC_TIMER_WHEEL_BITS)
+#define QDF_MC_TIMER_WHEEL_MASK (QDF_MC_TIMER_WHEEL_SIZE - 1)
+#define QDF_MC_TIMER_WHEEL_LEVELS 5
+#define QDF_MC_TIMER_WHEEL_MAX_TICKS \
+	((1UL << (QDF_MC_TIMER_WHEEL_BITS * QDF_MC_TIMER_WHEEL_LEVELS)) - 1)
+/* repost the batch message if it was not run within this many ticks */
+#define QDF_MC_TIMER_WHEEL_REPOST_TICKS 100
+
+/**
+ * struct qdf_mc_timer_wheel - the MC timer wheel
+ * @lock: protects the wheel; taken before any timer's platform spinlock
+ * @slots: timer lists for each level and slot
+ * @expired: timers which expired and wait for their callbacks to run
+ * @clk: the next tick to be processed
+ * @last_jiffies: jiffies value corresponding to @clk
+ * @tick_jiffies: length of one tick in jiffies
+ * @nr_queued: number of timers in @slots
+ * @nr_wake: number of QDF_TIMER_TYPE_WAKE_APPS timers in @slots
+ * @next_clk: tick the kernel timers are armed for
+ * @expire_pending: a batch message is posted and has not run yet; it is
+ *	reposted if it did not run within QDF_MC_TIMER_WHEEL_REPOST_TICKS
+ * @posted_clk: value of @clk when the batch message was posted
+ * @tick_timer: deferrable kernel timer driving the wheel
+ * @wake_timer: non-deferrable kernel timer driving the wheel while
+ *	QDF_TIMER_TYPE_WAKE_APPS timers are queued
+ * @batch_timer: pseudo MC timer used to post the batch message through the
+ *	registered scheduler callback
+ */
+struct qdf_mc_timer_wheel {
+	qdf_spinlock_t lock;
+	struct list_head slots[QDF_MC_TIMER_WHEEL_LEVELS]
+			      [QDF_MC_TIMER_WHEEL_SIZE];
+	struct list_head expired;
+	unsigned long clk;
+	unsigned long last_jiffies;
+	unsigned long tick_jiffies;
+	uint32_t nr_queued;
+	uint32_t nr_wake;
+	unsigned long next_clk;
+	bool expire_pending;
+	unsigned long posted_clk;
+	qdf_timer_t tick_timer;
+	qdf_timer_t wake_timer;
+	qdf_mc_timer_t batch_timer;
+};
+
+static struct qdf_mc_timer_wheel qdf_mc_timer_wheel;
+
+static inline qdf_mc_timer_t *
+qdf_mc_timer_wheel_entry(qdf_mc_timer_platform_t *platform_info)
+{
+	return qdf_container_of(platform_info, qdf_mc_timer_t, platform_info);
+}
+
+/**
+ * qdf_mc_timer_wheel_catch_up() - advance an empty wheel to the current time
+ * @wheel: the timer wheel
+ *
+ * Return: None
+ */
+static void qdf_mc_timer_wheel_catch_up(struct qdf_mc_timer_wheel *wheel)
+{
+	unsigned long ticks;
+
+	ticks = (jiffies - wheel->last_jiffies) / wheel->tick_jiffies;
+	wheel->clk += ticks;
+	wheel->last_jiffies += ticks * wheel->tick_jiffies;
+}
+
+/**
+ * qdf_mc_timer_wheel_enqueue() - put a timer in its wheel slot
+ * @wheel: the timer wheel
+ * @platform_info: platform info of the timer, with @wheel_expires set
+ *
+ * Return: the tick at which the wheel has to run for this timer, which is
+ *	its expiry on level 0 and the cascade of its slot on higher levels
+ */
+static unsigned long
+qdf_mc_timer_wheel_enqueue(struct qdf_mc_timer_wheel *wheel,
+			   qdf_mc_timer_platform_t *platform_info)
+{
+	unsigned long expires = platform_info->wheel_expires;
+	unsigned long delta = expires - wheel->clk;
+	unsigned int idx, shift;
+	int lvl;
+
+	/* already due; fire on the next tick */
+	if ((long)delta < 0) {
+		expires = wheel->clk;
+		platform_info->wheel_expires = expires;
+		delta = 0;
+	}
+
+	for (lvl = 0; lvl < QDF_MC_TIMER_WHEEL_LEVELS - 1; lvl++) {
+		if (delta < (1UL << (QDF_MC_TIMER_WHEEL_BITS * (lvl + 1))))
+			break;
+	}
+
+	shift = QDF_MC_TIMER_WHEEL_BITS * lvl;
+	idx = (expires >> shift) & QDF_MC_TIMER_WHEEL_MASK;
+	list_add_tail(&platform_info->wheel_node, &wheel->slots[lvl][idx]);
+
+	return (expires >> shift) << shift;
+}
+
+/**
+ * qdf_mc_timer_wheel_next() - find the next tick with work on it
+ * @wheel: the timer wheel
+ *
+ * A level 0 slot needs the wheel to run at the tick it expires on, and a
+ * higher level slot at the tick it is cascaded on, which may be before the
+ * expiry of its timers but never after it.
+ *
+ * Return: the earliest such tick of all non-empty slots
+ */
+static unsigned long qdf_mc_timer_wheel_next(struct qdf_mc_timer_wheel *wheel)
+{
+	unsigned long next = wheel->clk + QDF_MC_TIMER_WHEEL_MAX_TICKS;
+	unsigned long pos, tick;
+	unsigned int shift, k;
+	int lvl;
+
+	for (lvl = 0; lvl < QDF_MC_TIMER_WHEEL_LEVELS; lvl++) {
+		shift = QDF_MC_TIMER_WHEEL_BITS * lvl;
+		pos = wheel->clk >> shift;
+
+		for (k = 0; k < QDF_MC_TIMER_WHEEL_SIZE; k++) {
+			if (list_empty(&wheel->slots[lvl]
+					[(pos + k) & QDF_MC_TIMER_WHEEL_MASK]))
+				continue;
+
+			tick = (pos + k) << shift;
+			/* this slot was cascaded already, it is a lap ahead */
+			if ((long)(tick - wheel->clk) < 0)
+				tick += QDF_MC_TIMER_WHEEL_SIZE << shift;
+
+			if ((long)(tick - next) < 0)
+				next = tick;
+		}
+	}
+
+	return next;
+}
+
+/**
+ * qdf_mc_timer_wheel_arm() - arm the kernel timers for a wheel tick
+ * @wheel: the timer wheel
+ * @next: the tick to process next
+ *
+ * The non-deferrable timer is only armed while WAKE_APPS timers are queued.
+ * Caller must hold the wheel lock.
+ *
+ * Return: None
+ */
+static void qdf_mc_timer_wheel_arm(struct qdf_mc_timer_wheel *wheel,
+				   unsigned long next)
+{
+	unsigned long expires;
+
+	/* tick @clk is processed once a full tick passed @last_jiffies */
+	expires = wheel->last_jiffies +
+		  (next - wheel->clk + 1) * wheel->tick_jiffies;
+	wheel->next_clk = next;
+
+	mod_timer(&wheel->tick_timer.os_timer, expires);
+	if (wheel->nr_wake)
+		mod_timer(&wheel->wake_timer.os_timer, expires);
+}
+
+static void qdf_mc_timer_wheel_cascade(struct qdf_mc_timer_wheel *wheel,
+				       int lvl, unsigned int idx)
+{
+	qdf_mc_timer_platform_t *platform_info, *tmp;
+	struct list_head head;
+
+	INIT_LIST_HEAD(&head);
+	list_splice_init(&wheel->slots[lvl][idx], &head);
+
+	list_for_each_entry_safe(platform_info, tmp, &head, wheel_node) {
+		list_del(&platform_info->wheel_node);
+		qdf_mc_timer_wheel_enqueue(wheel, platform_info);
+	}
+}
+
+/**
+ * qdf_mc_timer_wheel_expire_slot() - move a level 0 slot to the expired list
+ * @wheel: the timer wheel
+ * @idx: the level 0 slot index
+ *
+ * Return: None
+ */
+static void qdf_mc_timer_wheel_expire_slot(struct qdf_mc_timer_wheel *wheel,
+					   unsigned int idx)
+{
+	qdf_mc_timer_platform_t *platform_info;
+	qdf_mc_timer_t *timer;
+
+	list_for_each_entry(platform_info, &wheel->slots[0][idx], wheel_node) {
+		timer = qdf_mc_timer_wheel_entry(platform_info);
+		wheel->nr_queued--;
+		if (QDF_TIMER_TYPE_WAKE_APPS == timer->type)
+			wheel->nr_wake--;
+	}
+
+	list_splice_tail_init(&wheel->slots[0][idx], &wheel->expired);
+}
+
+/**
+ * qdf_mc_timer_wheel_run() - process all ticks which elapsed so far
+ * @wheel: the timer wheel
+ *
+ * Caller must hold the wheel lock.
+ *
+ * Return: true if the batch message should be posted
+ */
+static bool qdf_mc_timer_wheel_run(struct qdf_mc_timer_wheel *wheel)
+{
+	unsigned long ticks;
+	unsigned int idx;
+	int lvl;
+
+	ticks = (jiffies - wheel->last_jiffies) / wheel->tick_jiffies;
+
+	while (ticks && wheel->nr_queued) {
+		idx = wheel->clk & QDF_MC_TIMER_WHEEL_MASK;
+
+		/* not a cascade point and nothing expires, skip to the next
+		 * tick with work on it
+		 */
+		if (idx && list_empty(&wheel->slots[0][idx])) {
+			unsigned long skip;
+
+			skip = qdf_mc_timer_wheel_next(wheel) - wheel->clk;
+			if (skip > ticks)
+				skip = ticks;
+
+			wheel->clk += skip;
+			wheel->last_jiffies += skip * wheel->tick_jiffies;
+			ticks -= skip;
+			continue;
+		}
+
+		if (!idx) {
+			for (lvl = 1; lvl < QDF_MC_TIMER_WHEEL_LEVELS; lvl++) {
+				unsigned int lidx;
+
+				lidx = (wheel->clk >>
+					(QDF_MC_TIMER_WHEEL_BITS * lvl)) &
+					QDF_MC_TIMER_WHEEL_MASK;
+				qdf_mc_timer_wheel_cascade(wheel, lvl, lidx);
+				if (lidx)
+					break;
+			}
+		}
+
+		qdf_mc_timer_wheel_expire_slot(wheel, idx);
+		wheel->clk++;
+		wheel->last_jiffies += wheel->tick_jiffies;
+		ticks--;
+	}
+
+	/* nothing left in the wheel, skip the remaining empty ticks */
+	if (!wheel->nr_queued)
+		qdf_mc_timer_wheel_catch_up(wheel);
+
+	if (list_empty(&wheel->expired))
+		return false;
+
+	if (wheel->expire_pending &&
+	    wheel->clk - wheel->posted_clk < QDF_MC_TIMER_WHEEL_REPOST_TICKS)
+		return false;
+
+	wheel->expire_pending = true;
+	wheel->posted_clk = wheel->clk;
+
+	return true;
+}
+
+/**
+ * qdf_mc_timer_wheel_rearm() - arm the kernel timers for the next event
+ * @wheel: the timer wheel
+ *
+ * The next event is the next tick with work on it, or the tick at which the
+ * batch message is reposted while expired timers wait for it. The post may
+ * fail or the message may be flushed, and the expired timers must not be
+ * stranded then, even if the wheel itself is empty.
+ * Caller must hold the wheel lock.
+ *
+ * Return: None
+ */
+static void qdf_mc_timer_wheel_rearm(struct qdf_mc_timer_wheel *wheel)
+{
+	unsigned long next = 0, repost;
+	bool armed = false;
+
+	if (wheel->nr_queued) {
+		next = qdf_mc_timer_wheel_next(wheel);
+		armed = true;
+	}
+
+	if (!list_empty(&wheel->expired)) {
+		repost = wheel->posted_clk + QDF_MC_TIMER_WHEEL_REPOST_TICKS;
+		if (!armed || (long)(repost - next) < 0)
+			next = repost;
+		armed = true;
+	}
+
+	if (armed)
+		qdf_mc_timer_wheel_arm(wheel, next);
+}
+
+static void qdf_mc_timer_wheel_tick(void *context)
+{
+	struct qdf_mc_timer_wheel *wheel = context;
+	bool post;
+
+	qdf_spin_lock_irqsave(&wheel->lock);
+
+	post = qdf_mc_timer_wheel_run(wheel);
+
+	qdf_mc_timer_wheel_rearm(wheel);
+
+	if (post) {
+		qdf_spin_lock_irqsave(&wheel->batch_timer.platform_info.spinlock);
+		wheel->batch_timer.state = QDF_TIMER_STATE_RUNNING;
+		qdf_spin_unlock_irqrestore(
+				&wheel->batch_timer.platform_info.spinlock);
+	}
+
+	qdf_spin_unlock_irqrestore(&wheel->lock);
+
+	/* serialize a single message for all expired timers to MC thread */
+	if (post && scheduler_timer_callback)
+		scheduler_timer_callback(&wheel->batch_timer);
+}
+
+/**
+ * qdf_mc_timer_wheel_expire() - run the callbacks of all expired timers
+ * @user_data: the timer wheel
+ *
+ * This runs in the MC thread, as the callback of the batch message.
+ *
+ * Return: None
+ */
+static void qdf_mc_timer_wheel_expire(void *user_data)
+{
+	struct qdf_mc_timer_wheel *wheel = user_data;
+	qdf_mc_timer_platform_t *platform_info;
+	qdf_mc_timer_callback_t callback;
+	qdf_mc_timer_t *timer;
+	QDF_TIMER_TYPE type = QDF_TIMER_TYPE_SW;
+	void *cb_data = NULL;
+
+	qdf_spin_lock_irqsave(&wheel->lock);
+	wheel->expire_pending = false;
+
+	while (!list_empty(&wheel->expired)) {
+		platform_info = list_first_entry(&wheel->expired,
+						 qdf_mc_timer_platform_t,
+						 wheel_node);
+		list_del_init(&platform_info->wheel_node);
+		timer = qdf_mc_timer_wheel_entry(platform_info);
+		callback = NULL;
+
+		qdf_spin_lock_irqsave(&platform_info->spinlock);
+		if (QDF_TIMER_STATE_RUNNING == timer->state) {
+			/* callback may restart the timer */
+			timer->state = QDF_TIMER_STATE_STOPPED;
+			callback = timer->callback;
+			cb_data = timer->user_data;
+			type = timer->type;
+		}
+		qdf_spin_unlock_irqrestore(&platform_info->spinlock);
+
+		if (!callback)
+			continue;
+
+		/* the timer may be restarted or destroyed by its callback */
+		qdf_spin_unlock_irqrestore(&wheel->lock);
+		qdf_try_allowing_sleep(type);
+		callback(cb_data);
+		qdf_spin_lock_irqsave(&wheel->lock);
+	}
+
+	qdf_spin_unlock_irqrestore(&wheel->lock);
+}
+
+static void qdf_mc_timer_wheel_init(void)
+{
+	struct qdf_mc_timer_wheel *wheel = &qdf_mc_timer_wheel;
+	int lvl, idx;
+
+	qdf_spinlock_create(&wheel->lock);
+
+	for (lvl = 0; lvl < QDF_MC_TIMER_WHEEL_LEVELS; lvl++)
+		for (idx = 0; idx < QDF_MC_TIMER_WHEEL_SIZE; idx++)
+			INIT_LIST_HEAD(&wheel->slots[lvl][idx]);
+	INIT_LIST_HEAD(&wheel->expired);
+
+	wheel->tick_jiffies =
+		__qdf_scaled_msecs_to_jiffies(QDF_MC_TIMER_WHEEL_TICK_MS);
+	if (!wheel->tick_jiffies)
+		wheel->tick_jiffies = 1;
+	wheel->clk = 0;
+	wheel->last_jiffies = jiffies;
+	wheel->nr_queued = 0;
+	wheel->nr_wake = 0;
+	wheel->next_clk = 0;
+	wheel->expire_pending = false;
+
+	qdf_timer_init(NULL, &wheel->tick_timer, qdf_mc_timer_wheel_tick,
+		       wheel, QDF_TIMER_TYPE_SW);
+	qdf_timer_init(NULL, &wheel->wake_timer, qdf_mc_timer_wheel_tick,
+		       wheel, QDF_TIMER_TYPE_WAKE_APPS);
+
+	/* the batch timer never sits in the wheel, it only carries the
+	 * expiry callback through the registered scheduler callback
+	 */
+	qdf_spinlock_create(&wheel->batch_timer.platform_info.spinlock);
+	INIT_LIST_HEAD(&wheel->batch_timer.platform_info.wheel_node);
+	wheel->batch_timer.callback = qdf_mc_timer_wheel_expire;
+	wheel->batch_timer.user_data = wheel;
+	wheel->batch_timer.type = QDF_TIMER_TYPE_SW;
+	wheel->batch_timer.platform_info.cookie = LINUX_TIMER_COOKIE;
+	wheel->batch_timer.state = QDF_TIMER_STATE_STOPPED;
+}
+
+static void qdf_mc_timer_wheel_deinit(void)
+{
+	struct qdf_mc_timer_wheel *wheel = &qdf_mc_timer_wheel;
+
+	qdf_timer_sync_cancel(&wheel->tick_timer);
+	qdf_timer_sync_cancel(&wheel->wake_timer);
+	qdf_timer_free(&wheel->tick_timer);
+	qdf_timer_free(&wheel->wake_timer);
+
+	QDF_BUG(!wheel->nr_queued);
+
+	qdf_spinlock_destroy(&wheel->batch_timer.platform_info.spinlock);
+	qdf_spinlock_destroy(&wheel->lock);
+}
+
+static inline void qdf_mc_timer_backend_lock(void)
+{
+	qdf_spin_lock_irqsave(&qdf_mc_timer_wheel.lock);
+}
+
+static inline void qdf_mc_timer_backend_unlock(void)
+{
+	qdf_spin_unlock_irqrestore(&qdf_mc_timer_wheel.lock);
+}
+
+static void qdf_mc_timer_setup(qdf_mc_timer_t *timer,
+			       QDF_TIMER_TYPE timer_type)
+{
+	INIT_LIST_HEAD(&timer->platform_info.wheel_node);
+	timer->platform_info.wheel_expires = 0;
+}
+
+/**
+ * qdf_mc_timer_os_start() - queue a timer in the wheel
+ * @timer: the timer to queue
+ * @expiration_time: expiration time in milliseconds
+ *
+ * Caller must hold the wheel lock.
+ *
+ * Return: None
+ */
+static void qdf_mc_timer_os_start(qdf_mc_timer_t *timer,
+				  uint32_t expiration_time)
+{
+	struct qdf_mc_timer_wheel *wheel = &qdf_mc_timer_wheel;
+	unsigned long delta, next;
+	bool first, first_wake;
+
+	if (!wheel->nr_queued)
+		qdf_mc_timer_wheel_catch_up(wheel);
+
+	/* round up, so the timer never fires early */
+	delta = __qdf_scaled_msecs_to_jiffies(expiration_time) +
+		(jiffies - wheel->last_jiffies);
+	delta = DIV_ROUND_UP(delta, wheel->tick_jiffies);
+	if (delta > QDF_MC_TIMER_WHEEL_MAX_TICKS)
+		delta = QDF_MC_TIMER_WHEEL_MAX_TICKS;
+
+	timer->platform_info.wheel_expires = wheel->clk + delta;
+	next = qdf_mc_timer_wheel_enqueue(wheel, &timer->platform_info);
+
+	first = !wheel->nr_queued++;
+	first_wake = QDF_TIMER_TYPE_WAKE_APPS == timer->type &&
+		     !wheel->nr_wake++;
+
+	/* with expired timers waiting, the tick is armed for their repost */
+	if ((first && list_empty(&wheel->expired)) ||
+	    (long)(next - wheel->next_clk) < 0)
+		qdf_mc_timer_wheel_arm(wheel, next);
+	else if (first_wake)
+		qdf_mc_timer_wheel_arm(wheel, wheel->next_clk);
+}
+
+/**
+ * qdf_mc_timer_os_stop() - remove a timer from the wheel
+ * @timer: the timer to remove
+ *
+ * This removes the timer from the wheel, or from the expired list if its
+ * callback did not run yet. Caller must hold the wheel lock.
+ *
+ * Return: None
+ */
+static void qdf_mc_timer_os_stop(qdf_mc_timer_t *timer)
+{
+	struct qdf_mc_timer_wheel *wheel = &qdf_mc_timer_wheel;
+	qdf_mc_timer_platform_t *platform_info = &timer->platform_info;
+	unsigned long delta;
+
+	if (list_empty(&platform_info->wheel_node))
+		return;
+
+	list_del_init(&platform_info->wheel_node);
+
+	/* timers on the expired list are no longer accounted as queued */
+	delta = platform_info->wheel_expires - wheel->clk;
+	if ((long)delta < 0)
+		return;
+
+	wheel->nr_queued--;
+	if (QDF_TIMER_TYPE_WAKE_APPS == timer->type)
+		wheel->nr_wake--;
+}
+
+static inline void qdf_mc_timer_os_stop_sync(qdf_mc_timer_t *timer)
+{
+	qdf_mc_timer_os_stop(timer);
+}
+#else
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
 static void __os_mc_timer_shim(struct timer_list *os_timer)
 {
@@ -326,6 +885,41 @@ static void qdf_mc_timer_setup(qdf_mc_timer_t *timer,
 	timer->platform_info.timer.data = (unsigned long)timer;
 }
 #endif
+
+static inline void qdf_mc_timer_wheel_init(void)
+{
+}
+
+static inline void qdf_mc_timer_wheel_deinit(void)
+{
+}
+
+static inline void qdf_mc_timer_backend_lock(void)
+{
+}
+
+static inline void qdf_mc_timer_backend_unlock(void)
+{
+}
+
+static inline void qdf_mc_timer_os_start(qdf_mc_timer_t *timer,
+					 uint32_t expiration_time)
+{
+	mod_timer(&(timer->platform_info.timer),
+		  jiffies + __qdf_scaled_msecs_to_jiffies(expiration_time));
+}
+
+static inline void qdf_mc_timer_os_stop(qdf_mc_timer_t *timer)
+{
+	del_timer(&(timer->platform_info.timer));
+}
+
+static inline void qdf_mc_timer_os_stop_sync(qdf_mc_timer_t *timer)
+{
+	del_timer_sync(&(timer->platform_info.timer));
+}
+#endif /* QDF_MC_TIMER_WHEEL */
+
 /**
  * qdf_mc_timer_init() - initialize a QDF timer
  * @timer: Pointer to timer object
@@ -496,6 +1090,7 @@ QDF_STATUS qdf_mc_timer_destroy(qdf_mc_timer_t *timer)
 	}
 	qdf_mem_free(timer->timer_node);
 
+	qdf_mc_timer_backend_lock();
 	qdf_spin_lock_irqsave(&timer->platform_info.spinlock);
 
 	switch (timer->state) {
@@ -506,7 +1101,7 @@ QDF_STATUS qdf_mc_timer_destroy(qdf_mc_timer_t *timer)
 
 	case QDF_TIMER_STATE_RUNNING:
 		/* Stop the timer first */
-		del_timer(&(timer->platform_info.timer));
+		qdf_mc_timer_os_stop(timer);
 		v_status = QDF_STATUS_SUCCESS;
 		break;
 	case QDF_TIMER_STATE_STOPPED:
@@ -526,11 +1121,13 @@ QDF_STATUS qdf_mc_timer_destroy(qdf_mc_timer_t *timer)
 		timer->platform_info.cookie = LINUX_INVALID_TIMER_COOKIE;
 		timer->state = QDF_TIMER_STATE_UNUSED;
 		qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+		qdf_mc_timer_backend_unlock();
 		qdf_spinlock_destroy(&timer->platform_info.spinlock);
 		return v_status;
 	}
 
 	qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+	qdf_mc_timer_backend_unlock();
 
 	QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_INFO_HIGH,
 		  "%s: Cannot destroy timer in state = %d", __func__,
@@ -583,6 +1180,7 @@ QDF_STATUS qdf_mc_timer_destroy(qdf_mc_timer_t *timer)
 		QDF_ASSERT(0);
 		return QDF_STATUS_E_INVAL;
 	}
+	qdf_mc_timer_backend_lock();
 	qdf_spin_lock_irqsave(&timer->platform_info.spinlock);
 
 	switch (timer->state) {
@@ -593,7 +1191,7 @@ QDF_STATUS qdf_mc_timer_destroy(qdf_mc_timer_t *timer)
 
 	case QDF_TIMER_STATE_RUNNING:
 		/* Stop the timer first */
-		del_timer(&(timer->platform_info.timer));
+		qdf_mc_timer_os_stop(timer);
 		v_status = QDF_STATUS_SUCCESS;
 		break;
 
@@ -614,10 +1212,12 @@ QDF_STATUS qdf_mc_timer_destroy(qdf_mc_timer_t *timer)
 		timer->platform_info.cookie = LINUX_INVALID_TIMER_COOKIE;
 		timer->state = QDF_TIMER_STATE_UNUSED;
 		qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+		qdf_mc_timer_backend_unlock();
 		return v_status;
 	}
 
 	qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+	qdf_mc_timer_backend_unlock();
 
 	QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_INFO_HIGH,
 		  "%s: Cannot destroy timer in state = %d", __func__,
@@ -675,11 +1275,13 @@ QDF_STATUS qdf_mc_timer_start(qdf_mc_timer_t *timer, uint32_t expiration_time)
 	}
 
 	/* make sure the remainer of the logic isn't interrupted */
+	qdf_mc_timer_backend_lock();
 	qdf_spin_lock_irqsave(&timer->platform_info.spinlock);
 
 	/* ensure if the timer can be started */
 	if (QDF_TIMER_STATE_STOPPED != timer->state) {
 		qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+		qdf_mc_timer_backend_unlock();
 		QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_ERROR,
 			  "%s: Cannot start timer in state = %d %ps",
 			  __func__, timer->state, (void *)timer->callback);
@@ -687,8 +1289,7 @@ QDF_STATUS qdf_mc_timer_start(qdf_mc_timer_t *timer, uint32_t expiration_time)
 	}
 
 	/* start the timer */
-	mod_timer(&(timer->platform_info.timer),
-		  jiffies + __qdf_scaled_msecs_to_jiffies(expiration_time));
+	qdf_mc_timer_os_start(timer, expiration_time);
 
 	timer->state = QDF_TIMER_STATE_RUNNING;
 
@@ -706,6 +1307,7 @@ QDF_STATUS qdf_mc_timer_start(qdf_mc_timer_t *timer, uint32_t expiration_time)
 	}
 
 	qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+	qdf_mc_timer_backend_unlock();
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -744,20 +1346,23 @@ QDF_STATUS qdf_mc_timer_stop(qdf_mc_timer_t *timer)
 	}
 
 	/* ensure the timer state is correct */
+	qdf_mc_timer_backend_lock();
 	qdf_spin_lock_irqsave(&timer->platform_info.spinlock);
 
 	if (QDF_TIMER_STATE_RUNNING != timer->state) {
 		qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+		qdf_mc_timer_backend_unlock();
 		return QDF_STATUS_SUCCESS;
 	}
 
 	qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
 
-	del_timer(&(timer->platform_info.timer));
+	qdf_mc_timer_os_stop(timer);
 
 	qdf_spin_lock_irqsave(&timer->platform_info.spinlock);
 	timer->state = QDF_TIMER_STATE_STOPPED;
 	qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+	qdf_mc_timer_backend_unlock();
 
 	qdf_try_allowing_sleep(timer->type);
 
@@ -785,17 +1390,20 @@ QDF_STATUS qdf_mc_timer_stop_sync(qdf_mc_timer_t *timer)
 	}
 
 	/* ensure the timer state is correct */
+	qdf_mc_timer_backend_lock();
 	qdf_spin_lock_irqsave(&timer->platform_info.spinlock);
 
 	if (QDF_TIMER_STATE_RUNNING != timer->state) {
 		qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
+		qdf_mc_timer_backend_unlock();
 		return QDF_STATUS_SUCCESS;
 	}
 
 	timer->state = QDF_TIMER_STATE_STOPPED;
 
 	qdf_spin_unlock_irqrestore(&timer->platform_info.spinlock);
-	del_timer_sync(&(timer->platform_info.timer));
+	qdf_mc_timer_os_stop_sync(timer);
+	qdf_mc_timer_backend_unlock();
 
 	qdf_try_allowing_sleep(timer->type);
 
@@ -866,6 +1474,7 @@ void qdf_timer_module_deinit(void)
 {
 	QDF_TRACE(QDF_MODULE_ID_QDF, QDF_TRACE_LEVEL_INFO_HIGH,
 		  "De-Initializing the QDF MC timer module");
+	qdf_mc_timer_wheel_deinit();
 	qdf_mutex_destroy(&persistent_timer_count_lock);
 }
 qdf_export_symbol(qdf_timer_module_deinit);
@@ -33,6 +33,7 @@
 #include "qdf_talloc.h"
 #include <linux/debugfs.h>
 #include <linux/seq_file.h>
+#include <linux/math64.h>
 #include <linux/string.h>
 #include <qdf_list.h>
 
@@ -95,6 +96,10 @@ static struct __qdf_mem_stat {
 	int32_t tx_descs_max;
 } qdf_mem_stat;
 
+/* List of all preallocated qdf_mempool instances, used for stats */
+static LIST_HEAD(qdf_mempool_list);
+static DEFINE_MUTEX(qdf_mempool_list_lock);
+
 #ifdef MEMORY_DEBUG
 #include "qdf_debug_domain.h"
 
@@ -554,7 +559,6 @@ QDF_STATUS qdf_prealloc_disabled_config_set(const char *str_value)
 /* Debugfs root directory for qdf_mem */
 static struct dentry *qdf_mem_debugfs_root;
 
-#ifdef MEMORY_DEBUG
 static int seq_printf_printer(void *priv, const char *fmt, ...)
 {
 	struct seq_file *file = priv;
@@ -568,6 +572,8 @@ static int seq_printf_printer(void *priv, const char *fmt, ...)
 	return 0;
 }
 
+#ifdef MEMORY_DEBUG
+
 /**
  * qdf_print_major_alloc() - memory metadata table print logic
  * @table: the memory metadata table to print
@@ -1041,6 +1047,33 @@ static QDF_STATUS qdf_mem_debug_debugfs_exit(void)
 
 #endif /* MEMORY_DEBUG */
 
+/**
+ * qdf_mempool_stats_show() - print mempool stats to debugfs
+ * @seq: seq_file handle
+ * @v: current iterator
+ *
+ * Return: 0 - success
+ */
+static int qdf_mempool_stats_show(struct seq_file *seq, void *v)
+{
+	qdf_mempool_stats_print(seq_printf_printer, seq);
+
+	return 0;
+}
+
+static int qdf_mempool_stats_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, qdf_mempool_stats_show, inode->i_private);
+}
+
+/* file operation table for mempool stats */
+static const struct file_operations fops_qdf_mempool_stats = {
+	.owner = THIS_MODULE,
+	.open = qdf_mempool_stats_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
 
 static void qdf_mem_debugfs_exit(void)
 {
@@ -1076,6 +1109,12 @@ static QDF_STATUS qdf_mem_debugfs_init(void)
 				qdf_mem_debugfs_root,
 				&qdf_mem_stat.skb);
 
+	debugfs_create_file("mempool",
+			    S_IRUSR,
+			    qdf_mem_debugfs_root,
+			    NULL,
+			    &fops_qdf_mempool_stats);
+
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -1209,6 +1248,115 @@ static inline void qdf_mem_dma_dec(qdf_size_t size)
 	qdf_atomic_sub(size, &qdf_mem_stat.dma);
 }
 
+/**
+ * qdf_mempool_update_used_max() - sample the number of elements handed out
+ * @pool: Handle to memory pool
+ *
+ * Elements parked in per-CPU caches are free, so the in-use count is summed
+ * from the per-CPU alloc/free balance rather than derived from @free_cnt.
+ * Caller must hold @pool->lock.
+ *
+ * Return: none
+ */
+static void qdf_mempool_update_used_max(__qdf_mempool_t pool)
+{
+	long in_use = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu)
+		in_use += READ_ONCE(per_cpu_ptr(pool->cpu_cache, cpu)->in_use);
+
+	if (in_use > pool->used_max)
+		pool->used_max = in_use;
+}
+
+/**
+ * qdf_mempool_get_locked() - take elements from the shared free list
+ * @pool: Handle to memory pool
+ * @bufs: array to fill with the elements taken
+ * @num: maximum number of elements to take
+ *
+ * Caller must hold @pool->lock.
+ *
+ * Return: number of elements actually taken
+ */
+static int qdf_mempool_get_locked(__qdf_mempool_t pool, void **bufs, int num)
+{
+	mempool_elem_t *elem;
+	int i;
+
+	for (i = 0; i < num; i++) {
+		elem = STAILQ_FIRST(&pool->free_list);
+		if (!elem)
+			break;
+
+		STAILQ_REMOVE_HEAD(&pool->free_list, mempool_entry);
+		bufs[i] = elem;
+	}
+
+	pool->free_cnt -= i;
+	qdf_mempool_update_used_max(pool);
+
+	return i;
+}
+
+/**
+ * qdf_mempool_put_locked() - return elements to the shared free list
+ * @pool: Handle to memory pool
+ * @bufs: elements to return
+ * @num: number of elements in @bufs
+ *
+ * Caller must hold @pool->lock.
+ *
+ * Return: none
+ */
+static void qdf_mempool_put_locked(__qdf_mempool_t pool, void **bufs, int num)
+{
+	int i;
+
+	for (i = 0; i < num; i++)
+		STAILQ_INSERT_HEAD(&pool->free_list, (mempool_elem_t *)bufs[i],
+				   mempool_entry);
+
+	pool->free_cnt += num;
+}
+
+/**
+ * qdf_mempool_steal() - take free elements parked in per-CPU caches
+ * @pool: Handle to memory pool
+ * @bufs: array to fill with the elements taken
+ * @num: maximum number of elements to take
+ *
+ * Used once the shared free list is empty, so that a pool never fails an
+ * allocation while free elements sit in the caches of other CPUs. Caller
+ * must have bottom halves disabled and must not hold any cache lock or
+ * @pool->lock.
+ *
+ * Return: number of elements actually taken
+ */
+static int qdf_mempool_steal(__qdf_mempool_t pool, void **bufs, int num)
+{
+	struct __qdf_mempool_cpu_cache *cache;
+	int cnt = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		cache = per_cpu_ptr(pool->cpu_cache, cpu);
+		if (!READ_ONCE(cache->count))
+			continue;
+
+		spin_lock(&cache->lock);
+		while (cnt < num && cache->count)
+			bufs[cnt++] = cache->objs[--cache->count];
+		spin_unlock(&cache->lock);
+
+		if (cnt == num)
+			break;
+	}
+
+	return cnt;
+}
+
 /**
  * __qdf_mempool_init() - Create and initialize memory pool
  *
@@ -1218,6 +1366,14 @@ static inline void qdf_mem_dma_dec(qdf_size_t size)
  * @elem_size: size of each pool element in bytes
  * @flags: flags
  *
+ * The pool memory is allocated on the NUMA node of the device and each
+ * element is cache line aligned, so elements never share a cache line.
+ * A per-CPU cache of up to __QDF_MEMPOOL_CPU_CACHE_SIZE free elements sits
+ * in front of the shared free list. The common alloc/free path takes only
+ * the local cache spinlock, which is uncontended unless another CPU is
+ * stealing from the cache, and not the pool lock. An allocation only fails
+ * once the shared list and all per-CPU caches are empty.
+ *
  * return: Handle to memory pool or NULL if allocation failed
  */
 int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
@@ -1226,6 +1382,7 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
 	__qdf_mempool_ctxt_t *new_pool = NULL;
 	u_int32_t align = L1_CACHE_BYTES;
 	unsigned long aligned_pool_mem;
+	int node = dev_to_node(osdev->dev);
 	int pool_id;
 	int i;
 
@@ -1257,11 +1414,10 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
 		return -ENOMEM;
 
 	new_pool = osdev->mem_pool[pool_id] = (__qdf_mempool_ctxt_t *)
-		kmalloc(sizeof(__qdf_mempool_ctxt_t), GFP_KERNEL);
+		kzalloc_node(sizeof(__qdf_mempool_ctxt_t), GFP_KERNEL, node);
 	if (!new_pool)
 		return -ENOMEM;
 
-	memset(new_pool, 0, sizeof(*new_pool));
 	/* TBD: define flags for zeroing buffers etc */
 	new_pool->flags = flags;
 	new_pool->pool_id = pool_id;
@@ -1271,7 +1427,7 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
 	new_pool->mem_size = elem_cnt * new_pool->elem_size +
 				((align)?(align - 1):0);
 
-	new_pool->pool_mem = kzalloc(new_pool->mem_size, GFP_KERNEL);
+	new_pool->pool_mem = kzalloc_node(new_pool->mem_size, GFP_KERNEL, node);
 	if (!new_pool->pool_mem) {
 			/* TBD: Check if we need get_free_pages above */
 		kfree(new_pool);
@@ -1279,11 +1435,20 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
 		return -ENOMEM;
 	}
 
+	new_pool->cpu_cache = alloc_percpu(struct __qdf_mempool_cpu_cache);
+	if (!new_pool->cpu_cache) {
+		kfree(new_pool->pool_mem);
+		kfree(new_pool);
+		osdev->mem_pool[pool_id] = NULL;
+		return -ENOMEM;
+	}
+
 	spin_lock_init(&new_pool->lock);
+	for_each_possible_cpu(i)
+		spin_lock_init(&per_cpu_ptr(new_pool->cpu_cache, i)->lock);
 
 	/* Initialize free list */
-	aligned_pool_mem = (unsigned long)(new_pool->pool_mem) +
-			((align) ? (unsigned long)(new_pool->pool_mem)%align:0);
+	aligned_pool_mem = ALIGN((unsigned long)new_pool->pool_mem, align);
 	STAILQ_INIT(&new_pool->free_list);
 
 	for (i = 0; i < elem_cnt; i++)
@@ -1291,8 +1456,13 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
 			(mempool_elem_t *)(aligned_pool_mem +
 			(new_pool->elem_size * i)), mempool_entry);
 
-
+	new_pool->max_elem = elem_cnt;
 	new_pool->free_cnt = elem_cnt;
+
+	mutex_lock(&qdf_mempool_list_lock);
+	list_add_tail(&new_pool->node, &qdf_mempool_list);
+	mutex_unlock(&qdf_mempool_list_lock);
+
 	*pool_addr = new_pool;
 	return 0;
 }
@@ -1319,7 +1489,12 @@ void __qdf_mempool_destroy(qdf_device_t osdev, __qdf_mempool_t pool)
 
 	pool_id = pool->pool_id;
 
+	mutex_lock(&qdf_mempool_list_lock);
+	list_del(&pool->node);
+	mutex_unlock(&qdf_mempool_list_lock);
+
 	/* TBD: Check if free count matches elem_cnt if debug is enabled */
+	free_percpu(pool->cpu_cache);
 	kfree(pool->pool_mem);
 	kfree(pool);
 	osdev->mem_pool[pool_id] = NULL;
@@ -1336,6 +1511,7 @@ qdf_export_symbol(__qdf_mempool_destroy);
  */
 void *__qdf_mempool_alloc(qdf_device_t osdev, __qdf_mempool_t pool)
 {
+	struct __qdf_mempool_cpu_cache *cache;
 	void *buf = NULL;
 
 	if (!pool)
@@ -1344,16 +1520,33 @@ void *__qdf_mempool_alloc(qdf_device_t osdev, __qdf_mempool_t pool)
 	if (prealloc_disabled)
 		return  qdf_mem_malloc(pool->elem_size);
 
-	spin_lock_bh(&pool->lock);
+	local_bh_disable();
+	cache = this_cpu_ptr(pool->cpu_cache);
+	spin_lock(&cache->lock);
 
-	buf = STAILQ_FIRST(&pool->free_list);
-	if (buf) {
-		STAILQ_REMOVE_HEAD(&pool->free_list, mempool_entry);
-		pool->free_cnt--;
+	if (qdf_likely(cache->count)) {
+		cache->hits++;
+	} else {
+		cache->misses++;
+		spin_lock(&pool->lock);
+		cache->count = qdf_mempool_get_locked(
+					pool, cache->objs,
+					__QDF_MEMPOOL_CPU_CACHE_BATCH);
+		spin_unlock(&pool->lock);
 	}
 
-	/* TBD: Update free count if debug is enabled */
-	spin_unlock_bh(&pool->lock);
+	if (cache->count)
+		buf = cache->objs[--cache->count];
+
+	spin_unlock(&cache->lock);
+
+	if (qdf_unlikely(!buf))
+		qdf_mempool_steal(pool, &buf, 1);
+
+	if (buf)
+		cache->in_use++;
+
+	local_bh_enable();
 
 	return buf;
 }
@@ -1369,6 +1562,8 @@ qdf_export_symbol(__qdf_mempool_alloc);
  */
 void __qdf_mempool_free(qdf_device_t osdev, __qdf_mempool_t pool, void *buf)
 {
+	struct __qdf_mempool_cpu_cache *cache;
+
 	if (!pool)
 		return;
 
@@ -1376,15 +1571,175 @@ void __qdf_mempool_free(qdf_device_t osdev, __qdf_mempool_t pool, void *buf)
 	if (prealloc_disabled)
 		return qdf_mem_free(buf);
 
-	spin_lock_bh(&pool->lock);
-	pool->free_cnt++;
+	local_bh_disable();
+	cache = this_cpu_ptr(pool->cpu_cache);
+	spin_lock(&cache->lock);
+
+	if (qdf_unlikely(cache->count == __QDF_MEMPOOL_CPU_CACHE_SIZE)) {
+		cache->count -= __QDF_MEMPOOL_CPU_CACHE_BATCH;
+		spin_lock(&pool->lock);
+		qdf_mempool_put_locked(pool, &cache->objs[cache->count],
+				       __QDF_MEMPOOL_CPU_CACHE_BATCH);
+		spin_unlock(&pool->lock);
+	}
 
-	STAILQ_INSERT_TAIL
-		(&pool->free_list, (mempool_elem_t *)buf, mempool_entry);
-	spin_unlock_bh(&pool->lock);
+	cache->objs[cache->count++] = buf;
+	cache->in_use--;
+
+	spin_unlock(&cache->lock);
+	local_bh_enable();
 }
 qdf_export_symbol(__qdf_mempool_free);
 
+/**
+ * __qdf_mempool_alloc_bulk() - Allocate multiple elements from memory pool
+ * @osdev: platform device object
+ * @pool: Handle to memory pool
+ * @bufs: array to be filled with the allocated elements
+ * @num: number of elements requested
+ *
+ * Elements are served from the local CPU cache first and the remainder is
+ * taken from the shared free list under a single lock acquisition, falling
+ * back to the caches of other CPUs once the shared list is empty.
+ *
+ * Return: number of elements allocated, which may be less than @num
+ */
+int __qdf_mempool_alloc_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **bufs, int num)
+{
+	struct __qdf_mempool_cpu_cache *cache;
+	int cnt = 0;
+	int got;
+
+	if (!pool || num <= 0)
+		return 0;
+
+	if (prealloc_disabled) {
+		for (cnt = 0; cnt < num; cnt++) {
+			bufs[cnt] = qdf_mem_malloc(pool->elem_size);
+			if (!bufs[cnt])
+				break;
+		}
+		return cnt;
+	}
+
+	local_bh_disable();
+	cache = this_cpu_ptr(pool->cpu_cache);
+	spin_lock(&cache->lock);
+
+	while (cnt < num && cache->count) {
+		bufs[cnt++] = cache->objs[--cache->count];
+		cache->hits++;
+	}
+
+	if (cnt < num) {
+		spin_lock(&pool->lock);
+		got = qdf_mempool_get_locked(pool, &bufs[cnt], num - cnt);
+		spin_unlock(&pool->lock);
+		cache->misses += got;
+		cnt += got;
+	}
+
+	spin_unlock(&cache->lock);
+
+	if (qdf_unlikely(cnt < num))
+		cnt += qdf_mempool_steal(pool, &bufs[cnt], num - cnt);
+
+	cache->in_use += cnt;
+
+	local_bh_enable();
+
+	return cnt;
+}
+qdf_export_symbol(__qdf_mempool_alloc_bulk);
+
+/**
+ * __qdf_mempool_free_bulk() - Free multiple memory pool elements
+ * @osdev: platform device object
+ * @pool: Handle to memory pool
+ * @bufs: elements to be freed
+ * @num: number of elements in @bufs
+ *
+ * Elements refill the local CPU cache first and the remainder is returned
+ * to the shared free list under a single lock acquisition.
+ *
+ * Return: none
+ */
+void __qdf_mempool_free_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **bufs, int num)
+{
+	struct __qdf_mempool_cpu_cache *cache;
+	int cnt = 0;
+
+	if (!pool || num <= 0)
+		return;
+
+	if (prealloc_disabled) {
+		for (cnt = 0; cnt < num; cnt++)
+			qdf_mem_free(bufs[cnt]);
+		return;
+	}
+
+	local_bh_disable();
+	cache = this_cpu_ptr(pool->cpu_cache);
+	spin_lock(&cache->lock);
+
+	while (cnt < num && cache->count < __QDF_MEMPOOL_CPU_CACHE_SIZE)
+		cache->objs[cache->count++] = bufs[cnt++];
+
+	if (cnt < num) {
+		spin_lock(&pool->lock);
+		qdf_mempool_put_locked(pool, &bufs[cnt], num - cnt);
+		spin_unlock(&pool->lock);
+	}
+
+	cache->in_use -= num;
+
+	spin_unlock(&cache->lock);
+	local_bh_enable();
+}
+qdf_export_symbol(__qdf_mempool_free_bulk);
+
+void qdf_mempool_stats_print(int (*print)(void *priv, const char *fmt, ...),
+			     void *print_priv)
+{
+	struct __qdf_mempool_cpu_cache *cache;
+	__qdf_mempool_t pool;
+	u_int32_t cached;
+	u_int64_t hits;
+	u_int64_t misses;
+	int cpu;
+
+	print(print_priv,
+	      "pool elem_size max_elem free cached used_max cache_hits cache_misses hit_pct");
+
+	mutex_lock(&qdf_mempool_list_lock);
+	list_for_each_entry(pool, &qdf_mempool_list, node) {
+		cached = 0;
+		hits = 0;
+		misses = 0;
+
+		spin_lock_bh(&pool->lock);
+		qdf_mempool_update_used_max(pool);
+		spin_unlock_bh(&pool->lock);
+
+		for_each_possible_cpu(cpu) {
+			cache = per_cpu_ptr(pool->cpu_cache, cpu);
+			cached += READ_ONCE(cache->count);
+			hits += READ_ONCE(cache->hits);
+			misses += READ_ONCE(cache->misses);
+		}
+
+		print(print_priv, "%4d %9zu %8u %4u %6u %8u %10llu %12llu %7llu",
+		      pool->pool_id, pool->elem_size, pool->max_elem,
+		      pool->free_cnt, cached, pool->used_max, hits, misses,
+		      (hits + misses) ? div64_u64(hits * 100, hits + misses) :
+		      0);
+	}
+	mutex_unlock(&qdf_mempool_list_lock);
+}
+qdf_export_symbol(qdf_mempool_stats_print);
+
 #ifdef CNSS_MEM_PRE_ALLOC
 static bool qdf_might_be_prealloc(void *ptr)
 {
@@ -28,6 +28,7 @@
 #include <qdf_mem.h>
 #include <qdf_event.h>
 #include <qdf_talloc.h>
+#include <qdf_func_tracker.h>
 
 MODULE_AUTHOR("Qualcomm Atheros Inc.");
 MODULE_DESCRIPTION("Qualcomm Atheros Device Framework Module");
@@ -58,6 +59,7 @@ int qdf_mod_init(void)
 	qdf_nbuf_mod_init();
 	qdf_frag_mod_init();
 	qdf_event_list_init();
+	qdf_prof_init();
 
 	return 0;
 }
@@ -76,6 +78,7 @@ static void __exit qdf_mod_exit(void)
 void qdf_mod_exit(void)
 #endif
 {
+	qdf_prof_deinit();
 	qdf_event_list_destroy();
 	qdf_frag_mod_exit();
 	qdf_nbuf_mod_exit();
@@ -242,6 +242,113 @@ TRACE_EVENT(dp_ce_tasklet_sched_latency,
 	    TP_printk("ce_id=%u latency(ns)=%llu", __entry->ce_id,
 		      __entry->sched_latency)
 );
+
+DECLARE_EVENT_CLASS(dp_trace_msdu_class,
+		    TP_PROTO(uint8_t ring_id, uint8_t vdev_id, uint16_t peer_id,
+			     uint8_t tid, uint16_t len, uint8_t status,
+			     uint32_t latency),
+		    TP_ARGS(ring_id, vdev_id, peer_id, tid, len, status,
+			    latency),
+		    TP_STRUCT__entry(
+			__field(uint8_t, ring_id)
+			__field(uint8_t, vdev_id)
+			__field(uint16_t, peer_id)
+			__field(uint8_t, tid)
+			__field(uint8_t, status)
+			__field(uint16_t, len)
+			__field(uint32_t, latency)
+		    ),
+		    TP_fast_assign(
+			__entry->ring_id = ring_id;
+			__entry->vdev_id = vdev_id;
+			__entry->peer_id = peer_id;
+			__entry->tid = tid;
+			__entry->status = status;
+			__entry->len = len;
+			__entry->latency = latency;
+		    ),
+		    TP_printk("ring=%u vdev=%u peer=%u tid=%u len=%u status=%u latency(ms)=%u",
+			      __entry->ring_id, __entry->vdev_id,
+			      __entry->peer_id, __entry->tid, __entry->len,
+			      __entry->status, __entry->latency)
+);
+
+DEFINE_EVENT(dp_trace_msdu_class, dp_rx_msdu,
+	     TP_PROTO(uint8_t ring_id, uint8_t vdev_id, uint16_t peer_id,
+		      uint8_t tid, uint16_t len, uint8_t status,
+		      uint32_t latency),
+	     TP_ARGS(ring_id, vdev_id, peer_id, tid, len, status, latency)
+);
+
+DEFINE_EVENT(dp_trace_msdu_class, dp_tx_send_msdu,
+	     TP_PROTO(uint8_t ring_id, uint8_t vdev_id, uint16_t peer_id,
+		      uint8_t tid, uint16_t len, uint8_t status,
+		      uint32_t latency),
+	     TP_ARGS(ring_id, vdev_id, peer_id, tid, len, status, latency)
+);
+
+DEFINE_EVENT(dp_trace_msdu_class, dp_tx_comp_msdu,
+	     TP_PROTO(uint8_t ring_id, uint8_t vdev_id, uint16_t peer_id,
+		      uint8_t tid, uint16_t len, uint8_t status,
+		      uint32_t latency),
+	     TP_ARGS(ring_id, vdev_id, peer_id, tid, len, status, latency)
+);
+
+DECLARE_EVENT_CLASS(dp_trace_ring_class,
+		    TP_PROTO(uint8_t ring_id, uint32_t hp, uint32_t tp,
+			     uint32_t num_reaped, uint32_t quota),
+		    TP_ARGS(ring_id, hp, tp, num_reaped, quota),
+		    TP_STRUCT__entry(
+			__field(uint8_t, ring_id)
+			__field(uint32_t, hp)
+			__field(uint32_t, tp)
+			__field(uint32_t, num_reaped)
+			__field(uint32_t, quota)
+		    ),
+		    TP_fast_assign(
+			__entry->ring_id = ring_id;
+			__entry->hp = hp;
+			__entry->tp = tp;
+			__entry->num_reaped = num_reaped;
+			__entry->quota = quota;
+		    ),
+		    TP_printk("ring=%u hp=%u tp=%u reaped=%u quota=%u",
+			      __entry->ring_id, __entry->hp, __entry->tp,
+			      __entry->num_reaped, __entry->quota)
+);
+
+DEFINE_EVENT(dp_trace_ring_class, dp_rx_ring_reap,
+	     TP_PROTO(uint8_t ring_id, uint32_t hp, uint32_t tp,
+		      uint32_t num_reaped, uint32_t quota),
+	     TP_ARGS(ring_id, hp, tp, num_reaped, quota)
+);
+
+DEFINE_EVENT(dp_trace_ring_class, dp_tx_comp_ring_reap,
+	     TP_PROTO(uint8_t ring_id, uint32_t hp, uint32_t tp,
+		      uint32_t num_reaped, uint32_t quota),
+	     TP_ARGS(ring_id, hp, tp, num_reaped, quota)
+);
+
+TRACE_EVENT(dp_rx_peer_deliver,
+	    TP_PROTO(uint8_t vdev_id, uint16_t peer_id, uint32_t num_msdus,
+		     uint32_t num_bytes),
+	    TP_ARGS(vdev_id, peer_id, num_msdus, num_bytes),
+	    TP_STRUCT__entry(
+		__field(uint8_t, vdev_id)
+		__field(uint16_t, peer_id)
+		__field(uint32_t, num_msdus)
+		__field(uint32_t, num_bytes)
+	    ),
+	    TP_fast_assign(
+		__entry->vdev_id = vdev_id;
+		__entry->peer_id = peer_id;
+		__entry->num_msdus = num_msdus;
+		__entry->num_bytes = num_bytes;
+	    ),
+	    TP_printk("vdev=%u peer=%u msdus=%u bytes=%u",
+		      __entry->vdev_id, __entry->peer_id,
+		      __entry->num_msdus, __entry->num_bytes)
+);
 #endif /* _QDF_TRACEPOINT_DEFS_H */
 
 /* Below should be outside the protection */
@@ -37,6 +37,7 @@ qdf_flex_mem_seg_alloc(struct qdf_flex_mem_pool *pool)
 		return NULL;
 
 	seg->dynamic = true;
+	seg->owned = false;
 	seg->bytes = (uint8_t *)(seg + 1);
 	seg->used_bitmap = 0;
 	qdf_list_insert_back(&pool->seg_list, &seg->node);
@@ -50,6 +51,11 @@ void qdf_flex_mem_init(struct qdf_flex_mem_pool *pool)
 
 	qdf_spinlock_create(&pool->lock);
 
+	for (i = 0; i < QDF_FM_CPU_SLOTS; i++) {
+		pool->slots[i].busy = 0;
+		pool->slots[i].seg = NULL;
+	}
+
 	for (i = 0; i < pool->reduction_limit; i++)
 		qdf_flex_mem_seg_alloc(pool);
 }
@@ -58,9 +64,17 @@ qdf_export_symbol(qdf_flex_mem_init);
 void qdf_flex_mem_deinit(struct qdf_flex_mem_pool *pool)
 {
 	struct qdf_flex_mem_segment *seg, *next;
+	int i;
 
 	qdf_spinlock_destroy(&pool->lock);
 
+	for (i = 0; i < QDF_FM_CPU_SLOTS; i++) {
+		seg = pool->slots[i].seg;
+		if (seg)
+			seg->owned = false;
+		pool->slots[i].seg = NULL;
+	}
+
 	qdf_list_for_each_del(&pool->seg_list, seg, next, node) {
 		QDF_BUG(!seg->used_bitmap);
 		if (seg->used_bitmap)
@@ -73,85 +87,209 @@ void qdf_flex_mem_deinit(struct qdf_flex_mem_pool *pool)
 }
 qdf_export_symbol(qdf_flex_mem_deinit);
 
-static void *__qdf_flex_mem_alloc(struct qdf_flex_mem_pool *pool)
+/**
+ * qdf_flex_mem_slot_get() - try to take exclusive use of the local CPU slot
+ * @pool: the pool to get the slot from
+ *
+ * This never spins; if the slot is in use by another context (e.g. the current
+ * task was interrupted by a softirq using the same pool), the caller falls
+ * back to the locked path.
+ *
+ * Return: the slot on success, NULL if the slot is busy or the pool is locked
+ */
+static struct qdf_flex_mem_cpu_slot *
+qdf_flex_mem_slot_get(struct qdf_flex_mem_pool *pool)
 {
-	struct qdf_flex_mem_segment *seg;
+	struct qdf_flex_mem_cpu_slot *slot;
 
-	qdf_list_for_each(&pool->seg_list, seg, node) {
-		int index;
-		void *ptr;
+	if (pool->locked_only)
+		return NULL;
+
+	slot = &pool->slots[qdf_get_cpu() % QDF_FM_CPU_SLOTS];
+	if (qdf_atomic_test_and_set_bit(0, &slot->busy))
+		return NULL;
 
+	return slot;
+}
+
+static void qdf_flex_mem_slot_put(struct qdf_flex_mem_cpu_slot *slot)
+{
+	/* value returning atomics are fully ordered, unlike clear_bit */
+	qdf_atomic_test_and_clear_bit(0, &slot->busy);
+}
+
+/**
+ * qdf_flex_mem_seg_claim() - atomically claim an unused item of a segment
+ * @pool: the pool @seg belongs to
+ * @seg: the segment to claim from
+ *
+ * Return: pointer to the zeroed item, NULL if @seg is full
+ */
+static void *qdf_flex_mem_seg_claim(struct qdf_flex_mem_pool *pool,
+				    struct qdf_flex_mem_segment *seg)
+{
+	void *ptr;
+	int index;
+
+	do {
 		index = qdf_ffz(seg->used_bitmap);
 		if (index < 0)
-			continue;
+			return NULL;
 
 		QDF_BUG(index < QDF_FM_BITMAP_BITS);
+	} while (qdf_atomic_test_and_set_bit(index, &seg->used_bitmap));
 
-		seg->used_bitmap ^= (QDF_FM_BITMAP)1 << index;
-		ptr = &seg->bytes[index * pool->item_size];
-		qdf_mem_zero(ptr, pool->item_size);
+	ptr = &seg->bytes[index * pool->item_size];
+	qdf_mem_zero(ptr, pool->item_size);
+
+	return ptr;
+}
+
+static bool qdf_flex_mem_seg_contains(struct qdf_flex_mem_pool *pool,
+				      struct qdf_flex_mem_segment *seg,
+				      void *ptr)
+{
+	uint8_t *low_addr = seg->bytes;
+	uint8_t *high_addr = low_addr + pool->item_size * QDF_FM_BITMAP_BITS;
+
+	return (uint8_t *)ptr >= low_addr && (uint8_t *)ptr < high_addr;
+}
+
+static void qdf_flex_mem_seg_free(struct qdf_flex_mem_pool *pool,
+				  struct qdf_flex_mem_segment *seg)
+{
+	if (!seg->dynamic)
+		return;
+
+	/* owned segments may be accessed without the lock; keep them */
+	if (seg->owned)
+		return;
+
+	if (seg->used_bitmap)
+		return;
+
+	if (qdf_list_size(&pool->seg_list) <= pool->reduction_limit)
+		return;
+
+	qdf_list_remove_node(&pool->seg_list, &seg->node);
+	qdf_tfree(seg);
+}
+
+/**
+ * qdf_flex_mem_slot_own() - make @slot the owner of @seg
+ * @pool: the pool @slot and @seg belong to
+ * @slot: the slot taking ownership, held by the caller
+ * @seg: the segment to own
+ *
+ * The segment previously owned by @slot is released, and freed if it became
+ * empty in the meantime. Caller must hold the pool lock.
+ *
+ * Return: None
+ */
+static void qdf_flex_mem_slot_own(struct qdf_flex_mem_pool *pool,
+				  struct qdf_flex_mem_cpu_slot *slot,
+				  struct qdf_flex_mem_segment *seg)
+{
+	struct qdf_flex_mem_segment *old_seg = slot->seg;
+
+	if (old_seg == seg)
+		return;
+
+	seg->owned = true;
+	slot->seg = seg;
+
+	if (old_seg) {
+		old_seg->owned = false;
+		qdf_flex_mem_seg_free(pool, old_seg);
+	}
+}
+
+static void *__qdf_flex_mem_alloc(struct qdf_flex_mem_pool *pool,
+				  struct qdf_flex_mem_cpu_slot *slot)
+{
+	struct qdf_flex_mem_segment *seg;
+	void *ptr;
+
+	/* prefer a segment nobody owns, so it can become ours */
+	qdf_list_for_each(&pool->seg_list, seg, node) {
+		if (seg->owned)
+			continue;
+
+		ptr = qdf_flex_mem_seg_claim(pool, seg);
+		if (!ptr)
+			continue;
+
+		if (slot)
+			qdf_flex_mem_slot_own(pool, slot, seg);
 
 		return ptr;
 	}
 
+	qdf_list_for_each(&pool->seg_list, seg, node) {
+		ptr = qdf_flex_mem_seg_claim(pool, seg);
+		if (ptr)
+			return ptr;
+	}
+
 	seg = qdf_flex_mem_seg_alloc(pool);
 	if (!seg)
 		return NULL;
 
-	seg->used_bitmap = 1;
+	ptr = qdf_flex_mem_seg_claim(pool, seg);
+	if (slot)
+		qdf_flex_mem_slot_own(pool, slot, seg);
 
-	return seg->bytes;
+	return ptr;
 }
 
 void *qdf_flex_mem_alloc(struct qdf_flex_mem_pool *pool)
 {
-	void *ptr;
+	struct qdf_flex_mem_cpu_slot *slot;
+	void *ptr = NULL;
 
 	QDF_BUG(pool);
 	if (!pool)
 		return NULL;
 
-	qdf_spin_lock_bh(&pool->lock);
-	ptr = __qdf_flex_mem_alloc(pool);
-	qdf_spin_unlock_bh(&pool->lock);
+	slot = qdf_flex_mem_slot_get(pool);
+	if (slot && slot->seg)
+		ptr = qdf_flex_mem_seg_claim(pool, slot->seg);
+
+	if (!ptr) {
+		qdf_spin_lock_bh(&pool->lock);
+		ptr = __qdf_flex_mem_alloc(pool, slot);
+		qdf_spin_unlock_bh(&pool->lock);
+	}
+
+	if (slot)
+		qdf_flex_mem_slot_put(slot);
 
 	return ptr;
 }
 qdf_export_symbol(qdf_flex_mem_alloc);
 
-static void qdf_flex_mem_seg_free(struct qdf_flex_mem_pool *pool,
-				  struct qdf_flex_mem_segment *seg)
+static void qdf_flex_mem_seg_release(struct qdf_flex_mem_pool *pool,
+				     struct qdf_flex_mem_segment *seg,
+				     void *ptr)
 {
-	if (!seg->dynamic)
-		return;
+	unsigned long index;
 
-	if (qdf_list_size(&pool->seg_list) <= pool->reduction_limit)
-		return;
+	index = ((uint8_t *)ptr - seg->bytes) / pool->item_size;
+	QDF_BUG(index < QDF_FM_BITMAP_BITS);
 
-	qdf_list_remove_node(&pool->seg_list, &seg->node);
-	qdf_tfree(seg);
+	qdf_atomic_clear_bit(index, &seg->used_bitmap);
 }
 
 static void __qdf_flex_mem_free(struct qdf_flex_mem_pool *pool, void *ptr)
 {
 	struct qdf_flex_mem_segment *seg;
-	void *low_addr;
-	void *high_addr;
-	unsigned long index;
 
 	qdf_list_for_each(&pool->seg_list, seg, node) {
-		low_addr = seg->bytes;
-		high_addr = low_addr + pool->item_size * QDF_FM_BITMAP_BITS;
-
-		if (ptr < low_addr || ptr > high_addr)
+		if (!qdf_flex_mem_seg_contains(pool, seg, ptr))
 			continue;
 
-		index = (ptr - low_addr) / pool->item_size;
-		QDF_BUG(index < QDF_FM_BITMAP_BITS);
-
-		seg->used_bitmap ^= (QDF_FM_BITMAP)1 << index;
-		if (!seg->used_bitmap)
-			qdf_flex_mem_seg_free(pool, seg);
+		qdf_flex_mem_seg_release(pool, seg, ptr);
+		qdf_flex_mem_seg_free(pool, seg);
 
 		return;
 	}
@@ -161,6 +299,8 @@ static void __qdf_flex_mem_free(struct qdf_flex_mem_pool *pool, void *ptr)
 
 void qdf_flex_mem_free(struct qdf_flex_mem_pool *pool, void *ptr)
 {
+	struct qdf_flex_mem_cpu_slot *slot;
+
 	QDF_BUG(pool);
 	if (!pool)
 		return;
@@ -169,9 +309,20 @@ void qdf_flex_mem_free(struct qdf_flex_mem_pool *pool, void *ptr)
 	if (!ptr)
 		return;
 
+	slot = qdf_flex_mem_slot_get(pool);
+	if (slot) {
+		if (slot->seg &&
+		    qdf_flex_mem_seg_contains(pool, slot->seg, ptr)) {
+			qdf_flex_mem_seg_release(pool, slot->seg, ptr);
+			qdf_flex_mem_slot_put(slot);
+			return;
+		}
+		qdf_flex_mem_slot_put(slot);
+	}
+
+	/* remote free: the owning segment may be freed once it is empty */
 	qdf_spin_lock_bh(&pool->lock);
 	__qdf_flex_mem_free(pool, ptr);
 	qdf_spin_unlock_bh(&pool->lock);
 }
 qdf_export_symbol(qdf_flex_mem_free);
-
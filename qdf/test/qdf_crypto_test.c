@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2021 The Linux Foundation. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_crypto.h"
+#include "qdf_mem.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+#include "qdf_types.h"
+#include "qdf_crypto_test.h"
+
+#define UT_CMAC_BENCH_ITERATIONS 1000
+
+/* RFC 4493 section 4 AES-CMAC test vectors */
+static const uint8_t ut_cmac_key[AES_BLOCK_SIZE] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+	0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const uint8_t ut_cmac_msg[64] = {
+	0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+	0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+	0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+	0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+	0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+	0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+	0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+	0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+
+static const struct {
+	uint16_t len;
+	uint8_t mic[CMAC_TLEN];
+} ut_cmac_vectors[] = {
+	{ 0, { 0xbb, 0x1d, 0x69, 0x29, 0xe9, 0x59, 0x37, 0x28 } },
+	{ 16, { 0x07, 0x0a, 0x16, 0xb4, 0x6b, 0x4d, 0x41, 0x44 } },
+	{ 40, { 0xdf, 0xa6, 0x67, 0x47, 0xde, 0x9a, 0xe6, 0x30 } },
+	{ 64, { 0x51, 0xf0, 0xbe, 0xbf, 0x7e, 0x3b, 0x9d, 0x92 } },
+};
+
+static uint32_t qdf_crypto_ut_cmac_vectors(void)
+{
+	struct qdf_crypto_cmac_ctx *ctx;
+	uint8_t mic[CMAC_TLEN];
+	uint32_t errors = 0;
+	uint32_t i;
+
+	ctx = qdf_crypto_aes_128_cmac_ctx_create(ut_cmac_key);
+	if (!ctx) {
+		qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_ctx_create");
+		return 1;
+	}
+
+	for (i = 0; i < QDF_ARRAY_SIZE(ut_cmac_vectors); i++) {
+		uint16_t len = ut_cmac_vectors[i].len;
+
+		if (qdf_crypto_aes_128_cmac(ut_cmac_key, ut_cmac_msg, len,
+					    mic) ||
+		    qdf_mem_cmp(mic, ut_cmac_vectors[i].mic, CMAC_TLEN)) {
+			qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac len %u",
+				       len);
+			errors++;
+		}
+
+		qdf_mem_zero(mic, sizeof(mic));
+		if (qdf_crypto_aes_128_cmac_keyed(ctx, ut_cmac_msg, len, mic) ||
+		    qdf_mem_cmp(mic, ut_cmac_vectors[i].mic, CMAC_TLEN)) {
+			qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_keyed len %u",
+				       len);
+			errors++;
+		}
+	}
+
+	qdf_crypto_aes_128_cmac_ctx_destroy(ctx);
+
+	return errors;
+}
+
+static uint32_t qdf_crypto_ut_cmac_batch(void)
+{
+	struct qdf_crypto_cmac_req reqs[QDF_ARRAY_SIZE(ut_cmac_vectors)];
+	uint8_t mics[QDF_ARRAY_SIZE(ut_cmac_vectors)][CMAC_TLEN];
+	struct qdf_crypto_cmac_ctx *ctx;
+	uint32_t errors = 0;
+	uint32_t i;
+
+	ctx = qdf_crypto_aes_128_cmac_ctx_create(ut_cmac_key);
+	if (!ctx) {
+		qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_ctx_create");
+		return 1;
+	}
+
+	for (i = 0; i < QDF_ARRAY_SIZE(ut_cmac_vectors); i++) {
+		reqs[i].ctx = ctx;
+		reqs[i].data = ut_cmac_msg;
+		reqs[i].len = ut_cmac_vectors[i].len;
+		reqs[i].mic = mics[i];
+	}
+
+	if (qdf_crypto_aes_128_cmac_batch(reqs, QDF_ARRAY_SIZE(reqs))) {
+		qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_batch");
+		errors++;
+	}
+
+	for (i = 0; i < QDF_ARRAY_SIZE(ut_cmac_vectors); i++) {
+		if (qdf_mem_cmp(mics[i], ut_cmac_vectors[i].mic, CMAC_TLEN)) {
+			qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_batch req %u",
+				       i);
+			errors++;
+		}
+	}
+
+	/* an invalid request is reported without skipping the others */
+	qdf_mem_zero(mics, sizeof(mics));
+	reqs[0].ctx = NULL;
+	if (!qdf_crypto_aes_128_cmac_batch(reqs, QDF_ARRAY_SIZE(reqs))) {
+		qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_batch accepted invalid req");
+		errors++;
+	}
+
+	if (qdf_mem_cmp(mics[1], ut_cmac_vectors[1].mic, CMAC_TLEN)) {
+		qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_batch skipped valid req");
+		errors++;
+	}
+
+	qdf_crypto_aes_128_cmac_ctx_destroy(ctx);
+
+	return errors;
+}
+
+static uint32_t qdf_crypto_ut_cmac_bench(void)
+{
+	struct qdf_crypto_cmac_ctx *ctx;
+	uint8_t mic[CMAC_TLEN];
+	uint64_t start, oneshot_us, keyed_us;
+	uint32_t i;
+
+	ctx = qdf_crypto_aes_128_cmac_ctx_create(ut_cmac_key);
+	if (!ctx) {
+		qdf_nofl_alert("FAIL: qdf_crypto_aes_128_cmac_ctx_create");
+		return 1;
+	}
+
+	start = qdf_get_monotonic_boottime();
+	for (i = 0; i < UT_CMAC_BENCH_ITERATIONS; i++)
+		qdf_crypto_aes_128_cmac(ut_cmac_key, ut_cmac_msg,
+					sizeof(ut_cmac_msg), mic);
+	oneshot_us = qdf_get_monotonic_boottime() - start;
+
+	start = qdf_get_monotonic_boottime();
+	for (i = 0; i < UT_CMAC_BENCH_ITERATIONS; i++)
+		qdf_crypto_aes_128_cmac_keyed(ctx, ut_cmac_msg,
+					      sizeof(ut_cmac_msg), mic);
+	keyed_us = qdf_get_monotonic_boottime() - start;
+
+	qdf_crypto_aes_128_cmac_ctx_destroy(ctx);
+
+	qdf_nofl_info("CMAC %d x %zu bytes: one-shot %llu us, keyed %llu us",
+		      UT_CMAC_BENCH_ITERATIONS, sizeof(ut_cmac_msg),
+		      oneshot_us, keyed_us);
+
+	return 0;
+}
+
+uint32_t qdf_crypto_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += qdf_crypto_ut_cmac_vectors();
+	errors += qdf_crypto_ut_cmac_batch();
+	errors += qdf_crypto_ut_cmac_bench();
+
+	return errors;
+}
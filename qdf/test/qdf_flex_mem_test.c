@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2021 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_flex_mem.h"
+#include "qdf_flex_mem_test.h"
+#include "qdf_list.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+
+#define qdf_flex_mem_test_item_size 64
+#define qdf_flex_mem_test_segs 3
+#define qdf_flex_mem_test_items (QDF_FM_BITMAP_BITS * qdf_flex_mem_test_segs)
+
+#define qdf_flex_mem_bench_threads 8
+#define qdf_flex_mem_bench_iters 100000
+#define qdf_flex_mem_bench_batch 8
+
+DEFINE_QDF_FLEX_MEM_POOL(qdf_flex_mem_test_pool, qdf_flex_mem_test_item_size,
+			 0);
+
+static uint32_t qdf_flex_mem_test_alloc_free(void)
+{
+	struct qdf_flex_mem_pool *pool = &qdf_flex_mem_test_pool;
+	static uint8_t *items[qdf_flex_mem_test_items];
+	int i, j;
+
+	qdf_flex_mem_init(pool);
+
+	/* a pool should ... */
+	for (i = 0; i < qdf_flex_mem_test_items; i++) {
+		/* ... hand out zeroed items, growing as needed */
+		items[i] = qdf_flex_mem_alloc(pool);
+		QDF_BUG(items[i]);
+		for (j = 0; j < qdf_flex_mem_test_item_size; j++)
+			QDF_BUG(!items[i][j]);
+		qdf_mem_set(items[i], qdf_flex_mem_test_item_size, 0xa5);
+	}
+
+	/* ... never hand out the same item twice */
+	for (i = 0; i < qdf_flex_mem_test_items; i++)
+		for (j = i + 1; j < qdf_flex_mem_test_items; j++)
+			QDF_BUG(items[i] != items[j]);
+
+	QDF_BUG(qdf_list_size(&pool->seg_list) >= qdf_flex_mem_test_segs);
+
+	/* ... accept items back in any order */
+	for (i = qdf_flex_mem_test_items - 1; i >= 0; i -= 2)
+		qdf_flex_mem_free(pool, items[i]);
+	for (i = qdf_flex_mem_test_items - 2; i >= 0; i -= 2)
+		qdf_flex_mem_free(pool, items[i]);
+
+	/* ... only keep segments still owned by a CPU slot, or the head */
+	QDF_BUG(qdf_list_size(&pool->seg_list) <= QDF_FM_CPU_SLOTS + 1);
+
+	qdf_flex_mem_deinit(pool);
+
+	/* ... release every segment on deinit once all items are freed */
+	QDF_BUG(qdf_list_empty(&pool->seg_list));
+
+	return 0;
+}
+
+static QDF_STATUS qdf_flex_mem_bench_thread(void *context)
+{
+	struct qdf_flex_mem_pool *pool = context;
+	void *items[qdf_flex_mem_bench_batch];
+	int i, j;
+
+	for (i = 0; i < qdf_flex_mem_bench_iters; i++) {
+		for (j = 0; j < qdf_flex_mem_bench_batch; j++) {
+			items[j] = qdf_flex_mem_alloc(pool);
+			QDF_BUG(items[j]);
+		}
+
+		for (j = 0; j < qdf_flex_mem_bench_batch; j++)
+			qdf_flex_mem_free(pool, items[j]);
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static uint64_t qdf_flex_mem_bench_run(struct qdf_flex_mem_pool *pool)
+{
+	qdf_thread_t *threads[qdf_flex_mem_bench_threads];
+	uint64_t start_us;
+	int i;
+
+	qdf_flex_mem_init(pool);
+
+	start_us = qdf_get_monotonic_boottime();
+
+	for (i = 0; i < qdf_flex_mem_bench_threads; i++) {
+		threads[i] = qdf_thread_run(qdf_flex_mem_bench_thread, pool);
+		QDF_BUG(threads[i]);
+	}
+
+	for (i = 0; i < qdf_flex_mem_bench_threads; i++) {
+		if (threads[i])
+			qdf_thread_join(threads[i]);
+	}
+
+	start_us = qdf_get_monotonic_boottime() - start_us;
+
+	qdf_flex_mem_deinit(pool);
+
+	return start_us;
+}
+
+static uint32_t qdf_flex_mem_test_bench(void)
+{
+	struct qdf_flex_mem_pool *pool = &qdf_flex_mem_test_pool;
+	uint64_t ops = (uint64_t)qdf_flex_mem_bench_threads *
+		       qdf_flex_mem_bench_iters * qdf_flex_mem_bench_batch;
+	uint64_t locked_us;
+	uint64_t percpu_us;
+
+	pool->locked_only = true;
+	locked_us = qdf_flex_mem_bench_run(pool);
+
+	pool->locked_only = false;
+	percpu_us = qdf_flex_mem_bench_run(pool);
+
+	qdf_nofl_info("flex mem bench: %d threads, %llu alloc/free pairs",
+		      qdf_flex_mem_bench_threads, ops);
+	qdf_nofl_info("flex mem bench: locked %llu us, per-cpu %llu us",
+		      locked_us, percpu_us);
+
+	return 0;
+}
+
+uint32_t qdf_flex_mem_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += qdf_flex_mem_test_alloc_free();
+	errors += qdf_flex_mem_test_bench();
+
+	return errors;
+}
+
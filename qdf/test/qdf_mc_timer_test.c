@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_atomic.h"
+#include "qdf_mc_timer.h"
+#include "qdf_mc_timer_test.h"
+#include "qdf_mem.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+
+#define qdf_mc_timer_stress_count 100000
+/* spread the stress timers over an hour, so every wheel level is used */
+#define qdf_mc_timer_stress_spread_ms (3600 * 1000)
+#define qdf_mc_timer_stress_min_ms 1000
+
+#define qdf_mc_timer_fire_count 1000
+#define qdf_mc_timer_fire_max_ms 200
+#define qdf_mc_timer_fire_wait_ms 5000
+
+static void qdf_mc_timer_test_cb(void *user_data)
+{
+	qdf_atomic_t *fired = user_data;
+
+	qdf_atomic_inc(fired);
+}
+
+static qdf_mc_timer_t *qdf_mc_timer_test_create(uint32_t count,
+						qdf_atomic_t *fired)
+{
+	qdf_mc_timer_t *timers;
+	QDF_STATUS status;
+	uint32_t i;
+
+	timers = qdf_mem_valloc(count * sizeof(*timers));
+	QDF_BUG(timers);
+	if (!timers)
+		return NULL;
+
+	for (i = 0; i < count; i++) {
+		status = qdf_mc_timer_init(&timers[i], QDF_TIMER_TYPE_SW,
+					   qdf_mc_timer_test_cb, fired);
+		QDF_BUG(QDF_IS_STATUS_SUCCESS(status));
+	}
+
+	return timers;
+}
+
+static void qdf_mc_timer_test_destroy(qdf_mc_timer_t *timers, uint32_t count)
+{
+	uint32_t i;
+
+	for (i = 0; i < count; i++)
+		QDF_BUG(QDF_IS_STATUS_SUCCESS(qdf_mc_timer_destroy(&timers[i])));
+
+	qdf_mem_vfree(timers);
+}
+
+static uint32_t qdf_mc_timer_test_stress(void)
+{
+	qdf_mc_timer_t *timers;
+	qdf_atomic_t fired;
+	uint64_t start_us;
+	uint64_t stop_us;
+	uint32_t i;
+
+	qdf_atomic_init(&fired);
+
+	timers = qdf_mc_timer_test_create(qdf_mc_timer_stress_count, &fired);
+	if (!timers)
+		return 1;
+
+	/* starting many timers should ... */
+	start_us = qdf_get_monotonic_boottime();
+	for (i = 0; i < qdf_mc_timer_stress_count; i++)
+		QDF_BUG(QDF_IS_STATUS_SUCCESS(qdf_mc_timer_start(
+			&timers[i], qdf_mc_timer_stress_min_ms +
+			(i * 7919) % qdf_mc_timer_stress_spread_ms)));
+	start_us = qdf_get_monotonic_boottime() - start_us;
+
+	/* ... leave all of them running */
+	for (i = 0; i < qdf_mc_timer_stress_count; i++)
+		QDF_BUG(qdf_mc_timer_get_current_state(&timers[i]) ==
+			QDF_TIMER_STATE_RUNNING);
+
+	/* ... and allow stopping all of them, in any order */
+	stop_us = qdf_get_monotonic_boottime();
+	for (i = 0; i < qdf_mc_timer_stress_count; i += 2)
+		QDF_BUG(QDF_IS_STATUS_SUCCESS(qdf_mc_timer_stop(&timers[i])));
+	for (i = 1; i < qdf_mc_timer_stress_count; i += 2)
+		QDF_BUG(QDF_IS_STATUS_SUCCESS(qdf_mc_timer_stop(&timers[i])));
+	stop_us = qdf_get_monotonic_boottime() - stop_us;
+
+	for (i = 0; i < qdf_mc_timer_stress_count; i++)
+		QDF_BUG(qdf_mc_timer_get_current_state(&timers[i]) ==
+			QDF_TIMER_STATE_STOPPED);
+
+	/* ... without any of them firing */
+	QDF_BUG(!qdf_atomic_read(&fired));
+
+	qdf_mc_timer_test_destroy(timers, qdf_mc_timer_stress_count);
+
+	qdf_nofl_info("mc timer stress: %u timers, start %llu us, stop %llu us",
+		      qdf_mc_timer_stress_count, start_us, stop_us);
+
+	return 0;
+}
+
+static uint32_t qdf_mc_timer_test_fire(void)
+{
+	qdf_mc_timer_t *timers;
+	qdf_atomic_t fired;
+	uint32_t waited_ms = 0;
+	uint32_t i;
+
+	qdf_atomic_init(&fired);
+
+	timers = qdf_mc_timer_test_create(qdf_mc_timer_fire_count, &fired);
+	if (!timers)
+		return 1;
+
+	/* started timers should all fire exactly once */
+	for (i = 0; i < qdf_mc_timer_fire_count; i++)
+		QDF_BUG(QDF_IS_STATUS_SUCCESS(qdf_mc_timer_start(
+			&timers[i], 10 + i % qdf_mc_timer_fire_max_ms)));
+
+	while (qdf_atomic_read(&fired) < qdf_mc_timer_fire_count &&
+	       waited_ms < qdf_mc_timer_fire_wait_ms) {
+		qdf_sleep(10);
+		waited_ms += 10;
+	}
+
+	QDF_BUG(qdf_atomic_read(&fired) == qdf_mc_timer_fire_count);
+
+	for (i = 0; i < qdf_mc_timer_fire_count; i++)
+		QDF_BUG(qdf_mc_timer_get_current_state(&timers[i]) ==
+			QDF_TIMER_STATE_STOPPED);
+
+	qdf_mc_timer_test_destroy(timers, qdf_mc_timer_fire_count);
+
+	return 0;
+}
+
+uint32_t qdf_mc_timer_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += qdf_mc_timer_test_stress();
+	errors += qdf_mc_timer_test_fire();
+
+	return errors;
+}
+
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2021 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef __QDF_MC_TIMER_TEST_H
+#define __QDF_MC_TIMER_TEST_H
+
+#ifdef WLAN_MC_TIMER_TEST
+/**
+ * qdf_mc_timer_unit_test() - run the qdf mc timer unit test suite
+ *
+ * This starts and stops a large number of MC timers and logs the time taken,
+ * then checks that a smaller set of short timers all fire. The scheduler
+ * thread must be running for the latter.
+ *
+ * Return: number of failed test cases
+ */
+uint32_t qdf_mc_timer_unit_test(void);
+#else
+static inline uint32_t qdf_mc_timer_unit_test(void)
+{
+	return 0;
+}
+#endif /* WLAN_MC_TIMER_TEST */
+
+#endif /* __QDF_MC_TIMER_TEST_H */
+
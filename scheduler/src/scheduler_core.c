@@ -19,6 +19,7 @@
 #include <scheduler_core.h>
 #include <qdf_atomic.h>
 #include "qdf_flex_mem.h"
+#include "qdf_func_tracker.h"
 
 static struct scheduler_ctx g_sched_ctx;
 static struct scheduler_ctx *gp_sched_ctx;
@@ -353,6 +354,7 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 	int i;
 	QDF_STATUS status;
 	struct scheduler_msg *msg;
+	qdf_prof_ts_t prof_ts;
 
 	if (!sch_ctx) {
 		QDF_DEBUG_PANIC("sch_ctx is null");
@@ -393,8 +395,10 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 			sched_history_start(msg);
 			qdf_timer_start(&sch_ctx->watchdog_timer,
 					sch_ctx->timeout);
+			prof_ts = qdf_prof_start();
 			status = sch_ctx->queue_ctx.
 					scheduler_msg_process_fn[i](msg);
+			qdf_prof_end(QDF_PROF_SCHED_MSG, prof_ts);
 			qdf_timer_stop(&sch_ctx->watchdog_timer);
 			sched_history_stop();
 
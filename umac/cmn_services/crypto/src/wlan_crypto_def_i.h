@@ -22,6 +22,8 @@
 #ifndef _WLAN_CRYPTO_DEF_I_H_
 #define _WLAN_CRYPTO_DEF_I_H_
 
+#include <qdf_atomic.h>
+#include <qdf_lock.h>
 #include <wlan_cmn_ieee80211.h>
 #ifdef WLAN_CRYPTO_AES
 #include "wlan_crypto_aes_i.h"
@@ -384,6 +386,33 @@ struct crypto_add_key_result {
 typedef void (*crypto_add_key_callback)(void *context,
 					struct crypto_add_key_result *result);
 
+/**
+ * struct wlan_crypto_mic_ctx - cached keyed BIP MIC transform for an IGTK
+ * @ref_cnt: references held by the IGTK slot and by frames being MIC'd
+ * @keyval: key value the transform was keyed with
+ * @keylen: length of @keyval
+ * @cipher: BIP cipher the transform was set up for
+ * @cmac: keyed AES-128-CMAC context
+ * @gmac: keyed AES-GMAC context
+ *
+ * The transform is rebuilt whenever the IGTK in the slot no longer matches
+ * @cipher and @keyval, so key installs need not invalidate it explicitly.
+ * A rebuilt transform replaces the old one in the slot under mic_ctx_lock;
+ * the old one is freed when its last reference is dropped.
+ */
+struct wlan_crypto_mic_ctx {
+	qdf_atomic_t ref_cnt;
+	uint8_t keyval[WLAN_CRYPTO_KEYBUF_SIZE];
+	uint8_t keylen;
+	enum wlan_crypto_cipher_type cipher;
+#ifdef WLAN_CRYPTO_OMAC1_OS_DERIVATIVE
+	struct qdf_crypto_cmac_ctx *cmac;
+#endif
+#ifdef WLAN_CRYPTO_GCM_OS_DERIVATIVE
+	struct qdf_crypto_gmac_ctx *gmac;
+#endif
+};
+
 /**
  * struct wlan_crypto_comp_priv - crypto component private structure
  * @crypto_params:    crypto params for the peer
@@ -391,6 +420,9 @@ typedef void (*crypto_add_key_callback)(void *context,
  * @igtk_key:         igtk key buffer for this peer
  * @bigtk_key:        bigtk key buffer for this peer
  * @igtk_key_type:    igtk key type
+ * @igtk_tx_mic_ctx:  cached MIC transforms used to add MMIE on tx
+ * @igtk_rx_mic_ctx:  cached MIC transforms used to validate MMIE on rx
+ * @mic_ctx_lock:     protects the @igtk_tx_mic_ctx and @igtk_rx_mic_ctx slots
  * @def_tx_keyid:     default key used for this peer
  * @def_igtk_tx_keyid default igtk key used for this peer
  * @def_bigtk_tx_keyid default bigtk key used for this peer
@@ -406,6 +438,9 @@ struct wlan_crypto_comp_priv {
 	struct wlan_crypto_key *igtk_key[WLAN_CRYPTO_MAXIGTKKEYIDX];
 	struct wlan_crypto_key *bigtk_key[WLAN_CRYPTO_MAXBIGTKKEYIDX];
 	enum wlan_crypto_cipher_type igtk_key_type;
+	struct wlan_crypto_mic_ctx *igtk_tx_mic_ctx[WLAN_CRYPTO_MAXIGTKKEYIDX];
+	struct wlan_crypto_mic_ctx *igtk_rx_mic_ctx[WLAN_CRYPTO_MAXIGTKKEYIDX];
+	qdf_spinlock_t mic_ctx_lock;
 	uint8_t def_tx_keyid;
 	uint8_t def_igtk_tx_keyid;
 	uint8_t def_bigtk_tx_keyid;
@@ -1402,6 +1402,7 @@ QDF_STATUS wlan_crypto_delkey(struct wlan_objmgr_vdev *vdev,
 		if (is_igtk(key_idx)) {
 			key = crypto_priv->igtk_key[igtk_idx];
 			crypto_priv->igtk_key[igtk_idx] = NULL;
+			wlan_crypto_free_igtk_mic_ctx(crypto_priv, igtk_idx);
 		} else {
 			key = crypto_priv->bigtk_key[bigtk_idx];
 			crypto_priv->bigtk_key[bigtk_idx] = NULL;
@@ -2126,6 +2127,294 @@ static void wlan_crypto_gmac_pn_swap(uint8_t *a, uint8_t *b)
 	a[5] = b[0];
 }
 
+/**
+ * wlan_crypto_mic_ctx_put() - drop a reference to a cached MIC transform
+ * @mic_ctx: cached MIC transform, may be NULL
+ *
+ * The transform is freed with its last reference, so a frame still being
+ * MIC'd with it keeps it alive after it is replaced or dropped from its
+ * IGTK slot.
+ *
+ * Return: None
+ */
+static void wlan_crypto_mic_ctx_put(struct wlan_crypto_mic_ctx *mic_ctx)
+{
+	if (!mic_ctx || !qdf_atomic_dec_and_test(&mic_ctx->ref_cnt))
+		return;
+
+#ifdef WLAN_CRYPTO_OMAC1_OS_DERIVATIVE
+	qdf_crypto_aes_128_cmac_ctx_destroy(mic_ctx->cmac);
+#endif
+#ifdef WLAN_CRYPTO_GCM_OS_DERIVATIVE
+	qdf_crypto_aes_gmac_ctx_destroy(mic_ctx->gmac);
+#endif
+	qdf_mem_zero(mic_ctx, sizeof(*mic_ctx));
+	qdf_mem_free(mic_ctx);
+}
+
+void wlan_crypto_free_igtk_mic_ctx(struct wlan_crypto_comp_priv *crypto_priv,
+				   uint8_t igtk_idx)
+{
+	struct wlan_crypto_mic_ctx *tx_mic_ctx;
+	struct wlan_crypto_mic_ctx *rx_mic_ctx;
+
+	if (igtk_idx >= WLAN_CRYPTO_MAXIGTKKEYIDX)
+		return;
+
+	qdf_spin_lock_bh(&crypto_priv->mic_ctx_lock);
+	tx_mic_ctx = crypto_priv->igtk_tx_mic_ctx[igtk_idx];
+	rx_mic_ctx = crypto_priv->igtk_rx_mic_ctx[igtk_idx];
+	crypto_priv->igtk_tx_mic_ctx[igtk_idx] = NULL;
+	crypto_priv->igtk_rx_mic_ctx[igtk_idx] = NULL;
+	qdf_spin_unlock_bh(&crypto_priv->mic_ctx_lock);
+
+	wlan_crypto_mic_ctx_put(tx_mic_ctx);
+	wlan_crypto_mic_ctx_put(rx_mic_ctx);
+}
+
+#if defined(WLAN_CRYPTO_OMAC1_OS_DERIVATIVE) || \
+	defined(WLAN_CRYPTO_GCM_OS_DERIVATIVE)
+/**
+ * wlan_crypto_mic_ctx_match() - check cached MIC transform is keyed for key
+ * @mic_ctx: cached MIC transform
+ * @cipher: BIP cipher
+ * @key: IGTK currently installed in the slot
+ *
+ * Return: true if the transform can be used for @key
+ */
+static bool wlan_crypto_mic_ctx_match(struct wlan_crypto_mic_ctx *mic_ctx,
+				      enum wlan_crypto_cipher_type cipher,
+				      struct wlan_crypto_key *key)
+{
+	if (mic_ctx->cipher != cipher || mic_ctx->keylen != key->keylen ||
+	    key->keylen > WLAN_CRYPTO_KEYBUF_SIZE)
+		return false;
+
+	return !qdf_mem_cmp(mic_ctx->keyval, key->keyval, key->keylen);
+}
+
+/**
+ * wlan_crypto_mic_ctx_get() - get the cached MIC transform of an IGTK slot
+ * @crypto_priv: crypto component private object
+ * @mic_slot: IGTK slot of the cache
+ * @cipher: BIP cipher
+ * @key: IGTK currently installed in the slot
+ *
+ * Return: transform keyed for @key with a reference held for the caller,
+ * NULL if the slot holds none
+ */
+static struct wlan_crypto_mic_ctx *
+wlan_crypto_mic_ctx_get(struct wlan_crypto_comp_priv *crypto_priv,
+			struct wlan_crypto_mic_ctx **mic_slot,
+			enum wlan_crypto_cipher_type cipher,
+			struct wlan_crypto_key *key)
+{
+	struct wlan_crypto_mic_ctx *mic_ctx;
+
+	qdf_spin_lock_bh(&crypto_priv->mic_ctx_lock);
+	mic_ctx = *mic_slot;
+	if (mic_ctx && wlan_crypto_mic_ctx_match(mic_ctx, cipher, key))
+		qdf_atomic_inc(&mic_ctx->ref_cnt);
+	else
+		mic_ctx = NULL;
+	qdf_spin_unlock_bh(&crypto_priv->mic_ctx_lock);
+
+	return mic_ctx;
+}
+
+/**
+ * wlan_crypto_mic_ctx_alloc() - allocate a MIC transform holder for a key
+ * @cipher: BIP cipher
+ * @key: IGTK the transform is going to be keyed with
+ *
+ * Return: holder with one reference for the caller, NULL on failure
+ */
+static struct wlan_crypto_mic_ctx *
+wlan_crypto_mic_ctx_alloc(enum wlan_crypto_cipher_type cipher,
+			  struct wlan_crypto_key *key)
+{
+	struct wlan_crypto_mic_ctx *mic_ctx;
+
+	if (key->keylen > WLAN_CRYPTO_KEYBUF_SIZE)
+		return NULL;
+
+	mic_ctx = qdf_mem_malloc(sizeof(*mic_ctx));
+	if (!mic_ctx)
+		return NULL;
+
+	qdf_atomic_init(&mic_ctx->ref_cnt);
+	qdf_atomic_inc(&mic_ctx->ref_cnt);
+	mic_ctx->cipher = cipher;
+	mic_ctx->keylen = key->keylen;
+	qdf_mem_copy(mic_ctx->keyval, key->keyval, key->keylen);
+
+	return mic_ctx;
+}
+
+/**
+ * wlan_crypto_mic_ctx_install() - cache a keyed MIC transform in a slot
+ * @crypto_priv: crypto component private object
+ * @mic_slot: IGTK slot of the cache
+ * @mic_ctx: keyed transform, the caller keeps its own reference
+ *
+ * The transform previously cached in the slot is released and freed once
+ * the frames being MIC'd with it are done.
+ *
+ * Return: None
+ */
+static void
+wlan_crypto_mic_ctx_install(struct wlan_crypto_comp_priv *crypto_priv,
+			    struct wlan_crypto_mic_ctx **mic_slot,
+			    struct wlan_crypto_mic_ctx *mic_ctx)
+{
+	struct wlan_crypto_mic_ctx *old_mic_ctx;
+
+	qdf_atomic_inc(&mic_ctx->ref_cnt);
+
+	qdf_spin_lock_bh(&crypto_priv->mic_ctx_lock);
+	old_mic_ctx = *mic_slot;
+	*mic_slot = mic_ctx;
+	qdf_spin_unlock_bh(&crypto_priv->mic_ctx_lock);
+
+	wlan_crypto_mic_ctx_put(old_mic_ctx);
+}
+#endif
+
+#ifdef WLAN_CRYPTO_OMAC1_OS_DERIVATIVE
+/**
+ * wlan_crypto_bip_cmac() - calculate BIP-CMAC-128 MIC with a cached transform
+ * @crypto_priv: crypto component private object
+ * @mic_slot: IGTK slot of the MIC transform cache
+ * @key: IGTK
+ * @data: AAD || management frame body || MMIE
+ * @data_len: length of @data
+ * @mic: MIC output
+ *
+ * The AES key schedule and CMAC subkeys are derived once per IGTK instead of
+ * for every protected management frame. The transform is keyed outside of
+ * mic_ctx_lock and used with a reference held, so a concurrent rebuild or
+ * delkey cannot free it underneath.
+ *
+ * Return: 0 on success, negative value on failure
+ */
+static int wlan_crypto_bip_cmac(struct wlan_crypto_comp_priv *crypto_priv,
+				struct wlan_crypto_mic_ctx **mic_slot,
+				struct wlan_crypto_key *key,
+				const uint8_t *data, size_t data_len,
+				uint8_t *mic)
+{
+	struct wlan_crypto_mic_ctx *mic_ctx;
+	int ret;
+
+	mic_ctx = wlan_crypto_mic_ctx_get(crypto_priv, mic_slot,
+					  WLAN_CRYPTO_CIPHER_AES_CMAC, key);
+	if (!mic_ctx) {
+		mic_ctx = wlan_crypto_mic_ctx_alloc(WLAN_CRYPTO_CIPHER_AES_CMAC,
+						    key);
+		if (!mic_ctx)
+			return omac1_aes_128(key->keyval, data, data_len, mic);
+
+		mic_ctx->cmac = qdf_crypto_aes_128_cmac_ctx_create(key->keyval);
+		if (!mic_ctx->cmac) {
+			wlan_crypto_mic_ctx_put(mic_ctx);
+			return omac1_aes_128(key->keyval, data, data_len, mic);
+		}
+
+		wlan_crypto_mic_ctx_install(crypto_priv, mic_slot, mic_ctx);
+	}
+
+	ret = qdf_crypto_aes_128_cmac_keyed(mic_ctx->cmac, data, data_len,
+					    mic);
+	wlan_crypto_mic_ctx_put(mic_ctx);
+
+	return ret;
+}
+#else
+static inline int
+wlan_crypto_bip_cmac(struct wlan_crypto_comp_priv *crypto_priv,
+		     struct wlan_crypto_mic_ctx **mic_slot,
+		     struct wlan_crypto_key *key,
+		     const uint8_t *data, size_t data_len,
+		     uint8_t *mic)
+{
+	return omac1_aes_128(key->keyval, data, data_len, mic);
+}
+#endif
+
+#ifdef WLAN_CRYPTO_GCM_OS_DERIVATIVE
+/**
+ * wlan_crypto_bip_gmac() - calculate BIP-GMAC MIC with a cached transform
+ * @crypto_priv: crypto component private object
+ * @mic_slot: IGTK slot of the MIC transform cache
+ * @key: IGTK
+ * @iv: nonce
+ * @iv_len: length of @iv
+ * @aad: AAD || management frame body || MMIE
+ * @aad_len: length of @aad
+ * @tag: MIC output
+ *
+ * The gcm(aes) transform is allocated and keyed once per IGTK instead of for
+ * every protected management frame. GMAC-128 and GMAC-256 share the cache tag
+ * and are told apart by the key length. As for CMAC, the transform is only
+ * used with a reference held.
+ *
+ * Return: 0 on success, negative value on failure
+ */
+static int wlan_crypto_bip_gmac(struct wlan_crypto_comp_priv *crypto_priv,
+				struct wlan_crypto_mic_ctx **mic_slot,
+				struct wlan_crypto_key *key,
+				uint8_t *iv, size_t iv_len,
+				const uint8_t *aad, size_t aad_len,
+				uint8_t *tag)
+{
+	struct wlan_crypto_mic_ctx *mic_ctx;
+	int ret;
+
+	mic_ctx = wlan_crypto_mic_ctx_get(crypto_priv, mic_slot,
+					  WLAN_CRYPTO_CIPHER_AES_GMAC, key);
+	if (!mic_ctx) {
+		mic_ctx = wlan_crypto_mic_ctx_alloc(WLAN_CRYPTO_CIPHER_AES_GMAC,
+						    key);
+		if (!mic_ctx)
+			return wlan_crypto_aes_gmac(key->keyval, key->keylen,
+						    iv, iv_len, aad, aad_len,
+						    tag);
+
+		mic_ctx->gmac = qdf_crypto_aes_gmac_ctx_create(key->keyval,
+							       key->keylen);
+		if (!mic_ctx->gmac) {
+			wlan_crypto_mic_ctx_put(mic_ctx);
+			return wlan_crypto_aes_gmac(key->keyval, key->keylen,
+						    iv, iv_len, aad, aad_len,
+						    tag);
+		}
+
+		wlan_crypto_mic_ctx_install(crypto_priv, mic_slot, mic_ctx);
+	}
+
+	ret = qdf_crypto_aes_gmac_keyed(mic_ctx->gmac, iv, aad,
+					aad + AAD_LEN,
+					aad_len - AAD_LEN -
+					IEEE80211_MMIE_GMAC_MICLEN,
+					tag);
+	wlan_crypto_mic_ctx_put(mic_ctx);
+
+	return ret;
+}
+#else
+static inline int
+wlan_crypto_bip_gmac(struct wlan_crypto_comp_priv *crypto_priv,
+		     struct wlan_crypto_mic_ctx **mic_slot,
+		     struct wlan_crypto_key *key,
+		     uint8_t *iv, size_t iv_len,
+		     const uint8_t *aad, size_t aad_len,
+		     uint8_t *tag)
+{
+	return wlan_crypto_aes_gmac(key->keyval, key->keylen, iv, iv_len,
+				    aad, aad_len, tag);
+}
+#endif
+
 /**
  * wlan_crypto_add_mmie - called by mgmt txrx to add mmie in frame
  * @vdev: vdev
@@ -2147,6 +2436,7 @@ uint8_t *wlan_crypto_add_mmie(struct wlan_objmgr_vdev *vdev,
 	uint8_t mic[16];
 	struct wlan_crypto_comp_priv *crypto_priv;
 	struct wlan_crypto_params *crypto_params;
+	struct wlan_crypto_mic_ctx **mic_slot;
 	int32_t ret = -1;
 
 	if (!bfrm) {
@@ -2172,6 +2462,8 @@ uint8_t *wlan_crypto_add_mmie(struct wlan_objmgr_vdev *vdev,
 		crypto_err("No igtk key present");
 		return NULL;
 	}
+	mic_slot =
+		&crypto_priv->igtk_tx_mic_ctx[crypto_priv->def_igtk_tx_keyid];
 	mic_len = (crypto_priv->igtk_key_type
 			== WLAN_CRYPTO_CIPHER_AES_CMAC) ? 8 : 16;
 
@@ -2232,8 +2524,8 @@ uint8_t *wlan_crypto_add_mmie(struct wlan_objmgr_vdev *vdev,
 	qdf_mem_copy(buf + aad_len, bfrm + hdrlen, len - hdrlen);
 	if (crypto_priv->igtk_key_type == WLAN_CRYPTO_CIPHER_AES_CMAC) {
 
-		ret = omac1_aes_128(key->keyval, buf,
-					len + aad_len - hdrlen, mic);
+		ret = wlan_crypto_bip_cmac(crypto_priv, mic_slot, key, buf,
+					   len + aad_len - hdrlen, mic);
 		qdf_mem_copy(mmie->mic, mic, 8);
 
 	} else if (crypto_priv->igtk_key_type
@@ -2247,9 +2539,9 @@ uint8_t *wlan_crypto_add_mmie(struct wlan_objmgr_vdev *vdev,
 
 		qdf_mem_copy(nounce, hdr->i_addr2, QDF_MAC_ADDR_SIZE);
 		wlan_crypto_gmac_pn_swap(nounce + 6, pn);
-		ret = wlan_crypto_aes_gmac(key->keyval, key->keylen, nounce,
-					sizeof(nounce), buf,
-					len + aad_len - hdrlen, mmie->mic);
+		ret = wlan_crypto_bip_gmac(crypto_priv, mic_slot, key, nounce,
+					   sizeof(nounce), buf,
+					   len + aad_len - hdrlen, mmie->mic);
 	}
 	qdf_mem_free(buf);
 	if (ret < 0) {
@@ -2280,6 +2572,7 @@ bool wlan_crypto_is_mmie_valid(struct wlan_objmgr_vdev *vdev,
 	uint16_t mic_len, hdrlen, len;
 	struct wlan_crypto_comp_priv *crypto_priv;
 	struct wlan_crypto_params *crypto_params;
+	struct wlan_crypto_mic_ctx **mic_slot;
 	uint8_t aad_len = 20;
 	int32_t ret = -1;
 
@@ -2328,6 +2621,8 @@ bool wlan_crypto_is_mmie_valid(struct wlan_objmgr_vdev *vdev,
 		crypto_err("No igtk key present");
 		return false;
 	}
+	mic_slot = &crypto_priv->igtk_rx_mic_ctx[mmie->key_id -
+						 WLAN_CRYPTO_MAXKEYIDX];
 
 	/* validate ipn */
 	ipn = mmie->sequence_number;
@@ -2372,8 +2667,8 @@ bool wlan_crypto_is_mmie_valid(struct wlan_objmgr_vdev *vdev,
 		return false;
 	}
 	if (crypto_priv->igtk_key_type == WLAN_CRYPTO_CIPHER_AES_CMAC) {
-		ret = omac1_aes_128(key->keyval, buf,
-					len - hdrlen + aad_len, mic);
+		ret = wlan_crypto_bip_cmac(crypto_priv, mic_slot, key, buf,
+					   len - hdrlen + aad_len, mic);
 	} else if (crypto_priv->igtk_key_type
 				== WLAN_CRYPTO_CIPHER_AES_CMAC_256) {
 		ret = omac1_aes_256(key->keyval, buf,
@@ -2383,9 +2678,9 @@ bool wlan_crypto_is_mmie_valid(struct wlan_objmgr_vdev *vdev,
 					== WLAN_CRYPTO_CIPHER_AES_GMAC_256)) {
 		qdf_mem_copy(nounce, hdr->i_addr2, QDF_MAC_ADDR_SIZE);
 		wlan_crypto_gmac_pn_swap(nounce + 6, ipn);
-		ret = wlan_crypto_aes_gmac(key->keyval, key->keylen, nounce,
-					sizeof(nounce), buf,
-					len + aad_len - hdrlen, mic);
+		ret = wlan_crypto_bip_gmac(crypto_priv, mic_slot, key, nounce,
+					   sizeof(nounce), buf,
+					   len + aad_len - hdrlen, mic);
 	}
 
 	qdf_mem_free(buf);
@@ -92,6 +92,8 @@ static QDF_STATUS wlan_crypto_vdev_obj_create_handler(
 	if (!crypto_priv)
 		return QDF_STATUS_E_NOMEM;
 
+	qdf_spinlock_create(&crypto_priv->mic_ctx_lock);
+
 	crypto_param = &(crypto_priv->crypto_params);
 
 	RESET_AUTHMODE(crypto_param);
@@ -127,8 +129,10 @@ static QDF_STATUS wlan_crypto_vdev_obj_create_handler(
 							WLAN_UMAC_COMP_CRYPTO,
 							(void *)crypto_priv,
 							QDF_STATUS_SUCCESS);
-	if (status != QDF_STATUS_SUCCESS)
+	if (status != QDF_STATUS_SUCCESS) {
+		qdf_spinlock_destroy(&crypto_priv->mic_ctx_lock);
 		qdf_mem_free(crypto_priv);
+	}
 
 	return status;
 }
@@ -148,6 +152,8 @@ static QDF_STATUS wlan_crypto_peer_obj_create_handler(
 	if (!crypto_priv)
 		return QDF_STATUS_E_NOMEM;
 
+	qdf_spinlock_create(&crypto_priv->mic_ctx_lock);
+
 	status = wlan_objmgr_peer_component_obj_attach(peer,
 				WLAN_UMAC_COMP_CRYPTO, (void *)crypto_priv,
 				QDF_STATUS_SUCCESS);
@@ -166,6 +172,7 @@ static QDF_STATUS wlan_crypto_peer_obj_create_handler(
 		}
 	} else {
 		crypto_err("peer obj failed status %d", status);
+		qdf_spinlock_destroy(&crypto_priv->mic_ctx_lock);
 		qdf_mem_free(crypto_priv);
 	}
 
@@ -189,6 +196,7 @@ static void wlan_crypto_free_key(struct wlan_crypto_comp_priv *crypto_priv)
 	}
 
 	for (i = 0; i < WLAN_CRYPTO_MAXIGTKKEYIDX; i++) {
+		wlan_crypto_free_igtk_mic_ctx(crypto_priv, i);
 		if (crypto_priv->igtk_key[i]) {
 			qdf_mem_free(crypto_priv->igtk_key[i]);
 			crypto_priv->igtk_key[i] = NULL;
@@ -244,6 +252,7 @@ static QDF_STATUS wlan_crypto_vdev_obj_destroy_handler(
 
 	wlan_crypto_pmksa_flush(&crypto_priv->crypto_params);
 	wlan_crypto_free_key(crypto_priv);
+	qdf_spinlock_destroy(&crypto_priv->mic_ctx_lock);
 	qdf_mem_free(crypto_priv);
 
 	return QDF_STATUS_SUCCESS;
@@ -269,6 +278,7 @@ static QDF_STATUS wlan_crypto_peer_obj_destroy_handler(
 						WLAN_UMAC_COMP_CRYPTO,
 						(void *)crypto_priv);
 	wlan_crypto_free_key(crypto_priv);
+	qdf_spinlock_destroy(&crypto_priv->mic_ctx_lock);
 	qdf_mem_free(crypto_priv);
 
 	return QDF_STATUS_SUCCESS;
@@ -115,4 +115,14 @@ static inline void *wlan_get_peer_crypto_obj(struct wlan_objmgr_peer *peer)
 
 	return crypto_priv;
 }
+
+/**
+ * wlan_crypto_free_igtk_mic_ctx() - free cached MIC transforms of an IGTK
+ * @crypto_priv: crypto component private object
+ * @igtk_idx: IGTK slot index
+ *
+ * Return: None
+ */
+void wlan_crypto_free_igtk_mic_ctx(struct wlan_crypto_comp_priv *crypto_priv,
+				   uint8_t igtk_idx);
 #endif /* end of __WLAN_CRYPTO_OBJ_MGR_I_*/
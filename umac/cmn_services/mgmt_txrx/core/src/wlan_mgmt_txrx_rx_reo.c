@@ -23,6 +23,7 @@
 #include <wlan_mgmt_txrx_rx_reo_tgt_api.h>
 #include "wlan_mgmt_txrx_main_i.h"
 #include <qdf_util.h>
+#include <qdf_time.h>
 
 static struct mgmt_rx_reo_context g_rx_reo_ctx;
 
@@ -1179,6 +1180,180 @@ exit:
 	return status;
 }
 
+/**
+ * mgmt_rx_reo_list_index_init() - Initialize the reorder list index
+ * @index: Pointer to reorder list index
+ * @max_list_size: Maximum size of the reorder list
+ *
+ * The index is sized once here and never grows, so that insertion never
+ * allocates with the reorder list lock held.
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS
+mgmt_rx_reo_list_index_init(struct mgmt_rx_reo_list_index *index,
+			    uint32_t max_list_size)
+{
+	index->size = MGMT_RX_REO_LIST_INDEX_SIZE(max_list_size);
+	index->entries = qdf_mem_malloc(index->size *
+					sizeof(*index->entries));
+	if (!index->entries) {
+		index->size = 0;
+		return QDF_STATUS_E_NOMEM;
+	}
+
+	index->head = 0;
+	index->count = 0;
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * mgmt_rx_reo_list_index_deinit() - De initialize the reorder list index
+ * @index: Pointer to reorder list index
+ *
+ * Return: void
+ */
+static void
+mgmt_rx_reo_list_index_deinit(struct mgmt_rx_reo_list_index *index)
+{
+	qdf_mem_free(index->entries);
+	index->entries = NULL;
+	index->size = 0;
+	index->head = 0;
+	index->count = 0;
+}
+
+/**
+ * mgmt_rx_reo_list_index_get_entry() - Get the reorder list entry at a given
+ * position
+ * @index: Pointer to reorder list index
+ * @pos: Position of the entry relative to the head of the reorder list
+ *
+ * This API expects the caller to acquire the spin lock protecting the reorder
+ * list.
+ *
+ * Return: Pointer to the reorder list entry
+ */
+static inline struct mgmt_rx_reo_list_entry *
+mgmt_rx_reo_list_index_get_entry(const struct mgmt_rx_reo_list_index *index,
+				 uint32_t pos)
+{
+	return index->entries[index->head + pos];
+}
+
+/**
+ * mgmt_rx_reo_list_index_find_insert_pos() - Find the position at which a
+ * frame has to be inserted in the reorder list
+ * @index: Pointer to reorder list index
+ * @global_ts: Global time stamp of the frame
+ *
+ * Binary search for the first entry in the reorder list whose global time
+ * stamp is greater than @global_ts. Entries with the same global time stamp
+ * as the frame stay ahead of it, which is the order in which the frames were
+ * received. This API expects the caller to acquire the spin lock protecting
+ * the reorder list.
+ *
+ * Return: Position of the least greater entry. Number of entries in the
+ * reorder list if there is no such entry.
+ */
+static uint32_t
+mgmt_rx_reo_list_index_find_insert_pos(
+		const struct mgmt_rx_reo_list_index *index,
+		uint32_t global_ts)
+{
+	uint32_t low = 0;
+	uint32_t high = index->count;
+
+	while (low < high) {
+		uint32_t mid = low + (high - low) / 2;
+		struct mgmt_rx_reo_list_entry *mid_entry;
+		uint32_t mid_global_ts;
+
+		mid_entry = mgmt_rx_reo_list_index_get_entry(index, mid);
+		mid_global_ts = mgmt_rx_reo_get_global_ts(mid_entry->rx_params);
+
+		if (mgmt_rx_reo_compare_global_timestamps_gte(global_ts,
+							      mid_global_ts))
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+/**
+ * mgmt_rx_reo_list_index_insert() - Insert an entry into the reorder list
+ * index
+ * @index: Pointer to reorder list index
+ * @pos: Position at which the entry has to be inserted
+ * @entry: Pointer to the reorder list entry
+ *
+ * The entries after @pos are moved by one position. Entries are moved back
+ * to the start of the array when the end of the array is reached. This API
+ * expects the caller to acquire the spin lock protecting the reorder list.
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS
+mgmt_rx_reo_list_index_insert(struct mgmt_rx_reo_list_index *index,
+			      uint32_t pos,
+			      struct mgmt_rx_reo_list_entry *entry)
+{
+	struct mgmt_rx_reo_list_entry **entries = index->entries;
+	uint32_t head = index->head;
+
+	if (pos > index->count) {
+		mgmt_rx_reo_err("Invalid index position %u, count = %u",
+				pos, index->count);
+		return QDF_STATUS_E_INVAL;
+	}
+
+	if (index->count == index->size) {
+		mgmt_rx_reo_err("Index full, count = %u", index->count);
+		return QDF_STATUS_E_RESOURCES;
+	}
+
+	if (head + index->count == index->size) {
+		qdf_mem_move(entries, &entries[head], pos * sizeof(*entries));
+		qdf_mem_move(&entries[pos + 1], &entries[head + pos],
+			     (index->count - pos) * sizeof(*entries));
+		head = 0;
+	} else {
+		qdf_mem_move(&entries[head + pos + 1], &entries[head + pos],
+			     (index->count - pos) * sizeof(*entries));
+	}
+
+	entries[head + pos] = entry;
+	index->head = head;
+	index->count++;
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * mgmt_rx_reo_list_index_remove_head() - Remove the first entry from the
+ * reorder list index
+ * @index: Pointer to reorder list index
+ *
+ * This API expects the caller to acquire the spin lock protecting the reorder
+ * list.
+ *
+ * Return: void
+ */
+static void
+mgmt_rx_reo_list_index_remove_head(struct mgmt_rx_reo_list_index *index)
+{
+	qdf_assert_always(index->count);
+
+	index->count--;
+	if (index->count)
+		index->head++;
+	else
+		index->head = 0;
+}
+
 /**
  * mgmt_rx_reo_list_is_ready_to_send_up_entry() - API to check whether the
  * list entry can be send to upper layers.
@@ -1202,58 +1377,42 @@ mgmt_rx_reo_list_is_ready_to_send_up_entry(struct mgmt_rx_reo_list *reo_list,
 }
 
 /**
- * mgmt_rx_reo_list_release_entries() - Release entries from the reorder list
- * @reo_context: Pointer to management Rx reorder context
+ * mgmt_rx_reo_list_dequeue_ready_entries() - Move the entries which are ready
+ * to be delivered from the head of the reorder list to a release list
+ * @reo_list: Pointer to reorder list
+ * @release_list: List to which the entries are moved
  *
- * This API releases the entries from the reorder list based on the following
- * conditions.
- *   a) Entries with total wait count equal to 0
- *   b) Entries which are timed out or entries with global time stamp <= global
- *      time stamp of the latest frame which is timed out. We can only release
- *      the entries in the increasing order of the global time stamp.
- *      So all the entries with global time stamp <= global time stamp of the
- *      latest timed out frame has to be released.
+ * Entries are moved in the increasing order of global time stamp till an
+ * entry which is not ready to be delivered is found. Global time stamp of the
+ * last released frame is updated for each entry moved, so that the frames
+ * older than the moved entries are treated as stale from this point. This API
+ * acquires the lock protecting the reorder list only once for the whole batch.
  *
  * Return: QDF_STATUS
  */
 static QDF_STATUS
-mgmt_rx_reo_list_release_entries(struct mgmt_rx_reo_context *reo_context)
+mgmt_rx_reo_list_dequeue_ready_entries(struct mgmt_rx_reo_list *reo_list,
+				       qdf_list_t *release_list)
 {
-	struct mgmt_rx_reo_list *reo_list;
-	QDF_STATUS status;
-
-	if (!reo_context) {
-		mgmt_rx_reo_err("reo context is null");
-		return QDF_STATUS_E_NULL_VALUE;
-	}
-
-	reo_list = &reo_context->reo_list;
+	struct mgmt_rx_reo_global_ts_info *ts_last_released_frame =
+					&reo_list->ts_last_released_frame;
+	struct mgmt_rx_reo_list_entry *first_entry;
+	QDF_STATUS status = QDF_STATUS_SUCCESS;
 
-	qdf_spin_lock(&reo_context->frame_release_lock);
+	qdf_spin_lock_bh(&reo_list->list_lock);
 
 	while (1) {
-		struct mgmt_rx_reo_list_entry *first_entry;
-		/* TODO yield if release_count > THRESHOLD */
-		uint16_t release_count = 0;
-		struct mgmt_rx_reo_global_ts_info *ts_last_released_frame =
-					&reo_list->ts_last_released_frame;
 		uint32_t entry_global_ts;
 
-		qdf_spin_lock_bh(&reo_list->list_lock);
-
 		first_entry = qdf_list_first_entry_or_null(
 			&reo_list->list, struct mgmt_rx_reo_list_entry, node);
 
-		if (!first_entry) {
-			status = QDF_STATUS_SUCCESS;
-			goto exit_unlock_list_lock;
-		}
+		if (!first_entry)
+			break;
 
 		if (!mgmt_rx_reo_list_is_ready_to_send_up_entry(reo_list,
-								first_entry)) {
-			status = QDF_STATUS_SUCCESS;
-			goto exit_unlock_list_lock;
-		}
+								first_entry))
+			break;
 
 		if (mgmt_rx_reo_list_max_size_exceeded(reo_list))
 			first_entry->status |=
@@ -1263,9 +1422,13 @@ mgmt_rx_reo_list_release_entries(struct mgmt_rx_reo_context *reo_context)
 					      &first_entry->node);
 		if (QDF_IS_STATUS_ERROR(status)) {
 			status = QDF_STATUS_E_FAILURE;
-			goto exit_unlock_list_lock;
+			break;
 		}
 
+		qdf_assert_always(mgmt_rx_reo_list_index_get_entry(
+					&reo_list->index, 0) == first_entry);
+		mgmt_rx_reo_list_index_remove_head(&reo_list->index);
+
 		/**
 		 * Last released frame global time stamp is invalid means that
 		 * current frame is the first frame to be released to the
@@ -1293,28 +1456,88 @@ mgmt_rx_reo_list_release_entries(struct mgmt_rx_reo_context *reo_context)
 			qdf_assert_always(0);
 		}
 
-		qdf_spin_unlock_bh(&reo_list->list_lock);
+		qdf_list_insert_back(release_list, &first_entry->node);
+	}
 
-		status = mgmt_rx_reo_list_entry_send_up(reo_list,
-							first_entry);
-		if (QDF_IS_STATUS_ERROR(status)) {
-			status = QDF_STATUS_E_FAILURE;
-			qdf_mem_free(first_entry);
-			goto exit_unlock_frame_release_lock;
-		}
+	qdf_spin_unlock_bh(&reo_list->list_lock);
+
+	return status;
+}
+
+/**
+ * mgmt_rx_reo_list_release_entries() - Release entries from the reorder list
+ * @reo_context: Pointer to management Rx reorder context
+ *
+ * This API releases the entries from the reorder list based on the following
+ * conditions.
+ *   a) Entries with total wait count equal to 0
+ *   b) Entries which are timed out or entries with global time stamp <= global
+ *      time stamp of the latest timed out frame. We can only release
+ *      the entries in the increasing order of the global time stamp.
+ *      So all the entries with global time stamp <= global time stamp of the
+ *      latest timed out frame has to be released.
+ *
+ * Entries are released in batches. All the entries which are ready at the
+ * head of the reorder list are moved out under a single acquisition of the
+ * list lock and then delivered to the upper layers without holding it. The
+ * frame release lock is held throughout, so the order of delivery is the
+ * order of the reorder list.
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS
+mgmt_rx_reo_list_release_entries(struct mgmt_rx_reo_context *reo_context)
+{
+	struct mgmt_rx_reo_list *reo_list;
+	qdf_list_t release_list;
+	QDF_STATUS status;
 
-		qdf_mem_free(first_entry);
-		release_count++;
+	if (!reo_context) {
+		mgmt_rx_reo_err("reo context is null");
+		return QDF_STATUS_E_NULL_VALUE;
 	}
 
-	status = QDF_STATUS_SUCCESS;
-	goto exit_unlock_frame_release_lock;
+	reo_list = &reo_context->reo_list;
+
+	qdf_list_create(&release_list, reo_list->max_list_size);
+
+	qdf_spin_lock(&reo_context->frame_release_lock);
+
+	while (1) {
+		struct mgmt_rx_reo_list_entry *cur_entry;
+		struct mgmt_rx_reo_list_entry *temp;
+
+		status = mgmt_rx_reo_list_dequeue_ready_entries(reo_list,
+								&release_list);
+
+		if (qdf_list_empty(&release_list))
+			break;
+
+		/**
+		 * Entries already moved out of the reorder list can't be put
+		 * back. Deliver all of them even if one of them fails.
+		 */
+		qdf_list_for_each_del(&release_list, cur_entry, temp, node) {
+			QDF_STATUS send_up_status;
+
+			qdf_list_remove_node(&release_list, &cur_entry->node);
+
+			send_up_status = mgmt_rx_reo_list_entry_send_up(
+							reo_list, cur_entry);
+			if (QDF_IS_STATUS_ERROR(send_up_status))
+				status = QDF_STATUS_E_FAILURE;
+
+			qdf_mem_free(cur_entry);
+		}
+
+		if (QDF_IS_STATUS_ERROR(status))
+			break;
+	}
 
-exit_unlock_list_lock:
-	qdf_spin_unlock_bh(&reo_list->list_lock);
-exit_unlock_frame_release_lock:
 	qdf_spin_unlock(&reo_context->frame_release_lock);
 
+	qdf_list_destroy(&release_list);
+
 	return status;
 }
 
@@ -1453,6 +1676,8 @@ mgmt_rx_reo_prepare_list_entry(
  * @num_mlo_links: Number of MLO links
  * @wait_count_old_frame: Pointer to the wait count structure for the old frame.
  * @wait_count_new_frame: Pointer to the wait count structure for the new frame.
+ * @is_updated: Set to true if any of the wait counts of the old frame is
+ * reduced, false otherwise
  *
  * This API optimizes the wait count of a frame based on the wait count of
  * a frame received after that on air. Old frame refers to the frame received
@@ -1468,37 +1693,102 @@ static QDF_STATUS
 mgmt_rx_reo_update_wait_count(
 		uint8_t num_mlo_links,
 		struct mgmt_rx_reo_wait_count *wait_count_old_frame,
-		const struct mgmt_rx_reo_wait_count *wait_count_new_frame)
+		const struct mgmt_rx_reo_wait_count *wait_count_new_frame,
+		bool *is_updated)
 {
 	uint8_t link_id;
 
 	qdf_assert_always(wait_count_old_frame);
 	qdf_assert_always(wait_count_new_frame);
+	qdf_assert_always(is_updated);
 
 	qdf_assert_always(num_mlo_links <= MGMT_RX_REO_MAX_LINKS);
 
+	*is_updated = false;
+
 	for (link_id = 0; link_id < num_mlo_links; link_id++) {
-		if (wait_count_old_frame->per_link_count[link_id]) {
-			uint32_t temp_wait_count;
+		if (wait_count_old_frame->per_link_count[link_id] >
+		    wait_count_new_frame->per_link_count[link_id]) {
 			uint32_t wait_count_diff;
 
-			temp_wait_count =
-				wait_count_old_frame->per_link_count[link_id];
+			wait_count_diff =
+				wait_count_old_frame->per_link_count[link_id] -
+				wait_count_new_frame->per_link_count[link_id];
 			wait_count_old_frame->per_link_count[link_id] =
-				qdf_min(wait_count_old_frame->
-					per_link_count[link_id],
-					wait_count_new_frame->
-					per_link_count[link_id]);
-			wait_count_diff = temp_wait_count -
-				wait_count_old_frame->per_link_count[link_id];
-
+				wait_count_new_frame->per_link_count[link_id];
 			wait_count_old_frame->total_count -= wait_count_diff;
+			*is_updated = true;
 		}
 	}
 
 	return QDF_STATUS_SUCCESS;
 }
 
+/**
+ * mgmt_rx_reo_list_entry_update_status() - Update the status of a reorder
+ * list entry after its wait count is modified
+ * @entry: Pointer to the reorder list entry
+ *
+ * Return: void
+ */
+static inline void
+mgmt_rx_reo_list_entry_update_status(struct mgmt_rx_reo_list_entry *entry)
+{
+	if (entry->wait_count.total_count == 0)
+		entry->status &=
+			~MGMT_RX_REO_STATUS_WAIT_FOR_FRAME_ON_OTHER_LINKS;
+}
+
+#ifdef WLAN_MGMT_RX_REO_DEBUG_SUPPORT
+/**
+ * mgmt_rx_reo_list_check_wait_count_order() - Check that the per link wait
+ * counts never decrease along the reorder list
+ * @index: Pointer to reorder list index
+ * @num_mlo_links: Number of MLO HW links
+ *
+ * mgmt_rx_reo_update_list() stops its backward walk at the first entry whose
+ * wait counts are not reduced, which is only equivalent to walking the whole
+ * list while this ordering holds. Must be called with the list lock held.
+ *
+ * Return: void
+ */
+static void
+mgmt_rx_reo_list_check_wait_count_order(
+			const struct mgmt_rx_reo_list_index *index,
+			uint8_t num_mlo_links)
+{
+	struct mgmt_rx_reo_list_entry *older;
+	struct mgmt_rx_reo_list_entry *newer;
+	uint32_t pos;
+	uint8_t link_id;
+
+	for (pos = 1; pos < index->count; pos++) {
+		older = mgmt_rx_reo_list_index_get_entry(index, pos - 1);
+		newer = mgmt_rx_reo_list_index_get_entry(index, pos);
+
+		for (link_id = 0; link_id < num_mlo_links; link_id++)
+			qdf_assert_always(
+				older->wait_count.per_link_count[link_id] <=
+				newer->wait_count.per_link_count[link_id]);
+	}
+}
+#else
+/**
+ * mgmt_rx_reo_list_check_wait_count_order() - Check that the per link wait
+ * counts never decrease along the reorder list
+ * @index: Pointer to reorder list index
+ * @num_mlo_links: Number of MLO HW links
+ *
+ * Return: void
+ */
+static inline void
+mgmt_rx_reo_list_check_wait_count_order(
+			const struct mgmt_rx_reo_list_index *index,
+			uint8_t num_mlo_links)
+{
+}
+#endif /* WLAN_MGMT_RX_REO_DEBUG_SUPPORT */
+
 /**
  * mgmt_rx_reo_update_list() - Modify the reorder list when a frame is received
  * @reo_list: Pointer to reorder list
@@ -1508,22 +1798,32 @@ mgmt_rx_reo_update_wait_count(
  *
  * API to update the reorder list on every management frame reception.
  * This API does the following things.
- *   a) Update the wait counts for all the frames in the reorder list with
+ *   a) Find the position of the current frame in the reorder list by a binary
+ *      search on the global time stamp using the reorder list index.
+ *   b) Update the wait count of the frames in the reorder list with global
+ *      time stamp > current frame's global time stamp. Let the current frame
+ *      belong to link "l". Then link "l"'s wait count can be reduced by one for
+ *      all the frames in the reorder list with global time stamp > current
+ *      frame's global time stamp.
+ *   c) If the current frame is to be consumed by host, insert it in the
+ *      reorder list such that the list is always sorted in the increasing order
+ *      of global time stamp. Update the wait count of the current frame based
+ *      on the frame next to it in the reorder list (if any).
+ *   d) Update the wait counts for all the frames in the reorder list with
  *      global time stamp <= current frame's global time stamp. We use the
  *      following principle for updating the wait count in this case.
  *      Let A and B be two management frames with global time stamp of A <=
  *      global time stamp of B. Let WAi and WBi be the wait count of A and B
  *      for link i, then WAi <= WBi. Hence we can optimize WAi as
  *      min(WAi, WBi).
- *   b) If the current frame is to be consumed by host, insert it in the
- *      reorder list such that the list is always sorted in the increasing order
- *      of global time stamp. Update the wait count of the current frame based
- *      on the frame next to it in the reorder list (if any).
- *   c) Update the wait count of the frames in the reorder list with global
- *      time stamp > current frame's global time stamp. Let the current frame
- *      belong to link "l". Then link "l"'s wait count can be reduced by one for
- *      all the frames in the reorder list with global time stamp > current
- *      frame's global time stamp.
+ *
+ * Step d) applies the same principle between every pair of adjacent entries,
+ * so the per link wait counts never decrease along the reorder list. Hence
+ * the walk in step d) goes backwards from the current frame and stops at the
+ * first entry whose wait counts are not modified; none of the entries before
+ * it can be modified either. For frames received in order, steps b) and d)
+ * touch at most one entry. With WLAN_MGMT_RX_REO_DEBUG_SUPPORT the ordering
+ * is checked over the whole list after every update.
  *
  * Return: QDF_STATUS
  */
@@ -1533,12 +1833,17 @@ mgmt_rx_reo_update_list(struct mgmt_rx_reo_list *reo_list,
 			struct mgmt_rx_reo_frame_descriptor *frame_desc,
 			bool *is_queued)
 {
+	struct mgmt_rx_reo_list_index *index;
 	struct mgmt_rx_reo_list_entry *cur_entry;
-	struct mgmt_rx_reo_list_entry *least_greater_entry;
-	bool least_greater_entry_found = false;
+	struct mgmt_rx_reo_list_entry *least_greater_entry = NULL;
+	struct mgmt_rx_reo_wait_count wait_count;
 	QDF_STATUS status;
 	uint32_t new_frame_global_ts;
+	uint8_t frame_link_id;
 	struct mgmt_rx_reo_list_entry *new_entry = NULL;
+	uint32_t insert_pos;
+	uint32_t pos;
+	bool is_updated;
 
 	if (!is_queued)
 		return QDF_STATUS_E_NULL_VALUE;
@@ -1555,6 +1860,8 @@ mgmt_rx_reo_update_list(struct mgmt_rx_reo_list *reo_list,
 	}
 
 	new_frame_global_ts = mgmt_rx_reo_get_global_ts(frame_desc->rx_params);
+	frame_link_id = mgmt_rx_reo_get_link_id(frame_desc->rx_params);
+	index = &reo_list->index;
 
 	/* Prepare the list entry before acquiring lock */
 	if (frame_desc->type == MGMT_RX_REO_FRAME_DESC_HOST_CONSUMED_FRAME) {
@@ -1567,29 +1874,35 @@ mgmt_rx_reo_update_list(struct mgmt_rx_reo_list *reo_list,
 
 	qdf_spin_lock_bh(&reo_list->list_lock);
 
-	qdf_list_for_each(&reo_list->list, cur_entry, node) {
-		uint32_t cur_entry_global_ts;
+	insert_pos = mgmt_rx_reo_list_index_find_insert_pos(
+						index, new_frame_global_ts);
+	if (insert_pos < index->count)
+		least_greater_entry = mgmt_rx_reo_list_index_get_entry(
+							index, insert_pos);
 
-		cur_entry_global_ts = mgmt_rx_reo_get_global_ts(
-					cur_entry->rx_params);
+	for (pos = insert_pos; pos < index->count; pos++) {
+		cur_entry = mgmt_rx_reo_list_index_get_entry(index, pos);
 
-		if (!mgmt_rx_reo_compare_global_timestamps_gte(
-		    new_frame_global_ts, cur_entry_global_ts)) {
-			least_greater_entry = cur_entry;
-			least_greater_entry_found = true;
-			break;
+		if (cur_entry->wait_count.per_link_count[frame_link_id]) {
+			cur_entry->wait_count.per_link_count[frame_link_id]--;
+			cur_entry->wait_count.total_count--;
+			mgmt_rx_reo_list_entry_update_status(cur_entry);
 		}
+	}
 
+	/**
+	 * Wait count of the current frame bounded by that of the least greater
+	 * entry. This is the wait count of the current frame if it is queued
+	 * and the bound for the wait counts of all the older entries.
+	 */
+	wait_count = frame_desc->wait_count;
+	if (least_greater_entry) {
 		status = mgmt_rx_reo_update_wait_count(
-					num_mlo_links,
-					&cur_entry->wait_count,
-					&frame_desc->wait_count);
+					num_mlo_links, &wait_count,
+					&least_greater_entry->wait_count,
+					&is_updated);
 		if (QDF_IS_STATUS_ERROR(status))
-			goto error;
-
-		if (cur_entry->wait_count.total_count == 0)
-			cur_entry->status &=
-			      ~MGMT_RX_REO_STATUS_WAIT_FOR_FRAME_ON_OTHER_LINKS;
+			goto exit;
 	}
 
 	frame_desc->is_stale = false;
@@ -1600,57 +1913,73 @@ mgmt_rx_reo_update_list(struct mgmt_rx_reo_list *reo_list,
 		status = mgmt_rx_reo_handle_stale_frame(
 				reo_list, frame_desc->rx_params->reo_params);
 		if (QDF_IS_STATUS_ERROR(status))
-			goto error;
+			goto exit;
 	}
 
 	if (frame_desc->type == MGMT_RX_REO_FRAME_DESC_HOST_CONSUMED_FRAME &&
 	    !frame_desc->is_stale) {
-		if (least_greater_entry_found) {
-			status = mgmt_rx_reo_update_wait_count(
-					num_mlo_links,
-					&new_entry->wait_count,
-					&least_greater_entry->wait_count);
-
-			if (QDF_IS_STATUS_ERROR(status))
-				goto error;
-
-			if (new_entry->wait_count.total_count == 0)
-				new_entry->status &=
-					~MGMT_RX_REO_STATUS_WAIT_FOR_FRAME_ON_OTHER_LINKS;
-		}
+		new_entry->wait_count = wait_count;
+		mgmt_rx_reo_list_entry_update_status(new_entry);
 
 		new_entry->insertion_ts = qdf_get_log_timestamp();
 		new_entry->ingress_timestamp = frame_desc->ingress_timestamp;
 
-		status = qdf_list_insert_before(&reo_list->list,
+		status = mgmt_rx_reo_list_index_insert(index, insert_pos,
+						       new_entry);
+		if (QDF_IS_STATUS_ERROR(status))
+			goto exit;
+
+		if (least_greater_entry)
+			status = qdf_list_insert_before(
+						&reo_list->list,
 						&new_entry->node,
 						&least_greater_entry->node);
-		if (QDF_IS_STATUS_ERROR(status))
-			goto error;
+		else
+			status = qdf_list_insert_back(&reo_list->list,
+						      &new_entry->node);
+		/* List insertion can't fail once the index is updated */
+		qdf_assert_always(QDF_IS_STATUS_SUCCESS(status));
 
 		*is_queued = true;
 	}
 
-	cur_entry = least_greater_entry;
-	qdf_list_for_each_from(&reo_list->list, cur_entry, node) {
-		uint8_t frame_link_id;
+	pos = insert_pos;
+	while (pos > 0) {
+		pos--;
+		cur_entry = mgmt_rx_reo_list_index_get_entry(index, pos);
 
-		frame_link_id = mgmt_rx_reo_get_link_id(frame_desc->rx_params);
-		if (cur_entry->wait_count.per_link_count[frame_link_id]) {
-			cur_entry->wait_count.per_link_count[frame_link_id]--;
-			cur_entry->wait_count.total_count--;
-			if (cur_entry->wait_count.total_count == 0)
-				cur_entry->status &=
-					~MGMT_RX_REO_STATUS_WAIT_FOR_FRAME_ON_OTHER_LINKS;
-		}
+		status = mgmt_rx_reo_update_wait_count(
+					num_mlo_links,
+					&cur_entry->wait_count,
+					&wait_count, &is_updated);
+		if (QDF_IS_STATUS_ERROR(status))
+			goto exit;
+
+		/**
+		 * Invariant: per link wait counts never decrease along the
+		 * list. Step b) maps every count c to max(c - 1, 0) for a
+		 * suffix, the new entry is bounded by its successor and this
+		 * walk bounds each entry by its successor, all of which keep
+		 * the ordering, and removing entries cannot break it.
+		 * cur_entry is already bounded by wait_count on every link,
+		 * so every older entry, bounded by cur_entry, is as well.
+		 */
+		if (!is_updated)
+			break;
+
+		mgmt_rx_reo_list_entry_update_status(cur_entry);
+		wait_count = cur_entry->wait_count;
 	}
 
+	mgmt_rx_reo_list_check_wait_count_order(index, num_mlo_links);
+
 	status = QDF_STATUS_SUCCESS;
-	goto exit;
 
-error:
+exit:
+	qdf_spin_unlock_bh(&reo_list->list_lock);
+
 	/* Cleanup the entry if it is not queued */
-	if (!*is_queued) {
+	if (new_entry && !*is_queued) {
 		struct wlan_objmgr_pdev *pdev;
 		uint8_t link_id;
 
@@ -1669,20 +1998,15 @@ error:
 		qdf_mem_free(new_entry);
 	}
 
-exit:
-	qdf_spin_unlock_bh(&reo_list->list_lock);
-
 	if (!*is_queued)
 		return status;
 
-	if (frame_desc->type == MGMT_RX_REO_FRAME_DESC_HOST_CONSUMED_FRAME) {
-		if (least_greater_entry_found)
-			mgmt_rx_reo_debug("Inserting new entry %pK before %pK",
-					  new_entry, least_greater_entry);
-		else
-			mgmt_rx_reo_debug("Inserting new entry %pK at the tail",
-					  new_entry);
-	}
+	if (least_greater_entry)
+		mgmt_rx_reo_debug("Inserting new entry %pK before %pK",
+				  new_entry, least_greater_entry);
+	else
+		mgmt_rx_reo_debug("Inserting new entry %pK at the tail",
+				  new_entry);
 
 	return status;
 }
@@ -1703,6 +2027,13 @@ mgmt_rx_reo_list_init(struct mgmt_rx_reo_list *reo_list)
 	reo_list->max_list_size = MGMT_RX_REO_LIST_MAX_SIZE;
 	reo_list->list_entry_timeout_us = MGMT_RX_REO_LIST_TIMEOUT_US;
 
+	status = mgmt_rx_reo_list_index_init(&reo_list->index,
+					     reo_list->max_list_size);
+	if (QDF_IS_STATUS_ERROR(status)) {
+		mgmt_rx_reo_err("Failed to initialize reo list index");
+		return status;
+	}
+
 	qdf_list_create(&reo_list->list, reo_list->max_list_size);
 	qdf_spinlock_create(&reo_list->list_lock);
 
@@ -1711,6 +2042,9 @@ mgmt_rx_reo_list_init(struct mgmt_rx_reo_list *reo_list)
 				QDF_TIMER_TYPE_WAKE_APPS);
 	if (QDF_IS_STATUS_ERROR(status)) {
 		mgmt_rx_reo_err("Failed to initialize reo list ageout timer");
+		qdf_spinlock_destroy(&reo_list->list_lock);
+		qdf_list_destroy(&reo_list->list);
+		mgmt_rx_reo_list_index_deinit(&reo_list->index);
 		return status;
 	}
 
@@ -2304,6 +2638,12 @@ mgmt_rx_reo_sim_process_rx_frame(struct wlan_objmgr_pdev *pdev, qdf_nbuf_t buf,
 
 	qdf_spin_unlock(&sim_context->pending_frame_list.lock);
 
+	if (sim_context->benchmark) {
+		qdf_spin_lock(&sim_context->benchmark_stats.lock);
+		sim_context->benchmark_stats.num_delivered++;
+		qdf_spin_unlock(&sim_context->benchmark_stats.lock);
+	}
+
 	mgmt_rx_reo_debug("Successfully processed mgmt frame");
 	mgmt_rx_reo_debug("link_id = %u, ctr = %u, ts = %u",
 			  reo_params->link_id, reo_params->mgmt_pkt_ctr,
@@ -2361,17 +2701,118 @@ mgmt_rx_reo_sim_get_random_unsigned_int(uint32_t max)
  * mgmt_rx_reo_sim_sleep() - Wrapper API to sleep for given micro seconds
  * @sleeptime_us: Sleep time in micro seconds
  *
- * This API uses msleep() internally. So the granularity is limited to
- * milliseconds.
+ * This API uses msleep() internally for delays of a millisecond or more. So
+ * the granularity is limited to milliseconds. Shorter delays, used in the
+ * benchmark mode, are handled by usleep_range().
  *
  * Return: none
  */
 static void
 mgmt_rx_reo_sim_sleep(uint32_t sleeptime_us)
 {
+	if (sleeptime_us < USEC_PER_MSEC) {
+		usleep_range(sleeptime_us, 2 * sleeptime_us + 1);
+		return;
+	}
+
 	msleep(sleeptime_us / USEC_PER_MSEC);
 }
 
+/**
+ * mgmt_rx_reo_sim_get_delay() - Generate a random simulated delay
+ * @sim_context: Pointer to management rx-reorder simulation context
+ * @min_delay_us: Minimum delay in micro seconds
+ * @min_max_delta_us: Difference between maximum and minimum delay in micro
+ * seconds
+ *
+ * In benchmark mode the delay is reduced by
+ * MGMT_RX_REO_SIM_BENCHMARK_DELAY_DIVISOR.
+ *
+ * Return: Delay in micro seconds
+ */
+static uint32_t
+mgmt_rx_reo_sim_get_delay(struct mgmt_rx_reo_sim_context *sim_context,
+			  uint32_t min_delay_us, uint32_t min_max_delta_us)
+{
+	uint32_t delay_us;
+
+	delay_us = min_delay_us +
+		   mgmt_rx_reo_sim_get_random_unsigned_int(min_max_delta_us);
+
+	if (sim_context->benchmark)
+		delay_us /= MGMT_RX_REO_SIM_BENCHMARK_DELAY_DIVISOR;
+
+	return delay_us;
+}
+
+/**
+ * mgmt_rx_reo_sim_benchmark_account_frame() - Account a frame processed by
+ * the reorder algorithm in the benchmark statistics
+ * @sim_context: Pointer to management rx-reorder simulation context
+ * @algo_time_us: Time spent in the reorder algorithm for the frame
+ * @is_queued: Whether the frame is queued in the reorder list
+ *
+ * Return: void
+ */
+static void
+mgmt_rx_reo_sim_benchmark_account_frame(
+		struct mgmt_rx_reo_sim_context *sim_context,
+		uint64_t algo_time_us, bool is_queued)
+{
+	struct mgmt_rx_reo_sim_benchmark_stats *stats;
+
+	if (!sim_context->benchmark)
+		return;
+
+	stats = &sim_context->benchmark_stats;
+
+	qdf_spin_lock(&stats->lock);
+	stats->num_frames++;
+	if (is_queued)
+		stats->num_queued++;
+	stats->algo_time_us += algo_time_us;
+	stats->max_algo_time_us = QDF_MAX(stats->max_algo_time_us,
+					  algo_time_us);
+	qdf_spin_unlock(&stats->lock);
+}
+
+/**
+ * mgmt_rx_reo_sim_benchmark_print_stats() - Print the benchmark statistics
+ * @sim_context: Pointer to management rx-reorder simulation context
+ *
+ * Return: void
+ */
+static void
+mgmt_rx_reo_sim_benchmark_print_stats(
+		struct mgmt_rx_reo_sim_context *sim_context)
+{
+	struct mgmt_rx_reo_sim_benchmark_stats *stats;
+	uint64_t elapsed_us;
+	uint64_t frames_per_sec = 0;
+	uint64_t avg_algo_time_us = 0;
+
+	stats = &sim_context->benchmark_stats;
+
+	qdf_spin_lock(&stats->lock);
+
+	elapsed_us = qdf_get_monotonic_boottime() - stats->start_ts;
+	if (elapsed_us)
+		frames_per_sec = qdf_do_div(stats->num_delivered *
+					    USEC_PER_SEC, elapsed_us);
+	if (stats->num_frames)
+		avg_algo_time_us = qdf_do_div(stats->algo_time_us,
+					      stats->num_frames);
+
+	mgmt_rx_reo_err("reo sim benchmark: elapsed = %llu us, frames = %llu, queued = %llu, delivered = %llu",
+			elapsed_us, stats->num_frames, stats->num_queued,
+			stats->num_delivered);
+	mgmt_rx_reo_err("reo sim benchmark: throughput = %llu frames/s, algo time avg = %llu us, max = %llu us",
+			frames_per_sec, avg_algo_time_us,
+			stats->max_algo_time_us);
+
+	qdf_spin_unlock(&stats->lock);
+}
+
 /**
  * mgmt_rx_reo_sim_frame_handler_host() - Management frame handler at the host
  * layer
@@ -2396,6 +2837,7 @@ mgmt_rx_reo_sim_frame_handler_host(void *arg)
 	struct mgmt_rx_reo_sim_context *sim_context;
 	bool is_queued = false;
 	struct wlan_objmgr_pdev *pdev;
+	uint64_t algo_start_ts;
 
 	if (!frame_fw) {
 		mgmt_rx_reo_err("HOST-%d : Pointer to FW frame struct is null",
@@ -2412,9 +2854,9 @@ mgmt_rx_reo_sim_frame_handler_host(void *arg)
 		goto error_free_fw_frame;
 	}
 
-	fw_to_host_delay_us = MGMT_RX_REO_SIM_DELAY_FW_TO_HOST_MIN +
-			      mgmt_rx_reo_sim_get_random_unsigned_int(
-			      MGMT_RX_REO_SIM_DELAY_FW_TO_HOST_MIN_MAX_DELTA);
+	fw_to_host_delay_us = mgmt_rx_reo_sim_get_delay(
+			sim_context, MGMT_RX_REO_SIM_DELAY_FW_TO_HOST_MIN,
+			MGMT_RX_REO_SIM_DELAY_FW_TO_HOST_MIN_MAX_DELTA);
 
 	mgmt_rx_reo_sim_sleep(fw_to_host_delay_us);
 
@@ -2479,6 +2921,8 @@ mgmt_rx_reo_sim_frame_handler_host(void *arg)
 		goto error_free_mgmt_rx_event_params;
 	}
 
+	algo_start_ts = qdf_get_monotonic_boottime();
+
 	status = wlan_mgmt_rx_reo_algo_entry(pdev, frame_descriptor,
 					     &is_queued);
 
@@ -2487,6 +2931,10 @@ mgmt_rx_reo_sim_frame_handler_host(void *arg)
 		goto error_free_mgmt_rx_event_params;
 	}
 
+	mgmt_rx_reo_sim_benchmark_account_frame(
+			sim_context, qdf_get_monotonic_boottime() -
+			algo_start_ts, is_queued);
+
 	if (!is_queued)
 		free_mgmt_rx_event_params(frame_descriptor->rx_params);
 	qdf_mem_free(frame_descriptor);
@@ -2642,8 +3090,8 @@ mgmt_rx_reo_sim_frame_handler_fw(void *arg)
 		goto error_free_mac_hw_frame;
 	}
 
-	mac_hw_to_fw_delay_us = MGMT_RX_REO_SIM_DELAY_MAC_HW_TO_FW_MIN +
-			mgmt_rx_reo_sim_get_random_unsigned_int(
+	mac_hw_to_fw_delay_us = mgmt_rx_reo_sim_get_delay(
+			sim_context, MGMT_RX_REO_SIM_DELAY_MAC_HW_TO_FW_MIN,
 			MGMT_RX_REO_SIM_DELAY_MAC_HW_TO_FW_MIN_MAX_DELTA);
 	mgmt_rx_reo_sim_sleep(mac_hw_to_fw_delay_us);
 
@@ -2936,8 +3384,8 @@ mgmt_rx_reo_sim_mac_hw_thread(void *data)
 			qdf_assert_always(0);
 		}
 
-		inter_frame_delay_us = MGMT_RX_REO_SIM_INTER_FRAME_DELAY_MIN +
-			mgmt_rx_reo_sim_get_random_unsigned_int(
+		inter_frame_delay_us = mgmt_rx_reo_sim_get_delay(
+			sim_context, MGMT_RX_REO_SIM_INTER_FRAME_DELAY_MIN,
 			MGMT_RX_REO_SIM_INTER_FRAME_DELAY_MIN_MAX_DELTA);
 
 		mgmt_rx_reo_sim_sleep(inter_frame_delay_us);
@@ -3194,8 +3642,14 @@ mgmt_rx_reo_sim_pdev_object_destroy_notification(struct wlan_objmgr_pdev *pdev)
 	return QDF_STATUS_SUCCESS;
 }
 
-QDF_STATUS
-mgmt_rx_reo_sim_start(void)
+/**
+ * mgmt_rx_reo_sim_launch() - Start management Rx reorder simulation
+ * @benchmark: Whether to run the simulation in benchmark mode
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS
+mgmt_rx_reo_sim_launch(bool benchmark)
 {
 	struct mgmt_rx_reo_sim_context *sim_context;
 	qdf_thread_t *mac_hw_thread;
@@ -3239,6 +3693,22 @@ mgmt_rx_reo_sim_start(void)
 		sim_context->fw_mgmt_frame_handler[link_id] = wq;
 	}
 
+	sim_context->benchmark = benchmark;
+	if (benchmark) {
+		struct mgmt_rx_reo_sim_benchmark_stats *stats;
+
+		stats = &sim_context->benchmark_stats;
+
+		qdf_spin_lock(&stats->lock);
+		stats->num_frames = 0;
+		stats->num_queued = 0;
+		stats->num_delivered = 0;
+		stats->algo_time_us = 0;
+		stats->max_algo_time_us = 0;
+		stats->start_ts = qdf_get_monotonic_boottime();
+		qdf_spin_unlock(&stats->lock);
+	}
+
 	mac_hw_thread = qdf_create_thread(mgmt_rx_reo_sim_mac_hw_thread,
 					  sim_context, "MAC_HW_thread");
 	if (!mac_hw_thread) {
@@ -3273,6 +3743,18 @@ error_destroy_fw_and_host_work_queues_till_last_link:
 	return status;
 }
 
+QDF_STATUS
+mgmt_rx_reo_sim_start(void)
+{
+	return mgmt_rx_reo_sim_launch(false);
+}
+
+QDF_STATUS
+mgmt_rx_reo_sim_benchmark_start(void)
+{
+	return mgmt_rx_reo_sim_launch(true);
+}
+
 QDF_STATUS
 mgmt_rx_reo_sim_stop(void)
 {
@@ -3343,6 +3825,11 @@ mgmt_rx_reo_sim_stop(void)
 		mgmt_rx_reo_err("reo sim passed");
 	}
 
+	if (sim_context->benchmark) {
+		mgmt_rx_reo_sim_benchmark_print_stats(sim_context);
+		sim_context->benchmark = false;
+	}
+
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -3383,6 +3870,7 @@ mgmt_rx_reo_sim_init(struct mgmt_rx_reo_context *reo_context)
 	}
 
 	qdf_spinlock_create(&sim_context->link_id_to_pdev_map.lock);
+	qdf_spinlock_create(&sim_context->benchmark_stats.lock);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -3407,6 +3895,7 @@ mgmt_rx_reo_sim_deinit(struct mgmt_rx_reo_context *reo_context)
 
 	sim_context = &reo_context->sim_context;
 
+	qdf_spinlock_destroy(&sim_context->benchmark_stats.lock);
 	qdf_spinlock_destroy(&sim_context->link_id_to_pdev_map.lock);
 
 	status = mgmt_rx_reo_sim_deinit_stale_frame_list(
@@ -3515,6 +4004,9 @@ mgmt_rx_reo_flush_reorder_list(struct mgmt_rx_reo_list *reo_list)
 		qdf_mem_free(cur_entry);
 	}
 
+	reo_list->index.head = 0;
+	reo_list->index.count = 0;
+
 	qdf_spin_unlock_bh(&reo_list->list_lock);
 
 	return QDF_STATUS_SUCCESS;
@@ -3542,6 +4034,7 @@ mgmt_rx_reo_list_deinit(struct mgmt_rx_reo_list *reo_list)
 	}
 	qdf_spinlock_destroy(&reo_list->list_lock);
 	qdf_list_destroy(&reo_list->list);
+	mgmt_rx_reo_list_index_deinit(&reo_list->index);
 
 	return QDF_STATUS_SUCCESS;
 }
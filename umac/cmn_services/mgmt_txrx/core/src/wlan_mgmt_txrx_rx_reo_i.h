@@ -35,6 +35,11 @@
 #include <wlan_objmgr_psoc_obj.h>
 
 #define MGMT_RX_REO_LIST_MAX_SIZE        (100)
+/*
+ * The reorder list can briefly hold more than its max size, until the
+ * entries beyond it are released, so give the index twice that room.
+ */
+#define MGMT_RX_REO_LIST_INDEX_SIZE(max_list_size) (2 * (max_list_size))
 #define MGMT_RX_REO_LIST_TIMEOUT_US      (10 * USEC_PER_MSEC)
 #define MGMT_RX_REO_STATUS_WAIT_FOR_FRAME_ON_OTHER_LINKS         (BIT(0))
 #define MGMT_RX_REO_STATUS_AGED_OUT                              (BIT(1))
@@ -148,6 +153,26 @@ struct mgmt_rx_reo_global_ts_info {
 	uint32_t global_ts;
 };
 
+struct mgmt_rx_reo_list_entry;
+
+/**
+ * struct mgmt_rx_reo_list_index - Array of pointers to the reorder list
+ * entries, kept in the same order as the reorder list. It is used to find the
+ * insertion position of a new frame by a binary search on the global time
+ * stamp and to walk the list in either direction from that position.
+ * @entries: Array of entry pointers. Valid pointers are stored at positions
+ * [@head, @head + @count).
+ * @head: Position in @entries of the first entry of the reorder list
+ * @count: Number of entries in the reorder list
+ * @size: Number of pointers @entries can hold
+ */
+struct mgmt_rx_reo_list_index {
+	struct mgmt_rx_reo_list_entry **entries;
+	uint32_t head;
+	uint32_t count;
+	uint32_t size;
+};
+
 /**
  * struct mgmt_rx_reo_list – Linked list used to reorder the management frames
  * received. Each list entry would correspond to a management frame. List
@@ -161,6 +186,7 @@ struct mgmt_rx_reo_global_ts_info {
  * @ageout_timer: Periodic timer to age-out the list entries
  * @ts_last_released_frame: Stores the global time stamp for the last frame
  * removed from the reorder list
+ * @index: Sorted index of the list entries, protected by @list_lock
  */
 struct mgmt_rx_reo_list {
 	qdf_list_t list;
@@ -169,6 +195,7 @@ struct mgmt_rx_reo_list {
 	uint32_t list_entry_timeout_us;
 	qdf_timer_t ageout_timer;
 	struct mgmt_rx_reo_global_ts_info ts_last_released_frame;
+	struct mgmt_rx_reo_list_index index;
 };
 
 /*
@@ -224,6 +251,9 @@ struct mgmt_rx_reo_list_entry {
 				(MGMT_RX_REO_SIM_PENDING_FRAME_LIST_MAX_SIZE)
 #define MGMT_RX_REO_SIM_STALE_FRAME_TEMP_LIST_MAX_SIZE (100)
 
+/* Factor by which the simulated delays are reduced in benchmark mode */
+#define MGMT_RX_REO_SIM_BENCHMARK_DELAY_DIVISOR        (1000)
+
 /**
  * struct mgmt_rx_frame_params - Parameters associated with a management frame.
  * This structure is used by the simulation framework.
@@ -345,6 +375,27 @@ struct mgmt_rx_reo_mac_hw_simulator {
 	qdf_thread_t *mac_hw_thread;
 };
 
+/**
+ * struct mgmt_rx_reo_sim_benchmark_stats - Throughput statistics of the
+ * reorder algorithm collected by the simulation framework in benchmark mode
+ * @start_ts: Host time stamp(microsecond) when the simulation is started
+ * @num_frames: Number of frames given to the reorder algorithm
+ * @num_queued: Number of frames queued in the reorder list
+ * @num_delivered: Number of frames delivered to the upper layer
+ * @algo_time_us: Total time spent in the reorder algorithm
+ * @max_algo_time_us: Maximum time spent in the reorder algorithm for a frame
+ * @lock: lock used to protect this structure
+ */
+struct mgmt_rx_reo_sim_benchmark_stats {
+	uint64_t start_ts;
+	uint64_t num_frames;
+	uint64_t num_queued;
+	uint64_t num_delivered;
+	uint64_t algo_time_us;
+	uint64_t max_algo_time_us;
+	qdf_spinlock_t lock;
+};
+
 /**
  * struct mgmt_rx_reo_sim_context - Management rx-reorder simulation context
  * @host_mgmt_frame_handler: Per link work queue to simulate the host layer
@@ -354,6 +405,10 @@ struct mgmt_rx_reo_mac_hw_simulator {
  * @mac_hw_sim:  MAC HW simulation object
  * @snapshot: snapshots required for reo algorithm
  * @link_id_to_pdev_map: link_id to pdev object map
+ * @benchmark: Whether the simulation runs in benchmark mode. In benchmark
+ * mode the simulated delays are reduced by
+ * MGMT_RX_REO_SIM_BENCHMARK_DELAY_DIVISOR to load the reorder algorithm.
+ * @benchmark_stats: Statistics collected in benchmark mode
  */
 struct mgmt_rx_reo_sim_context {
 	struct workqueue_struct *host_mgmt_frame_handler[MGMT_RX_REO_MAX_LINKS];
@@ -364,6 +419,8 @@ struct mgmt_rx_reo_sim_context {
 	struct mgmt_rx_reo_snapshot snapshot[MGMT_RX_REO_MAX_LINKS]
 					    [MGMT_RX_REO_SHARED_SNAPSHOT_MAX];
 	struct mgmt_rx_reo_sim_link_id_to_pdev_map link_id_to_pdev_map;
+	bool benchmark;
+	struct mgmt_rx_reo_sim_benchmark_stats benchmark_stats;
 };
 #endif /* WLAN_MGMT_RX_REO_SIM_SUPPORT */
 
@@ -620,6 +677,20 @@ mgmt_rx_reo_deinit_context(void);
 QDF_STATUS
 mgmt_rx_reo_sim_start(void);
 
+/**
+ * mgmt_rx_reo_sim_benchmark_start() - Helper API to start management Rx
+ * reorder simulation in benchmark mode
+ *
+ * This API starts the simulation framework with the simulated delays reduced
+ * so that the reorder algorithm is loaded with frames. Throughput statistics
+ * of the reorder algorithm are printed when the simulation is stopped using
+ * mgmt_rx_reo_sim_stop().
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS
+mgmt_rx_reo_sim_benchmark_start(void);
+
 /**
  * mgmt_rx_reo_sim_stop() - Helper API to stop management Rx reorder
  * simulation
@@ -92,6 +92,19 @@ wlan_get_pdev_from_mlo_link_id(uint8_t mlo_link_id);
 QDF_STATUS
 wlan_mgmt_rx_reo_sim_start(void);
 
+/**
+ * wlan_mgmt_rx_reo_sim_benchmark_start() - Helper API to start management Rx
+ * reorder simulation in benchmark mode
+ *
+ * This API starts the simulation framework with reduced simulated delays to
+ * measure the throughput of the reorder algorithm. Statistics are printed
+ * when the simulation is stopped using wlan_mgmt_rx_reo_sim_stop().
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS
+wlan_mgmt_rx_reo_sim_benchmark_start(void);
+
 /**
  * wlan_mgmt_rx_reo_sim_stop() - Helper API to stop management Rx reorder
  * simulation
@@ -121,6 +134,22 @@ wlan_mgmt_rx_reo_sim_start(void)
 	return QDF_STATUS_E_INVAL;
 }
 
+/**
+ * wlan_mgmt_rx_reo_sim_benchmark_start() - Helper API to start management Rx
+ * reorder simulation in benchmark mode
+ *
+ * Error print is added to indicate that simulation framework is not compiled.
+ *
+ * Return: QDF_STATUS_E_INVAL
+ */
+static inline QDF_STATUS
+wlan_mgmt_rx_reo_sim_benchmark_start(void)
+{
+	mgmt_txrx_err("Mgmt rx reo simulation is not compiled");
+
+	return QDF_STATUS_E_INVAL;
+}
+
 /**
  * wlan_mgmt_rx_reo_sim_stop() - Helper API to stop management Rx reorder
  * simulation
@@ -213,6 +213,14 @@ wlan_mgmt_rx_reo_sim_start(void)
 
 qdf_export_symbol(wlan_mgmt_rx_reo_sim_start);
 
+QDF_STATUS
+wlan_mgmt_rx_reo_sim_benchmark_start(void)
+{
+	return mgmt_rx_reo_sim_benchmark_start();
+}
+
+qdf_export_symbol(wlan_mgmt_rx_reo_sim_benchmark_start);
+
 QDF_STATUS
 wlan_mgmt_rx_reo_sim_stop(void)
 {
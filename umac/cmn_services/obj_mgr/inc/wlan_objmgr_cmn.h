@@ -28,16 +28,37 @@
 #include "qdf_status.h"
 #include "wlan_cmn.h"
 #include "qdf_atomic.h"
+#include "qdf_types.h"
 
 /* No. of PSOCs can be supported */
 #define WLAN_OBJMGR_MAX_DEVICES 3
 
 /* size of Hash */
-#define WLAN_PEER_HASHSIZE 64
+#define WLAN_PEER_HASH_BITS 6
+#define WLAN_PEER_HASHSIZE (1 << WLAN_PEER_HASH_BITS)
 
-/* simple hash is enough for variation of macaddr */
-#define WLAN_PEER_HASH(addr)   \
-(((const uint8_t *)(addr))[QDF_MAC_ADDR_SIZE - 1] % WLAN_PEER_HASHSIZE)
+/**
+ * wlan_peer_hash() - hash a MAC address into a peer hash bucket
+ * @addr: MAC address
+ *
+ * All six bytes are folded and spread with a multiplicative (Fibonacci) hash,
+ * so that addresses differing only in the OUI or in a middle byte, as MLO
+ * link addresses and randomized addresses often do, land in different buckets.
+ *
+ * Return: bucket index in [0, WLAN_PEER_HASHSIZE)
+ */
+static inline uint8_t wlan_peer_hash(const uint8_t *addr)
+{
+	uint32_t key;
+
+	key = ((uint32_t)addr[2] << 24 | (uint32_t)addr[3] << 16 |
+	       (uint32_t)addr[4] << 8 | addr[5]) ^
+	      ((uint32_t)addr[0] << 8 | addr[1]) * 0x10001;
+
+	return (key * 0x9E3779B1) >> (32 - WLAN_PEER_HASH_BITS);
+}
+
+#define WLAN_PEER_HASH(addr) wlan_peer_hash((const uint8_t *)(addr))
 
 #define obj_mgr_log(level, args...) \
 		QDF_TRACE(QDF_MODULE_ID_OBJ_MGR, level, ## args)
@@ -120,7 +141,9 @@ enum wlan_objmgr_obj_type {
  * struct wlan_peer_list {
  * @peer_hash[]:    peer sub lists
  * @peer_list_lock: List lock, this has to be acquired on
- *		    accessing/updating the list
+ *		    accessing/updating the list. With WLAN_OBJMGR_PEER_RCU,
+ *		    active peer lookups walk the sublists under RCU instead
+ *		    and only updates and no-state walks take it.
  *
  *  Peer list, it maintains sublists based on the MAC address as hash
  *  Note: For DA WDS similar peer list has to be maintained
@@ -513,6 +536,63 @@ static inline const char *string_from_dbgid(wlan_objmgr_ref_dbgid id)
 #define WLAN_OBJMGR_RATELIMIT_THRESH 2
 #endif
 
+#ifdef WLAN_OBJMGR_PCPU_REF
+/* number of per-CPU counter slots of a percpu reference */
+#define WLAN_OBJMGR_PCPU_REF_SLOTS 8
+
+/*
+ * Bias held by the atomic ref_cnt while the object is in per-CPU mode, so that
+ * it can't reach zero while the per-CPU slots are folded into it
+ */
+#define WLAN_OBJMGR_PCPU_REF_BIAS (1 << 30)
+
+/* per-CPU slot value once the slot has been folded into the atomic counter */
+#define WLAN_OBJMGR_PCPU_REF_DEAD ((int32_t)0x80000000)
+
+/**
+ * struct wlan_objmgr_pcpu_ref_slot - per-CPU slot of a reference count
+ * @cnt: references taken minus references released on this slot, or
+ *	WLAN_OBJMGR_PCPU_REF_DEAD
+ */
+struct wlan_objmgr_pcpu_ref_slot {
+	qdf_atomic_t cnt;
+} qdf_cacheline_aligned;
+
+/**
+ * struct wlan_objmgr_pcpu_ref - percpu-ref style reference count
+ * @atomic_mode: non-zero once the object has been switched to atomic mode
+ * @slot: per-CPU counter slots, indexed by CPU modulo the number of slots
+ *
+ * While the object is live, references are counted on the slot of the
+ * current CPU and the object's atomic ref_cnt only holds
+ * WLAN_OBJMGR_PCPU_REF_BIAS. On logical delete each slot is atomically
+ * exchanged with WLAN_OBJMGR_PCPU_REF_DEAD and folded into ref_cnt, after
+ * which the bias is dropped; an update racing with the switch either lands
+ * on the slot before it is folded or sees the slot dead and goes to ref_cnt.
+ */
+struct wlan_objmgr_pcpu_ref {
+	qdf_atomic_t atomic_mode;
+	struct wlan_objmgr_pcpu_ref_slot slot[WLAN_OBJMGR_PCPU_REF_SLOTS];
+};
+
+/**
+ * struct wlan_objmgr_pcpu_ref_id_slot - per-CPU slot of ref id debug counts
+ * @ref_id_dbg: per ref id counts on this slot, or WLAN_OBJMGR_PCPU_REF_DEAD
+ */
+struct wlan_objmgr_pcpu_ref_id_slot {
+	qdf_atomic_t ref_id_dbg[WLAN_REF_ID_MAX];
+} qdf_cacheline_aligned;
+
+/**
+ * struct wlan_objmgr_pcpu_ref_ids - per-CPU ref id debug counts
+ * @slot: per-CPU slots, folded into the object's ref_id_dbg[] the same way
+ *	as struct wlan_objmgr_pcpu_ref
+ */
+struct wlan_objmgr_pcpu_ref_ids {
+	struct wlan_objmgr_pcpu_ref_id_slot slot[WLAN_OBJMGR_PCPU_REF_SLOTS];
+};
+#endif
+
 #ifdef WLAN_OBJMGR_REF_ID_TRACE
 #define WLAN_OBJMGR_TRACE_FUNC_SIZE 30
 /**
@@ -609,4 +609,28 @@ static inline void wlan_objmgr_set_dp_mlo_ctx(void *dp_handle)
 }
 #endif /* WLAN_FEATURE_11BE_MLO */
 
+#if defined(WLAN_OBJMGR_PCPU_REF) && defined(WLAN_OBJMGR_PCPU_REF_BENCHMARK)
+/**
+ * wlan_objmgr_pcpu_ref_benchmark() - Compare per-CPU and atomic references
+ * @num_threads: number of concurrent get/release threads (max 16)
+ * @iterations: get/release pairs done by each thread
+ *
+ * Runs the objmgr get/release pattern (ref_cnt plus ref id debug count) from
+ * @num_threads threads, first on shared atomics and then on per-CPU
+ * references, logs the elapsed time of both and checks that the counts are
+ * exact after switching the per-CPU reference to atomic mode.
+ *
+ * Return: SUCCESS if the folded counts are exact, failure otherwise
+ */
+QDF_STATUS wlan_objmgr_pcpu_ref_benchmark(uint32_t num_threads,
+					  uint32_t iterations);
+#else
+static inline
+QDF_STATUS wlan_objmgr_pcpu_ref_benchmark(uint32_t num_threads,
+					  uint32_t iterations)
+{
+	return QDF_STATUS_E_NOSUPPORT;
+}
+#endif
+
 #endif /* _WLAN_OBJMGR_GLOBAL_OBJ_H_*/
@@ -191,6 +191,8 @@ struct wlan_objmgr_pdev_mlme {
  * @wlan_psoc:         back pointer to PSOC, its attached to
  * @ref_cnt:           Ref count
  * @ref_id_dbg:        Array to track Ref count
+ * @pcpu_ref:          Per-CPU ref count, used until logical delete
+ * @pcpu_ref_ids:      Per-CPU ref id debug counts, used until logical delete
  */
 struct wlan_objmgr_pdev_objmgr {
 	uint8_t wlan_pdev_id;
@@ -205,6 +207,10 @@ struct wlan_objmgr_pdev_objmgr {
 	struct wlan_objmgr_psoc *wlan_psoc;
 	qdf_atomic_t ref_cnt;
 	qdf_atomic_t ref_id_dbg[WLAN_REF_ID_MAX];
+#ifdef WLAN_OBJMGR_PCPU_REF
+	struct wlan_objmgr_pcpu_ref pcpu_ref;
+	struct wlan_objmgr_pcpu_ref_ids pcpu_ref_ids;
+#endif
 };
 
 /**
@@ -25,6 +25,7 @@
 
 #include <qdf_types.h>
 #include <qdf_atomic.h>
+#include <qdf_rcu.h>
 #include "wlan_objmgr_vdev_obj.h"
 #ifdef WLAN_FEATURE_11BE_MLO
 #include "wlan_mlo_mgr_public_structs.h"
@@ -157,6 +158,8 @@ struct wlan_objmgr_peer_mlme {
  * @ref_id_dbg:        Array to track Ref count
  * @print_cnt:         Count to throttle Logical delete prints
  * @wlan_objmgr_trace: Trace ref and deref
+ * @pcpu_ref:          Per-CPU ref count, used until logical delete
+ * @pcpu_ref_ids:      Per-CPU ref id debug counts, used until logical delete
  */
 struct wlan_objmgr_peer_objmgr {
 	struct wlan_objmgr_vdev *vdev;
@@ -168,6 +171,12 @@ struct wlan_objmgr_peer_objmgr {
 #ifdef WLAN_OBJMGR_REF_ID_TRACE
 	struct wlan_objmgr_trace trace;
 #endif
+#ifdef WLAN_OBJMGR_PCPU_REF
+	struct wlan_objmgr_pcpu_ref pcpu_ref;
+#ifdef WLAN_OBJMGR_REF_ID_DEBUG
+	struct wlan_objmgr_pcpu_ref_ids pcpu_ref_ids;
+#endif
+#endif
 };
 
 /**
@@ -184,6 +193,8 @@ struct wlan_objmgr_peer_objmgr {
  * @peer_lock:        Lock for access/update peer contents
  * @mlo_peer_ctx:     Reference to MLO Peer context
  * @mldaddr:          Peer MLD MAC address
+ * @rcu:              RCU head, the peer is freed after a grace period so that
+ *                    lockless lookups never touch freed memory
  */
 struct wlan_objmgr_peer {
 	qdf_list_node_t psoc_peer;
@@ -200,6 +211,9 @@ struct wlan_objmgr_peer {
 	struct wlan_mlo_peer_context *mlo_peer_ctx;
 	uint8_t mldaddr[QDF_MAC_ADDR_SIZE];
 #endif
+#ifdef WLAN_OBJMGR_PEER_RCU
+	qdf_rcu_head_t rcu;
+#endif
 };
 
 /**
@@ -901,7 +915,9 @@ static inline void wlan_peer_set_macaddr(struct wlan_objmgr_peer *peer,
  * @new_macaddr: New MAC address
  *
  * API to update peer MAC address and corresponding peer hash entry in PSOC
- * peer list.
+ * peer list. With WLAN_OBJMGR_PEER_RCU it waits for a grace period between
+ * unhashing and rehashing the peer, so it must be called from process
+ * context.
  *
  * Return: SUCCESS/FAILURE
  */
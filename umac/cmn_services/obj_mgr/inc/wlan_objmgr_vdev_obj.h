@@ -349,6 +349,8 @@ struct wlan_objmgr_vdev_nif {
  *  @ref_cnt:           Ref count
  *  @ref_id_dbg:        Array to track Ref count
  *  @wlan_objmgr_trace: Trace ref and deref
+ *  @pcpu_ref:          Per-CPU ref count, used until logical delete
+ *  @pcpu_ref_ids:      Per-CPU ref id debug counts, used until logical delete
  */
 struct wlan_objmgr_vdev_objmgr {
 	uint8_t vdev_id;
@@ -365,6 +367,10 @@ struct wlan_objmgr_vdev_objmgr {
 #ifdef WLAN_OBJMGR_REF_ID_TRACE
 	struct wlan_objmgr_trace trace;
 #endif
+#ifdef WLAN_OBJMGR_PCPU_REF
+	struct wlan_objmgr_pcpu_ref pcpu_ref;
+	struct wlan_objmgr_pcpu_ref_ids pcpu_ref_ids;
+#endif
 };
 
 /**
@@ -335,16 +335,16 @@ static void wlan_objmgr_print_pending_refs(union wlan_objmgr_del_obj *obj,
 					  QDF_TRACE_LEVEL_DEBUG);
 		break;
 	case WLAN_PDEV_OP:
-		wlan_objmgr_print_ref_ids(obj->obj_pdev->pdev_objmgr.ref_id_dbg,
-					  QDF_TRACE_LEVEL_DEBUG);
+		wlan_objmgr_print_obj_ref_ids(&obj->obj_pdev->pdev_objmgr,
+					      QDF_TRACE_LEVEL_DEBUG);
 		break;
 	case WLAN_VDEV_OP:
-		wlan_objmgr_print_ref_ids(obj->obj_vdev->vdev_objmgr.ref_id_dbg,
-					  QDF_TRACE_LEVEL_DEBUG);
+		wlan_objmgr_print_obj_ref_ids(&obj->obj_vdev->vdev_objmgr,
+					      QDF_TRACE_LEVEL_DEBUG);
 		break;
 	case WLAN_PEER_OP:
-		wlan_objmgr_print_ref_ids(obj->obj_peer->peer_objmgr.ref_id_dbg,
-					  QDF_TRACE_LEVEL_DEBUG);
+		wlan_objmgr_print_obj_ref_ids(&obj->obj_peer->peer_objmgr,
+					      QDF_TRACE_LEVEL_DEBUG);
 		break;
 	default:
 		obj_mgr_debug("invalid obj_type");
@@ -389,7 +389,7 @@ wlan_objmgr_trace_print_ref(union wlan_objmgr_del_obj *obj,
 		vdev_obj = &obj->obj_vdev->vdev_objmgr;
 		trace = &vdev_obj->trace;
 		for (id = 0; id < WLAN_REF_ID_MAX; id++) {
-			if (qdf_atomic_read(&vdev_obj->ref_id_dbg[id])) {
+			if (wlan_objmgr_ref_id_read(vdev_obj, id)) {
 				obj_mgr_debug("Reference:");
 
 				func_head = trace->references[id].head;
@@ -405,7 +405,7 @@ wlan_objmgr_trace_print_ref(union wlan_objmgr_del_obj *obj,
 		peer_obj = &obj->obj_peer->peer_objmgr;
 		trace = &peer_obj->trace;
 		for (id = 0; id < WLAN_REF_ID_MAX; id++) {
-			if (qdf_atomic_read(&peer_obj->ref_id_dbg[id])) {
+			if (wlan_objmgr_ref_id_read(peer_obj, id)) {
 				obj_mgr_debug("Reference:");
 
 				func_head = trace->references[id].head;
@@ -26,6 +26,10 @@
 #include "wlan_objmgr_psoc_obj.h"
 #include "qdf_mem.h"
 #include <qdf_module.h>
+#include <qdf_rcu.h>
+#include <qdf_threads.h>
+#include <qdf_time.h>
+#include <qdf_util.h>
 
 /* Global object, it is declared globally */
 struct wlan_objmgr_global *g_umac_glb_obj;
@@ -71,6 +75,11 @@ QDF_STATUS wlan_objmgr_global_obj_deinit(void)
 
 	wlan_objmgr_debug_info_deinit();
 
+#ifdef WLAN_OBJMGR_PEER_RCU
+	/* free peers still waiting for a grace period before leak checks */
+	qdf_rcu_barrier();
+#endif
+
 	if (QDF_STATUS_SUCCESS == wlan_objmgr_global_obj_can_destroyed()) {
 		qdf_spinlock_destroy(&g_umac_glb_obj->global_lock);
 		qdf_mem_free(g_umac_glb_obj);
@@ -843,6 +852,302 @@ void wlan_objmgr_print_ref_ids(qdf_atomic_t *id,
 	return;
 }
 
+#ifdef WLAN_OBJMGR_PCPU_REF
+/**
+ * wlan_objmgr_pcpu_slot_add() - Add to a per-CPU slot unless it is dead
+ * @slot: per-CPU slot
+ * @delta: value to be added
+ *
+ * Return: true if @delta was added, false if the slot has been folded and the
+ *	atomic counter must be updated instead
+ */
+static bool wlan_objmgr_pcpu_slot_add(qdf_atomic_t *slot, int32_t delta)
+{
+	int32_t cur, old;
+
+	cur = qdf_atomic_read(slot);
+	while (cur != WLAN_OBJMGR_PCPU_REF_DEAD) {
+		old = qdf_atomic_cmpxchg(slot, cur, cur + delta);
+		if (old == cur)
+			return true;
+		cur = old;
+	}
+
+	return false;
+}
+
+static inline uint8_t wlan_objmgr_pcpu_slot_idx(void)
+{
+	return qdf_get_cpu() % WLAN_OBJMGR_PCPU_REF_SLOTS;
+}
+
+void wlan_objmgr_pcpu_ref_init(struct wlan_objmgr_pcpu_ref *ref,
+			       qdf_atomic_t *ref_cnt)
+{
+	uint8_t i;
+
+	qdf_atomic_init(&ref->atomic_mode);
+	for (i = 0; i < WLAN_OBJMGR_PCPU_REF_SLOTS; i++)
+		qdf_atomic_init(&ref->slot[i].cnt);
+
+	qdf_atomic_set(ref_cnt, WLAN_OBJMGR_PCPU_REF_BIAS);
+}
+
+void wlan_objmgr_pcpu_ref_inc(struct wlan_objmgr_pcpu_ref *ref,
+			      qdf_atomic_t *ref_cnt)
+{
+	uint8_t idx = wlan_objmgr_pcpu_slot_idx();
+
+	if (!wlan_objmgr_pcpu_slot_add(&ref->slot[idx].cnt, 1))
+		qdf_atomic_inc(ref_cnt);
+}
+
+bool wlan_objmgr_pcpu_ref_dec_and_test(struct wlan_objmgr_pcpu_ref *ref,
+				       qdf_atomic_t *ref_cnt)
+{
+	uint8_t idx = wlan_objmgr_pcpu_slot_idx();
+
+	/* ref_cnt holds the bias as long as any slot is alive */
+	if (wlan_objmgr_pcpu_slot_add(&ref->slot[idx].cnt, -1))
+		return false;
+
+	return qdf_atomic_dec_and_test(ref_cnt);
+}
+
+int32_t wlan_objmgr_pcpu_ref_read(struct wlan_objmgr_pcpu_ref *ref,
+				  qdf_atomic_t *ref_cnt)
+{
+	int32_t cnt, val;
+	uint8_t i;
+
+	if (qdf_atomic_read(&ref->atomic_mode))
+		return qdf_atomic_read(ref_cnt);
+
+	cnt = qdf_atomic_read(ref_cnt) - WLAN_OBJMGR_PCPU_REF_BIAS;
+	for (i = 0; i < WLAN_OBJMGR_PCPU_REF_SLOTS; i++) {
+		val = qdf_atomic_read(&ref->slot[i].cnt);
+		if (val != WLAN_OBJMGR_PCPU_REF_DEAD)
+			cnt += val;
+	}
+
+	return cnt;
+}
+
+void wlan_objmgr_pcpu_ref_switch_to_atomic(struct wlan_objmgr_pcpu_ref *ref,
+					   qdf_atomic_t *ref_cnt)
+{
+	int32_t val;
+	uint8_t i;
+
+	if (qdf_atomic_inc_return(&ref->atomic_mode) != 1)
+		return;
+
+	for (i = 0; i < WLAN_OBJMGR_PCPU_REF_SLOTS; i++) {
+		val = qdf_atomic_xchg(&ref->slot[i].cnt,
+				      WLAN_OBJMGR_PCPU_REF_DEAD);
+		qdf_atomic_add(val, ref_cnt);
+	}
+
+	/* the caller holds a reference, so this can't drop to zero */
+	qdf_atomic_sub(WLAN_OBJMGR_PCPU_REF_BIAS, ref_cnt);
+}
+
+void wlan_objmgr_pcpu_ref_ids_init(struct wlan_objmgr_pcpu_ref_ids *ids)
+{
+	uint8_t i;
+	uint32_t id;
+
+	for (i = 0; i < WLAN_OBJMGR_PCPU_REF_SLOTS; i++)
+		for (id = 0; id < WLAN_REF_ID_MAX; id++)
+			qdf_atomic_init(&ids->slot[i].ref_id_dbg[id]);
+}
+
+void wlan_objmgr_pcpu_ref_id_add(struct wlan_objmgr_pcpu_ref_ids *ids,
+				 qdf_atomic_t *ref_id_dbg,
+				 wlan_objmgr_ref_dbgid id, int32_t delta)
+{
+	uint8_t idx = wlan_objmgr_pcpu_slot_idx();
+
+	if (!wlan_objmgr_pcpu_slot_add(&ids->slot[idx].ref_id_dbg[id], delta))
+		qdf_atomic_add(delta, &ref_id_dbg[id]);
+}
+
+int32_t wlan_objmgr_pcpu_ref_id_read(struct wlan_objmgr_pcpu_ref_ids *ids,
+				     qdf_atomic_t *ref_id_dbg,
+				     wlan_objmgr_ref_dbgid id)
+{
+	int32_t cnt, val;
+	uint8_t i;
+
+	cnt = qdf_atomic_read(&ref_id_dbg[id]);
+	for (i = 0; i < WLAN_OBJMGR_PCPU_REF_SLOTS; i++) {
+		val = qdf_atomic_read(&ids->slot[i].ref_id_dbg[id]);
+		if (val != WLAN_OBJMGR_PCPU_REF_DEAD)
+			cnt += val;
+	}
+
+	return cnt;
+}
+
+void
+wlan_objmgr_pcpu_ref_ids_switch_to_atomic(struct wlan_objmgr_pcpu_ref_ids *ids,
+					  qdf_atomic_t *ref_id_dbg)
+{
+	int32_t val;
+	uint32_t id;
+	uint8_t i;
+
+	for (i = 0; i < WLAN_OBJMGR_PCPU_REF_SLOTS; i++) {
+		for (id = 0; id < WLAN_REF_ID_MAX; id++) {
+			val = qdf_atomic_xchg(&ids->slot[i].ref_id_dbg[id],
+					      WLAN_OBJMGR_PCPU_REF_DEAD);
+			if (val != WLAN_OBJMGR_PCPU_REF_DEAD)
+				qdf_atomic_add(val, &ref_id_dbg[id]);
+		}
+	}
+}
+
+void wlan_objmgr_print_pcpu_ref_ids(struct wlan_objmgr_pcpu_ref_ids *ids,
+				    qdf_atomic_t *ref_id_dbg,
+				    QDF_TRACE_LEVEL log_level)
+{
+	uint32_t i;
+	int32_t pending_ref;
+
+	obj_mgr_log_level(log_level, "Pending references of object");
+	for (i = 0; i < WLAN_REF_ID_MAX; i++) {
+		pending_ref = wlan_objmgr_pcpu_ref_id_read(ids, ref_id_dbg, i);
+		if (pending_ref)
+			obj_mgr_log_level(log_level, "%s(%d) -- %d",
+					  string_from_dbgid(i), i, pending_ref);
+	}
+}
+
+#ifdef WLAN_OBJMGR_PCPU_REF_BENCHMARK
+#define WLAN_OBJMGR_PCPU_REF_BENCH_MAX_THREADS 16
+
+/**
+ * struct wlan_objmgr_pcpu_ref_bench - contention benchmark context
+ * @pcpu: run with per-CPU references if set, atomic references otherwise
+ * @iterations: get/release pairs done by each thread
+ * @ref_cnt: atomic reference count
+ * @ref_id_dbg: atomic ref id debug counts
+ * @pcpu_ref: per-CPU reference count
+ * @pcpu_ref_ids: per-CPU ref id debug counts
+ */
+struct wlan_objmgr_pcpu_ref_bench {
+	bool pcpu;
+	uint32_t iterations;
+	qdf_atomic_t ref_cnt;
+	qdf_atomic_t ref_id_dbg[WLAN_REF_ID_MAX];
+	struct wlan_objmgr_pcpu_ref pcpu_ref;
+	struct wlan_objmgr_pcpu_ref_ids pcpu_ref_ids;
+};
+
+static QDF_STATUS wlan_objmgr_pcpu_ref_bench_thread(void *context)
+{
+	struct wlan_objmgr_pcpu_ref_bench *bench = context;
+	wlan_objmgr_ref_dbgid id;
+	uint32_t i;
+
+	for (i = 0; i < bench->iterations; i++) {
+		id = i % WLAN_REF_ID_MAX;
+		if (bench->pcpu) {
+			wlan_objmgr_ref_inc(bench);
+			wlan_objmgr_ref_id_inc(bench, id);
+			wlan_objmgr_ref_id_dec(bench, id);
+			wlan_objmgr_ref_dec_and_test(bench);
+		} else {
+			qdf_atomic_inc(&bench->ref_cnt);
+			qdf_atomic_inc(&bench->ref_id_dbg[id]);
+			qdf_atomic_dec(&bench->ref_id_dbg[id]);
+			qdf_atomic_dec_and_test(&bench->ref_cnt);
+		}
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static uint64_t
+wlan_objmgr_pcpu_ref_bench_run(struct wlan_objmgr_pcpu_ref_bench *bench,
+			       uint32_t num_threads)
+{
+	qdf_thread_t *threads[WLAN_OBJMGR_PCPU_REF_BENCH_MAX_THREADS];
+	uint64_t start_us;
+	uint32_t i;
+
+	start_us = qdf_get_monotonic_boottime();
+
+	for (i = 0; i < num_threads; i++)
+		threads[i] = qdf_thread_run(wlan_objmgr_pcpu_ref_bench_thread,
+					    bench);
+
+	for (i = 0; i < num_threads; i++) {
+		if (threads[i])
+			qdf_thread_join(threads[i]);
+	}
+
+	return qdf_get_monotonic_boottime() - start_us;
+}
+
+QDF_STATUS wlan_objmgr_pcpu_ref_benchmark(uint32_t num_threads,
+					  uint32_t iterations)
+{
+	struct wlan_objmgr_pcpu_ref_bench *bench;
+	uint64_t atomic_us, pcpu_us;
+	QDF_STATUS status = QDF_STATUS_SUCCESS;
+	uint32_t id;
+
+	if (!num_threads || num_threads > WLAN_OBJMGR_PCPU_REF_BENCH_MAX_THREADS)
+		return QDF_STATUS_E_INVAL;
+
+	bench = qdf_mem_malloc(sizeof(*bench));
+	if (!bench)
+		return QDF_STATUS_E_NOMEM;
+
+	bench->iterations = iterations;
+
+	/* baseline: shared atomic ref_cnt and ref_id_dbg[], creation ref */
+	qdf_atomic_set(&bench->ref_cnt, 1);
+	bench->pcpu = false;
+	atomic_us = wlan_objmgr_pcpu_ref_bench_run(bench, num_threads);
+
+	wlan_objmgr_ref_init(bench);
+	wlan_objmgr_ref_ids_init(bench);
+	wlan_objmgr_ref_inc(bench);
+	bench->pcpu = true;
+	pcpu_us = wlan_objmgr_pcpu_ref_bench_run(bench, num_threads);
+
+	/* only the creation ref must be left once folded */
+	wlan_objmgr_ref_switch_to_atomic(bench);
+	wlan_objmgr_ref_ids_switch_to_atomic(bench);
+	if (qdf_atomic_read(&bench->ref_cnt) != 1) {
+		obj_mgr_err("pcpu ref bench: ref_cnt %d after switch",
+			    qdf_atomic_read(&bench->ref_cnt));
+		status = QDF_STATUS_E_FAULT;
+	}
+	for (id = 0; id < WLAN_REF_ID_MAX; id++) {
+		if (qdf_atomic_read(&bench->ref_id_dbg[id])) {
+			obj_mgr_err("pcpu ref bench: ref id %u count %d", id,
+				    qdf_atomic_read(&bench->ref_id_dbg[id]));
+			status = QDF_STATUS_E_FAULT;
+		}
+	}
+
+	objmgr_nofl_info("pcpu ref bench: %u threads x %u get/release pairs",
+			 num_threads, iterations);
+	objmgr_nofl_info("pcpu ref bench: atomic %llu us, per-cpu %llu us",
+			 atomic_us, pcpu_us);
+
+	qdf_mem_free(bench);
+
+	return status;
+}
+
+qdf_export_symbol(wlan_objmgr_pcpu_ref_benchmark);
+#endif /* WLAN_OBJMGR_PCPU_REF_BENCHMARK */
+#endif /* WLAN_OBJMGR_PCPU_REF */
+
 QDF_STATUS wlan_objmgr_iterate_psoc_list(
 		wlan_objmgr_psoc_handler handler,
 		void *arg, wlan_objmgr_ref_dbgid dbg_id)
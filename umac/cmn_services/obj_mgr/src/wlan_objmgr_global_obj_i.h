@@ -145,4 +145,191 @@ QDF_STATUS wlan_objmgr_psoc_object_detach(
  */
 void wlan_objmgr_print_ref_ids(qdf_atomic_t *id,
 				QDF_TRACE_LEVEL log_level);
+
+#ifdef WLAN_OBJMGR_PCPU_REF
+/**
+ * wlan_objmgr_pcpu_ref_init() - Initialize a reference count in per-CPU mode
+ * @ref: per-CPU reference count
+ * @ref_cnt: atomic reference count of the object
+ *
+ * Return: nothing
+ */
+void wlan_objmgr_pcpu_ref_init(struct wlan_objmgr_pcpu_ref *ref,
+			       qdf_atomic_t *ref_cnt);
+
+/**
+ * wlan_objmgr_pcpu_ref_inc() - Take a reference
+ * @ref: per-CPU reference count
+ * @ref_cnt: atomic reference count of the object
+ *
+ * Return: nothing
+ */
+void wlan_objmgr_pcpu_ref_inc(struct wlan_objmgr_pcpu_ref *ref,
+			      qdf_atomic_t *ref_cnt);
+
+/**
+ * wlan_objmgr_pcpu_ref_dec_and_test() - Release a reference
+ * @ref: per-CPU reference count
+ * @ref_cnt: atomic reference count of the object
+ *
+ * Return: true if the last reference was released, which can only happen
+ *	once the object has been switched to atomic mode
+ */
+bool wlan_objmgr_pcpu_ref_dec_and_test(struct wlan_objmgr_pcpu_ref *ref,
+				       qdf_atomic_t *ref_cnt);
+
+/**
+ * wlan_objmgr_pcpu_ref_read() - Read a reference count
+ * @ref: per-CPU reference count
+ * @ref_cnt: atomic reference count of the object
+ *
+ * The value is exact in atomic mode only.
+ *
+ * Return: number of references held
+ */
+int32_t wlan_objmgr_pcpu_ref_read(struct wlan_objmgr_pcpu_ref *ref,
+				  qdf_atomic_t *ref_cnt);
+
+/**
+ * wlan_objmgr_pcpu_ref_switch_to_atomic() - Fold the per-CPU counts into the
+ *	atomic reference count
+ * @ref: per-CPU reference count
+ * @ref_cnt: atomic reference count of the object
+ *
+ * Called on logical delete, while the caller still holds a reference. Only
+ * the first call switches, later calls are no-ops.
+ *
+ * Return: nothing
+ */
+void wlan_objmgr_pcpu_ref_switch_to_atomic(struct wlan_objmgr_pcpu_ref *ref,
+					   qdf_atomic_t *ref_cnt);
+
+/**
+ * wlan_objmgr_pcpu_ref_ids_init() - Initialize per-CPU ref id debug counts
+ * @ids: per-CPU ref id debug counts
+ *
+ * Return: nothing
+ */
+void wlan_objmgr_pcpu_ref_ids_init(struct wlan_objmgr_pcpu_ref_ids *ids);
+
+/**
+ * wlan_objmgr_pcpu_ref_id_add() - Account a reference of a ref id
+ * @ids: per-CPU ref id debug counts
+ * @ref_id_dbg: atomic ref id debug counts of the object
+ * @id: ref id
+ * @delta: 1 for a reference taken, -1 for a reference released
+ *
+ * Return: nothing
+ */
+void wlan_objmgr_pcpu_ref_id_add(struct wlan_objmgr_pcpu_ref_ids *ids,
+				 qdf_atomic_t *ref_id_dbg,
+				 wlan_objmgr_ref_dbgid id, int32_t delta);
+
+/**
+ * wlan_objmgr_pcpu_ref_id_read() - Read the references held by a ref id
+ * @ids: per-CPU ref id debug counts
+ * @ref_id_dbg: atomic ref id debug counts of the object
+ * @id: ref id
+ *
+ * Return: number of references held by @id
+ */
+int32_t wlan_objmgr_pcpu_ref_id_read(struct wlan_objmgr_pcpu_ref_ids *ids,
+				     qdf_atomic_t *ref_id_dbg,
+				     wlan_objmgr_ref_dbgid id);
+
+/**
+ * wlan_objmgr_pcpu_ref_ids_switch_to_atomic() - Fold the per-CPU ref id
+ *	debug counts into the atomic ones
+ * @ids: per-CPU ref id debug counts
+ * @ref_id_dbg: atomic ref id debug counts of the object
+ *
+ * Return: nothing
+ */
+void
+wlan_objmgr_pcpu_ref_ids_switch_to_atomic(struct wlan_objmgr_pcpu_ref_ids *ids,
+					  qdf_atomic_t *ref_id_dbg);
+
+/**
+ * wlan_objmgr_print_pcpu_ref_ids() - Print ref counts of modules
+ * @ids: per-CPU ref id debug counts
+ * @ref_id_dbg: atomic ref id debug counts of the object
+ * @log_level: log level
+ *
+ * Return: nothing
+ */
+void wlan_objmgr_print_pcpu_ref_ids(struct wlan_objmgr_pcpu_ref_ids *ids,
+				    qdf_atomic_t *ref_id_dbg,
+				    QDF_TRACE_LEVEL log_level);
+
+/*
+ * Reference count accessors on the objmgr sub structure of an object
+ * (pdev_objmgr, vdev_objmgr or peer_objmgr).
+ *
+ * The per-CPU sums are approximate, so the "no reference held" sanity checks
+ * are only done once the object is in atomic mode. The ref id debug counts
+ * must be folded before the reference count is switched for the checks to
+ * stay exact.
+ */
+#define wlan_objmgr_ref_init(_objmgr) \
+	wlan_objmgr_pcpu_ref_init(&(_objmgr)->pcpu_ref, &(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_inc(_objmgr) \
+	wlan_objmgr_pcpu_ref_inc(&(_objmgr)->pcpu_ref, &(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_dec_and_test(_objmgr) \
+	wlan_objmgr_pcpu_ref_dec_and_test(&(_objmgr)->pcpu_ref, \
+					  &(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_read(_objmgr) \
+	wlan_objmgr_pcpu_ref_read(&(_objmgr)->pcpu_ref, &(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_switch_to_atomic(_objmgr) \
+	wlan_objmgr_pcpu_ref_switch_to_atomic(&(_objmgr)->pcpu_ref, \
+					      &(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_is_zero(_objmgr) \
+	(qdf_atomic_read(&(_objmgr)->pcpu_ref.atomic_mode) && \
+	 !qdf_atomic_read(&(_objmgr)->ref_cnt))
+
+#define wlan_objmgr_ref_ids_init(_objmgr) \
+	wlan_objmgr_pcpu_ref_ids_init(&(_objmgr)->pcpu_ref_ids)
+#define wlan_objmgr_ref_id_inc(_objmgr, _id) \
+	wlan_objmgr_pcpu_ref_id_add(&(_objmgr)->pcpu_ref_ids, \
+				    (_objmgr)->ref_id_dbg, _id, 1)
+#define wlan_objmgr_ref_id_dec(_objmgr, _id) \
+	wlan_objmgr_pcpu_ref_id_add(&(_objmgr)->pcpu_ref_ids, \
+				    (_objmgr)->ref_id_dbg, _id, -1)
+#define wlan_objmgr_ref_id_read(_objmgr, _id) \
+	wlan_objmgr_pcpu_ref_id_read(&(_objmgr)->pcpu_ref_ids, \
+				     (_objmgr)->ref_id_dbg, _id)
+#define wlan_objmgr_ref_ids_switch_to_atomic(_objmgr) \
+	wlan_objmgr_pcpu_ref_ids_switch_to_atomic(&(_objmgr)->pcpu_ref_ids, \
+						  (_objmgr)->ref_id_dbg)
+#define wlan_objmgr_ref_id_is_zero(_objmgr, _id) \
+	(qdf_atomic_read(&(_objmgr)->pcpu_ref.atomic_mode) && \
+	 !qdf_atomic_read(&(_objmgr)->ref_id_dbg[_id]))
+#define wlan_objmgr_print_obj_ref_ids(_objmgr, _log_level) \
+	wlan_objmgr_print_pcpu_ref_ids(&(_objmgr)->pcpu_ref_ids, \
+				       (_objmgr)->ref_id_dbg, _log_level)
+#else
+#define wlan_objmgr_ref_init(_objmgr) \
+	qdf_atomic_init(&(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_inc(_objmgr) \
+	qdf_atomic_inc(&(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_dec_and_test(_objmgr) \
+	qdf_atomic_dec_and_test(&(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_read(_objmgr) \
+	qdf_atomic_read(&(_objmgr)->ref_cnt)
+#define wlan_objmgr_ref_switch_to_atomic(_objmgr)
+#define wlan_objmgr_ref_is_zero(_objmgr) \
+	(!qdf_atomic_read(&(_objmgr)->ref_cnt))
+
+#define wlan_objmgr_ref_ids_init(_objmgr)
+#define wlan_objmgr_ref_id_inc(_objmgr, _id) \
+	qdf_atomic_inc(&(_objmgr)->ref_id_dbg[_id])
+#define wlan_objmgr_ref_id_dec(_objmgr, _id) \
+	qdf_atomic_dec(&(_objmgr)->ref_id_dbg[_id])
+#define wlan_objmgr_ref_id_read(_objmgr, _id) \
+	qdf_atomic_read(&(_objmgr)->ref_id_dbg[_id])
+#define wlan_objmgr_ref_ids_switch_to_atomic(_objmgr)
+#define wlan_objmgr_ref_id_is_zero(_objmgr, _id) \
+	(!qdf_atomic_read(&(_objmgr)->ref_id_dbg[_id]))
+#define wlan_objmgr_print_obj_ref_ids(_objmgr, _log_level) \
+	wlan_objmgr_print_ref_ids((_objmgr)->ref_id_dbg, _log_level)
+#endif
 #endif /* _WLAN_OBJMGR_GLOBAL_OBJ_I_H_ */
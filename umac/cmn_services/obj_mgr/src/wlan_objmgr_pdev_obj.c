@@ -136,7 +136,8 @@ struct wlan_objmgr_pdev *wlan_objmgr_pdev_obj_create(
 	pdev->pdev_objmgr.max_peer_count = wlan_psoc_get_max_peer_count(psoc);
 	/* Save HDD/OSIF pointer */
 	pdev->pdev_nif.pdev_ospriv = osdev_priv;
-	qdf_atomic_init(&pdev->pdev_objmgr.ref_cnt);
+	wlan_objmgr_ref_init(&pdev->pdev_objmgr);
+	wlan_objmgr_ref_ids_init(&pdev->pdev_objmgr);
 	pdev->pdev_objmgr.print_cnt = 0;
 	wlan_objmgr_pdev_get_ref(pdev, WLAN_OBJMGR_ID);
 	/* Invoke registered create handlers */
@@ -253,8 +254,8 @@ QDF_STATUS wlan_objmgr_pdev_obj_delete(struct wlan_objmgr_pdev *pdev)
 		      pdev->pdev_objmgr.wlan_pdev_id);
 
 	print_idx = qdf_get_pidx();
-	wlan_objmgr_print_ref_ids(pdev->pdev_objmgr.ref_id_dbg,
-				  QDF_TRACE_LEVEL_DEBUG);
+	wlan_objmgr_print_obj_ref_ids(&pdev->pdev_objmgr,
+				      QDF_TRACE_LEVEL_DEBUG);
 	/*
 	 * Update PDEV object state to LOGICALLY DELETED
 	 * It prevents further access of this object
@@ -262,6 +263,9 @@ QDF_STATUS wlan_objmgr_pdev_obj_delete(struct wlan_objmgr_pdev *pdev)
 	wlan_pdev_obj_lock(pdev);
 	pdev->obj_state = WLAN_OBJ_STATE_LOGICALLY_DELETED;
 	wlan_pdev_obj_unlock(pdev);
+	/* Fold the per-CPU counts while the creation reference is still held */
+	wlan_objmgr_ref_ids_switch_to_atomic(&pdev->pdev_objmgr);
+	wlan_objmgr_ref_switch_to_atomic(&pdev->pdev_objmgr);
 	wlan_objmgr_notify_log_delete(pdev, WLAN_PDEV_OP);
 	wlan_objmgr_pdev_release_ref(pdev, WLAN_OBJMGR_ID);
 
@@ -660,8 +664,8 @@ void wlan_objmgr_pdev_get_ref(struct wlan_objmgr_pdev *pdev,
 		QDF_ASSERT(0);
 		return;
 	}
-	qdf_atomic_inc(&pdev->pdev_objmgr.ref_cnt);
-	qdf_atomic_inc(&pdev->pdev_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_inc(&pdev->pdev_objmgr);
+	wlan_objmgr_ref_id_inc(&pdev->pdev_objmgr, id);
 }
 
 qdf_export_symbol(wlan_objmgr_pdev_get_ref);
@@ -710,24 +714,24 @@ void wlan_objmgr_pdev_release_ref(struct wlan_objmgr_pdev *pdev,
 
 	pdev_id = wlan_objmgr_pdev_get_pdev_id(pdev);
 
-	if (!qdf_atomic_read(&pdev->pdev_objmgr.ref_id_dbg[id])) {
+	if (wlan_objmgr_ref_id_is_zero(&pdev->pdev_objmgr, id)) {
 		obj_mgr_err("pdev (id:%d)ref cnt was not taken by %d",
 			    pdev_id, id);
-		wlan_objmgr_print_ref_ids(pdev->pdev_objmgr.ref_id_dbg,
-					  QDF_TRACE_LEVEL_FATAL);
+		wlan_objmgr_print_obj_ref_ids(&pdev->pdev_objmgr,
+					      QDF_TRACE_LEVEL_FATAL);
 		WLAN_OBJMGR_BUG(0);
 		return;
 	}
 
-	if (!qdf_atomic_read(&pdev->pdev_objmgr.ref_cnt)) {
+	if (wlan_objmgr_ref_is_zero(&pdev->pdev_objmgr)) {
 		obj_mgr_err("pdev ref cnt is 0: pdev-id:%d", pdev_id);
 		WLAN_OBJMGR_BUG(0);
 		return;
 	}
 
-	qdf_atomic_dec(&pdev->pdev_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_id_dec(&pdev->pdev_objmgr, id);
 	/* Decrement ref count, free pdev, if ref count == 0 */
-	if (qdf_atomic_dec_and_test(&pdev->pdev_objmgr.ref_cnt))
+	if (wlan_objmgr_ref_dec_and_test(&pdev->pdev_objmgr))
 		wlan_objmgr_pdev_obj_destroy(pdev);
 }
 
@@ -1143,7 +1147,7 @@ void wlan_print_pdev_info(struct wlan_objmgr_pdev *pdev)
 	obj_mgr_debug("max_peer_count: %d", pdev_objmgr->max_peer_count);
 	obj_mgr_debug("temp_peer_count: %d", pdev_objmgr->temp_peer_count);
 	obj_mgr_debug("wlan_psoc: %pK", pdev_objmgr->wlan_psoc);
-	obj_mgr_debug("ref_cnt: %d", qdf_atomic_read(&pdev_objmgr->ref_cnt));
+	obj_mgr_debug("ref_cnt: %d", wlan_objmgr_ref_read(pdev_objmgr));
 
 	wlan_pdev_obj_lock(pdev);
 	vdev_list = &pdev_objmgr->wlan_vdev_list;
@@ -69,6 +69,37 @@ static QDF_STATUS wlan_objmgr_peer_object_status(
 	return status;
 }
 
+#ifdef WLAN_OBJMGR_PEER_RCU
+static void wlan_objmgr_peer_rcu_free(qdf_rcu_head_t *head)
+{
+	struct wlan_objmgr_peer *peer;
+
+	peer = qdf_container_of(head, struct wlan_objmgr_peer, rcu);
+	qdf_spinlock_destroy(&peer->peer_lock);
+	qdf_mem_free(peer);
+}
+
+/**
+ * wlan_objmgr_peer_mem_free() - Free peer memory once lookups are done
+ * @peer: PEER object, already detached from the PSOC peer list
+ *
+ * Lockless lookups may still hold a pointer to the peer and take peer_lock
+ * to check its state, so the memory is freed after an RCU grace period.
+ *
+ * Return: void
+ */
+static void wlan_objmgr_peer_mem_free(struct wlan_objmgr_peer *peer)
+{
+	qdf_call_rcu(&peer->rcu, wlan_objmgr_peer_rcu_free);
+}
+#else
+static void wlan_objmgr_peer_mem_free(struct wlan_objmgr_peer *peer)
+{
+	qdf_spinlock_destroy(&peer->peer_lock);
+	qdf_mem_free(peer);
+}
+#endif
+
 static QDF_STATUS wlan_objmgr_peer_obj_free(struct wlan_objmgr_peer *peer)
 {
 	struct wlan_objmgr_psoc *psoc;
@@ -136,8 +167,7 @@ static QDF_STATUS wlan_objmgr_peer_obj_free(struct wlan_objmgr_peer *peer)
 	}
 	wlan_objmgr_peer_trace_del_ref_list(peer);
 	wlan_objmgr_peer_trace_deinit_lock(peer);
-	qdf_spinlock_destroy(&peer->peer_lock);
-	qdf_mem_free(peer);
+	wlan_objmgr_peer_mem_free(peer);
 	peer = NULL;
 
 	if (peer_free_notify)
@@ -157,10 +187,20 @@ wlan_objmgr_peer_init_ref_id_debug(struct wlan_objmgr_peer *peer)
 
 	for (id = 0; id < WLAN_REF_ID_MAX; id++)
 		qdf_atomic_init(&peer->peer_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_ids_init(&peer->peer_objmgr);
+}
+
+static void
+wlan_objmgr_peer_switch_ref_id_debug(struct wlan_objmgr_peer *peer)
+{
+	wlan_objmgr_ref_ids_switch_to_atomic(&peer->peer_objmgr);
 }
 #else
 static inline void
 wlan_objmgr_peer_init_ref_id_debug(struct wlan_objmgr_peer *peer) {}
+
+static inline void
+wlan_objmgr_peer_switch_ref_id_debug(struct wlan_objmgr_peer *peer) {}
 #endif
 
 struct wlan_objmgr_peer *wlan_objmgr_peer_obj_create(
@@ -196,7 +236,7 @@ struct wlan_objmgr_peer *wlan_objmgr_peer_obj_create(
 		return NULL;
 
 	peer->obj_state = WLAN_OBJ_STATE_ALLOCATED;
-	qdf_atomic_init(&peer->peer_objmgr.ref_cnt);
+	wlan_objmgr_ref_init(&peer->peer_objmgr);
 	wlan_objmgr_peer_init_ref_id_debug(peer);
 	wlan_objmgr_peer_trace_init_lock(peer);
 	wlan_objmgr_peer_get_ref(peer, WLAN_OBJMGR_ID);
@@ -231,9 +271,8 @@ struct wlan_objmgr_peer *wlan_objmgr_peer_obj_create(
 				QDF_MAC_ADDR_REF(macaddr));
 		/* if attach fails, detach from psoc table before free */
 		wlan_objmgr_psoc_peer_detach(psoc, peer);
-		qdf_spinlock_destroy(&peer->peer_lock);
 		wlan_objmgr_peer_trace_deinit_lock(peer);
-		qdf_mem_free(peer);
+		wlan_objmgr_peer_mem_free(peer);
 		return NULL;
 	}
 	wlan_peer_set_pdev_id(peer, wlan_objmgr_pdev_get_pdev_id(
@@ -364,6 +403,9 @@ QDF_STATUS wlan_objmgr_peer_obj_delete(struct wlan_objmgr_peer *peer)
 	wlan_peer_obj_lock(peer);
 	peer->obj_state = WLAN_OBJ_STATE_LOGICALLY_DELETED;
 	wlan_peer_obj_unlock(peer);
+	/* Fold the per-CPU counts while the creation reference is still held */
+	wlan_objmgr_peer_switch_ref_id_debug(peer);
+	wlan_objmgr_ref_switch_to_atomic(&peer->peer_objmgr);
 	wlan_objmgr_notify_log_delete(peer, WLAN_PEER_OP);
 	wlan_objmgr_peer_release_ref(peer, WLAN_OBJMGR_ID);
 
@@ -604,7 +646,7 @@ static inline void
 wlan_objmgr_peer_get_debug_id_ref(struct wlan_objmgr_peer *peer,
 				  wlan_objmgr_ref_dbgid id)
 {
-	qdf_atomic_inc(&peer->peer_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_id_inc(&peer->peer_objmgr, id);
 }
 #else
 static inline void
@@ -617,20 +659,20 @@ static QDF_STATUS
 wlan_objmgr_peer_release_debug_id_ref(struct wlan_objmgr_peer *peer,
 				      wlan_objmgr_ref_dbgid id)
 {
-	if (!qdf_atomic_read(&peer->peer_objmgr.ref_id_dbg[id])) {
+	if (wlan_objmgr_ref_id_is_zero(&peer->peer_objmgr, id)) {
 		uint8_t *macaddr;
 
 		macaddr = wlan_peer_get_macaddr(peer);
 		obj_mgr_err(
 		"peer("QDF_MAC_ADDR_FMT") ref was not taken by %d",
 			QDF_MAC_ADDR_REF(macaddr), id);
-		wlan_objmgr_print_ref_ids(peer->peer_objmgr.ref_id_dbg,
-					  QDF_TRACE_LEVEL_FATAL);
+		wlan_objmgr_print_obj_ref_ids(&peer->peer_objmgr,
+					      QDF_TRACE_LEVEL_FATAL);
 		WLAN_OBJMGR_BUG(0);
 		return QDF_STATUS_E_FAILURE;
 	}
 
-	qdf_atomic_dec(&peer->peer_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_id_dec(&peer->peer_objmgr, id);
 	return QDF_STATUS_SUCCESS;
 }
 #else
@@ -682,7 +724,7 @@ void wlan_objmgr_peer_get_ref_debug(struct wlan_objmgr_peer *peer,
 		return;
 	}
 	/* Increment ref count */
-	qdf_atomic_inc(&peer->peer_objmgr.ref_cnt);
+	wlan_objmgr_ref_inc(&peer->peer_objmgr);
 	wlan_objmgr_peer_get_debug_id_ref(peer, id);
 
 	wlan_objmgr_peer_ref_trace(peer, id, func, line);
@@ -700,7 +742,7 @@ void wlan_objmgr_peer_get_ref(struct wlan_objmgr_peer *peer,
 		return;
 	}
 	/* Increment ref count */
-	qdf_atomic_inc(&peer->peer_objmgr.ref_cnt);
+	wlan_objmgr_ref_inc(&peer->peer_objmgr);
 	wlan_objmgr_peer_get_debug_id_ref(peer, id);
 }
 
@@ -1187,7 +1229,7 @@ void wlan_objmgr_peer_release_ref_debug(struct wlan_objmgr_peer *peer,
 		return;
 	}
 
-	if (!qdf_atomic_read(&peer->peer_objmgr.ref_cnt)) {
+	if (wlan_objmgr_ref_is_zero(&peer->peer_objmgr)) {
 		uint8_t *macaddr;
 
 		macaddr = wlan_peer_get_macaddr(peer);
@@ -1207,7 +1249,7 @@ void wlan_objmgr_peer_release_ref_debug(struct wlan_objmgr_peer *peer,
 	 */
 	wlan_peer_obj_lock(peer);
 	/* Decrement ref count, free peer object, if ref count == 0 */
-	if (qdf_atomic_dec_and_test(&peer->peer_objmgr.ref_cnt)) {
+	if (wlan_objmgr_ref_dec_and_test(&peer->peer_objmgr)) {
 		wlan_peer_obj_unlock(peer);
 		wlan_objmgr_peer_obj_destroy(peer);
 	} else {
@@ -1230,7 +1272,7 @@ void wlan_objmgr_peer_release_ref(struct wlan_objmgr_peer *peer,
 		return;
 	}
 
-	if (!qdf_atomic_read(&peer->peer_objmgr.ref_cnt)) {
+	if (wlan_objmgr_ref_is_zero(&peer->peer_objmgr)) {
 		uint8_t *macaddr;
 
 		macaddr = wlan_peer_get_macaddr(peer);
@@ -1249,7 +1291,7 @@ void wlan_objmgr_peer_release_ref(struct wlan_objmgr_peer *peer,
 	 */
 	wlan_peer_obj_lock(peer);
 	/* Decrement ref count, free peer object, if ref count == 0 */
-	if (qdf_atomic_dec_and_test(&peer->peer_objmgr.ref_cnt)) {
+	if (wlan_objmgr_ref_dec_and_test(&peer->peer_objmgr)) {
 		wlan_peer_obj_unlock(peer);
 		wlan_objmgr_peer_obj_destroy(peer);
 	} else {
@@ -1265,14 +1307,14 @@ void
 wlan_objmgr_print_peer_ref_ids(struct wlan_objmgr_peer *peer,
 			       QDF_TRACE_LEVEL log_level)
 {
-	wlan_objmgr_print_ref_ids(peer->peer_objmgr.ref_id_dbg, log_level);
+	wlan_objmgr_print_obj_ref_ids(&peer->peer_objmgr, log_level);
 }
 
 uint32_t
 wlan_objmgr_peer_get_comp_ref_cnt(struct wlan_objmgr_peer *peer,
 				  enum wlan_umac_comp_id id)
 {
-	return qdf_atomic_read(&peer->peer_objmgr.ref_id_dbg[id]);
+	return wlan_objmgr_ref_id_read(&peer->peer_objmgr, id);
 }
 #else
 void
@@ -1281,7 +1323,7 @@ wlan_objmgr_print_peer_ref_ids(struct wlan_objmgr_peer *peer,
 {
 	uint32_t pending_ref;
 
-	pending_ref = qdf_atomic_read(&peer->peer_objmgr.ref_cnt);
+	pending_ref = wlan_objmgr_ref_read(&peer->peer_objmgr);
 	obj_mgr_log_level(log_level, "Pending refs -- %d", pending_ref);
 }
 
@@ -1331,6 +1373,10 @@ QDF_STATUS wlan_peer_update_macaddr(struct wlan_objmgr_peer *peer,
 		return status;
 	}
 
+#ifdef WLAN_OBJMGR_PEER_RCU
+	/* lockless lookups may still be walking the old hash bucket */
+	qdf_synchronize_rcu();
+#endif
 	wlan_peer_set_macaddr(peer, new_macaddr);
 
 	status = wlan_objmgr_psoc_peer_attach(psoc, peer);
@@ -420,9 +420,7 @@ QDF_STATUS wlan_objmgr_iterate_obj_list(
 		wlan_objmgr_ref_dbgid dbg_id)
 {
 	uint16_t obj_id;
-	uint8_t i;
-	struct wlan_objmgr_psoc_objmgr *objmgr = &psoc->soc_objmgr;
-	struct wlan_peer_list *peer_list;
+	qdf_list_t *vdev_peers;
 	struct wlan_objmgr_pdev *pdev;
 	struct wlan_objmgr_vdev *vdev;
 	struct wlan_objmgr_peer *peer;
@@ -453,21 +451,33 @@ QDF_STATUS wlan_objmgr_iterate_obj_list(
 		}
 		break;
 	case WLAN_PEER_OP:
-		/* Iterate through PEER list, invoke handler for each peer */
-		peer_list = &objmgr->peer_list;
-		/* Since peer list has sublist, iterate through sublists */
-		for (i = 0; i < WLAN_PEER_HASHSIZE; i++) {
-			peer = wlan_psoc_peer_list_peek_active_head(peer_list,
-					i, dbg_id);
+		/*
+		 * Iterate through the peer list of each vdev rather than the
+		 * psoc hash, so that the walk doesn't take the psoc wide peer
+		 * list lock, which MAC lookups and peer attach/detach contend
+		 * on.
+		 */
+		max_vdev_cnt = wlan_psoc_get_max_vdev_count(psoc);
+		for (obj_id = 0; obj_id < max_vdev_cnt; obj_id++) {
+			vdev = wlan_objmgr_get_vdev_by_id_from_psoc_no_state(
+					psoc, obj_id, dbg_id);
+			if (!vdev)
+				continue;
+
+			vdev_peers = &vdev->vdev_objmgr.wlan_peer_list;
+			peer = wlan_vdev_peer_list_peek_active_head(vdev,
+								    vdev_peers,
+								    dbg_id);
 			while (peer) {
 				handler(psoc, (void *)peer, arg);
 				/* Get next peer */
 				peer_next =
-					wlan_peer_get_next_active_peer_of_psoc(
-						peer_list, i, peer, dbg_id);
-				wlan_objmgr_peer_release_ref(peer,  dbg_id);
+					wlan_peer_get_next_active_peer_of_vdev(
+						vdev, vdev_peers, peer, dbg_id);
+				wlan_objmgr_peer_release_ref(peer, dbg_id);
 				peer = peer_next;
 			}
+			wlan_objmgr_vdev_release_ref(vdev, dbg_id);
 		}
 		break;
 	default:
@@ -1310,12 +1320,34 @@ struct wlan_objmgr_vdev *wlan_objmgr_get_vdev_by_macaddr_from_psoc_no_state(
 qdf_export_symbol(wlan_objmgr_get_vdev_by_macaddr_from_psoc_no_state);
 #endif
 
+#ifdef WLAN_OBJMGR_PEER_RCU
+static void wlan_obj_psoc_peerlist_add_tail(qdf_list_t *obj_list,
+				struct wlan_objmgr_peer *obj)
+{
+	qdf_list_insert_back_rcu(obj_list, &obj->psoc_peer);
+}
+
+static inline QDF_STATUS
+wlan_obj_psoc_peerlist_remove_node(qdf_list_t *obj_list,
+				   qdf_list_node_t *psoc_node)
+{
+	return qdf_list_remove_node_rcu(obj_list, psoc_node);
+}
+#else
 static void wlan_obj_psoc_peerlist_add_tail(qdf_list_t *obj_list,
 				struct wlan_objmgr_peer *obj)
 {
 	qdf_list_insert_back(obj_list, &obj->psoc_peer);
 }
 
+static inline QDF_STATUS
+wlan_obj_psoc_peerlist_remove_node(qdf_list_t *obj_list,
+				   qdf_list_node_t *psoc_node)
+{
+	return qdf_list_remove_node(obj_list, psoc_node);
+}
+#endif
+
 static QDF_STATUS wlan_obj_psoc_peerlist_remove_peer(
 				qdf_list_t *obj_list,
 				struct wlan_objmgr_peer *peer)
@@ -1327,7 +1359,8 @@ static QDF_STATUS wlan_obj_psoc_peerlist_remove_peer(
 	/* get vdev list node element */
 	psoc_node = &peer->psoc_peer;
 	/* list is empty, return failure */
-	if (qdf_list_remove_node(obj_list, psoc_node) != QDF_STATUS_SUCCESS)
+	if (wlan_obj_psoc_peerlist_remove_node(obj_list, psoc_node) !=
+	    QDF_STATUS_SUCCESS)
 		return QDF_STATUS_E_FAILURE;
 
 	return QDF_STATUS_SUCCESS;
@@ -1345,6 +1378,81 @@ static QDF_STATUS wlan_peer_bssid_match(struct wlan_objmgr_peer *peer,
 		return QDF_STATUS_E_FAILURE;
 }
 
+#ifdef WLAN_OBJMGR_PEER_RCU
+static inline QDF_STATUS
+wlan_obj_psoc_peer_rcu_try_get_ref(struct wlan_objmgr_peer *peer,
+				   wlan_objmgr_ref_dbgid dbg_id,
+				   const char *func, int line)
+{
+#ifdef WLAN_OBJMGR_REF_ID_TRACE
+	return wlan_objmgr_peer_try_get_ref_debug(peer, dbg_id, func, line);
+#else
+	return wlan_objmgr_peer_try_get_ref(peer, dbg_id);
+#endif
+}
+
+/**
+ * wlan_obj_psoc_peerlist_get_peer_rcu() - lockless lookup of an active peer
+ * @psoc: PSOC object
+ * @macaddr: MAC address
+ * @match_pdev: match @pdev_id as well
+ * @pdev_id: pdev (link) id of the peer
+ * @bssid: BSSID of the peer's vdev to match, NULL to skip the check
+ * @dbg_id: id of the caller
+ * @func: caller function name, used for ref id trace
+ * @line: caller line number, used for ref id trace
+ *
+ * Walks the MAC hash bucket under RCU, without the psoc lock or the peer list
+ * lock. Peers are freed after a grace period, so a peer seen here can be
+ * safely inspected, and wlan_objmgr_peer_try_get_ref() only succeeds for peers
+ * that still hold their creation reference. The vdev of a peer is only stable
+ * once the reference is held, so the BSSID is matched after taking it.
+ *
+ * Return: peer pointer with a reference taken for @dbg_id
+ *         NULL on FAILURE
+ */
+static struct wlan_objmgr_peer *
+wlan_obj_psoc_peerlist_get_peer_rcu(struct wlan_objmgr_psoc *psoc,
+				    uint8_t *macaddr, bool match_pdev,
+				    uint8_t pdev_id, uint8_t *bssid,
+				    wlan_objmgr_ref_dbgid dbg_id,
+				    const char *func, int line)
+{
+	struct wlan_peer_list *peer_list = &psoc->soc_objmgr.peer_list;
+	qdf_list_t *obj_list;
+	struct wlan_objmgr_peer *peer;
+
+	obj_list = &peer_list->peer_hash[WLAN_PEER_HASH(macaddr)];
+
+	qdf_rcu_read_lock();
+	qdf_list_for_each_rcu(obj_list, peer, psoc_peer) {
+		if (WLAN_ADDR_EQ(wlan_peer_get_macaddr(peer), macaddr) !=
+		    QDF_STATUS_SUCCESS)
+			continue;
+
+		if (match_pdev && wlan_peer_get_pdev_id(peer) != pdev_id)
+			continue;
+
+		if (wlan_obj_psoc_peer_rcu_try_get_ref(peer, dbg_id, func,
+						       line) !=
+		    QDF_STATUS_SUCCESS)
+			continue;
+
+		if (bssid &&
+		    wlan_peer_bssid_match(peer, bssid) != QDF_STATUS_SUCCESS) {
+			wlan_objmgr_peer_release_ref(peer, dbg_id);
+			continue;
+		}
+
+		qdf_rcu_read_unlock();
+		return peer;
+	}
+	qdf_rcu_read_unlock();
+
+	return NULL;
+}
+#endif
+
 /**
  * wlan_obj_psoc_peerlist_get_peer_by_pdev_id() - get peer from
  *                                                      psoc peer list
@@ -1428,7 +1536,9 @@ static struct wlan_objmgr_peer *wlan_obj_psoc_peerlist_get_peer_by_pdev_id(
  * Return: peer pointer
  *         NULL on FAILURE
  */
-#ifdef WLAN_OBJMGR_REF_ID_TRACE
+#ifdef WLAN_OBJMGR_PEER_RCU
+/* active lookups use wlan_obj_psoc_peerlist_get_peer_rcu() */
+#elif defined(WLAN_OBJMGR_REF_ID_TRACE)
 static struct wlan_objmgr_peer *wlan_obj_psoc_peerlist_get_peer_debug(
 		qdf_list_t *obj_list, uint8_t *macaddr,
 		wlan_objmgr_ref_dbgid dbg_id,
@@ -1659,7 +1769,9 @@ static struct wlan_objmgr_peer
  * Return: peer pointer
  *         NULL on FAILURE
  */
-#ifdef WLAN_OBJMGR_REF_ID_TRACE
+#ifdef WLAN_OBJMGR_PEER_RCU
+/* active lookups use wlan_obj_psoc_peerlist_get_peer_rcu() */
+#elif defined(WLAN_OBJMGR_REF_ID_TRACE)
 static struct wlan_objmgr_peer
 		*wlan_obj_psoc_peerlist_get_peer_by_mac_n_bssid_debug(
 					qdf_list_t *obj_list, uint8_t *macaddr,
@@ -2073,7 +2185,44 @@ QDF_STATUS wlan_objmgr_psoc_peer_detach(struct wlan_objmgr_psoc *psoc,
 	return QDF_STATUS_SUCCESS;
 }
 
+#ifdef WLAN_OBJMGR_PEER_RCU
 #ifdef WLAN_OBJMGR_REF_ID_TRACE
+struct wlan_objmgr_peer *wlan_objmgr_get_peer_debug(
+			struct wlan_objmgr_psoc *psoc, uint8_t pdev_id,
+			uint8_t *macaddr, wlan_objmgr_ref_dbgid dbg_id,
+			const char *func, int line)
+{
+	if (pdev_id >= WLAN_UMAC_MAX_PDEVS)
+		QDF_ASSERT(0);
+
+	if (!macaddr)
+		return NULL;
+
+	return wlan_obj_psoc_peerlist_get_peer_rcu(psoc, macaddr,
+						   true, pdev_id, NULL,
+						   dbg_id, func, line);
+}
+
+qdf_export_symbol(wlan_objmgr_get_peer_debug);
+#else
+struct wlan_objmgr_peer *wlan_objmgr_get_peer(
+			struct wlan_objmgr_psoc *psoc, uint8_t pdev_id,
+			uint8_t *macaddr, wlan_objmgr_ref_dbgid dbg_id)
+{
+	if (pdev_id >= WLAN_UMAC_MAX_PDEVS)
+		QDF_ASSERT(0);
+
+	if (!macaddr)
+		return NULL;
+
+	return wlan_obj_psoc_peerlist_get_peer_rcu(psoc, macaddr,
+						   true, pdev_id, NULL,
+						   dbg_id, NULL, 0);
+}
+
+qdf_export_symbol(wlan_objmgr_get_peer);
+#endif
+#elif defined(WLAN_OBJMGR_REF_ID_TRACE)
 struct wlan_objmgr_peer *wlan_objmgr_get_peer_debug(
 			struct wlan_objmgr_psoc *psoc, uint8_t pdev_id,
 			uint8_t *macaddr, wlan_objmgr_ref_dbgid dbg_id,
@@ -2153,7 +2302,38 @@ struct wlan_objmgr_peer *wlan_objmgr_get_peer(
 qdf_export_symbol(wlan_objmgr_get_peer);
 #endif
 
+#ifdef WLAN_OBJMGR_PEER_RCU
 #ifdef WLAN_OBJMGR_REF_ID_TRACE
+struct wlan_objmgr_peer *wlan_objmgr_get_peer_by_mac_debug(
+		struct wlan_objmgr_psoc *psoc, uint8_t *macaddr,
+		wlan_objmgr_ref_dbgid dbg_id,
+		const char *func, int line)
+{
+	if (!macaddr)
+		return NULL;
+
+	return wlan_obj_psoc_peerlist_get_peer_rcu(psoc, macaddr,
+						   false, 0, NULL,
+						   dbg_id, func, line);
+}
+
+qdf_export_symbol(wlan_objmgr_get_peer_by_mac_debug);
+#else
+struct wlan_objmgr_peer *wlan_objmgr_get_peer_by_mac(
+		struct wlan_objmgr_psoc *psoc, uint8_t *macaddr,
+		wlan_objmgr_ref_dbgid dbg_id)
+{
+	if (!macaddr)
+		return NULL;
+
+	return wlan_obj_psoc_peerlist_get_peer_rcu(psoc, macaddr,
+						   false, 0, NULL,
+						   dbg_id, NULL, 0);
+}
+
+qdf_export_symbol(wlan_objmgr_get_peer_by_mac);
+#endif
+#elif defined(WLAN_OBJMGR_REF_ID_TRACE)
 struct wlan_objmgr_peer *wlan_objmgr_get_peer_by_mac_debug(
 		struct wlan_objmgr_psoc *psoc, uint8_t *macaddr,
 		wlan_objmgr_ref_dbgid dbg_id,
@@ -2362,7 +2542,40 @@ struct wlan_objmgr_peer *wlan_objmgr_get_peer_by_mac_n_vdev_no_state(
 qdf_export_symbol(wlan_objmgr_get_peer_by_mac_n_vdev_no_state);
 #endif
 
+#ifdef WLAN_OBJMGR_PEER_RCU
 #ifdef WLAN_OBJMGR_REF_ID_TRACE
+struct wlan_objmgr_peer *wlan_objmgr_get_peer_by_mac_n_vdev_debug(
+			struct wlan_objmgr_psoc *psoc, uint8_t pdev_id,
+			uint8_t *bssid, uint8_t *macaddr,
+			wlan_objmgr_ref_dbgid dbg_id,
+			const char *func, int line)
+{
+	if (!macaddr || !bssid)
+		return NULL;
+
+	return wlan_obj_psoc_peerlist_get_peer_rcu(psoc, macaddr,
+						   true, pdev_id, bssid,
+						   dbg_id, func, line);
+}
+
+qdf_export_symbol(wlan_objmgr_get_peer_by_mac_n_vdev_debug);
+#else
+struct wlan_objmgr_peer *wlan_objmgr_get_peer_by_mac_n_vdev(
+			struct wlan_objmgr_psoc *psoc, uint8_t pdev_id,
+			uint8_t *bssid, uint8_t *macaddr,
+			wlan_objmgr_ref_dbgid dbg_id)
+{
+	if (!macaddr || !bssid)
+		return NULL;
+
+	return wlan_obj_psoc_peerlist_get_peer_rcu(psoc, macaddr,
+						   true, pdev_id, bssid,
+						   dbg_id, NULL, 0);
+}
+
+qdf_export_symbol(wlan_objmgr_get_peer_by_mac_n_vdev);
+#endif
+#elif defined(WLAN_OBJMGR_REF_ID_TRACE)
 struct wlan_objmgr_peer *wlan_objmgr_get_peer_by_mac_n_vdev_debug(
 			struct wlan_objmgr_psoc *psoc, uint8_t pdev_id,
 			uint8_t *bssid, uint8_t *macaddr,
@@ -2787,8 +3000,8 @@ static void wlan_objmgr_psoc_vdev_ref_print(struct wlan_objmgr_psoc *psoc,
 	wlan_vdev_obj_unlock(vdev);
 	obj_mgr_alert("Vdev ID is %d, state %d", id, obj_state);
 
-	wlan_objmgr_print_ref_ids(vdev->vdev_objmgr.ref_id_dbg,
-				  QDF_TRACE_LEVEL_FATAL);
+	wlan_objmgr_print_obj_ref_ids(&vdev->vdev_objmgr,
+				      QDF_TRACE_LEVEL_FATAL);
 }
 
 static void wlan_objmgr_psoc_pdev_ref_print(struct wlan_objmgr_psoc *psoc,
@@ -2802,8 +3015,8 @@ static void wlan_objmgr_psoc_pdev_ref_print(struct wlan_objmgr_psoc *psoc,
 	wlan_pdev_obj_unlock(pdev);
 	obj_mgr_alert("pdev ID is %d", id);
 
-	wlan_objmgr_print_ref_ids(pdev->pdev_objmgr.ref_id_dbg,
-				  QDF_TRACE_LEVEL_FATAL);
+	wlan_objmgr_print_obj_ref_ids(&pdev->pdev_objmgr,
+				      QDF_TRACE_LEVEL_FATAL);
 }
 
 QDF_STATUS wlan_objmgr_print_ref_all_objects_per_psoc(
@@ -2868,13 +3081,11 @@ uint32_t wlan_objmgr_psoc_check_for_pdev_leaks(struct wlan_objmgr_psoc *psoc)
 	obj_mgr_alert("----------------------------------------------------");
 
 	wlan_objmgr_for_each_psoc_pdev(psoc, pdev_id, pdev) {
-		qdf_atomic_t *ref_id_dbg;
 		int ref_id;
 		int32_t refs;
 
 		wlan_pdev_obj_lock(pdev);
-		ref_id_dbg = pdev->pdev_objmgr.ref_id_dbg;
-		wlan_objmgr_for_each_refs(ref_id_dbg, ref_id, refs) {
+		wlan_objmgr_for_each_refs(&pdev->pdev_objmgr, ref_id, refs) {
 			leaks++;
 			obj_mgr_alert("%7u   %4u   %s(%d)",
 				      pdev_id, refs,
@@ -2913,13 +3124,11 @@ uint32_t wlan_objmgr_psoc_check_for_vdev_leaks(struct wlan_objmgr_psoc *psoc)
 	obj_mgr_alert("----------------------------------------------------");
 
 	wlan_objmgr_for_each_psoc_vdev(psoc, vdev_id, vdev) {
-		qdf_atomic_t *ref_id_dbg;
 		int ref_id;
 		int32_t refs;
 
 		wlan_vdev_obj_lock(vdev);
-		ref_id_dbg = vdev->vdev_objmgr.ref_id_dbg;
-		wlan_objmgr_for_each_refs(ref_id_dbg, ref_id, refs) {
+		wlan_objmgr_for_each_refs(&vdev->vdev_objmgr, ref_id, refs) {
 			leaks++;
 			obj_mgr_alert("%7u   %4u   %s(%d)",
 				      vdev_id, refs, string_from_dbgid(ref_id),
@@ -2937,12 +3146,10 @@ qdf_export_symbol(wlan_objmgr_psoc_check_for_vdev_leaks);
 static void
 wlan_objmgr_print_peer_ref_leaks(struct wlan_objmgr_peer *peer, int vdev_id)
 {
-	qdf_atomic_t *ref_id_dbg;
 	int32_t refs;
 	int ref_id;
 
-	ref_id_dbg = peer->peer_objmgr.ref_id_dbg;
-	wlan_objmgr_for_each_refs(ref_id_dbg, ref_id, refs) {
+	wlan_objmgr_for_each_refs(&peer->peer_objmgr, ref_id, refs) {
 		obj_mgr_alert(QDF_MAC_ADDR_FMT " %7u   %4u   %s(%d)",
 			      QDF_MAC_ADDR_REF(peer->macaddr),
 			      vdev_id,
@@ -2957,7 +3164,7 @@ wlan_objmgr_print_peer_ref_leaks(struct wlan_objmgr_peer *peer, int vdev_id)
 	obj_mgr_alert(QDF_MAC_ADDR_FMT " %7u   %4u   %s",
 		      QDF_MAC_ADDR_REF(peer->macaddr),
 		      vdev_id,
-		      qdf_atomic_read(&peer->peer_objmgr.ref_cnt),
+		      wlan_objmgr_ref_read(&peer->peer_objmgr),
 		      "TOTAL_REF_COUNT");
 }
 #endif
@@ -2992,7 +3199,7 @@ uint32_t wlan_objmgr_psoc_check_for_peer_leaks(struct wlan_objmgr_psoc *psoc)
 		wlan_vdev_obj_lock(vdev);
 		wlan_objmgr_for_each_vdev_peer(vdev, peer) {
 			wlan_peer_obj_lock(peer);
-			leaks += qdf_atomic_read(&peer->peer_objmgr.ref_cnt);
+			leaks += wlan_objmgr_ref_read(&peer->peer_objmgr);
 			wlan_objmgr_print_peer_ref_leaks(peer, vdev_id);
 			wlan_peer_obj_unlock(peer);
 		}
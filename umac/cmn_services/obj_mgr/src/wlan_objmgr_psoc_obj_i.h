@@ -48,17 +48,17 @@
 		if ((vdev = (psoc)->soc_objmgr.wlan_vdev_list[vdev_id]))
 
 /**
- * wlan_objmgr_for_each_refs() - iterate non-zero ref counts in @ref_id_dbg
- * @ref_id_dbg: the ref count array to iterate
+ * wlan_objmgr_for_each_refs() - iterate non-zero ref counts of @objmgr
+ * @objmgr: the objmgr sub structure (pdev, vdev or peer) to iterate
  * @ref_id: the reference Id index cursor
  * @refs: the ref count cursor
  *
- * Note: The caller is responsible for grabbing @ref_id_dbg's parent object lock
+ * Note: The caller is responsible for grabbing @objmgr's parent object lock
  * before using this iterator
  */
-#define wlan_objmgr_for_each_refs(ref_id_dbg, ref_id, refs) \
+#define wlan_objmgr_for_each_refs(objmgr, ref_id, refs) \
 	for (ref_id = 0; ref_id < WLAN_REF_ID_MAX; ref_id++) \
-		if ((refs = qdf_atomic_read(&(ref_id_dbg)[ref_id])) > 0)
+		if ((refs = wlan_objmgr_ref_id_read(objmgr, ref_id)) > 0)
 
 /**
  * wlan_objmgr_psoc_pdev_attach() - store pdev in psoc's pdev list
@@ -220,7 +220,8 @@ struct wlan_objmgr_vdev *wlan_objmgr_vdev_obj_create(
 
 	/* peer count to 0 */
 	vdev->vdev_objmgr.wlan_peer_count = 0;
-	qdf_atomic_init(&vdev->vdev_objmgr.ref_cnt);
+	wlan_objmgr_ref_init(&vdev->vdev_objmgr);
+	wlan_objmgr_ref_ids_init(&vdev->vdev_objmgr);
 	vdev->vdev_objmgr.print_cnt = 0;
 	wlan_objmgr_vdev_get_ref(vdev, WLAN_OBJMGR_ID);
 	/* Initialize max peer count based on opmode type */
@@ -361,8 +362,8 @@ QDF_STATUS wlan_objmgr_vdev_obj_delete(struct wlan_objmgr_vdev *vdev)
 	obj_mgr_debug("Logically deleting vdev %d", vdev->vdev_objmgr.vdev_id);
 
 	print_idx = qdf_get_pidx();
-	wlan_objmgr_print_ref_ids(vdev->vdev_objmgr.ref_id_dbg,
-				  QDF_TRACE_LEVEL_DEBUG);
+	wlan_objmgr_print_obj_ref_ids(&vdev->vdev_objmgr,
+				      QDF_TRACE_LEVEL_DEBUG);
 	/*
 	 * Update VDEV object state to LOGICALLY DELETED
 	 * It prevents further access of this object
@@ -370,6 +371,9 @@ QDF_STATUS wlan_objmgr_vdev_obj_delete(struct wlan_objmgr_vdev *vdev)
 	wlan_vdev_obj_lock(vdev);
 	vdev->obj_state = WLAN_OBJ_STATE_LOGICALLY_DELETED;
 	wlan_vdev_obj_unlock(vdev);
+	/* Fold the per-CPU counts while the creation reference is still held */
+	wlan_objmgr_ref_ids_switch_to_atomic(&vdev->vdev_objmgr);
+	wlan_objmgr_ref_switch_to_atomic(&vdev->vdev_objmgr);
 	wlan_objmgr_notify_log_delete(vdev, WLAN_VDEV_OP);
 	wlan_objmgr_vdev_release_ref(vdev, WLAN_OBJMGR_ID);
 
@@ -1043,8 +1047,8 @@ void wlan_objmgr_vdev_get_ref_debug(struct wlan_objmgr_vdev *vdev,
 		return;
 	}
 	/* Increment ref count */
-	qdf_atomic_inc(&vdev->vdev_objmgr.ref_cnt);
-	qdf_atomic_inc(&vdev->vdev_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_inc(&vdev->vdev_objmgr);
+	wlan_objmgr_ref_id_inc(&vdev->vdev_objmgr, id);
 
 	wlan_objmgr_vdev_ref_trace(vdev, id, func, line);
 	return;
@@ -1061,8 +1065,8 @@ void wlan_objmgr_vdev_get_ref(struct wlan_objmgr_vdev *vdev,
 		return;
 	}
 	/* Increment ref count */
-	qdf_atomic_inc(&vdev->vdev_objmgr.ref_cnt);
-	qdf_atomic_inc(&vdev->vdev_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_inc(&vdev->vdev_objmgr);
+	wlan_objmgr_ref_id_inc(&vdev->vdev_objmgr, id);
 }
 
 qdf_export_symbol(wlan_objmgr_vdev_get_ref);
@@ -1321,25 +1325,25 @@ void wlan_objmgr_vdev_release_ref_debug(struct wlan_objmgr_vdev *vdev,
 
 	vdev_id = wlan_vdev_get_id(vdev);
 
-	if (!qdf_atomic_read(&vdev->vdev_objmgr.ref_id_dbg[id])) {
+	if (wlan_objmgr_ref_id_is_zero(&vdev->vdev_objmgr, id)) {
 		obj_mgr_alert("vdev (id:%d)ref cnt was not taken by %d",
 			      vdev_id, id);
-		wlan_objmgr_print_ref_ids(vdev->vdev_objmgr.ref_id_dbg,
-					  QDF_TRACE_LEVEL_FATAL);
+		wlan_objmgr_print_obj_ref_ids(&vdev->vdev_objmgr,
+					      QDF_TRACE_LEVEL_FATAL);
 		WLAN_OBJMGR_BUG(0);
 		return;
 	}
 
-	if (!qdf_atomic_read(&vdev->vdev_objmgr.ref_cnt)) {
+	if (wlan_objmgr_ref_is_zero(&vdev->vdev_objmgr)) {
 		obj_mgr_alert("vdev ref cnt is 0");
 		WLAN_OBJMGR_BUG(0);
 		return;
 	}
-	qdf_atomic_dec(&vdev->vdev_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_id_dec(&vdev->vdev_objmgr, id);
 	wlan_objmgr_vdev_deref_trace(vdev, id, func, line);
 
 	/* Decrement ref count, free vdev, if ref count == 0 */
-	if (qdf_atomic_dec_and_test(&vdev->vdev_objmgr.ref_cnt))
+	if (wlan_objmgr_ref_dec_and_test(&vdev->vdev_objmgr))
 		wlan_objmgr_vdev_obj_destroy(vdev);
 }
 
@@ -1358,24 +1362,24 @@ void wlan_objmgr_vdev_release_ref(struct wlan_objmgr_vdev *vdev,
 
 	vdev_id = wlan_vdev_get_id(vdev);
 
-	if (!qdf_atomic_read(&vdev->vdev_objmgr.ref_id_dbg[id])) {
+	if (wlan_objmgr_ref_id_is_zero(&vdev->vdev_objmgr, id)) {
 		obj_mgr_alert("vdev (id:%d)ref cnt was not taken by %d",
 			      vdev_id, id);
-		wlan_objmgr_print_ref_ids(vdev->vdev_objmgr.ref_id_dbg,
-					  QDF_TRACE_LEVEL_FATAL);
+		wlan_objmgr_print_obj_ref_ids(&vdev->vdev_objmgr,
+					      QDF_TRACE_LEVEL_FATAL);
 		WLAN_OBJMGR_BUG(0);
 		return;
 	}
 
-	if (!qdf_atomic_read(&vdev->vdev_objmgr.ref_cnt)) {
+	if (wlan_objmgr_ref_is_zero(&vdev->vdev_objmgr)) {
 		obj_mgr_alert("vdev ref cnt is 0");
 		WLAN_OBJMGR_BUG(0);
 		return;
 	}
-	qdf_atomic_dec(&vdev->vdev_objmgr.ref_id_dbg[id]);
+	wlan_objmgr_ref_id_dec(&vdev->vdev_objmgr, id);
 
 	/* Decrement ref count, free vdev, if ref count == 0 */
-	if (qdf_atomic_dec_and_test(&vdev->vdev_objmgr.ref_cnt))
+	if (wlan_objmgr_ref_dec_and_test(&vdev->vdev_objmgr))
 		wlan_objmgr_vdev_obj_destroy(vdev);
 }
 
@@ -1390,7 +1394,7 @@ void wlan_print_vdev_info(struct wlan_objmgr_vdev *vdev)
 
 	vdev_objmgr = &vdev->vdev_objmgr;
 
-	ref_cnt = qdf_atomic_read(&vdev_objmgr->ref_cnt);
+	ref_cnt = wlan_objmgr_ref_read(vdev_objmgr);
 
 	obj_mgr_debug("vdev: %pK", vdev);
 	obj_mgr_debug("vdev_id: %d", vdev_objmgr->vdev_id);
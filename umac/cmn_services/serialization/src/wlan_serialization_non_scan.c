@@ -551,6 +551,9 @@ wlan_ser_cancel_non_scan_cmd(
 	wlan_serialization_acquire_lock(&pdev_q->pdev_queue_lock);
 
 	qsize = wlan_serialization_list_size(pdev_queue);
+	if (!wlan_serialization_queue_may_match(pdev_queue, cmd, vdev))
+		qsize = 0;
+
 	while (!wlan_serialization_list_empty(pdev_queue) && qsize--) {
 		if (wlan_serialization_get_cmd_from_queue(pdev_queue, &nnode)
 		    != QDF_STATUS_SUCCESS) {
@@ -655,6 +658,8 @@ wlan_ser_cancel_non_scan_cmd(
 		pdev_status =
 			wlan_serialization_remove_node(pdev_queue,
 						       &cmd_list->pdev_node);
+		if (pdev_status == QDF_STATUS_SUCCESS)
+			wlan_serialization_unindex_cmd(cmd_list);
 
 		ser_vdev_obj = wlan_serialization_get_vdev_obj(
 					cmd_list->cmd.vdev);
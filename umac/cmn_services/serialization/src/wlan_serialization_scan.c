@@ -193,6 +193,9 @@ wlan_ser_cancel_scan_cmd(
 	wlan_serialization_acquire_lock(&pdev_q->pdev_queue_lock);
 
 	qsize = wlan_serialization_list_size(queue);
+	if (!wlan_serialization_queue_may_match(queue, cmd, vdev))
+		qsize = 0;
+
 	while (!wlan_serialization_list_empty(queue) && qsize--) {
 		if (wlan_serialization_get_cmd_from_queue(
 					queue, &nnode) != QDF_STATUS_SUCCESS) {
@@ -283,6 +286,8 @@ wlan_ser_cancel_scan_cmd(
 			break;
 		}
 
+		wlan_serialization_unindex_cmd(cmd_list);
+
 		qdf_mem_zero(&cmd_list->cmd,
 			     sizeof(struct wlan_serialization_command));
 		cmd_list->cmd_in_use = 0;
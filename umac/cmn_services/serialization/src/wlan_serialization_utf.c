@@ -22,6 +22,7 @@
 
 #include <qdf_status.h>
 #include <qdf_timer.h>
+#include <qdf_time.h>
 #include <wlan_objmgr_cmn.h>
 #include <wlan_objmgr_vdev_obj.h>
 #include <wlan_serialization_api.h>
@@ -447,6 +448,135 @@ static void wlan_ser_utf_vdev_iter_op(struct wlan_objmgr_pdev *pdev,
 	wlan_ser_utf_run(vdev, false, 2, false, is_blocking);
 }
 
+/**
+ * wlan_ser_utf_stress_round() - Run one round of the serialization stress test
+ * @scan_cmd: Run the round with scan cmds if set, with nonscan cmds otherwise
+ * @add_us: Accumulated time taken to add the cmds
+ * @cancel_us: Accumulated time taken to cancel the pending cmds
+ * @remove_us: Accumulated time taken to remove the active cmds
+ *
+ * Queues WLAN_SER_UTF_STRESS_CMDS cmds on every vdev initialized by the UTF,
+ * cancels the ones left in the pending queue one by one and then removes
+ * the active ones.
+ *
+ * Return: Number of cmds queued in the round
+ */
+static uint32_t wlan_ser_utf_stress_round(bool scan_cmd, uint64_t *add_us,
+					  uint64_t *cancel_us,
+					  uint64_t *remove_us)
+{
+	enum wlan_serialization_status
+		ret[WLAN_SER_UTF_MAX_VDEVS][WLAN_SER_UTF_STRESS_CMDS];
+	struct wlan_objmgr_vdev *vdev;
+	struct wlan_ser_utf_data *data;
+	uint32_t cmd_id;
+	uint32_t queued = 0;
+	uint64_t start;
+	uint8_t vdev_id;
+	uint8_t id;
+
+	start = qdf_ktime_to_us(qdf_ktime_get());
+	for (id = 0; id < WLAN_SER_UTF_STRESS_CMDS; id++) {
+		for (vdev_id = 0; vdev_id < WLAN_SER_UTF_MAX_VDEVS; vdev_id++) {
+			ret[vdev_id][id] = WLAN_SER_CMD_DENIED_UNSPECIFIED;
+			vdev = ser_utf_vdev[vdev_id].vdev;
+			if (!vdev)
+				continue;
+
+			if (!wlan_ser_utf_data_alloc(&data, vdev, id))
+				continue;
+
+			cmd_id = WLAN_SER_UTF_STRESS_CMD_ID_BASE + id;
+			if (scan_cmd)
+				ret[vdev_id][id] = wlan_ser_utf_add_scan_cmd(
+						vdev, cmd_id, data, false);
+			else
+				ret[vdev_id][id] = wlan_ser_utf_add_nonscan_cmd(
+						vdev, cmd_id, data,
+						false, false);
+
+			if (ret[vdev_id][id] == WLAN_SER_CMD_ACTIVE ||
+			    ret[vdev_id][id] == WLAN_SER_CMD_PENDING)
+				queued++;
+			else
+				qdf_mem_free(data);
+		}
+	}
+	*add_us += qdf_ktime_to_us(qdf_ktime_get()) - start;
+
+	start = qdf_ktime_to_us(qdf_ktime_get());
+	for (id = 0; id < WLAN_SER_UTF_STRESS_CMDS; id++) {
+		for (vdev_id = 0; vdev_id < WLAN_SER_UTF_MAX_VDEVS; vdev_id++) {
+			if (ret[vdev_id][id] != WLAN_SER_CMD_PENDING)
+				continue;
+
+			vdev = ser_utf_vdev[vdev_id].vdev;
+			cmd_id = WLAN_SER_UTF_STRESS_CMD_ID_BASE + id;
+			if (scan_cmd)
+				wlan_ser_utf_cancel_scan_cmd(
+					vdev, cmd_id,
+					WLAN_SERIALIZATION_PENDING_QUEUE,
+					WLAN_SER_CANCEL_SINGLE_SCAN);
+			else
+				wlan_ser_utf_cancel_nonscan_cmd(
+					vdev, cmd_id,
+					WLAN_SERIALIZATION_PENDING_QUEUE,
+					WLAN_SER_CANCEL_NON_SCAN_CMD);
+		}
+	}
+	*cancel_us += qdf_ktime_to_us(qdf_ktime_get()) - start;
+
+	start = qdf_ktime_to_us(qdf_ktime_get());
+	for (id = 0; id < WLAN_SER_UTF_STRESS_CMDS; id++) {
+		for (vdev_id = 0; vdev_id < WLAN_SER_UTF_MAX_VDEVS; vdev_id++) {
+			if (ret[vdev_id][id] != WLAN_SER_CMD_ACTIVE)
+				continue;
+
+			vdev = ser_utf_vdev[vdev_id].vdev;
+			cmd_id = WLAN_SER_UTF_STRESS_CMD_ID_BASE + id;
+			if (scan_cmd)
+				wlan_ser_utf_remove_scan_cmd(vdev, cmd_id);
+			else
+				wlan_ser_utf_remove_nonscan_cmd(vdev, cmd_id);
+		}
+	}
+	*remove_us += qdf_ktime_to_us(qdf_ktime_get()) - start;
+
+	return queued;
+}
+
+/**
+ * wlan_ser_utf_stress() - Serialization queue stress test
+ *
+ * Runs WLAN_SER_UTF_STRESS_ROUNDS rounds of scan and nonscan cmds through
+ * the serialization queues and reports the average time per cmd of the
+ * add, cancel and remove paths.
+ *
+ * Return: None
+ */
+static void wlan_ser_utf_stress(void)
+{
+	uint64_t add_us = 0, cancel_us = 0, remove_us = 0;
+	uint32_t queued = 0;
+	uint32_t round;
+
+	for (round = 0; round < WLAN_SER_UTF_STRESS_ROUNDS; round++) {
+		queued += wlan_ser_utf_stress_round(true, &add_us, &cancel_us,
+						    &remove_us);
+		queued += wlan_ser_utf_stress_round(false, &add_us, &cancel_us,
+						    &remove_us);
+	}
+
+	if (!queued) {
+		ser_err("Stress: no cmd queued");
+		return;
+	}
+
+	ser_err("Stress: %u cmds, add %llu us, cancel %llu us, remove %llu us, avg %llu ns/cmd",
+		queued, add_us, cancel_us, remove_us,
+		qdf_do_div((add_us + cancel_us + remove_us) * 1000, queued));
+}
+
 /*
  * List of available APIs
  * 1. wlan_serialization_request(
@@ -1000,6 +1130,9 @@ int wlan_ser_utf_main(struct wlan_objmgr_vdev *vdev, uint8_t val,
 		wlan_ser_utf_remove_nonscan_cmd(vdev, 2);
 		wlan_ser_utf_remove_nonscan_cmd(vdev, 3);
 		break;
+	case SER_UTF_TC_STRESS:
+		wlan_ser_utf_stress();
+		break;
 	default:
 		ser_err("Error: Unknown val");
 		break;
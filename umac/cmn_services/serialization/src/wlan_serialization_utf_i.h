@@ -28,6 +28,9 @@
 #define WLAN_SER_UTF_SCAN_CMD_TESTS 33
 #define WLAN_SER_UTF_TIMER_TIMEOUT_MS 5000
 #define WLAN_SER_UTF_TEST_CMD_TIMEOUT_MS 30000
+#define WLAN_SER_UTF_STRESS_CMDS 16
+#define WLAN_SER_UTF_STRESS_ROUNDS 100
+#define WLAN_SER_UTF_STRESS_CMD_ID_BASE 0x100
 
 /* Sample string: SER_Vxx_Cxx */
 #define WLAN_SER_UTF_STR_SIZE 15
@@ -98,6 +101,8 @@ char *wlan_serialization_status_strings[] = {
  *		to the pending queue between normal priority command
  * @SER_UTF_TC_HIGH_PRIO_BL_NONSCAN: Add high priority blocking
  *		nonscan cmd to the tail of pending queue
+ * @SER_UTF_TC_STRESS: Add, cancel and remove scan and nonscan cmds
+ *		across all vdevs of the pdev and report the time taken
  */
 enum wlan_ser_utf_tc_id {
 	SER_UTF_TC_DEINIT,
@@ -139,6 +144,7 @@ enum wlan_ser_utf_tc_id {
 	SER_UTF_TC_HIGH_PRIO_NONSCAN_WO_BL,
 	SER_UTF_TC_HIGH_PRIO_NONSCAN_W_BL,
 	SER_UTF_TC_HIGH_PRIO_BL_NONSCAN,
+	SER_UTF_TC_STRESS,
 };
 
 /**
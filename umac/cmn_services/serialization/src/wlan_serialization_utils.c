@@ -303,6 +303,10 @@ static void wlan_serialization_release_pdev_list_cmds(
 	while (!wlan_serialization_list_empty(&pdev_queue->active_list)) {
 		wlan_serialization_remove_front(
 				&pdev_queue->active_list, &node);
+		wlan_serialization_unindex_cmd(
+			qdf_container_of(node,
+					 struct wlan_serialization_command_list,
+					 pdev_node));
 		wlan_serialization_insert_back(
 				&pdev_queue->cmd_pool_list, node);
 	}
@@ -310,6 +314,10 @@ static void wlan_serialization_release_pdev_list_cmds(
 	while (!wlan_serialization_list_empty(&pdev_queue->pending_list)) {
 		wlan_serialization_remove_front(
 				&pdev_queue->pending_list, &node);
+		wlan_serialization_unindex_cmd(
+			qdf_container_of(node,
+					 struct wlan_serialization_command_list,
+					 pdev_node));
 		wlan_serialization_insert_back(
 				&pdev_queue->cmd_pool_list, node);
 	}
@@ -331,6 +339,7 @@ void wlan_serialization_destroy_pdev_list(
 {
 
 	wlan_serialization_release_pdev_list_cmds(pdev_queue);
+	wlan_serialization_deinit_cmd_index(pdev_queue);
 	qdf_list_destroy(&pdev_queue->pending_list);
 	qdf_list_destroy(&pdev_queue->active_list);
 
@@ -515,6 +524,8 @@ wlan_serialization_remove_cmd_from_queue(
 	if (QDF_STATUS_SUCCESS != status)
 		ser_err("Fail to add to free pool type %d",
 			cmd->cmd_type);
+	else if (node_type == WLAN_SER_PDEV_NODE)
+		wlan_serialization_unindex_cmd(cmd_list);
 
 	*pcmd_list = cmd_list;
 
@@ -560,6 +571,12 @@ wlan_serialization_add_cmd_to_queue(
 	if (QDF_IS_STATUS_ERROR(qdf_status))
 		goto error;
 
+	if (node_type == WLAN_SER_PDEV_NODE)
+		wlan_serialization_index_cmd(
+			wlan_serialization_get_pdev_queue_obj(
+				ser_pdev_obj, cmd_list->cmd.cmd_type),
+			queue, cmd_list);
+
 	if (is_cmd_for_active_queue)
 		status = WLAN_SER_CMD_ACTIVE;
 	else
@@ -798,6 +815,240 @@ bool wlan_serialization_match_cmd_blocking(
 	return match_found;
 }
 
+/**
+ * wlan_serialization_cmd_hash() - Index bucket of a command
+ * @cmd_type: command type
+ * @cmd_id: command id
+ * @vdev_id: vdev id of the command
+ *
+ * Return: bucket in the range [0, WLAN_SER_CMD_HASH_SIZE)
+ */
+static inline uint32_t
+wlan_serialization_cmd_hash(enum wlan_serialization_cmd_type cmd_type,
+			    uint32_t cmd_id, uint8_t vdev_id)
+{
+	uint32_t key;
+
+	key = cmd_id ^ ((uint32_t)cmd_type << 16) ^ ((uint32_t)vdev_id << 24);
+
+	return (key * 0x9e3779b1) >> (32 - WLAN_SER_CMD_HASH_BITS);
+}
+
+void
+wlan_serialization_index_cmd(struct wlan_serialization_pdev_queue *pdev_queue,
+			     qdf_list_t *queue,
+			     struct wlan_serialization_command_list *cmd_list)
+{
+	uint8_t vdev_id;
+	qdf_list_t *hash_list;
+	qdf_list_t *vdev_list;
+
+	if (!pdev_queue || !cmd_list->cmd.vdev)
+		return;
+
+	vdev_id = wlan_vdev_get_id(cmd_list->cmd.vdev);
+	if (vdev_id >= WLAN_UMAC_PSOC_MAX_VDEVS)
+		return;
+
+	hash_list = &pdev_queue->cmd_hash[wlan_serialization_cmd_hash(
+						cmd_list->cmd.cmd_type,
+						cmd_list->cmd.cmd_id,
+						vdev_id)];
+	vdev_list = &pdev_queue->vdev_cmd_list[vdev_id];
+
+	/* Mirror the insertion done on the pdev list to keep the order */
+	if (cmd_list->cmd.is_high_priority) {
+		qdf_list_insert_front(hash_list, &cmd_list->hash_node);
+		qdf_list_insert_front(vdev_list, &cmd_list->vdev_idx_node);
+	} else {
+		qdf_list_insert_back(hash_list, &cmd_list->hash_node);
+		qdf_list_insert_back(vdev_list, &cmd_list->vdev_idx_node);
+	}
+
+	cmd_list->pdev_list = queue;
+	cmd_list->hash_list = hash_list;
+	cmd_list->vdev_list = vdev_list;
+}
+
+void
+wlan_serialization_unindex_cmd(struct wlan_serialization_command_list *cmd_list)
+{
+	if (!cmd_list->pdev_list)
+		return;
+
+	qdf_list_remove_node(cmd_list->hash_list, &cmd_list->hash_node);
+	qdf_list_remove_node(cmd_list->vdev_list, &cmd_list->vdev_idx_node);
+
+	cmd_list->pdev_list = NULL;
+	cmd_list->hash_list = NULL;
+	cmd_list->vdev_list = NULL;
+}
+
+void
+wlan_serialization_init_cmd_index(
+		struct wlan_serialization_pdev_queue *pdev_queue)
+{
+	uint32_t max_size;
+	uint32_t i;
+
+	max_size = qdf_list_max_size(&pdev_queue->active_list) +
+		   qdf_list_max_size(&pdev_queue->pending_list);
+
+	for (i = 0; i < WLAN_SER_CMD_HASH_SIZE; i++)
+		qdf_list_create(&pdev_queue->cmd_hash[i], max_size);
+
+	for (i = 0; i < WLAN_UMAC_PSOC_MAX_VDEVS; i++)
+		qdf_list_create(&pdev_queue->vdev_cmd_list[i], max_size);
+}
+
+void
+wlan_serialization_deinit_cmd_index(
+		struct wlan_serialization_pdev_queue *pdev_queue)
+{
+	uint32_t i;
+
+	for (i = 0; i < WLAN_SER_CMD_HASH_SIZE; i++)
+		qdf_list_destroy(&pdev_queue->cmd_hash[i]);
+
+	for (i = 0; i < WLAN_UMAC_PSOC_MAX_VDEVS; i++)
+		qdf_list_destroy(&pdev_queue->vdev_cmd_list[i]);
+}
+
+/**
+ * wlan_serialization_get_indexed_pdev_queue() - Find the pdev queue owning
+ *	a pdev active/pending list
+ * @queue: pdev active/pending list
+ * @vdev: vdev whose pdev owns @queue
+ *
+ * Return: pdev queue owning @queue, NULL if @queue is not a pdev list of the
+ *	pdev of @vdev
+ */
+static struct wlan_serialization_pdev_queue *
+wlan_serialization_get_indexed_pdev_queue(qdf_list_t *queue,
+					  struct wlan_objmgr_vdev *vdev)
+{
+	struct wlan_objmgr_pdev *pdev;
+	struct wlan_ser_pdev_obj *ser_pdev_obj;
+	struct wlan_serialization_pdev_queue *pdev_queue;
+	uint8_t i;
+
+	pdev = wlan_vdev_get_pdev(vdev);
+	if (!pdev)
+		return NULL;
+
+	ser_pdev_obj = wlan_serialization_get_pdev_obj(pdev);
+	if (!ser_pdev_obj)
+		return NULL;
+
+	for (i = 0; i < SER_PDEV_QUEUE_COMP_MAX; i++) {
+		pdev_queue = &ser_pdev_obj->pdev_q[i];
+		if (queue == &pdev_queue->active_list ||
+		    queue == &pdev_queue->pending_list)
+			return pdev_queue;
+	}
+
+	return NULL;
+}
+
+/**
+ * wlan_serialization_find_indexed_cmd() - Find a command through the pdev
+ *	queue index
+ * @pdev_queue: pdev queue owning @queue
+ * @queue: pdev active/pending list to be searched
+ * @match_type: WLAN_SER_MATCH_CMD_ID_VDEV, WLAN_SER_MATCH_VDEV or
+ *	WLAN_SER_MATCH_CMD_TYPE_VDEV
+ * @cmd: command to be matched for WLAN_SER_MATCH_CMD_ID_VDEV
+ * @cmd_type: command type to be matched for WLAN_SER_MATCH_CMD_TYPE_VDEV
+ * @vdev: vdev to be matched
+ *
+ * Return: pdev_node of the first matching command of @queue, NULL if none
+ */
+static qdf_list_node_t *
+wlan_serialization_find_indexed_cmd(
+		struct wlan_serialization_pdev_queue *pdev_queue,
+		qdf_list_t *queue,
+		enum wlan_serialization_match_type match_type,
+		struct wlan_serialization_command *cmd,
+		enum wlan_serialization_cmd_type cmd_type,
+		struct wlan_objmgr_vdev *vdev)
+{
+	struct wlan_serialization_command_list *cmd_list;
+	qdf_list_node_t *node = NULL;
+	qdf_list_t *index;
+	uint8_t vdev_id;
+	bool by_hash;
+
+	vdev_id = wlan_vdev_get_id(vdev);
+	if (vdev_id >= WLAN_UMAC_PSOC_MAX_VDEVS)
+		return NULL;
+
+	by_hash = (match_type == WLAN_SER_MATCH_CMD_ID_VDEV);
+	if (by_hash)
+		index = &pdev_queue->cmd_hash[wlan_serialization_cmd_hash(
+							cmd->cmd_type,
+							cmd->cmd_id,
+							vdev_id)];
+	else
+		index = &pdev_queue->vdev_cmd_list[vdev_id];
+
+	if (qdf_list_peek_front(index, &node) != QDF_STATUS_SUCCESS)
+		return NULL;
+
+	do {
+		if (by_hash)
+			cmd_list = qdf_container_of(
+					node,
+					struct wlan_serialization_command_list,
+					hash_node);
+		else
+			cmd_list = qdf_container_of(
+					node,
+					struct wlan_serialization_command_list,
+					vdev_idx_node);
+
+		if (cmd_list->pdev_list != queue ||
+		    cmd_list->cmd.vdev != vdev)
+			continue;
+
+		switch (match_type) {
+		case WLAN_SER_MATCH_CMD_ID_VDEV:
+			if (cmd_list->cmd.cmd_id == cmd->cmd_id &&
+			    cmd_list->cmd.cmd_type == cmd->cmd_type)
+				return &cmd_list->pdev_node;
+			break;
+		case WLAN_SER_MATCH_CMD_TYPE_VDEV:
+			if (cmd_list->cmd.cmd_type == cmd_type)
+				return &cmd_list->pdev_node;
+			break;
+		default:
+			return &cmd_list->pdev_node;
+		}
+	} while (qdf_list_peek_next(index, node, &node) == QDF_STATUS_SUCCESS);
+
+	return NULL;
+}
+
+bool wlan_serialization_queue_may_match(qdf_list_t *queue,
+					struct wlan_serialization_command *cmd,
+					struct wlan_objmgr_vdev *vdev)
+{
+	qdf_list_node_t *node;
+
+	if (!vdev)
+		return true;
+
+	if (cmd)
+		node = wlan_serialization_find_cmd(
+				queue, WLAN_SER_MATCH_CMD_ID_VDEV,
+				cmd, 0, NULL, vdev, WLAN_SER_PDEV_NODE);
+	else
+		node = wlan_serialization_find_cmd(
+				queue, WLAN_SER_MATCH_VDEV,
+				NULL, 0, NULL, vdev, WLAN_SER_PDEV_NODE);
+
+	return !!node;
+}
+
 qdf_list_node_t *
 wlan_serialization_find_cmd(qdf_list_t *queue,
 			    enum wlan_serialization_match_type match_type,
@@ -812,12 +1063,27 @@ wlan_serialization_find_cmd(qdf_list_t *queue,
 	qdf_list_node_t *nnode = NULL;
 	QDF_STATUS status;
 	bool node_found = 0;
+	struct wlan_serialization_pdev_queue *pdev_queue;
 
 	queuelen = wlan_serialization_list_size(queue);
 
 	if (!queuelen)
 		goto error;
 
+	if (node_type == WLAN_SER_PDEV_NODE && vdev &&
+	    ((match_type == WLAN_SER_MATCH_CMD_ID_VDEV && cmd) ||
+	     match_type == WLAN_SER_MATCH_VDEV ||
+	     match_type == WLAN_SER_MATCH_CMD_TYPE_VDEV)) {
+		pdev_queue = wlan_serialization_get_indexed_pdev_queue(queue,
+								       vdev);
+		if (pdev_queue) {
+			cmd_node = wlan_serialization_find_indexed_cmd(
+					pdev_queue, queue, match_type,
+					cmd, cmd_type, vdev);
+			goto error;
+		}
+	}
+
 	while (queuelen--) {
 		status = wlan_serialization_get_cmd_from_queue(queue, &nnode);
 		if (status != QDF_STATUS_SUCCESS)
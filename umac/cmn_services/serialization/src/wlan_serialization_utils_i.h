@@ -47,6 +47,14 @@
 #define CMD_ACTIVE_MARKED_FOR_CANCEL  3
 #define CMD_ACTIVE_MARKED_FOR_REMOVAL 4
 #define CMD_MARKED_FOR_MOVEMENT       5
+
+/*
+ * Number of buckets in the per pdev queue command index, keyed on
+ * (cmd_type, cmd_id, vdev_id). Must be a power of 2.
+ */
+#define WLAN_SER_CMD_HASH_BITS        5
+#define WLAN_SER_CMD_HASH_SIZE        (1 << WLAN_SER_CMD_HASH_BITS)
+
 /**
  * struct wlan_serialization_timer - Timer used for serialization
  * @cmd:      Cmd to which the timer is linked
@@ -82,12 +90,23 @@ enum wlan_serialization_node {
  * @vdev_node: VDEV node identifier in the list
  * @cmd: Command to be serialized
  * @cmd_in_use: flag to check if the node/entry is logically active
+ * @hash_node: node in the (cmd_type, cmd_id, vdev_id) index of the pdev queue
+ * @vdev_idx_node: node in the per vdev index of the pdev queue
+ * @pdev_list: pdev active/pending list the command is linked in, NULL if
+ *	the command is not part of any pdev list
+ * @hash_list: index bucket @hash_node is linked in
+ * @vdev_list: per vdev index list @vdev_idx_node is linked in
  */
 struct wlan_serialization_command_list {
 	qdf_list_node_t pdev_node;
 	qdf_list_node_t vdev_node;
 	struct wlan_serialization_command cmd;
 	unsigned long cmd_in_use;
+	qdf_list_node_t hash_node;
+	qdf_list_node_t vdev_idx_node;
+	qdf_list_t *pdev_list;
+	qdf_list_t *hash_list;
+	qdf_list_t *vdev_list;
 };
 
 /**
@@ -99,6 +118,13 @@ struct wlan_serialization_command_list {
  * @blocking_cmd_active: Indicate if a blocking cmd is in active execution
  * @blocking_cmd_waiting: Indicate if a blocking cmd is in pending queue
  * @pdev_queue_lock: pdev lock to protect concurrent operations on the queues
+ * @cmd_hash: commands of the active and pending lists hashed on
+ *	(cmd_type, cmd_id, vdev_id)
+ * @vdev_cmd_list: commands of the active and pending lists per vdev id
+ *
+ * @cmd_hash and @vdev_cmd_list hold the commands in the same relative order
+ * as the active/pending lists, so an index lookup returns the same command a
+ * walk over the list would. They are protected by @pdev_queue_lock.
  */
 struct wlan_serialization_pdev_queue {
 	qdf_list_t active_list;
@@ -108,6 +134,8 @@ struct wlan_serialization_pdev_queue {
 	bool blocking_cmd_active;
 	uint16_t blocking_cmd_waiting;
 	qdf_spinlock_t pdev_queue_lock;
+	qdf_list_t cmd_hash[WLAN_SER_CMD_HASH_SIZE];
+	qdf_list_t vdev_cmd_list[WLAN_UMAC_PSOC_MAX_VDEVS];
 #ifdef WLAN_SER_DEBUG
 	struct ser_history history;
 #endif
@@ -560,14 +588,83 @@ bool wlan_serialization_match_cmd_blocking(
 		qdf_list_node_t *nnode,
 		enum wlan_serialization_node node_type);
 
+/**
+ * wlan_serialization_index_cmd() - Add a command to the pdev queue index
+ * @pdev_queue: pdev queue owning @queue
+ * @queue: pdev active/pending list the command has been inserted in
+ * @cmd_list: command that has been inserted in @queue
+ *
+ * Must be called with the pdev queue lock held, right after the command's
+ * pdev_node is inserted in @queue.
+ *
+ * Return: None
+ */
+void
+wlan_serialization_index_cmd(struct wlan_serialization_pdev_queue *pdev_queue,
+			     qdf_list_t *queue,
+			     struct wlan_serialization_command_list *cmd_list);
+
+/**
+ * wlan_serialization_unindex_cmd() - Remove a command from the pdev queue index
+ * @cmd_list: command whose pdev_node has been removed from its pdev list
+ *
+ * Must be called with the pdev queue lock held and before the command
+ * contents are cleared. It is a no-op for a command that is not indexed.
+ *
+ * Return: None
+ */
+void
+wlan_serialization_unindex_cmd(struct wlan_serialization_command_list *cmd_list);
+
+/**
+ * wlan_serialization_init_cmd_index() - Initialize the pdev queue index
+ * @pdev_queue: pdev queue whose index is to be initialized
+ *
+ * Return: None
+ */
+void
+wlan_serialization_init_cmd_index(
+		struct wlan_serialization_pdev_queue *pdev_queue);
+
+/**
+ * wlan_serialization_deinit_cmd_index() - Destroy the pdev queue index
+ * @pdev_queue: pdev queue whose index is to be destroyed
+ *
+ * Return: None
+ */
+void
+wlan_serialization_deinit_cmd_index(
+		struct wlan_serialization_pdev_queue *pdev_queue);
+
+/**
+ * wlan_serialization_queue_may_match() - Check if a cancel request can match
+ *	any command of a pdev list
+ * @queue: pdev active/pending list
+ * @cmd: command to be matched, can be NULL
+ * @vdev: vdev to be matched, can be NULL
+ *
+ * Uses the pdev queue index to rule out a walk over @queue when the cancel
+ * criteria are restricted to a vdev that has no command in @queue.
+ *
+ * Return: false if no command of @queue can match, true otherwise
+ */
+bool wlan_serialization_queue_may_match(qdf_list_t *queue,
+					struct wlan_serialization_command *cmd,
+					struct wlan_objmgr_vdev *vdev);
+
 /**
  * wlan_serialization_find_cmd() - Find the cmd matching the given criterias
+ * @queue: List of commands which has to be searched
+ * @match_type: Criteria to be matched
  * @cmd: Serialization command information
  * @cmd_type: Command type to be matched
  * @pdev: pdev object that needs to be matched
  * @vdev: vdev object that needs to be matched
  * @node_type: Node type. Pdev node or vdev node
  *
+ * Lookups of a pdev node by command id and vdev, or by vdev, are served from
+ * the pdev queue index; other criteria walk @queue.
+ *
  * Return: Pointer to the node member in the list
  */
 qdf_list_node_t *
@@ -36,6 +36,7 @@
 #include <scheduler_api.h>
 #include "reg_build_chan_list.h"
 #include <qdf_platform.h>
+#include <qdf_time.h>
 #include <wlan_reg_services_api.h>
 
 #define MAX_PWR_FCC_CHAN_12 8
@@ -1733,8 +1734,77 @@ reg_modify_chan_list_for_avoid_chan_ext(struct wlan_regulatory_pdev_priv_obj
 }
 #endif
 
-void reg_compute_pdev_current_chan_list(struct wlan_regulatory_pdev_priv_obj
-					*pdev_priv_obj)
+/**
+ * reg_get_chan_list_base_inputs() - Snapshot the configuration the base
+ * channel list stage depends on
+ * @pdev_priv_obj: Pointer to regulatory pdev private object
+ * @inputs: Output snapshot
+ */
+static void
+reg_get_chan_list_base_inputs(struct wlan_regulatory_pdev_priv_obj
+			      *pdev_priv_obj,
+			      struct reg_chan_list_base_inputs *inputs)
+{
+	qdf_mem_zero(inputs, sizeof(*inputs));
+
+	inputs->range_2g_low = pdev_priv_obj->range_2g_low;
+	inputs->range_2g_high = pdev_priv_obj->range_2g_high;
+	inputs->range_5g_low = pdev_priv_obj->range_5g_low;
+	inputs->range_5g_high = pdev_priv_obj->range_5g_high;
+	inputs->band_capability = pdev_priv_obj->band_capability;
+	inputs->dfs_enabled = pdev_priv_obj->dfs_enabled;
+	inputs->indoor_chan_enabled = pdev_priv_obj->indoor_chan_enabled;
+#ifdef DISABLE_UNII_SHARED_BANDS
+	inputs->unii_5g_bitmap = pdev_priv_obj->unii_5g_bitmap;
+#endif
+#ifdef CONFIG_BAND_6GHZ
+	inputs->is_6g_channel_list_populated =
+		pdev_priv_obj->is_6g_channel_list_populated;
+	inputs->ap_pwr_type = pdev_priv_obj->reg_cur_6g_ap_pwr_type;
+	inputs->client_mobility_type =
+		pdev_priv_obj->reg_cur_6g_client_mobility_type;
+#endif
+#ifdef CONFIG_AFC_SUPPORT
+	inputs->is_6g_afc_power_event_received =
+		pdev_priv_obj->is_6g_afc_power_event_received;
+#endif
+}
+
+/**
+ * reg_is_overlay_chan_list_trigger() - Whether a trigger only affects the
+ * passes applied on top of the base channel list
+ * @trigger: Reason for the rebuild
+ *
+ * Return: true if the cached base channel list stays valid for @trigger
+ */
+static bool reg_is_overlay_chan_list_trigger(enum reg_chan_list_trigger trigger)
+{
+	switch (trigger) {
+	case REG_CHAN_LIST_TRIGGER_NOL:
+	case REG_CHAN_LIST_TRIGGER_SAP_STATE:
+	case REG_CHAN_LIST_TRIGGER_FCC:
+	case REG_CHAN_LIST_TRIGGER_CHAN_144:
+	case REG_CHAN_LIST_TRIGGER_CACHED_CHAN:
+	case REG_CHAN_LIST_TRIGGER_AVOID_EXT:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * reg_compute_chan_list_base() - Compute the base stage of the current
+ * channel list and cache it
+ * @pdev_priv_obj: Pointer to regulatory pdev private object
+ *
+ * The base stage is the master channel list restricted by the pdev frequency
+ * range, band, UNII coex and DFS configuration. None of it depends on the
+ * NOL, so NOL updates and the other overlay triggers restart from the cached
+ * copy instead.
+ */
+static void
+reg_compute_chan_list_base(struct wlan_regulatory_pdev_priv_obj
+			   *pdev_priv_obj)
 {
 	reg_modify_6g_afc_chan_list(pdev_priv_obj);
 
@@ -1757,6 +1827,75 @@ void reg_compute_pdev_current_chan_list(struct wlan_regulatory_pdev_priv_obj
 	reg_modify_chan_list_for_dfs_channels(pdev_priv_obj->cur_chan_list,
 					      pdev_priv_obj->dfs_enabled);
 
+	qdf_mem_copy(pdev_priv_obj->base_chan_list,
+		     pdev_priv_obj->cur_chan_list,
+		     NUM_CHANNELS * sizeof(struct regulatory_channel));
+	reg_get_chan_list_base_inputs(pdev_priv_obj,
+				      &pdev_priv_obj->base_inputs);
+	pdev_priv_obj->base_chan_list_valid = true;
+}
+
+/**
+ * reg_restore_chan_list_base() - Restart the current channel list from the
+ * cached base stage
+ * @pdev_priv_obj: Pointer to regulatory pdev private object
+ *
+ * NOL state is updated in the master list without a base rebuild, so it is
+ * refreshed from there.
+ */
+static void
+reg_restore_chan_list_base(struct wlan_regulatory_pdev_priv_obj
+			   *pdev_priv_obj)
+{
+	struct regulatory_channel *cur_chan_list = pdev_priv_obj->cur_chan_list;
+	struct regulatory_channel *mas_chan_list = pdev_priv_obj->mas_chan_list;
+	enum channel_enum chan_enum;
+
+	qdf_mem_copy(cur_chan_list, pdev_priv_obj->base_chan_list,
+		     NUM_CHANNELS * sizeof(struct regulatory_channel));
+
+	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+		cur_chan_list[chan_enum].nol_chan =
+			mas_chan_list[chan_enum].nol_chan;
+		cur_chan_list[chan_enum].nol_history =
+			mas_chan_list[chan_enum].nol_history;
+	}
+}
+
+/**
+ * reg_can_reuse_chan_list_base() - Whether the cached base stage can be
+ * reused for a rebuild
+ * @pdev_priv_obj: Pointer to regulatory pdev private object
+ * @trigger: Reason for the rebuild
+ *
+ * Return: true if only the overlay passes need to run
+ */
+static bool
+reg_can_reuse_chan_list_base(struct wlan_regulatory_pdev_priv_obj
+			     *pdev_priv_obj,
+			     enum reg_chan_list_trigger trigger)
+{
+	struct reg_chan_list_base_inputs inputs;
+
+	if (!pdev_priv_obj->base_chan_list_valid ||
+	    !reg_is_overlay_chan_list_trigger(trigger))
+		return false;
+
+	reg_get_chan_list_base_inputs(pdev_priv_obj, &inputs);
+
+	return !qdf_mem_cmp(&inputs, &pdev_priv_obj->base_inputs,
+			    sizeof(inputs));
+}
+
+/**
+ * reg_apply_chan_list_overlays() - Apply the NOL and later passes to the
+ * current channel list
+ * @pdev_priv_obj: Pointer to regulatory pdev private object
+ */
+static void
+reg_apply_chan_list_overlays(struct wlan_regulatory_pdev_priv_obj
+			     *pdev_priv_obj)
+{
 	reg_modify_chan_list_for_nol_list(pdev_priv_obj->cur_chan_list);
 
 	reg_modify_chan_list_for_indoor_channels(pdev_priv_obj);
@@ -1788,6 +1927,133 @@ void reg_compute_pdev_current_chan_list(struct wlan_regulatory_pdev_priv_obj
 	reg_modify_chan_list_for_avoid_chan_ext(pdev_priv_obj);
 }
 
+/**
+ * reg_mark_chan_changed() - Add a channel to a pending channel delta
+ * @delta: Pending channel delta
+ * @chan_enum: Changed channel
+ */
+static void reg_mark_chan_changed(struct reg_chan_list_delta *delta,
+				  enum channel_enum chan_enum)
+{
+	if (qdf_test_bit(chan_enum, delta->changed))
+		return;
+
+	qdf_set_bit(chan_enum, delta->changed);
+	delta->num_changed++;
+}
+
+/**
+ * reg_record_chan_list_delta() - Record the channels changed by a rebuild in
+ * the pending north and south bound deltas
+ * @pdev_priv_obj: Pointer to regulatory pdev private object
+ * @prev_chan_list: Current channel list before the rebuild, NULL if unknown
+ *
+ * Return: Number of channels changed by the rebuild
+ */
+static uint16_t
+reg_record_chan_list_delta(struct wlan_regulatory_pdev_priv_obj
+			   *pdev_priv_obj,
+			   struct regulatory_channel *prev_chan_list)
+{
+	struct regulatory_channel *cur_chan_list = pdev_priv_obj->cur_chan_list;
+	enum channel_enum chan_enum;
+	uint16_t num_changed = 0;
+
+	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+		if (prev_chan_list &&
+		    !qdf_mem_cmp(&prev_chan_list[chan_enum],
+				 &cur_chan_list[chan_enum],
+				 sizeof(struct regulatory_channel)))
+			continue;
+
+		reg_mark_chan_changed(&pdev_priv_obj->chan_delta_sb, chan_enum);
+		reg_mark_chan_changed(&pdev_priv_obj->chan_delta_nb, chan_enum);
+		num_changed++;
+	}
+
+	return num_changed;
+}
+
+void reg_update_pdev_current_chan_list(struct wlan_regulatory_pdev_priv_obj
+				       *pdev_priv_obj,
+				       enum reg_chan_list_trigger trigger)
+{
+	struct regulatory_channel *prev_chan_list;
+	struct reg_chan_list_rebuild_stats *stats;
+	uint64_t start_us, elapsed_us;
+	uint16_t num_changed;
+	bool incremental;
+
+	if (trigger >= REG_CHAN_LIST_TRIGGER_MAX)
+		trigger = REG_CHAN_LIST_TRIGGER_FULL;
+
+	start_us = qdf_get_monotonic_boottime();
+
+	/* without the previous list every channel is reported as changed */
+	prev_chan_list = qdf_mem_malloc(NUM_CHANNELS *
+					sizeof(struct regulatory_channel));
+	if (prev_chan_list)
+		qdf_mem_copy(prev_chan_list, pdev_priv_obj->cur_chan_list,
+			     NUM_CHANNELS * sizeof(struct regulatory_channel));
+
+	incremental = reg_can_reuse_chan_list_base(pdev_priv_obj, trigger);
+	if (incremental)
+		reg_restore_chan_list_base(pdev_priv_obj);
+	else
+		reg_compute_chan_list_base(pdev_priv_obj);
+
+	reg_apply_chan_list_overlays(pdev_priv_obj);
+
+	num_changed = reg_record_chan_list_delta(pdev_priv_obj,
+						 prev_chan_list);
+	if (prev_chan_list)
+		qdf_mem_free(prev_chan_list);
+
+	elapsed_us = qdf_get_monotonic_boottime() - start_us;
+
+	stats = &pdev_priv_obj->rebuild_stats[trigger];
+	stats->count++;
+	if (incremental)
+		stats->incremental++;
+	stats->last_us = elapsed_us;
+	stats->total_us += elapsed_us;
+	if (elapsed_us > stats->max_us)
+		stats->max_us = elapsed_us;
+	stats->last_changed = num_changed;
+
+	reg_debug("trigger %d %s rebuild: %llu us, %d channels changed",
+		  trigger, incremental ? "incremental" : "full",
+		  elapsed_us, num_changed);
+}
+
+void reg_compute_pdev_current_chan_list(struct wlan_regulatory_pdev_priv_obj
+					*pdev_priv_obj)
+{
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_FULL);
+}
+
+QDF_STATUS
+reg_get_chan_list_rebuild_stats(struct wlan_objmgr_pdev *pdev,
+				enum reg_chan_list_trigger trigger,
+				struct reg_chan_list_rebuild_stats *stats)
+{
+	struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj;
+
+	if (trigger >= REG_CHAN_LIST_TRIGGER_MAX || !stats)
+		return QDF_STATUS_E_INVAL;
+
+	pdev_priv_obj = reg_get_pdev_obj(pdev);
+	if (!IS_VALID_PDEV_REG_OBJ(pdev_priv_obj)) {
+		reg_err("reg pdev priv obj is NULL");
+		return QDF_STATUS_E_FAILURE;
+	}
+
+	*stats = pdev_priv_obj->rebuild_stats[trigger];
+
+	return QDF_STATUS_SUCCESS;
+}
+
 void reg_reset_reg_rules(struct reg_rule_info *reg_rules)
 {
 	qdf_mem_zero(reg_rules, sizeof(*reg_rules));
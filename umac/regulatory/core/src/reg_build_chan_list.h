@@ -72,10 +72,42 @@ reg_save_reg_rules_to_pdev(struct reg_rule_info *psoc_reg_rules,
 /**
  * reg_compute_pdev_current_chan_list() - Compute pdev current channel list.
  * @pdev_priv_obj: Pointer to regdb pdev private object.
+ *
+ * Same as reg_update_pdev_current_chan_list() with
+ * REG_CHAN_LIST_TRIGGER_FULL.
  */
 void reg_compute_pdev_current_chan_list(
 		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj);
 
+/**
+ * reg_update_pdev_current_chan_list() - Recompute pdev current channel list
+ * after a change
+ * @pdev_priv_obj: Pointer to regdb pdev private object.
+ * @trigger: What changed
+ *
+ * Triggers that leave the master list, band, frequency range, UNII coex and
+ * DFS configuration untouched restart from the cached base channel list and
+ * only redo the NOL and later passes. The channels that changed are added to
+ * the pending channel deltas and the rebuild time is accounted to @trigger.
+ */
+void reg_update_pdev_current_chan_list(
+		struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj,
+		enum reg_chan_list_trigger trigger);
+
+/**
+ * reg_get_chan_list_rebuild_stats() - Get the current channel list rebuild
+ * timing of a trigger
+ * @pdev: Pointer to pdev
+ * @trigger: Rebuild trigger
+ * @stats: Output statistics
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS
+reg_get_chan_list_rebuild_stats(struct wlan_objmgr_pdev *pdev,
+				enum reg_chan_list_trigger trigger,
+				struct reg_chan_list_rebuild_stats *stats);
+
 /**
  * reg_propagate_mas_chan_list_to_pdev() - Propagate master channel list to pdev
  * @psoc: Pointer to psoc object.
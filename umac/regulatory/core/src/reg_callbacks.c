@@ -40,13 +40,19 @@
  * @pdev: Pointer to global pdev structure.
  * @ch_avoid_ind: if chan avoid indicated
  * @avoid_info: chan avoid info if @ch_avoid_ind is true
+ * @delta: channels changed since the previous notification
+ *
+ * Channel delta callbacks are only called if @delta is not empty.
  */
 static void reg_call_chan_change_cbks(struct wlan_objmgr_psoc *psoc,
 				      struct wlan_objmgr_pdev *pdev,
 				      bool ch_avoid_ind,
-				      struct avoid_freq_ind_data *avoid_info)
+				      struct avoid_freq_ind_data *avoid_info,
+				      struct reg_chan_list_delta *delta)
 {
 	struct chan_change_cbk_entry *cbk_list;
+	struct chan_delta_cbk_entry *delta_cbk_list;
+	reg_chan_delta_callback delta_callback;
 	struct wlan_regulatory_psoc_priv_obj *psoc_priv_obj;
 	struct wlan_regulatory_pdev_priv_obj *pdev_priv_obj;
 	struct regulatory_channel *cur_chan_list;
@@ -90,6 +96,24 @@ static void reg_call_chan_change_cbks(struct wlan_objmgr_psoc *psoc,
 			callback(psoc, pdev, cur_chan_list, avoid_freq_ind,
 				 cbk_list[ctr].arg);
 	}
+
+	if (!delta->num_changed)
+		goto free_list;
+
+	delta_cbk_list = psoc_priv_obj->delta_cbk_list;
+
+	for (ctr = 0; ctr < REG_MAX_CHAN_CHANGE_CBKS; ctr++) {
+		delta_callback = NULL;
+		qdf_spin_lock_bh(&psoc_priv_obj->cbk_list_lock);
+		if (delta_cbk_list[ctr].cbk)
+			delta_callback = delta_cbk_list[ctr].cbk;
+		qdf_spin_unlock_bh(&psoc_priv_obj->cbk_list_lock);
+		if (delta_callback)
+			delta_callback(psoc, pdev, cur_chan_list, delta,
+				       delta_cbk_list[ctr].arg);
+	}
+
+free_list:
 	qdf_mem_free(cur_chan_list);
 }
 
@@ -182,7 +206,7 @@ static QDF_STATUS reg_sched_chan_change_cbks_sb(struct scheduler_msg *msg)
 	struct wlan_objmgr_pdev *pdev = load->pdev;
 
 	reg_call_chan_change_cbks(psoc, pdev, load->ch_avoid_ind,
-				  &load->avoid_info);
+				  &load->avoid_info, &load->delta);
 
 	wlan_objmgr_pdev_release_ref(pdev, WLAN_REGULATORY_SB_ID);
 	wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_SB_ID);
@@ -220,7 +244,7 @@ static QDF_STATUS reg_sched_chan_change_cbks_nb(struct scheduler_msg *msg)
 	struct wlan_objmgr_pdev *pdev = load->pdev;
 
 	reg_call_chan_change_cbks(psoc, pdev, load->ch_avoid_ind,
-				  &load->avoid_info);
+				  &load->avoid_info, &load->delta);
 
 	wlan_objmgr_pdev_release_ref(pdev, WLAN_REGULATORY_NB_ID);
 	wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_NB_ID);
@@ -273,6 +297,7 @@ QDF_STATUS reg_send_scheduler_msg_sb(struct wlan_objmgr_psoc *psoc,
 		wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_SB_ID);
 		return QDF_STATUS_E_NOMEM;
 	}
+	payload->delta = pdev_priv_obj->chan_delta_sb;
 
 	msg.bodyptr = payload;
 	msg.callback = reg_sched_chan_change_cbks_sb;
@@ -285,6 +310,9 @@ QDF_STATUS reg_send_scheduler_msg_sb(struct wlan_objmgr_psoc *psoc,
 		wlan_objmgr_pdev_release_ref(pdev, WLAN_REGULATORY_SB_ID);
 		wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_SB_ID);
 		qdf_mem_free(payload);
+	} else {
+		qdf_mem_zero(&pdev_priv_obj->chan_delta_sb,
+			     sizeof(pdev_priv_obj->chan_delta_sb));
 	}
 
 	return status;
@@ -334,6 +362,7 @@ QDF_STATUS reg_send_scheduler_msg_nb(struct wlan_objmgr_psoc *psoc,
 		wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_NB_ID);
 		return QDF_STATUS_E_NOMEM;
 	}
+	payload->delta = pdev_priv_obj->chan_delta_nb;
 	msg.bodyptr = payload;
 	msg.callback = reg_sched_chan_change_cbks_nb;
 	msg.flush_callback = reg_chan_change_flush_cbk_nb;
@@ -345,6 +374,9 @@ QDF_STATUS reg_send_scheduler_msg_nb(struct wlan_objmgr_psoc *psoc,
 		wlan_objmgr_pdev_release_ref(pdev, WLAN_REGULATORY_NB_ID);
 		wlan_objmgr_psoc_release_ref(psoc, WLAN_REGULATORY_NB_ID);
 		qdf_mem_free(payload);
+	} else {
+		qdf_mem_zero(&pdev_priv_obj->chan_delta_nb,
+			     sizeof(pdev_priv_obj->chan_delta_nb));
 	}
 
 	return status;
@@ -384,7 +416,8 @@ QDF_STATUS reg_notify_sap_event(struct wlan_objmgr_pdev *pdev,
 
 	pdev_priv_obj->sap_state = sap_state;
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_SAP_STATE);
 	status = reg_send_scheduler_msg_sb(psoc, pdev);
 
 	return status;
@@ -441,3 +474,51 @@ void reg_unregister_chan_change_callback(struct wlan_objmgr_psoc *psoc,
 		reg_err("callback not found in the list");
 }
 
+void reg_register_chan_delta_callback(struct wlan_objmgr_psoc *psoc,
+				      reg_chan_delta_callback cbk, void *arg)
+{
+	struct wlan_regulatory_psoc_priv_obj *psoc_priv_obj;
+	uint32_t count;
+
+	psoc_priv_obj = reg_get_psoc_obj(psoc);
+	if (!psoc_priv_obj) {
+		reg_err("reg psoc private obj is NULL");
+		return;
+	}
+
+	qdf_spin_lock_bh(&psoc_priv_obj->cbk_list_lock);
+	for (count = 0; count < REG_MAX_CHAN_CHANGE_CBKS; count++)
+		if (!psoc_priv_obj->delta_cbk_list[count].cbk) {
+			psoc_priv_obj->delta_cbk_list[count].cbk = cbk;
+			psoc_priv_obj->delta_cbk_list[count].arg = arg;
+			break;
+		}
+	qdf_spin_unlock_bh(&psoc_priv_obj->cbk_list_lock);
+
+	if (count == REG_MAX_CHAN_CHANGE_CBKS)
+		reg_err("delta callback list is full");
+}
+
+void reg_unregister_chan_delta_callback(struct wlan_objmgr_psoc *psoc,
+					reg_chan_delta_callback cbk)
+{
+	struct wlan_regulatory_psoc_priv_obj *psoc_priv_obj;
+	uint32_t count;
+
+	psoc_priv_obj = reg_get_psoc_obj(psoc);
+	if (!psoc_priv_obj) {
+		reg_err("reg psoc private obj is NULL");
+		return;
+	}
+
+	qdf_spin_lock_bh(&psoc_priv_obj->cbk_list_lock);
+	for (count = 0; count < REG_MAX_CHAN_CHANGE_CBKS; count++)
+		if (psoc_priv_obj->delta_cbk_list[count].cbk == cbk) {
+			psoc_priv_obj->delta_cbk_list[count].cbk = NULL;
+			break;
+		}
+	qdf_spin_unlock_bh(&psoc_priv_obj->cbk_list_lock);
+
+	if (count == REG_MAX_CHAN_CHANGE_CBKS)
+		reg_err("delta callback not found in the list");
+}
@@ -166,7 +166,8 @@ static void reg_update_unsafe_ch(struct wlan_objmgr_psoc *psoc,
 			psoc_priv_obj->ch_avoid_ind = false;
 	}
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_UNSAFE_CHAN);
 	status = reg_send_scheduler_msg_nb(psoc, pdev);
 
 	if (QDF_IS_STATUS_ERROR(status))
@@ -84,6 +84,69 @@ struct chan_change_cbk_entry {
 	void *arg;
 };
 
+/**
+ * typedef reg_chan_delta_callback() - Regulatory channel delta callback
+ * @psoc: Pointer to psoc
+ * @pdev: Pointer to pdev
+ * @chan_list: Pointer to regulatory channel list
+ * @delta: Channels of @chan_list changed since the previous notification
+ * @arg: list of arguments
+ */
+typedef void (*reg_chan_delta_callback)(
+		struct wlan_objmgr_psoc *psoc,
+		struct wlan_objmgr_pdev *pdev,
+		struct regulatory_channel *chan_list,
+		const struct reg_chan_list_delta *delta,
+		void *arg);
+
+/**
+ * struct chan_delta_cbk_entry - Channel delta callback entry
+ * @cbk: Callback
+ * @arg: Arguments
+ */
+struct chan_delta_cbk_entry {
+	reg_chan_delta_callback cbk;
+	void *arg;
+};
+
+/**
+ * struct reg_chan_list_base_inputs - pdev configuration the base stage of the
+ * current channel list is computed from
+ * @range_2g_low: 2 GHz low frequency limit
+ * @range_2g_high: 2 GHz high frequency limit
+ * @range_5g_low: 5 GHz low frequency limit
+ * @range_5g_high: 5 GHz high frequency limit
+ * @band_capability: bitmap of enabled bands
+ * @dfs_enabled: whether DFS channels are enabled
+ * @indoor_chan_enabled: whether indoor channels are enabled, selects the
+ *	6 GHz LPI/VLP merge order
+ * @unii_5g_bitmap: UNII-1/UNII-2A disable bitmap
+ * @is_6g_channel_list_populated: whether the 6 GHz lists are populated
+ * @ap_pwr_type: 6 GHz AP power type
+ * @client_mobility_type: 6 GHz client type
+ * @is_6g_afc_power_event_received: whether an AFC power event was applied
+ */
+struct reg_chan_list_base_inputs {
+	qdf_freq_t range_2g_low;
+	qdf_freq_t range_2g_high;
+	qdf_freq_t range_5g_low;
+	qdf_freq_t range_5g_high;
+	uint32_t band_capability;
+	bool dfs_enabled;
+	bool indoor_chan_enabled;
+#ifdef DISABLE_UNII_SHARED_BANDS
+	uint8_t unii_5g_bitmap;
+#endif
+#ifdef CONFIG_BAND_6GHZ
+	bool is_6g_channel_list_populated;
+	enum reg_6g_ap_type ap_pwr_type;
+	enum reg_6g_client_type client_mobility_type;
+#endif
+#ifdef CONFIG_AFC_SUPPORT
+	bool is_6g_afc_power_event_received;
+#endif
+};
+
 /**
  * struct wlan_regulatory_psoc_priv_obj - wlan regulatory psoc private object
  * @mas_chan_params: master channel parameters list
@@ -120,6 +183,7 @@ struct chan_change_cbk_entry {
  * @coex_unsafe_chan_reg_disable: To disable reg channels for received coex
  * unsafe channels list
  * @sta_sap_scc_on_indoor_channel: Value of sap+sta scc on indoor support
+ * @delta_cbk_list: channel delta callbacks, protected by @cbk_list_lock
  */
 struct wlan_regulatory_psoc_priv_obj {
 	struct mas_chan_params mas_chan_params[PSOC_MAX_PHY_REG_CAP];
@@ -188,6 +252,7 @@ struct wlan_regulatory_psoc_priv_obj {
 	bool coex_unsafe_chan_reg_disable;
 #endif
 	bool sta_sap_scc_on_indoor_channel;
+	struct chan_delta_cbk_entry delta_cbk_list[REG_MAX_CHAN_CHANGE_CBKS];
 };
 
 /**
@@ -229,6 +294,13 @@ struct wlan_regulatory_psoc_priv_obj {
  * @is_reg_noaction_on_afc_pwr_evt: indicates whether regulatory needs to
  * take action when AFC Power event is received
  * @sta_sap_scc_on_indoor_channel: Value of sap+sta scc on indoor support
+ * @base_chan_list: current channel list as it was before the NOL and later
+ *	passes of the last full rebuild
+ * @base_inputs: configuration @base_chan_list was computed from
+ * @base_chan_list_valid: whether @base_chan_list may be reused
+ * @chan_delta_sb: channels changed since the last south bound notification
+ * @chan_delta_nb: channels changed since the last north bound notification
+ * @rebuild_stats: current channel list rebuild timing per trigger
  */
 struct wlan_regulatory_pdev_priv_obj {
 	struct regulatory_channel cur_chan_list[NUM_CHANNELS];
@@ -301,6 +373,13 @@ struct wlan_regulatory_pdev_priv_obj {
 	bool is_reg_noaction_on_afc_pwr_evt;
 #endif
 	bool sta_sap_scc_on_indoor_channel;
+	struct regulatory_channel base_chan_list[NUM_CHANNELS];
+	struct reg_chan_list_base_inputs base_inputs;
+	bool base_chan_list_valid;
+	struct reg_chan_list_delta chan_delta_sb;
+	struct reg_chan_list_delta chan_delta_nb;
+	struct reg_chan_list_rebuild_stats
+			rebuild_stats[REG_CHAN_LIST_TRIGGER_MAX];
 };
 
 /**
@@ -47,6 +47,78 @@
 
 const struct chan_map *channel_map;
 
+/*
+ * Channel center frequencies all sit on a 5 MHz raster above channel 1,
+ * so reg_freq_lookup_tbl keeps one slot per 5 MHz step holding the lowest
+ * channel enum whose center frequency falls into that step. At most two
+ * centers share a step (4.9 GHz band), so a lookup checks the slot enum
+ * and its successor. The center frequencies are identical across the
+ * regional channel maps, hence one table built from channel_map_global
+ * serves whichever map is current.
+ */
+#define REG_FREQ_LOOKUP_MIN_FREQ  TWOG_CHAN_1_IN_MHZ
+#define REG_FREQ_LOOKUP_MAX_FREQ  7115
+#define REG_FREQ_LOOKUP_STEP      5
+#define REG_FREQ_LOOKUP_SLOTS \
+	((REG_FREQ_LOOKUP_MAX_FREQ - REG_FREQ_LOOKUP_MIN_FREQ) / \
+	 REG_FREQ_LOOKUP_STEP + 1)
+#define REG_FREQ_LOOKUP_NONE      0xFF
+
+QDF_COMPILE_TIME_ASSERT(reg_freq_lookup_enum_fits,
+			NUM_CHANNELS < REG_FREQ_LOOKUP_NONE);
+
+static uint8_t reg_freq_lookup_tbl[REG_FREQ_LOOKUP_SLOTS];
+static bool reg_chan_lookup_ready;
+
+/**
+ * reg_get_chan_enum_for_freq_linear() - Reference frequency to channel enum
+ * search over the current channel map
+ * @freq: Channel center frequency
+ *
+ * Return: Channel enum, or INVALID_CHANNEL if @freq is not a channel center
+ */
+static enum channel_enum reg_get_chan_enum_for_freq_linear(qdf_freq_t freq)
+{
+	uint32_t count;
+
+	for (count = 0; count < NUM_CHANNELS; count++)
+		if (channel_map[count].center_freq == freq)
+			return count;
+
+	return INVALID_CHANNEL;
+}
+
+/**
+ * reg_freq_lookup_chan_enum() - Frequency to channel enum via the 5 MHz
+ * slot table
+ * @freq: Channel center frequency
+ *
+ * Must only be called once reg_chan_lookup_ready is set.
+ *
+ * Return: Channel enum, or INVALID_CHANNEL if @freq is not a channel center
+ */
+static inline enum channel_enum reg_freq_lookup_chan_enum(qdf_freq_t freq)
+{
+	uint8_t chan_enum;
+
+	if (freq < REG_FREQ_LOOKUP_MIN_FREQ || freq > REG_FREQ_LOOKUP_MAX_FREQ)
+		return INVALID_CHANNEL;
+
+	chan_enum = reg_freq_lookup_tbl[(freq - REG_FREQ_LOOKUP_MIN_FREQ) /
+					REG_FREQ_LOOKUP_STEP];
+	if (chan_enum == REG_FREQ_LOOKUP_NONE)
+		return INVALID_CHANNEL;
+
+	if (channel_map[chan_enum].center_freq == freq)
+		return chan_enum;
+
+	if (chan_enum + 1 < NUM_CHANNELS &&
+	    channel_map[chan_enum + 1].center_freq == freq)
+		return chan_enum + 1;
+
+	return INVALID_CHANNEL;
+}
+
 #ifdef CONFIG_CHAN_FREQ_API
 /* bonded_chan_40mhz_list_freq - List of 40MHz bonnded channel frequencies */
 static const struct bonded_channel_freq bonded_chan_40mhz_list_freq[] = {
@@ -316,12 +388,83 @@ struct bw_puncture_bitmap_pair bw_puncture_bitmap_pair_map[] = {
 };
 #endif /* WLAN_FEATURE_11BE */
 
+/*
+ * reg_bonded_chan_idx - For each entry of bw_bonded_array_pair_map and each
+ * channel enum, the position (plus one) of the first bonded channel of that
+ * width containing the channel center frequency, or 0 if there is none.
+ */
+static uint8_t reg_bonded_chan_idx[QDF_ARRAY_SIZE(bw_bonded_array_pair_map)]
+				  [NUM_CHANNELS];
+
+/**
+ * reg_get_bonded_chan_entry_linear() - Reference bonded channel search
+ * @bonded_chan_arr: Bonded channel array of the requested width
+ * @array_size: Number of entries in @bonded_chan_arr
+ * @freq: Input frequency
+ *
+ * Return: First bonded channel containing @freq, else NULL
+ */
+static const struct bonded_channel_freq *
+reg_get_bonded_chan_entry_linear(const struct bonded_channel_freq
+				 *bonded_chan_arr,
+				 uint16_t array_size, qdf_freq_t freq)
+{
+	uint16_t i;
+
+	for (i = 0; i < array_size; i++) {
+		if ((freq >= bonded_chan_arr[i].start_freq) &&
+		    (freq <= bonded_chan_arr[i].end_freq)) {
+			return &bonded_chan_arr[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * reg_init_bonded_chan_lookup() - Fill reg_bonded_chan_idx from the bonded
+ * channel arrays
+ *
+ * Return: QDF_STATUS_SUCCESS, or QDF_STATUS_E_RANGE if a bonded array is too
+ * large to be indexed by the table
+ */
+static QDF_STATUS reg_init_bonded_chan_lookup(void)
+{
+	const struct bonded_channel_freq *bonded_chan_arr, *entry;
+	uint16_t array_size, i;
+	enum channel_enum chan_enum;
+	qdf_freq_t freq;
+
+	for (i = 0; i < QDF_ARRAY_SIZE(bw_bonded_array_pair_map); i++) {
+		bonded_chan_arr = bw_bonded_array_pair_map[i].bonded_chan_arr;
+		array_size = bw_bonded_array_pair_map[i].array_size;
+		if (array_size >= 0xFF) {
+			reg_err("bonded array for chwidth %d too large: %d",
+				bw_bonded_array_pair_map[i].chwidth,
+				array_size);
+			return QDF_STATUS_E_RANGE;
+		}
+
+		for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+			freq = channel_map_global[chan_enum].center_freq;
+			entry = reg_get_bonded_chan_entry_linear(
+					bonded_chan_arr, array_size, freq);
+			reg_bonded_chan_idx[i][chan_enum] =
+				entry ? entry - bonded_chan_arr + 1 : 0;
+		}
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
 const struct bonded_channel_freq *
 reg_get_bonded_chan_entry(qdf_freq_t freq,
 			  enum phy_ch_width chwidth)
 {
-	const struct bonded_channel_freq *bonded_chan_arr;
+	const struct bonded_channel_freq *bonded_chan_arr, *entry;
 	uint16_t array_size, i, num_bws;
+	enum channel_enum chan_enum;
+	uint8_t idx;
 
 	num_bws = QDF_ARRAY_SIZE(bw_bonded_array_pair_map);
 	for (i = 0; i < num_bws; i++) {
@@ -338,18 +481,76 @@ reg_get_bonded_chan_entry(qdf_freq_t freq,
 		return NULL;
 	}
 
-	for (i = 0; i < array_size; i++) {
-		if ((freq >= bonded_chan_arr[i].start_freq) &&
-		    (freq <= bonded_chan_arr[i].end_freq)) {
-			return &bonded_chan_arr[i];
-		}
+	/*
+	 * Channel center frequencies are resolved through the precomputed
+	 * index, anything else (e.g. a bonded center frequency) is searched.
+	 */
+	chan_enum = reg_chan_lookup_ready ? reg_freq_lookup_chan_enum(freq) :
+					    INVALID_CHANNEL;
+	if (chan_enum != INVALID_CHANNEL) {
+		idx = reg_bonded_chan_idx[i][chan_enum];
+		entry = idx ? &bonded_chan_arr[idx - 1] : NULL;
+	} else {
+		entry = reg_get_bonded_chan_entry_linear(bonded_chan_arr,
+							 array_size, freq);
 	}
+	if (entry)
+		return entry;
 
 	reg_debug("Could not find a bonded pair for freq %d and width %d",
 		  freq, chwidth);
 	return NULL;
 }
 
+#ifdef REG_CHAN_LOOKUP_VERIFY
+/**
+ * reg_verify_bonded_chan_lookup() - Check reg_get_bonded_chan_entry()
+ * against the reference search for every width and frequency in @min..@max
+ * @min_freq: Lowest frequency to check
+ * @max_freq: Highest frequency to check
+ *
+ * Return: Number of mismatches found
+ */
+static uint32_t reg_verify_bonded_chan_lookup(qdf_freq_t min_freq,
+					      qdf_freq_t max_freq)
+{
+	const struct bw_bonded_array_pair *pair;
+	const struct bonded_channel_freq *fast, *ref;
+	uint32_t mismatches = 0;
+	qdf_freq_t freq;
+	uint16_t i;
+
+	for (i = 0; i < QDF_ARRAY_SIZE(bw_bonded_array_pair_map); i++) {
+		pair = &bw_bonded_array_pair_map[i];
+		for (freq = min_freq; freq <= max_freq; freq++) {
+			fast = reg_get_bonded_chan_entry(freq, pair->chwidth);
+			ref = reg_get_bonded_chan_entry_linear(
+					pair->bonded_chan_arr,
+					pair->array_size, freq);
+			if (fast != ref) {
+				reg_err("bonded mismatch freq %d width %d",
+					freq, pair->chwidth);
+				mismatches++;
+			}
+		}
+	}
+
+	return mismatches;
+}
+#endif /* REG_CHAN_LOOKUP_VERIFY */
+#else
+static inline QDF_STATUS reg_init_bonded_chan_lookup(void)
+{
+	return QDF_STATUS_SUCCESS;
+}
+
+#ifdef REG_CHAN_LOOKUP_VERIFY
+static inline uint32_t reg_verify_bonded_chan_lookup(qdf_freq_t min_freq,
+						     qdf_freq_t max_freq)
+{
+	return 0;
+}
+#endif /* REG_CHAN_LOOKUP_VERIFY */
 #endif /*CONFIG_CHAN_FREQ_API*/
 
 enum phy_ch_width get_next_lower_bandwidth(enum phy_ch_width ch_width)
@@ -1221,6 +1422,83 @@ const struct chan_map channel_map_china[NUM_CHANNELS] = {
 #endif /* CONFIG_BAND_6GHZ */
 };
 
+#ifdef REG_CHAN_LOOKUP_VERIFY
+/**
+ * reg_verify_chan_lookup_tables() - Exhaustively compare the table driven
+ * frequency lookups with the reference linear searches
+ *
+ * Every frequency from 100 MHz below the first channel to 100 MHz above the
+ * last one is checked, for the channel enum and for each bonded width.
+ *
+ * Return: None
+ */
+static void reg_verify_chan_lookup_tables(void)
+{
+	qdf_freq_t min_freq, max_freq, freq;
+	uint32_t mismatches = 0;
+
+	min_freq = channel_map_global[MIN_CHANNEL].center_freq - 100;
+	max_freq = channel_map_global[MAX_CHANNEL].center_freq + 100;
+
+	for (freq = min_freq; freq <= max_freq; freq++) {
+		if (reg_freq_lookup_chan_enum(freq) !=
+		    reg_get_chan_enum_for_freq_linear(freq)) {
+			reg_err("chan enum lookup mismatch freq %d", freq);
+			mismatches++;
+		}
+	}
+
+	mismatches += reg_verify_bonded_chan_lookup(min_freq, max_freq);
+
+	if (mismatches)
+		reg_err("channel lookup tables: %d mismatches", mismatches);
+	else
+		reg_debug("channel lookup tables verified for %d-%d MHz",
+			  min_freq, max_freq);
+}
+#else
+static inline void reg_verify_chan_lookup_tables(void)
+{
+}
+#endif /* REG_CHAN_LOOKUP_VERIFY */
+
+void reg_init_chan_lookup_tables(void)
+{
+	enum channel_enum chan_enum;
+	qdf_freq_t freq;
+	uint16_t slot;
+
+	reg_chan_lookup_ready = false;
+	qdf_mem_set(reg_freq_lookup_tbl, sizeof(reg_freq_lookup_tbl),
+		    REG_FREQ_LOOKUP_NONE);
+
+	for (chan_enum = 0; chan_enum < NUM_CHANNELS; chan_enum++) {
+		freq = channel_map_global[chan_enum].center_freq;
+		if (freq < REG_FREQ_LOOKUP_MIN_FREQ ||
+		    freq > REG_FREQ_LOOKUP_MAX_FREQ) {
+			reg_err("chan enum %d freq %d outside lookup table",
+				chan_enum, freq);
+			return;
+		}
+
+		slot = (freq - REG_FREQ_LOOKUP_MIN_FREQ) / REG_FREQ_LOOKUP_STEP;
+		if (reg_freq_lookup_tbl[slot] == REG_FREQ_LOOKUP_NONE) {
+			reg_freq_lookup_tbl[slot] = chan_enum;
+		} else if (reg_freq_lookup_tbl[slot] + 1 != chan_enum) {
+			/* only two adjacent enums may share a 5 MHz step */
+			reg_err("chan enum %d freq %d collides in lookup table",
+				chan_enum, freq);
+			return;
+		}
+	}
+
+	if (QDF_IS_STATUS_ERROR(reg_init_bonded_chan_lookup()))
+		return;
+
+	reg_chan_lookup_ready = true;
+	reg_verify_chan_lookup_tables();
+}
+
 void reg_init_channel_map(enum dfs_reg dfs_region)
 {
 	switch (dfs_region) {
@@ -1859,7 +2137,8 @@ QDF_STATUS reg_modify_chan_144(struct wlan_objmgr_pdev *pdev,
 	reg_debug("setting chan 144: %d", enable_ch_144);
 	pdev_priv_obj->en_chan_144 = enable_ch_144;
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_CHAN_144);
 
 	reg_tx_ops = reg_get_psoc_tx_ops(psoc);
 	if (reg_tx_ops->fill_umac_legacy_chanlist)
@@ -2588,7 +2867,8 @@ QDF_STATUS reg_enable_dfs_channels(struct wlan_objmgr_pdev *pdev,
 
 	pdev_priv_obj->dfs_enabled = enable;
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_DFS);
 
 	reg_tx_ops = reg_get_psoc_tx_ops(psoc);
 
@@ -2700,7 +2980,8 @@ QDF_STATUS reg_modify_pdev_chan_range(struct wlan_objmgr_pdev *pdev)
 	pdev_priv_obj->range_5g_high = reg_cap_ptr->high_5ghz_chan;
 	pdev_priv_obj->wireless_modes = reg_cap_ptr->wireless_modes;
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_FREQ_RANGE);
 
 	reg_tx_ops = reg_get_psoc_tx_ops(psoc);
 
@@ -2795,7 +3076,8 @@ QDF_STATUS reg_disable_chan_coex(struct wlan_objmgr_pdev *pdev,
 	reg_debug_rl("Setting UNII bitmask for 5G: %d", unii_5g_bitmap);
 	pdev_priv_obj->unii_5g_bitmap = unii_5g_bitmap;
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_COEX);
 
 	reg_tx_ops = reg_get_psoc_tx_ops(psoc);
 
@@ -2852,11 +3134,14 @@ QDF_STATUS reg_get_channel_list_with_power_for_freq(struct wlan_objmgr_pdev
 
 enum channel_enum reg_get_chan_enum_for_freq(qdf_freq_t freq)
 {
-	uint32_t count;
+	enum channel_enum chan_enum;
 
-	for (count = 0; count < NUM_CHANNELS; count++)
-		if (channel_map[count].center_freq == freq)
-			return count;
+	if (reg_chan_lookup_ready)
+		chan_enum = reg_freq_lookup_chan_enum(freq);
+	else
+		chan_enum = reg_get_chan_enum_for_freq_linear(freq);
+	if (chan_enum != INVALID_CHANNEL)
+		return chan_enum;
 
 	reg_debug_rl("invalid channel center frequency %d", freq);
 
@@ -4678,7 +4963,8 @@ void reg_update_nol_ch_for_freq(struct wlan_objmgr_pdev *pdev,
 		return;
 	}
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_NOL);
 
 	reg_send_scheduler_msg_sb(psoc, pdev);
 }
@@ -6201,7 +6487,8 @@ QDF_STATUS reg_set_ap_pwr_and_update_chan_list(struct wlan_objmgr_pdev *pdev,
 		return status;
 	}
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_6G_PWR_MODE);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -6517,7 +6804,8 @@ reg_update_avoid_ch_ext(struct wlan_objmgr_psoc *psoc,
 			psoc_priv_obj->ch_avoid_ext_ind = false;
 	}
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_AVOID_EXT);
 	status = reg_send_scheduler_msg_sb(psoc, pdev);
 
 	if (QDF_IS_STATUS_ERROR(status))
@@ -388,6 +388,15 @@ bool reg_chan_in_range(struct regulatory_channel *chan_list,
  */
 void reg_init_channel_map(enum dfs_reg dfs_region);
 
+/**
+ * reg_init_chan_lookup_tables() - Build the tables behind the constant time
+ * frequency to channel enum and bonded channel lookups
+ *
+ * Until this has run, or if the tables cannot be built, the lookups fall
+ * back to searching the channel and bonded channel arrays.
+ */
+void reg_init_chan_lookup_tables(void);
+
 /**
  * reg_get_psoc_tx_ops() - Get regdb tx ops
  * @psoc: Pointer to psoc structure
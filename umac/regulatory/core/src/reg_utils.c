@@ -579,7 +579,8 @@ QDF_STATUS reg_set_band(struct wlan_objmgr_pdev *pdev, uint32_t band_bitmap)
 	reg_info("set band bitmap: %d", band_bitmap);
 	pdev_priv_obj->band_capability = band_bitmap;
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_BAND);
 
 	status = reg_send_scheduler_msg_sb(psoc, pdev);
 
@@ -624,7 +625,8 @@ QDF_STATUS reg_restore_cached_channels(struct wlan_objmgr_pdev *pdev)
 	}
 
 	pdev_priv_obj->disable_cached_channels = false;
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_CACHED_CHAN);
 	status = reg_send_scheduler_msg_sb(psoc, pdev);
 	return status;
 }
@@ -648,7 +650,8 @@ QDF_STATUS reg_disable_cached_channels(struct wlan_objmgr_pdev *pdev)
 	}
 
 	pdev_priv_obj->disable_cached_channels = true;
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_CACHED_CHAN);
 	status = reg_send_scheduler_msg_sb(psoc, pdev);
 	return status;
 }
@@ -747,7 +750,8 @@ QDF_STATUS reg_set_fcc_constraint(struct wlan_objmgr_pdev *pdev,
 		return QDF_STATUS_E_INVAL;
 	}
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_FCC);
 
 	status = reg_send_scheduler_msg_sb(psoc, pdev);
 
@@ -852,7 +856,8 @@ static void reg_change_pdev_for_config(struct wlan_objmgr_psoc *psoc,
 	pdev_priv_obj->sta_sap_scc_on_indoor_channel =
 		psoc_priv_obj->sta_sap_scc_on_indoor_channel;
 
-	reg_compute_pdev_current_chan_list(pdev_priv_obj);
+	reg_update_pdev_current_chan_list(pdev_priv_obj,
+					  REG_CHAN_LIST_TRIGGER_CONFIG);
 
 	reg_send_scheduler_msg_sb(psoc, pdev);
 }
@@ -25,6 +25,7 @@
 #ifndef __REG_SERVICES_PUBLIC_STRUCT_H_
 #define __REG_SERVICES_PUBLIC_STRUCT_H_
 
+#include <qdf_util.h>
 #ifdef CONFIG_AFC_SUPPORT
 #include <wlan_reg_afc.h>
 #endif
@@ -1593,18 +1594,88 @@ struct avoid_freq_ind_data {
 	struct unsafe_ch_list chan_list;
 };
 
+/**
+ * enum reg_chan_list_trigger - Reason for recomputing the pdev current
+ * channel list
+ * @REG_CHAN_LIST_TRIGGER_FULL: master channel list or country changed
+ * @REG_CHAN_LIST_TRIGGER_BAND: band capability changed
+ * @REG_CHAN_LIST_TRIGGER_DFS: DFS channels enabled or disabled
+ * @REG_CHAN_LIST_TRIGGER_FREQ_RANGE: pdev frequency range changed
+ * @REG_CHAN_LIST_TRIGGER_COEX: UNII-1/UNII-2A coex disable bitmap changed
+ * @REG_CHAN_LIST_TRIGGER_6G_PWR_MODE: 6 GHz AP power type changed
+ * @REG_CHAN_LIST_TRIGGER_CONFIG: regulatory config vars (SRD, 5.9 GHz, ...)
+ *	changed
+ * @REG_CHAN_LIST_TRIGGER_UNSAFE_CHAN: LTE coex unsafe channels changed
+ * @REG_CHAN_LIST_TRIGGER_NOL: NOL membership of some channels changed
+ * @REG_CHAN_LIST_TRIGGER_SAP_STATE: SAP state changed
+ * @REG_CHAN_LIST_TRIGGER_FCC: FCC channel 12/13 constraint changed
+ * @REG_CHAN_LIST_TRIGGER_CHAN_144: channel 144 enabled or disabled
+ * @REG_CHAN_LIST_TRIGGER_CACHED_CHAN: cached channels disabled or restored
+ * @REG_CHAN_LIST_TRIGGER_AVOID_EXT: extended avoid frequency list changed
+ * @REG_CHAN_LIST_TRIGGER_MAX: number of triggers
+ */
+enum reg_chan_list_trigger {
+	REG_CHAN_LIST_TRIGGER_FULL,
+	REG_CHAN_LIST_TRIGGER_BAND,
+	REG_CHAN_LIST_TRIGGER_DFS,
+	REG_CHAN_LIST_TRIGGER_FREQ_RANGE,
+	REG_CHAN_LIST_TRIGGER_COEX,
+	REG_CHAN_LIST_TRIGGER_6G_PWR_MODE,
+	REG_CHAN_LIST_TRIGGER_CONFIG,
+	REG_CHAN_LIST_TRIGGER_UNSAFE_CHAN,
+	REG_CHAN_LIST_TRIGGER_NOL,
+	REG_CHAN_LIST_TRIGGER_SAP_STATE,
+	REG_CHAN_LIST_TRIGGER_FCC,
+	REG_CHAN_LIST_TRIGGER_CHAN_144,
+	REG_CHAN_LIST_TRIGGER_CACHED_CHAN,
+	REG_CHAN_LIST_TRIGGER_AVOID_EXT,
+	REG_CHAN_LIST_TRIGGER_MAX,
+};
+
+/**
+ * struct reg_chan_list_delta - Channels of the current channel list changed
+ * since the last notification
+ * @num_changed: number of bits set in @changed
+ * @changed: bitmap of changed channels, indexed by enum channel_enum
+ */
+struct reg_chan_list_delta {
+	uint16_t num_changed;
+	qdf_bitmap(changed, NUM_CHANNELS);
+};
+
+/**
+ * struct reg_chan_list_rebuild_stats - Current channel list rebuild timing
+ * for one trigger
+ * @count: number of rebuilds
+ * @incremental: number of rebuilds that reused the cached base channel list
+ * @last_us: duration of the last rebuild in microseconds
+ * @max_us: longest rebuild in microseconds
+ * @total_us: sum of all rebuild durations in microseconds
+ * @last_changed: number of channels changed by the last rebuild
+ */
+struct reg_chan_list_rebuild_stats {
+	uint32_t count;
+	uint32_t incremental;
+	uint64_t last_us;
+	uint64_t max_us;
+	uint64_t total_us;
+	uint16_t last_changed;
+};
+
 /**
  * struct reg_sched_payload
  * @psoc: psoc ptr
  * @pdev: pdev ptr
  * @ch_avoid_ind: if avoidance event indicated
  * @avoid_info: chan avoid info if @ch_avoid_ind is true
+ * @delta: channels changed since the previous message in this direction
  */
 struct reg_sched_payload {
 	struct wlan_objmgr_psoc *psoc;
 	struct wlan_objmgr_pdev *pdev;
 	bool ch_avoid_ind;
 	struct avoid_freq_ind_data avoid_info;
+	struct reg_chan_list_delta delta;
 };
 
 #define FIVEG_STARTING_FREQ        5000
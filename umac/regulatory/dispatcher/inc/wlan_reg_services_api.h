@@ -987,6 +987,45 @@ void wlan_reg_register_chan_change_callback(struct wlan_objmgr_psoc *psoc,
 void wlan_reg_unregister_chan_change_callback(struct wlan_objmgr_psoc *psoc,
 					      void *cbk);
 
+/**
+ * wlan_reg_register_chan_delta_callback() - add chan delta cbk
+ * @psoc: psoc ptr
+ * @cbk: callback, of type reg_chan_delta_callback
+ * @arg: argument
+ *
+ * The callback receives the current channel list together with the set of
+ * channels changed since the previous notification, and is not called when
+ * nothing changed.
+ *
+ * Return: None
+ */
+void wlan_reg_register_chan_delta_callback(struct wlan_objmgr_psoc *psoc,
+					   void *cbk, void *arg);
+
+/**
+ * wlan_reg_unregister_chan_delta_callback() - remove chan delta cbk
+ * @psoc: psoc ptr
+ * @cbk: callback
+ *
+ * Return: None
+ */
+void wlan_reg_unregister_chan_delta_callback(struct wlan_objmgr_psoc *psoc,
+					     void *cbk);
+
+/**
+ * wlan_reg_get_chan_list_rebuild_stats() - Get the current channel list
+ * rebuild timing of a trigger
+ * @pdev: pdev ptr
+ * @trigger: rebuild trigger
+ * @stats: output statistics
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS
+wlan_reg_get_chan_list_rebuild_stats(struct wlan_objmgr_pdev *pdev,
+				     enum reg_chan_list_trigger trigger,
+				     struct reg_chan_list_rebuild_stats *stats);
+
 /**
  * wlan_reg_is_11d_offloaded() - 11d offloaded supported
  * @psoc: psoc ptr
@@ -314,6 +314,7 @@ QDF_STATUS wlan_regulatory_init(void)
 		goto unreg_pdev_create;
 	}
 	channel_map = channel_map_global;
+	reg_init_chan_lookup_tables();
 	reg_debug("regulatory handlers registered with obj mgr");
 
 	return status;
@@ -657,6 +658,28 @@ void wlan_reg_unregister_chan_change_callback(struct wlan_objmgr_psoc *psoc,
 					    (reg_chan_change_callback)cbk);
 }
 
+void wlan_reg_register_chan_delta_callback(struct wlan_objmgr_psoc *psoc,
+					   void *cbk, void *arg)
+{
+	reg_register_chan_delta_callback(psoc, (reg_chan_delta_callback)cbk,
+					 arg);
+}
+
+void wlan_reg_unregister_chan_delta_callback(struct wlan_objmgr_psoc *psoc,
+					     void *cbk)
+{
+	reg_unregister_chan_delta_callback(psoc,
+					   (reg_chan_delta_callback)cbk);
+}
+
+QDF_STATUS
+wlan_reg_get_chan_list_rebuild_stats(struct wlan_objmgr_pdev *pdev,
+				     enum reg_chan_list_trigger trigger,
+				     struct reg_chan_list_rebuild_stats *stats)
+{
+	return reg_get_chan_list_rebuild_stats(pdev, trigger, stats);
+}
+
 bool wlan_reg_is_11d_offloaded(struct wlan_objmgr_psoc *psoc)
 {
 	return reg_is_11d_offloaded(psoc);
@@ -40,6 +40,9 @@
  *   it the node is physically deleted from the scan cache.
  * - While reading the node the ref_cnt should be incremented. Once reading
  *   operation is done ref_cnt is decremented.
+ * - Each node is also linked on the age list of the db in insertion order,
+ *   so eviction and age out start from its head instead of walking every
+ *   hash bucket.
  */
 #include <qdf_status.h>
 #include <wlan_objmgr_psoc_obj.h>
@@ -200,12 +203,13 @@ static QDF_STATUS scm_del_scan_node_from_db(struct scan_dbs *scan_db,
 	struct scan_cache_node *scan_node)
 {
 	QDF_STATUS status = QDF_STATUS_SUCCESS;
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 
 	if (!scan_node)
 		return QDF_STATUS_E_INVAL;
 
 	hash_idx = SCAN_GET_HASH(scan_node->entry->bssid.bytes);
+	qdf_list_remove_node(&scan_db->age_list, &scan_node->age_node);
 	scm_del_scan_node(&scan_db->scan_hash_tbl[hash_idx], scan_node);
 	scan_db->num_entries--;
 
@@ -298,6 +302,26 @@ static void scm_scan_entry_del(struct scan_dbs *scan_db,
 	scm_scan_entry_put_ref(scan_db, scan_node, false);
 }
 
+/**
+ * scm_scan_node_init() - init a scan node before it is linked to the db
+ * @scan_node: node with its entry set
+ *
+ * Return: void
+ */
+static void scm_scan_node_init(struct scan_cache_node *scan_node)
+{
+	struct scan_cache_entry *entry = scan_node->entry;
+
+	qdf_atomic_init(&scan_node->ref_cnt);
+	qdf_atomic_init(&scan_node->snap_ref);
+	scan_node->cookie = SCAN_NODE_ACTIVE_COOKIE;
+	scan_node->summary.entry_time = entry->scan_entry_time;
+	scan_node->summary.chan_freq = entry->channel.chan_freq;
+	scan_node->summary.is_6ghz =
+		WLAN_REG_IS_6GHZ_CHAN_FREQ(entry->channel.chan_freq);
+	scm_scan_entry_get_ref(scan_node);
+}
+
 /**
  * scm_add_scan_node() - API to add scan node
  * @scan_db: data base
@@ -305,6 +329,9 @@ static void scm_scan_entry_del(struct scan_dbs *scan_db,
  * @dup_node: node before which new node to be added
  * if it's not NULL, otherwise add node to tail
  *
+ * The node is always added to the tail of the age list, as the newest
+ * entry of the db.
+ *
  * Call must be protected by scan_db->scan_db_lock
  *
  * Return: void
@@ -313,24 +340,54 @@ static void scm_add_scan_node(struct scan_dbs *scan_db,
 	struct scan_cache_node *scan_node,
 	struct scan_cache_node *dup_node)
 {
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 
 	hash_idx =
 		SCAN_GET_HASH(scan_node->entry->bssid.bytes);
 
-	qdf_atomic_init(&scan_node->ref_cnt);
-	scan_node->cookie = SCAN_NODE_ACTIVE_COOKIE;
-	scm_scan_entry_get_ref(scan_node);
+	scm_scan_node_init(scan_node);
 	if (!dup_node)
 		qdf_list_insert_back(&scan_db->scan_hash_tbl[hash_idx],
 				     &scan_node->node);
 	else
 		qdf_list_insert_before(&scan_db->scan_hash_tbl[hash_idx],
 				       &scan_node->node, &dup_node->node);
+	qdf_list_insert_back(&scan_db->age_list, &scan_node->age_node);
 
 	scan_db->num_entries++;
 }
 
+/**
+ * scm_replace_scan_node() - API to replace a scan node with a new one
+ * @scan_db: data base
+ * @new_node: node to be added
+ * @old_node: node to be replaced
+ *
+ * The new node takes the place of @old_node in both the hash and the age
+ * list, @old_node is deleted and freed once its last ref is released.
+ *
+ * Call must be protected by scan_db->scan_db_lock
+ *
+ * Return: void
+ */
+static void scm_replace_scan_node(struct scan_dbs *scan_db,
+				  struct scan_cache_node *new_node,
+				  struct scan_cache_node *old_node)
+{
+	uint32_t hash_idx;
+
+	hash_idx = SCAN_GET_HASH(old_node->entry->bssid.bytes);
+
+	scm_scan_node_init(new_node);
+	qdf_list_insert_before(&scan_db->scan_hash_tbl[hash_idx],
+			       &new_node->node, &old_node->node);
+	qdf_list_insert_before(&scan_db->age_list,
+			       &new_node->age_node, &old_node->age_node);
+	scan_db->num_entries++;
+
+	scm_scan_entry_del(scan_db, old_node);
+}
+
 
 /**
  * scm_get_next_valid_node() - API get the next valid scan node from
@@ -413,6 +470,54 @@ scm_get_next_node(struct scan_dbs *scan_db,
 	return next_node;
 }
 
+/**
+ * scm_get_next_age_node() - API get the next scan node from the age list
+ * @scan_db: scan data base
+ * @cur_node: current node pointer
+ *
+ * Same as scm_get_next_node() but walks the age list, so nodes come out
+ * oldest first. If cur_node is NULL it will return the oldest node.
+ *
+ * Return: next scan cache node
+ */
+static struct scan_cache_node *
+scm_get_next_age_node(struct scan_dbs *scan_db,
+		      struct scan_cache_node *cur_node)
+{
+	struct scan_cache_node *next_node = NULL;
+	struct scan_cache_node *scan_node;
+	qdf_list_node_t *next_list = NULL;
+	qdf_list_node_t *temp_list;
+
+	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	if (cur_node)
+		qdf_list_peek_next(&scan_db->age_list, &cur_node->age_node,
+				   &next_list);
+	else
+		qdf_list_peek_front(&scan_db->age_list, &next_list);
+
+	while (next_list) {
+		scan_node = qdf_container_of(next_list,
+			struct scan_cache_node, age_node);
+		if (scan_node->cookie == SCAN_NODE_ACTIVE_COOKIE) {
+			next_node = scan_node;
+			/* Increase the ref count of the obtained node */
+			scm_scan_entry_get_ref(next_node);
+			break;
+		}
+		temp_list = NULL;
+		qdf_list_peek_next(&scan_db->age_list, next_list, &temp_list);
+		next_list = temp_list;
+	}
+
+	/* Decrement the ref count of the previous node */
+	if (cur_node)
+		scm_scan_entry_put_ref(scan_db, cur_node, false);
+	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+
+	return next_node;
+}
+
 /**
  * scm_check_and_age_out() - check and age out the old entries
  * @scan_db: scan db
@@ -488,9 +593,7 @@ scm_bss_is_nontx_of_conn_bss(struct scan_cache_node *conn_node,
 void scm_age_out_entries(struct wlan_objmgr_psoc *psoc,
 	struct scan_dbs *scan_db)
 {
-	int i;
 	struct scan_cache_node *cur_node = NULL;
-	struct scan_cache_node *next_node = NULL;
 	struct scan_cache_node *conn_node = NULL;
 	struct scan_default_params *def_param;
 
@@ -501,25 +604,29 @@ void scm_age_out_entries(struct wlan_objmgr_psoc *psoc,
 	}
 
 	conn_node = scm_get_conn_node(scan_db);
-	for (i = 0 ; i < SCAN_HASH_SIZE; i++) {
-		cur_node = scm_get_next_node(scan_db,
-			&scan_db->scan_hash_tbl[i], NULL);
-		while (cur_node) {
-			if (!conn_node /* if there is no connected node */ ||
-			    /* OR cur_node is not part of the MBSSID of the
-			     * connected node
-			     */
-			    (!scm_bss_is_connected(cur_node->entry) &&
-			     !scm_bss_is_nontx_of_conn_bss(conn_node,
-							  cur_node))) {
-				scm_check_and_age_out(scan_db, cur_node,
-					def_param->scan_cache_aging_time);
-			}
-			next_node = scm_get_next_node(scan_db,
-				&scan_db->scan_hash_tbl[i], cur_node);
-			cur_node = next_node;
-			next_node = NULL;
+	cur_node = scm_get_next_age_node(scan_db, NULL);
+	while (cur_node) {
+		/*
+		 * Entries are in insertion order, all the ones after the
+		 * first entry that is not old enough are younger still.
+		 */
+		if (util_scan_entry_age(cur_node->entry) <
+		    def_param->scan_cache_aging_time) {
+			scm_scan_entry_put_ref(scan_db, cur_node, true);
+			break;
 		}
+
+		if (!conn_node /* if there is no connected node */ ||
+		    /* OR cur_node is not part of the MBSSID of the
+		     * connected node
+		     */
+		    (!scm_bss_is_connected(cur_node->entry) &&
+		     !scm_bss_is_nontx_of_conn_bss(conn_node,
+						  cur_node))) {
+			scm_check_and_age_out(scan_db, cur_node,
+				def_param->scan_cache_aging_time);
+		}
+		cur_node = scm_get_next_age_node(scan_db, cur_node);
 	}
 
 	if (conn_node)
@@ -527,47 +634,19 @@ void scm_age_out_entries(struct wlan_objmgr_psoc *psoc,
 }
 
 /**
- * scm_flush_oldest_entry() - Iterate over scan db and flust out the
- *  oldest entry
+ * scm_flush_oldest_entry() - flush out the oldest entry of the scan db
  * @scan_db: scan db from which oldest entry needs to be flushed
  *
+ * The first active node of the age list is the oldest entry.
+ *
  * Return: QDF_STATUS
  */
 static QDF_STATUS scm_flush_oldest_entry(struct scan_dbs *scan_db)
 {
-	int i;
-	struct scan_cache_node *oldest_node = NULL;
-	struct scan_cache_node *cur_node;
-
-	for (i = 0 ; i < SCAN_HASH_SIZE; i++) {
-		/* Get the first valid node for the hash */
-		cur_node = scm_get_next_node(scan_db,
-					     &scan_db->scan_hash_tbl[i],
-					     NULL);
-		 /* Iterate scan db and flush out oldest node
-		  * take ref_cnt for oldest_node
-		  */
-
-		while (cur_node) {
-			if (!oldest_node ||
-			   (util_scan_entry_age(oldest_node->entry) <
-			    util_scan_entry_age(cur_node->entry))) {
-				if (oldest_node)
-					scm_scan_entry_put_ref(scan_db,
-							       oldest_node,
-							       true);
-				qdf_spin_lock_bh(&scan_db->scan_db_lock);
-				oldest_node = cur_node;
-				scm_scan_entry_get_ref(oldest_node);
-				qdf_spin_unlock_bh(&scan_db->scan_db_lock);
-			}
-
-			cur_node = scm_get_next_node(scan_db,
-					&scan_db->scan_hash_tbl[i],
-					cur_node);
-		};
-	}
+	struct scan_cache_node *oldest_node;
 
+	/* ref_cnt is taken for oldest_node */
+	oldest_node = scm_get_next_age_node(scan_db, NULL);
 	if (oldest_node) {
 		scm_debug("Flush oldest BSSID: "QDF_MAC_ADDR_FMT" with age %lu ms",
 			  QDF_MAC_ADDR_REF(oldest_node->entry->bssid.bytes),
@@ -639,6 +718,52 @@ scm_update_mlme_info(struct scan_cache_entry *src,
 		sizeof(struct mlme_info));
 }
 
+/**
+ * scm_update_node_mlme_info() - update mlme info of a scan db node
+ * @scan_db: scan db
+ * @scan_node: node to update, ref taken by the caller
+ * @mlme: mlme info to set
+ *
+ * Entries held by a scan snapshot are shared read-only, so such a node
+ * is replaced by an updated copy rather than written in place. If the
+ * copy cannot be allocated the entry is updated in place. snap_ref is
+ * only raised under scan_db_lock, so it is checked and the copy made
+ * under the same lock.
+ *
+ * Return: void
+ */
+static void scm_update_node_mlme_info(struct scan_dbs *scan_db,
+				      struct scan_cache_node *scan_node,
+				      struct mlme_info *mlme)
+{
+	struct scan_cache_node *new_node = NULL;
+	struct scan_cache_entry *new_entry;
+
+	/* Acquire db lock to prevent simultaneous update */
+	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	if (qdf_atomic_read(&scan_node->snap_ref) &&
+	    scan_node->cookie == SCAN_NODE_ACTIVE_COOKIE) {
+		new_entry = util_scan_copy_cache_entry(scan_node->entry);
+		if (new_entry) {
+			new_node = qdf_mem_malloc_atomic(sizeof(*new_node));
+			if (new_node)
+				new_node->entry = new_entry;
+			else
+				util_scan_free_cache_entry(new_entry);
+		}
+	}
+
+	if (new_node) {
+		qdf_mem_copy(&new_node->entry->mlme_info, mlme,
+			     sizeof(struct mlme_info));
+		scm_replace_scan_node(scan_db, new_node, scan_node);
+	} else {
+		qdf_mem_copy(&scan_node->entry->mlme_info, mlme,
+			     sizeof(struct mlme_info));
+	}
+	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+}
+
 /**
  * scm_copy_info_from_dup_entry() - copy duplicate node info
  * to new scan entry
@@ -778,6 +903,41 @@ scm_copy_info_from_dup_entry(struct wlan_objmgr_pdev *pdev,
 	scm_update_mlme_info(scan_entry, scan_params);
 }
 
+/**
+ * scm_find_dup_node() - find the db node an entry is a duplicate of
+ * @scan_db: scan db
+ * @entry: input scan cache entry
+ *
+ * ref_cnt is taken for the returned node, caller should release it.
+ *
+ * Return: duplicate node if found, NULL otherwise
+ */
+static struct scan_cache_node *
+scm_find_dup_node(struct scan_dbs *scan_db, struct scan_cache_entry *entry)
+{
+	uint32_t hash_idx;
+	struct scan_cache_node *cur_node;
+	struct scan_cache_node *next_node = NULL;
+
+	hash_idx = SCAN_GET_HASH(entry->bssid.bytes);
+
+	cur_node = scm_get_next_node(scan_db,
+				     &scan_db->scan_hash_tbl[hash_idx],
+				     NULL);
+
+	while (cur_node) {
+		if (util_is_scan_entry_match(entry,
+		   cur_node->entry))
+			return cur_node;
+		next_node = scm_get_next_node(scan_db,
+			 &scan_db->scan_hash_tbl[hash_idx], cur_node);
+		cur_node = next_node;
+		next_node = NULL;
+	}
+
+	return NULL;
+}
+
 /**
  * scm_find_duplicate() - find duplicate entry,
  * if present, add input scan entry before it and delete
@@ -800,31 +960,68 @@ scm_find_duplicate(struct wlan_objmgr_pdev *pdev,
 		   struct scan_cache_entry *entry,
 		   struct scan_cache_node **dup_node)
 {
-	uint8_t hash_idx;
 	struct scan_cache_node *cur_node;
-	struct scan_cache_node *next_node = NULL;
 
-	hash_idx = SCAN_GET_HASH(entry->bssid.bytes);
+	cur_node = scm_find_dup_node(scan_db, entry);
+	if (!cur_node)
+		return false;
 
-	cur_node = scm_get_next_node(scan_db,
-				     &scan_db->scan_hash_tbl[hash_idx],
-				     NULL);
+	scm_copy_info_from_dup_entry(pdev, scan_obj, scan_db,
+				     entry, cur_node);
+	*dup_node = cur_node;
 
-	while (cur_node) {
-		if (util_is_scan_entry_match(entry,
-		   cur_node->entry)) {
-			scm_copy_info_from_dup_entry(pdev, scan_obj, scan_db,
-						     entry, cur_node);
-			*dup_node = cur_node;
-			return true;
+	return true;
+}
+
+/**
+ * scm_db_add_entry() - add a scan entry to the scan db
+ * @scan_db: scan db
+ * @scan_params: new received entry
+ * @dup_node: duplicate node found for the entry, NULL if none
+ *
+ * Flushes the oldest entry if the db is full, then adds the entry and
+ * deletes @dup_node. The ref taken for @dup_node is released in all
+ * cases.
+ *
+ * Return: QDF_STATUS
+ */
+static QDF_STATUS scm_db_add_entry(struct scan_dbs *scan_db,
+				   struct scan_cache_entry *scan_params,
+				   struct scan_cache_node *dup_node)
+{
+	struct scan_cache_node *scan_node = NULL;
+	QDF_STATUS status;
+
+	if (scan_db->num_entries >= MAX_SCAN_CACHE_SIZE) {
+		status = scm_flush_oldest_entry(scan_db);
+		if (QDF_IS_STATUS_ERROR(status)) {
+			/* release ref taken for dup node */
+			if (dup_node)
+				scm_scan_entry_put_ref(scan_db, dup_node, true);
+			return status;
 		}
-		next_node = scm_get_next_node(scan_db,
-			 &scan_db->scan_hash_tbl[hash_idx], cur_node);
-		cur_node = next_node;
-		next_node = NULL;
 	}
 
-	return false;
+	scan_node = qdf_mem_malloc(sizeof(*scan_node));
+	if (!scan_node) {
+		/* release ref taken for dup node */
+		if (dup_node)
+			scm_scan_entry_put_ref(scan_db, dup_node, true);
+		return QDF_STATUS_E_NOMEM;
+	}
+
+	scan_node->entry = scan_params;
+	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	scm_add_scan_node(scan_db, scan_node, dup_node);
+
+	if (dup_node) {
+		/* release ref taken for dup node and delete it */
+		scm_scan_entry_del(scan_db, dup_node);
+		scm_scan_entry_put_ref(scan_db, dup_node, false);
+	}
+	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+
+	return QDF_STATUS_SUCCESS;
 }
 
 /**
@@ -839,9 +1036,7 @@ static QDF_STATUS scm_add_update_entry(struct wlan_objmgr_psoc *psoc,
 	struct wlan_objmgr_pdev *pdev, struct scan_cache_entry *scan_params)
 {
 	struct scan_cache_node *dup_node = NULL;
-	struct scan_cache_node *scan_node = NULL;
 	bool is_dup_found = false;
-	QDF_STATUS status;
 	struct scan_dbs *scan_db;
 	struct wlan_scan_obj *scan_obj;
 	uint8_t security_type;
@@ -894,36 +1089,8 @@ static QDF_STATUS scm_add_update_entry(struct wlan_objmgr_psoc *psoc,
 	if (scan_obj->cb.inform_beacon)
 		scan_obj->cb.inform_beacon(pdev, scan_params);
 
-	if (scan_db->num_entries >= MAX_SCAN_CACHE_SIZE) {
-		status = scm_flush_oldest_entry(scan_db);
-		if (QDF_IS_STATUS_ERROR(status)) {
-			/* release ref taken for dup node */
-			if (is_dup_found)
-				scm_scan_entry_put_ref(scan_db, dup_node, true);
-			return status;
-		}
-	}
-
-	scan_node = qdf_mem_malloc(sizeof(*scan_node));
-	if (!scan_node) {
-		/* release ref taken for dup node */
-		if (is_dup_found)
-			scm_scan_entry_put_ref(scan_db, dup_node, true);
-		return QDF_STATUS_E_NOMEM;
-	}
-
-	scan_node->entry = scan_params;
-	qdf_spin_lock_bh(&scan_db->scan_db_lock);
-	scm_add_scan_node(scan_db, scan_node, dup_node);
-
-	if (is_dup_found) {
-		/* release ref taken for dup node and delete it */
-		scm_scan_entry_del(scan_db, dup_node);
-		scm_scan_entry_put_ref(scan_db, dup_node, false);
-	}
-	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
-
-	return QDF_STATUS_SUCCESS;
+	return scm_db_add_entry(scan_db, scan_params,
+				is_dup_found ? dup_node : NULL);
 }
 
 #ifdef CONFIG_REG_CLIENT
@@ -1237,6 +1404,41 @@ scm_scan_apply_filter_get_entry(struct wlan_objmgr_psoc *psoc,
 	return QDF_STATUS_SUCCESS;
 }
 
+/**
+ * scm_filter_summary_match() - cheap pre-check of a node against a filter
+ * @summary: summary of the db entry
+ * @filter: filter to be applied
+ *
+ * Rejects on the age, band and channel criteria using only the node
+ * summary, before the full scm_filter_match() has to touch the entry.
+ *
+ * Return: false if the entry can not match the filter
+ */
+static bool scm_filter_summary_match(struct scan_cache_summary *summary,
+				     struct scan_filter *filter)
+{
+	uint16_t i;
+
+	if (filter->age_threshold &&
+	    filter->age_threshold <
+	    (qdf_mc_timer_get_system_time() - summary->entry_time))
+		return false;
+
+	if (filter->ignore_6ghz_channel && summary->is_6ghz)
+		return false;
+
+	if (!filter->num_of_channels)
+		return true;
+
+	for (i = 0; i < filter->num_of_channels; i++) {
+		if (!filter->chan_freq_list[i] ||
+		    filter->chan_freq_list[i] == summary->chan_freq)
+			return true;
+	}
+
+	return false;
+}
+
 /**
  * scm_get_results() - Iterate and get scan results
  * @psoc: psoc ptr
@@ -1261,8 +1463,11 @@ static void scm_get_results(struct wlan_objmgr_psoc *psoc,
 		if (!count)
 			continue;
 		while (cur_node) {
-			scm_scan_apply_filter_get_entry(psoc,
-				cur_node->entry, filter, scan_list);
+			if (!filter ||
+			    scm_filter_summary_match(&cur_node->summary,
+						     filter))
+				scm_scan_apply_filter_get_entry(psoc,
+					cur_node->entry, filter, scan_list);
 			next_node = scm_get_next_node(scan_db,
 				&scan_db->scan_hash_tbl[i], cur_node);
 			cur_node = next_node;
@@ -1341,6 +1546,87 @@ qdf_list_t *scm_get_scan_result(struct wlan_objmgr_pdev *pdev,
 	return tmp_list;
 }
 
+struct scan_snapshot *scm_get_scan_snapshot(struct wlan_objmgr_pdev *pdev,
+					    struct scan_filter *filter)
+{
+	struct wlan_objmgr_psoc *psoc;
+	struct scan_dbs *scan_db;
+	struct scan_snapshot *snap;
+	struct scan_cache_node *cur_node;
+	struct scan_cache_node *next_node;
+	struct security_info security = {0};
+	uint32_t max_entries;
+
+	if (!pdev) {
+		scm_err("pdev is NULL");
+		return NULL;
+	}
+
+	psoc = wlan_pdev_get_psoc(pdev);
+	if (!psoc) {
+		scm_err("psoc is NULL");
+		return NULL;
+	}
+
+	scan_db = wlan_pdev_get_scan_db(psoc, pdev);
+	if (!scan_db) {
+		scm_err("scan_db is NULL");
+		return NULL;
+	}
+
+	scm_age_out_entries(psoc, scan_db);
+
+	/*
+	 * Entries added after this point are not part of the snapshot, the
+	 * count only sizes the node array.
+	 */
+	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	max_entries = scan_db->num_entries;
+	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+	snap = qdf_mem_malloc_atomic(sizeof(*snap) +
+				     max_entries * sizeof(snap->nodes[0]));
+	if (!snap) {
+		scm_err("failed to allocate scan snapshot");
+		return NULL;
+	}
+	snap->scan_db = scan_db;
+
+	cur_node = scm_get_next_age_node(scan_db, NULL);
+	while (cur_node) {
+		if (snap->num_entries < max_entries &&
+		    (!filter ||
+		     (scm_filter_summary_match(&cur_node->summary, filter) &&
+		      scm_filter_match(psoc, cur_node->entry, filter,
+				       &security)))) {
+			/* pairs with the check in scm_update_node_mlme_info */
+			qdf_spin_lock_bh(&scan_db->scan_db_lock);
+			scm_scan_entry_get_ref(cur_node);
+			qdf_atomic_inc(&cur_node->snap_ref);
+			qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+			snap->nodes[snap->num_entries++] = cur_node;
+		}
+		next_node = scm_get_next_age_node(scan_db, cur_node);
+		cur_node = next_node;
+	}
+
+	return snap;
+}
+
+void scm_put_scan_snapshot(struct scan_snapshot *snap)
+{
+	uint32_t i;
+
+	if (!snap)
+		return;
+
+	for (i = 0; i < snap->num_entries; i++) {
+		qdf_atomic_dec(&snap->nodes[i]->snap_ref);
+		scm_scan_entry_put_ref(snap->scan_db, snap->nodes[i], true);
+	}
+
+	qdf_mem_free(snap);
+}
+
 /**
  * scm_iterate_db_and_call_func() - iterate and call the func
  * @scan_db: scan db
@@ -1630,6 +1916,7 @@ QDF_STATUS scm_db_init(struct wlan_objmgr_psoc *psoc)
 		for (j = 0; j < SCAN_HASH_SIZE; j++)
 			qdf_list_create(&scan_db->scan_hash_tbl[j],
 				MAX_SCAN_CACHE_SIZE);
+		qdf_list_create(&scan_db->age_list, MAX_SCAN_CACHE_SIZE);
 	}
 	return QDF_STATUS_SUCCESS;
 }
@@ -1655,12 +1942,122 @@ QDF_STATUS scm_db_deinit(struct wlan_objmgr_psoc *psoc)
 		scm_flush_scan_entries(psoc, scan_db, NULL);
 		for (j = 0; j < SCAN_HASH_SIZE; j++)
 			qdf_list_destroy(&scan_db->scan_hash_tbl[j]);
+		qdf_list_destroy(&scan_db->age_list);
 		qdf_spinlock_destroy(&scan_db->scan_db_lock);
 	}
 
 	return QDF_STATUS_SUCCESS;
 }
 
+#ifdef WLAN_SCAN_CACHE_DB_BENCHMARK
+/* OUIs the synthetic BSSIDs are spread over */
+static const uint8_t scm_db_benchmark_oui[][3] = {
+	{0x00, 0x0b, 0x86},
+	{0x70, 0x3a, 0x0e},
+	{0xb4, 0x5d, 0x50},
+};
+
+/**
+ * scm_db_benchmark_entry() - build a synthetic beacon scan entry
+ * @idx: BSS index, four BSSIDs per AP like a multi-BSSID set
+ *
+ * Return: scan entry, NULL on allocation failure
+ */
+static struct scan_cache_entry *scm_db_benchmark_entry(uint32_t idx)
+{
+	struct scan_cache_entry *entry;
+	uint32_t ap = idx >> 2;
+	uint8_t oui = ap % QDF_ARRAY_SIZE(scm_db_benchmark_oui);
+
+	entry = qdf_mem_malloc(sizeof(*entry));
+	if (!entry)
+		return NULL;
+
+	qdf_mem_copy(entry->bssid.bytes, scm_db_benchmark_oui[oui], 3);
+	entry->bssid.bytes[3] = (ap >> 12) & 0xff;
+	entry->bssid.bytes[4] = (ap >> 4) & 0xff;
+	entry->bssid.bytes[5] = ((ap & 0xf) << 4) | (idx & 0x3);
+	entry->ssid.length = qdf_scnprintf(entry->ssid.ssid,
+					   sizeof(entry->ssid.ssid),
+					   "bench-%u", idx);
+	entry->cap_info.wlan_caps.ess = 1;
+	entry->channel.chan_freq = 5180 + 20 * (ap % 8);
+	entry->scan_entry_time = qdf_mc_timer_get_system_time();
+
+	return entry;
+}
+
+QDF_STATUS scm_db_benchmark(uint32_t num_bcn)
+{
+	struct scan_dbs *scan_db;
+	struct scan_cache_entry *entry;
+	struct scan_cache_node *dup_node;
+	struct scan_cache_node *cur_node;
+	uint64_t start_us, insert_us, total_us = 0, max_us = 0;
+	uint32_t i, new_cnt = 0, max_chain = 0;
+	QDF_STATUS status = QDF_STATUS_SUCCESS;
+
+	scan_db = qdf_mem_malloc(sizeof(*scan_db));
+	if (!scan_db)
+		return QDF_STATUS_E_NOMEM;
+
+	qdf_spinlock_create(&scan_db->scan_db_lock);
+	for (i = 0; i < SCAN_HASH_SIZE; i++)
+		qdf_list_create(&scan_db->scan_hash_tbl[i],
+				MAX_SCAN_CACHE_SIZE);
+	qdf_list_create(&scan_db->age_list, MAX_SCAN_CACHE_SIZE);
+
+	for (i = 0; i < num_bcn; i++) {
+		/* every fifth beacon is a re-beacon of an earlier BSS */
+		entry = scm_db_benchmark_entry((i % 5 == 4) ? i / 2 : i);
+		if (!entry) {
+			status = QDF_STATUS_E_NOMEM;
+			break;
+		}
+
+		start_us = qdf_ktime_to_us(qdf_ktime_get());
+		dup_node = scm_find_dup_node(scan_db, entry);
+		if (!dup_node)
+			new_cnt++;
+		status = scm_db_add_entry(scan_db, entry, dup_node);
+		insert_us = qdf_ktime_to_us(qdf_ktime_get()) - start_us;
+
+		if (QDF_IS_STATUS_ERROR(status)) {
+			util_scan_free_cache_entry(entry);
+			break;
+		}
+		total_us += insert_us;
+		max_us = QDF_MAX(max_us, insert_us);
+	}
+
+	qdf_spin_lock_bh(&scan_db->scan_db_lock);
+	for (i = 0; i < SCAN_HASH_SIZE; i++)
+		max_chain = QDF_MAX(max_chain,
+				    qdf_list_size(&scan_db->scan_hash_tbl[i]));
+	qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+
+	scm_nofl_info("scan db benchmark: beacons %u entries %u evicted %u total %llu us max %llu us max chain %u",
+		      i, scan_db->num_entries, new_cnt - scan_db->num_entries,
+		      total_us, max_us, max_chain);
+
+	cur_node = scm_get_next_age_node(scan_db, NULL);
+	while (cur_node) {
+		qdf_spin_lock_bh(&scan_db->scan_db_lock);
+		scm_scan_entry_del(scan_db, cur_node);
+		qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+		cur_node = scm_get_next_age_node(scan_db, cur_node);
+	}
+
+	for (i = 0; i < SCAN_HASH_SIZE; i++)
+		qdf_list_destroy(&scan_db->scan_hash_tbl[i]);
+	qdf_list_destroy(&scan_db->age_list);
+	qdf_spinlock_destroy(&scan_db->scan_db_lock);
+	qdf_mem_free(scan_db);
+
+	return status;
+}
+#endif
+
 #ifdef FEATURE_6G_SCAN_CHAN_SORT_ALGO
 QDF_STATUS scm_channel_list_db_init(struct wlan_objmgr_psoc *psoc)
 {
@@ -1804,7 +2201,7 @@ void scm_update_rnr_from_scan_cache(struct wlan_objmgr_pdev *pdev)
 QDF_STATUS scm_update_scan_mlme_info(struct wlan_objmgr_pdev *pdev,
 	struct scan_cache_entry *entry)
 {
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 	struct scan_dbs *scan_db;
 	struct scan_cache_node *cur_node;
 	struct scan_cache_node *next_node = NULL;
@@ -1829,10 +2226,8 @@ QDF_STATUS scm_update_scan_mlme_info(struct wlan_objmgr_pdev *pdev,
 	while (cur_node) {
 		if (util_is_scan_entry_match(entry,
 					cur_node->entry)) {
-			/* Acquire db lock to prevent simultaneous update */
-			qdf_spin_lock_bh(&scan_db->scan_db_lock);
-			scm_update_mlme_info(entry, cur_node->entry);
-			qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+			scm_update_node_mlme_info(scan_db, cur_node,
+						  &entry->mlme_info);
 			scm_scan_entry_put_ref(scan_db,
 					cur_node, true);
 			return QDF_STATUS_SUCCESS;
@@ -1848,7 +2243,7 @@ QDF_STATUS scm_update_scan_mlme_info(struct wlan_objmgr_pdev *pdev,
 QDF_STATUS scm_scan_update_mlme_by_bssinfo(struct wlan_objmgr_pdev *pdev,
 		struct bss_info *bss_info, struct mlme_info *mlme)
 {
-	uint8_t hash_idx;
+	uint32_t hash_idx;
 	struct scan_dbs *scan_db;
 	struct scan_cache_node *cur_node;
 	struct scan_cache_node *next_node = NULL;
@@ -1874,13 +2269,9 @@ QDF_STATUS scm_scan_update_mlme_by_bssinfo(struct wlan_objmgr_pdev *pdev,
 		if (qdf_is_macaddr_equal(&bss_info->bssid, &entry->bssid) &&
 			(util_is_ssid_match(&bss_info->ssid, &entry->ssid)) &&
 			(bss_info->freq == entry->channel.chan_freq)) {
-			/* Acquire db lock to prevent simultaneous update */
-			qdf_spin_lock_bh(&scan_db->scan_db_lock);
-			qdf_mem_copy(&entry->mlme_info, mlme,
-					sizeof(struct mlme_info));
+			scm_update_node_mlme_info(scan_db, cur_node, mlme);
 			scm_scan_entry_put_ref(scan_db,
-					cur_node, false);
-			qdf_spin_unlock_bh(&scan_db->scan_db_lock);
+					cur_node, true);
 			return QDF_STATUS_SUCCESS;
 		}
 		next_node = scm_get_next_node(scan_db,
@@ -29,9 +29,31 @@
 #include <wlan_objmgr_vdev_obj.h>
 #include <wlan_scan_public_structs.h>
 
-#define SCAN_HASH_SIZE 64
-#define SCAN_GET_HASH(addr) \
-	(((const uint8_t *)(addr))[QDF_MAC_ADDR_SIZE - 1] % SCAN_HASH_SIZE)
+#define SCAN_HASH_BITS 8
+#define SCAN_HASH_SIZE (1 << SCAN_HASH_BITS)
+
+/**
+ * scm_get_bssid_hash() - get scan db hash index of a bssid
+ * @addr: bssid
+ *
+ * All six bytes are folded in, so BSSIDs of one vendor or of one
+ * multi-BSSID set, which only differ in a few low bits, still spread
+ * over the whole table.
+ *
+ * Return: hash index
+ */
+static inline uint32_t scm_get_bssid_hash(const uint8_t *addr)
+{
+	uint32_t key;
+
+	key = ((uint32_t)addr[2] << 24 | (uint32_t)addr[3] << 16 |
+	       (uint32_t)addr[4] << 8 | addr[5]) ^
+	      ((uint32_t)addr[0] << 8 | addr[1]);
+
+	return (key * 0x9E3779B1) >> (32 - SCAN_HASH_BITS);
+}
+
+#define SCAN_GET_HASH(addr) scm_get_bssid_hash((const uint8_t *)(addr))
 
 #define ADJACENT_CHANNEL_RSSI_THRESHOLD -80
 
@@ -39,11 +61,13 @@
  * struct scan_dbs - scan cache data base definition
  * @num_entries: number of scan entries
  * @scan_hash_tbl: link list of bssid hashed scan cache entries for a pdev
+ * @age_list: scan cache entries in insertion order, oldest first
  */
 struct scan_dbs {
 	uint32_t num_entries;
 	qdf_spinlock_t scan_db_lock;
 	qdf_list_t scan_hash_tbl[SCAN_HASH_SIZE];
+	qdf_list_t age_list;
 };
 
 /**
@@ -114,6 +138,28 @@ qdf_list_t *scm_get_scan_result(struct wlan_objmgr_pdev *pdev,
  */
 QDF_STATUS scm_purge_scan_results(qdf_list_t *scan_result);
 
+/**
+ * scm_get_scan_snapshot() - take a read-only snapshot of the scan db
+ * @pdev: pdev info
+ * @filter: Filters, NULL to take all entries
+ *
+ * The snapshot holds a ref on each matching db node instead of copying
+ * the entries. Entries must not be modified by the caller and do not
+ * carry neg_sec_info, use scm_get_scan_result() for that.
+ *
+ * Return: snapshot to be released with scm_put_scan_snapshot(), or NULL
+ */
+struct scan_snapshot *scm_get_scan_snapshot(struct wlan_objmgr_pdev *pdev,
+					    struct scan_filter *filter);
+
+/**
+ * scm_put_scan_snapshot() - release a scan db snapshot
+ * @snap: snapshot from scm_get_scan_snapshot()
+ *
+ * Return: void
+ */
+void scm_put_scan_snapshot(struct scan_snapshot *snap);
+
 /**
  * scm_update_scan_mlme_info() - updates scan entry with mlme data
  * @pdev: pdev object
@@ -261,6 +307,26 @@ QDF_STATUS scm_channel_list_db_deinit(struct wlan_objmgr_psoc *psoc)
 }
 #endif
 
+#ifdef WLAN_SCAN_CACHE_DB_BENCHMARK
+/**
+ * scm_db_benchmark() - insert synthetic beacons into a private scan db
+ * @num_bcn: number of beacons to insert
+ *
+ * Inserts @num_bcn synthetic entries, one in five a re-beacon of an
+ * earlier BSS, into a scan db that is not attached to any pdev, so that
+ * duplicate lookup and oldest entry eviction can be timed at capacity
+ * without touching the live scan cache.
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS scm_db_benchmark(uint32_t num_bcn);
+#else
+static inline QDF_STATUS scm_db_benchmark(uint32_t num_bcn)
+{
+	return QDF_STATUS_SUCCESS;
+}
+#endif
+
 /**
  * scm_scan_update_mlme_by_bssinfo() - updates scan entry with mlme data
  * @pdev: pdev object
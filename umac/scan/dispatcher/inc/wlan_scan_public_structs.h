@@ -306,20 +306,61 @@ struct bss_info {
 };
 
 #define SCAN_NODE_ACTIVE_COOKIE 0x1248F842
+
+/**
+ * struct scan_cache_summary - entry fields filters reject on first
+ * @entry_time: copy of scan_entry_time of the entry
+ * @chan_freq: copy of the entry channel frequency
+ * @is_6ghz: entry is on a 6 GHz channel
+ *
+ * Kept in the node so a filter can drop most entries without touching
+ * the scan entry itself.
+ */
+struct scan_cache_summary {
+	qdf_time_t entry_time;
+	uint32_t chan_freq;
+	bool is_6ghz;
+};
+
 /**
  * struct scan_cache_node - Scan cache entry node
  * @node: node pointers
+ * @age_node: node in the scan db age list
  * @ref_cnt: ref count if in use
+ * @snap_ref: number of scan snapshots sharing the entry
  * @cookie: cookie to check if entry is logically active
+ * @summary: filter summary of the entry
  * @entry: scan entry pointer
  */
 struct scan_cache_node {
 	qdf_list_node_t node;
+	qdf_list_node_t age_node;
 	qdf_atomic_t ref_cnt;
+	qdf_atomic_t snap_ref;
 	uint32_t cookie;
+	struct scan_cache_summary summary;
 	struct scan_cache_entry *entry;
 };
 
+struct scan_dbs;
+
+/**
+ * struct scan_snapshot - shared read-only view of scan cache entries
+ * @scan_db: scan db the nodes belong to
+ * @num_entries: number of valid entries in @nodes
+ * @nodes: referenced scan cache nodes, use nodes[i]->entry read-only
+ *
+ * Entries are shared with the scan db, not copied. An entry updated
+ * while a snapshot holds it is replaced in the db by an updated copy,
+ * the snapshot keeps seeing the old contents. neg_sec_info of shared
+ * entries is not filled for the filter used.
+ */
+struct scan_snapshot {
+	struct scan_dbs *scan_db;
+	uint32_t num_entries;
+	struct scan_cache_node *nodes[0];
+};
+
 /**
  * struct security_info - Scan cache security info
  * @authmodeset: auth mode
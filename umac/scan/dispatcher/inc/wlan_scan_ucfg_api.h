@@ -400,6 +400,27 @@ qdf_list_t *ucfg_scan_get_result(struct wlan_objmgr_pdev *pdev,
  */
 QDF_STATUS ucfg_scan_purge_results(qdf_list_t *scan_list);
 
+/**
+ * ucfg_scan_get_snapshot() - The Public API to get a scan db snapshot
+ * @pdev: pdev info
+ * @filter: Filters
+ *
+ * Read-only alternative to ucfg_scan_get_result() which shares the db
+ * entries instead of copying them.
+ *
+ * Return: snapshot pointer
+ */
+struct scan_snapshot *ucfg_scan_get_snapshot(struct wlan_objmgr_pdev *pdev,
+					     struct scan_filter *filter);
+
+/**
+ * ucfg_scan_put_snapshot() - release a scan db snapshot
+ * @snap: snapshot to be released
+ *
+ * Return: void
+ */
+void ucfg_scan_put_snapshot(struct scan_snapshot *snap);
+
 /**
  * ucfg_scan_flush_results() - The Public API to flush scan result
  * @pdev: pdev object
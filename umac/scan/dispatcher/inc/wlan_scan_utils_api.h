@@ -69,6 +69,40 @@ qdf_list_t *util_scan_unpack_beacon_frame(
 	uint8_t *frame, qdf_size_t frame_len, uint32_t frm_subtype,
 	struct mgmt_rx_event_params *rx_param);
 
+#ifdef WLAN_SCAN_IE_PARSE_BENCHMARK
+/**
+ * util_scan_ie_parse_benchmark() - time beacon unpacking over a corpus
+ * @pdev: pdev pointer
+ * @frames: beacon frames of the corpus
+ * @frame_lens: length of each frame in @frames
+ * @num_frames: number of frames in @frames
+ * @rx_param: rx meta data used for all frames
+ * @iterations: number of passes over the corpus
+ *
+ * Unpacks every frame of the corpus, MBSSID profiles included, and
+ * reports the number of frames parsed per second. The generated scan
+ * entries are freed, the scan cache is not touched.
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS
+util_scan_ie_parse_benchmark(struct wlan_objmgr_pdev *pdev,
+			     uint8_t **frames, qdf_size_t *frame_lens,
+			     uint32_t num_frames,
+			     struct mgmt_rx_event_params *rx_param,
+			     uint32_t iterations);
+#else
+static inline QDF_STATUS
+util_scan_ie_parse_benchmark(struct wlan_objmgr_pdev *pdev,
+			     uint8_t **frames, qdf_size_t *frame_lens,
+			     uint32_t num_frames,
+			     struct mgmt_rx_event_params *rx_param,
+			     uint32_t iterations)
+{
+	return QDF_STATUS_SUCCESS;
+}
+#endif
+
 /**
  * util_scan_add_hidden_ssid() - func to add hidden ssid
  * @pdev: pdev pointer
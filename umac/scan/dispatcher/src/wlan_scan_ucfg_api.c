@@ -65,6 +65,17 @@ QDF_STATUS ucfg_scan_purge_results(qdf_list_t *scan_list)
 	return scm_purge_scan_results(scan_list);
 }
 
+struct scan_snapshot *ucfg_scan_get_snapshot(struct wlan_objmgr_pdev *pdev,
+					     struct scan_filter *filter)
+{
+	return scm_get_scan_snapshot(pdev, filter);
+}
+
+void ucfg_scan_put_snapshot(struct scan_snapshot *snap)
+{
+	scm_put_scan_snapshot(snap);
+}
+
 QDF_STATUS ucfg_scan_flush_results(struct wlan_objmgr_pdev *pdev,
 	struct scan_filter *filter)
 {
@@ -1109,13 +1109,292 @@ util_scan_parse_vendor_ie(struct scan_cache_entry *scan_params,
 	return QDF_STATUS_SUCCESS;
 }
 
+/* Number of distinct element IDs */
+#define SCAN_IE_INDEX_NUM_ID 256
+/* End of an element chain in the IE index */
+#define SCAN_IE_INDEX_NONE 0xffff
+/* Largest IE buffer indexed without allocating */
+#define SCAN_IE_INDEX_SCRATCH_IE_LEN 2048
+/* Frame IEs, plus the profile and synthesized IEs of an MBSSID profile */
+#define SCAN_IE_INDEX_NUM_SCRATCH 3
+
+/**
+ * struct scan_ie_index_elem - one element of an indexed IE buffer
+ * @offset: offset of the element from the start of the IE buffer
+ * @next: index of the next element with the same element ID
+ * @eid: element ID the element was indexed under
+ */
+struct scan_ie_index_elem {
+	uint16_t offset;
+	uint16_t next;
+	uint8_t eid;
+};
+
+/**
+ * struct scan_ie_index - offset table of an IE buffer
+ * @ies: indexed IE buffer
+ * @ie_len: length of @ies
+ * @parsed_len: length covered by complete elements
+ * @num_ie: number of complete elements
+ * @max_ie: number of @elem allocated
+ * @first: per element ID, first element with that ID
+ * @last: per element ID, last element with that ID
+ * @elem: complete elements in frame order
+ *
+ * Built with one walk of the buffer so that element lookups, the MBSSID
+ * profile merge and the scan entry IE list no longer walk it again. All
+ * elements with the same ID, e.g. all vendor or all extension elements,
+ * are chained in frame order from @first. Entries of @first and @last
+ * not used by @elem are always SCAN_IE_INDEX_NONE.
+ */
+struct scan_ie_index {
+	uint8_t *ies;
+	uint16_t ie_len;
+	uint16_t parsed_len;
+	uint16_t num_ie;
+	uint16_t max_ie;
+	uint16_t first[SCAN_IE_INDEX_NUM_ID];
+	uint16_t last[SCAN_IE_INDEX_NUM_ID];
+	struct scan_ie_index_elem *elem;
+};
+
+#define SCAN_IE_INDEX_MAX_IE(_ie_len) ((_ie_len) / MIN_IE_LEN + 1)
+
+/*
+ * Indexes reused across frames, so that parsing a frame neither allocates
+ * nor clears the per element ID tables. A bit set in
+ * scan_ie_index_scratch_busy marks the index as taken; a parse that finds
+ * all of them taken, or a frame too long for them, allocates instead.
+ */
+static struct scan_ie_index scan_ie_index_scratch[SCAN_IE_INDEX_NUM_SCRATCH];
+static struct scan_ie_index_elem
+scan_ie_index_scratch_elem[SCAN_IE_INDEX_NUM_SCRATCH]
+			  [SCAN_IE_INDEX_MAX_IE(SCAN_IE_INDEX_SCRATCH_IE_LEN)];
+static unsigned long scan_ie_index_scratch_busy;
+
+/**
+ * util_scan_ie_index_init() - set up an empty IE index
+ * @ie_index: IE index
+ * @elem: element array of @ie_index
+ * @max_ie: number of @elem
+ *
+ * Return: void
+ */
+static void util_scan_ie_index_init(struct scan_ie_index *ie_index,
+				    struct scan_ie_index_elem *elem,
+				    uint16_t max_ie)
+{
+	ie_index->elem = elem;
+	ie_index->max_ie = max_ie;
+	ie_index->num_ie = 0;
+	qdf_mem_set(ie_index->first, sizeof(ie_index->first), 0xff);
+	qdf_mem_set(ie_index->last, sizeof(ie_index->last), 0xff);
+}
+
+/**
+ * util_scan_ie_index_get() - get an IE index
+ * @ie_len: largest IE buffer the index is used for
+ *
+ * Return: IE index, NULL on allocation failure
+ */
+static struct scan_ie_index *util_scan_ie_index_get(uint32_t ie_len)
+{
+	struct scan_ie_index *ie_index;
+	uint32_t max_ie = SCAN_IE_INDEX_MAX_IE(ie_len);
+	uint8_t i;
+
+	if (ie_len <= SCAN_IE_INDEX_SCRATCH_IE_LEN) {
+		for (i = 0; i < SCAN_IE_INDEX_NUM_SCRATCH; i++) {
+			if (qdf_atomic_test_and_set_bit(
+					i, &scan_ie_index_scratch_busy))
+				continue;
+
+			ie_index = &scan_ie_index_scratch[i];
+			if (!ie_index->elem)
+				util_scan_ie_index_init(
+					ie_index,
+					scan_ie_index_scratch_elem[i],
+					SCAN_IE_INDEX_MAX_IE(
+						SCAN_IE_INDEX_SCRATCH_IE_LEN));
+			return ie_index;
+		}
+	}
+
+	ie_index = qdf_mem_malloc_atomic(sizeof(*ie_index) +
+					 max_ie * sizeof(ie_index->elem[0]));
+	if (!ie_index)
+		return NULL;
+
+	util_scan_ie_index_init(ie_index,
+				(struct scan_ie_index_elem *)(ie_index + 1),
+				max_ie);
+
+	return ie_index;
+}
+
+/**
+ * util_scan_ie_index_put() - release an IE index got from
+ *			      util_scan_ie_index_get()
+ * @ie_index: IE index, may be NULL
+ *
+ * Return: void
+ */
+static void util_scan_ie_index_put(struct scan_ie_index *ie_index)
+{
+	if (!ie_index)
+		return;
+
+	if (ie_index >= scan_ie_index_scratch &&
+	    ie_index < scan_ie_index_scratch + SCAN_IE_INDEX_NUM_SCRATCH) {
+		qdf_atomic_test_and_clear_bit(ie_index - scan_ie_index_scratch,
+					      &scan_ie_index_scratch_busy);
+		return;
+	}
+
+	qdf_mem_free(ie_index);
+}
+
+/**
+ * util_scan_ie_index_reset() - empty an IE index
+ * @ie_index: IE index
+ * @ies: IE buffer to be indexed
+ * @ie_len: length of @ies
+ *
+ * Only the per element ID entries of the elements indexed so far are
+ * cleared, rather than the whole tables.
+ *
+ * Return: void
+ */
+static void util_scan_ie_index_reset(struct scan_ie_index *ie_index,
+				     uint8_t *ies, uint16_t ie_len)
+{
+	uint16_t i;
+	uint8_t eid;
+
+	for (i = 0; i < ie_index->num_ie; i++) {
+		eid = ie_index->elem[i].eid;
+		ie_index->first[eid] = SCAN_IE_INDEX_NONE;
+		ie_index->last[eid] = SCAN_IE_INDEX_NONE;
+	}
+
+	ie_index->ies = ies;
+	ie_index->ie_len = ie_len;
+	ie_index->parsed_len = 0;
+	ie_index->num_ie = 0;
+}
+
+/**
+ * util_scan_ie_index_add() - append the element at @offset to the index
+ * @ie_index: IE index
+ * @offset: offset of a complete element in the indexed buffer
+ *
+ * Return: void
+ */
+static void util_scan_ie_index_add(struct scan_ie_index *ie_index,
+				   uint16_t offset)
+{
+	uint16_t idx = ie_index->num_ie;
+	uint8_t eid = ie_index->ies[offset];
+
+	if (idx >= ie_index->max_ie)
+		return;
+
+	ie_index->elem[idx].offset = offset;
+	ie_index->elem[idx].next = SCAN_IE_INDEX_NONE;
+	ie_index->elem[idx].eid = eid;
+	if (ie_index->last[eid] == SCAN_IE_INDEX_NONE)
+		ie_index->first[eid] = idx;
+	else
+		ie_index->elem[ie_index->last[eid]].next = idx;
+	ie_index->last[eid] = idx;
+	ie_index->num_ie++;
+}
+
+/**
+ * util_scan_ie_index_build() - index all complete elements of an IE buffer
+ * @ie_index: IE index, allocated for at least @ie_len
+ * @ies: IE buffer
+ * @ie_len: length of @ies
+ *
+ * Return: void
+ */
+static void util_scan_ie_index_build(struct scan_ie_index *ie_index,
+				     uint8_t *ies, uint16_t ie_len)
+{
+	uint32_t offset = 0;
+	uint32_t elem_len;
+
+	util_scan_ie_index_reset(ie_index, ies, ie_len);
+
+	while (ie_len - offset >= MIN_IE_LEN) {
+		elem_len = ies[offset + TAG_LEN_POS] + MIN_IE_LEN;
+		if (elem_len > ie_len - offset)
+			break;
+		util_scan_ie_index_add(ie_index, offset);
+		offset += elem_len;
+	}
+	ie_index->parsed_len = offset;
+}
+
+/**
+ * util_scan_ie_index_truncated() - check for a trailing incomplete element
+ * @ie_index: IE index
+ *
+ * Return: true if the buffer ends with an element overrunning it
+ */
+static inline bool
+util_scan_ie_index_truncated(struct scan_ie_index *ie_index)
+{
+	return ie_index->ie_len - ie_index->parsed_len >= MIN_IE_LEN;
+}
+
+/**
+ * util_scan_ie_index_find() - find the first element with an element ID
+ * @ie_index: IE index
+ * @eid: element ID
+ *
+ * Elements whose ID byte has been cleared in the buffer since the index
+ * was built are skipped, and dropped from the chain so that they are not
+ * visited again.
+ *
+ * Return: pointer to the element, NULL if not found
+ */
+static uint8_t *util_scan_ie_index_find(struct scan_ie_index *ie_index,
+					uint8_t eid)
+{
+	uint16_t idx = ie_index->first[eid];
+
+	while (idx != SCAN_IE_INDEX_NONE &&
+	       ie_index->ies[ie_index->elem[idx].offset] != eid)
+		idx = ie_index->elem[idx].next;
+	ie_index->first[eid] = idx;
+
+	if (idx == SCAN_IE_INDEX_NONE)
+		return NULL;
+
+	return ie_index->ies + ie_index->elem[idx].offset;
+}
+
+/**
+ * util_scan_populate_bcn_ie_list() - fill the IE list of a scan entry
+ * @pdev: pdev pointer
+ * @scan_params: scan entry holding a copy of the frame
+ * @ie_index: index of the IE buffer the entry frame was copied from
+ * @chan_freq: channel frequency found in the IEs
+ * @band_mask: band mask of the rx channel
+ *
+ * Return: QDF_STATUS
+ */
 static QDF_STATUS
 util_scan_populate_bcn_ie_list(struct wlan_objmgr_pdev *pdev,
 			       struct scan_cache_entry *scan_params,
+			       struct scan_ie_index *ie_index,
 			       qdf_freq_t *chan_freq, uint8_t band_mask)
 {
-	struct ie_header *ie, *sub_ie;
-	uint32_t ie_len, sub_ie_len;
+	struct ie_header *ie = NULL, *sub_ie;
+	uint32_t sub_ie_len;
+	uint8_t *ies;
+	uint16_t i;
 	QDF_STATUS status;
 	uint8_t chan_idx;
 	struct wlan_scan_obj *scan_obj;
@@ -1134,30 +1413,15 @@ util_scan_populate_bcn_ie_list(struct wlan_objmgr_pdev *pdev,
 		return QDF_STATUS_E_INVAL;
 	}
 
-	ie_len = util_scan_entry_ie_len(scan_params);
-	ie = (struct ie_header *)
-		  util_scan_entry_ie_data(scan_params);
-
-	while (ie_len >= sizeof(struct ie_header)) {
-		ie_len -= sizeof(struct ie_header);
+	/* The entry holds its own copy of the frame the index was built on */
+	if (util_scan_entry_ie_len(scan_params) != ie_index->ie_len)
+		return QDF_STATUS_E_INVAL;
+	ies = util_scan_entry_ie_data(scan_params);
 
-		if (!ie->ie_len) {
-			ie += 1;
+	for (i = 0; i < ie_index->num_ie; i++) {
+		ie = (struct ie_header *)(ies + ie_index->elem[i].offset);
+		if (!ie->ie_len)
 			continue;
-		}
-
-		if (ie_len < ie->ie_len) {
-			if (scan_obj->allow_bss_with_incomplete_ie) {
-				scm_debug(QDF_MAC_ADDR_FMT": Scan allowed with incomplete corrupted IE:%x, ie_len: %d, ie->ie_len: %d, stop processing further",
-					  QDF_MAC_ADDR_REF(scan_params->bssid.bytes),
-					  ie->ie_id, ie_len, ie->ie_len);
-				break;
-			}
-			scm_debug(QDF_MAC_ADDR_FMT": Scan not allowed with incomplete corrupted IE:%x, ie_len: %d, ie->ie_len: %d, stop processing further",
-				  QDF_MAC_ADDR_REF(scan_params->bssid.bytes),
-				  ie->ie_id, ie_len, ie->ie_len);
-			return QDF_STATUS_E_INVAL;
-		}
 
 		switch (ie->ie_id) {
 		case WLAN_ELEMID_SSID:
@@ -1370,14 +1634,24 @@ util_scan_populate_bcn_ie_list(struct wlan_objmgr_pdev *pdev,
 		default:
 			break;
 		}
+	}
 
-		/* Consume info element */
-		ie_len -= ie->ie_len;
-		/* Go to next IE */
-		ie = (struct ie_header *)
-			(((uint8_t *) ie) +
-			sizeof(struct ie_header) +
-			ie->ie_len);
+	if (util_scan_ie_index_truncated(ie_index)) {
+		ie = (struct ie_header *)(ies + ie_index->parsed_len);
+		if (scan_obj->allow_bss_with_incomplete_ie) {
+			scm_debug(QDF_MAC_ADDR_FMT": Scan allowed with incomplete corrupted IE:%x, ie_len: %d, ie->ie_len: %d, stop processing further",
+				  QDF_MAC_ADDR_REF(scan_params->bssid.bytes),
+				  ie->ie_id,
+				  ie_index->ie_len - ie_index->parsed_len -
+				  MIN_IE_LEN, ie->ie_len);
+			return QDF_STATUS_SUCCESS;
+		}
+		scm_debug(QDF_MAC_ADDR_FMT": Scan not allowed with incomplete corrupted IE:%x, ie_len: %d, ie->ie_len: %d, stop processing further",
+			  QDF_MAC_ADDR_REF(scan_params->bssid.bytes),
+			  ie->ie_id,
+			  ie_index->ie_len - ie_index->parsed_len - MIN_IE_LEN,
+			  ie->ie_len);
+		return QDF_STATUS_E_INVAL;
 	}
 
 	return QDF_STATUS_SUCCESS;
@@ -1881,6 +2155,7 @@ util_scan_gen_scan_entry(struct wlan_objmgr_pdev *pdev,
 			 uint32_t frm_subtype,
 			 struct mgmt_rx_event_params *rx_param,
 			 struct scan_mbssid_info *mbssid_info,
+			 struct scan_ie_index *ie_index,
 			 qdf_list_t *scan_list)
 {
 	struct wlan_frame_hdr *hdr;
@@ -1972,8 +2247,8 @@ util_scan_gen_scan_entry(struct wlan_objmgr_pdev *pdev,
 	scan_entry->raw_frame.len = frame_len;
 	qdf_mem_copy(scan_entry->raw_frame.ptr,
 		frame, frame_len);
-	status = util_scan_populate_bcn_ie_list(pdev, scan_entry, &chan_freq,
-						band_mask);
+	status = util_scan_populate_bcn_ie_list(pdev, scan_entry, ie_index,
+						&chan_freq, band_mask);
 	if (QDF_IS_STATUS_ERROR(status)) {
 		scm_debug(QDF_MAC_ADDR_FMT": failed to parse beacon IE",
 			  QDF_MAC_ADDR_REF(scan_entry->bssid.bytes));
@@ -2090,33 +2365,30 @@ static bool util_is_noninh_ie(uint8_t elem_id,
  * util_scan_find_noninheritance_ie() - find noninheritance information element
  * This block of code is to identify if there is any non-inheritance element
  * present as part of the nontransmitted BSSID profile.
- * @elem_id: element id
- * @ies: pointer consisting of IEs
- * @len: IE length
+ * @ie_index: index of the nontransmitted BSSID profile
  *
- * Return: NULL if the element ID is not found or if IE pointer is NULL else
- * pointer to the first byte of the requested element
+ * Only the extension elements of the profile are looked at.
+ *
+ * Return: NULL if the element is not found else pointer to the first byte
+ * of the non inheritance element
  */
 static uint8_t
-*util_scan_find_noninheritance_ie(uint8_t elem_id, uint8_t *ies,
-				  int32_t len)
+*util_scan_find_noninheritance_ie(struct scan_ie_index *ie_index)
 {
-	if (!ies)
-		return NULL;
+	uint16_t idx;
+	uint8_t *ies;
 
-	while (len >= MIN_IE_LEN && len >= ies[TAG_LEN_POS] + MIN_IE_LEN) {
-		if ((ies[ID_POS] == elem_id) &&
+	for (idx = ie_index->first[WLAN_ELEMID_EXTN_ELEM];
+	     idx != SCAN_IE_INDEX_NONE; idx = ie_index->elem[idx].next) {
+		ies = ie_index->ies + ie_index->elem[idx].offset;
+		if (ies[TAG_LEN_POS] &&
 		    (ies[ELEM_ID_EXTN_POS] ==
-		     WLAN_EXTN_ELEMID_NONINHERITANCE)) {
+		     WLAN_EXTN_ELEMID_NONINHERITANCE))
 			return ies;
-		}
-		len -= ies[TAG_LEN_POS] + MIN_IE_LEN;
-		ies += ies[TAG_LEN_POS] + MIN_IE_LEN;
 	}
 
 	return NULL;
 }
-#endif
 
 /*
  * util_scan_find_ie() - find information element
@@ -2143,7 +2415,6 @@ static uint8_t *util_scan_find_ie(uint8_t eid, uint8_t *ies,
 	return NULL;
 }
 
-#ifdef WLAN_FEATURE_MBSSID
 static void util_gen_new_bssid(uint8_t *bssid, uint8_t max_bssid,
 			       uint8_t mbssid_index,
 			       uint8_t *new_bssid_addr)
@@ -2438,43 +2709,79 @@ static size_t util_oui_header_len(uint8_t *ie)
 	return OUI_LEN;
 }
 
-static uint32_t util_gen_new_ie(uint8_t *ie, uint32_t ielen,
-				uint8_t *subelement,
-				size_t subie_len, uint8_t *new_ie,
+/**
+ * util_gen_ie_append() - append an element to the synthesized IEs
+ * @new_index: index of the synthesized IE buffer
+ * @pos: write position in the synthesized IE buffer, advanced on success
+ * @elem: element to be copied
+ *
+ * Return: false if the element does not fit in the buffer
+ */
+static bool util_gen_ie_append(struct scan_ie_index *new_index,
+			       uint8_t **pos, const uint8_t *elem)
+{
+	uint32_t elem_len = elem[TAG_LEN_POS] + MIN_IE_LEN;
+
+	if ((*pos + elem_len) > (new_index->ies + new_index->ie_len))
+		return false;
+
+	qdf_mem_copy(*pos, elem, elem_len);
+	util_scan_ie_index_add(new_index, *pos - new_index->ies);
+	*pos += elem_len;
+
+	return true;
+}
+
+/**
+ * util_gen_new_ie() - synthesize the IEs of a nontransmitted BSSID profile
+ * @ie_index: index of the transmitted BSSID IEs
+ * @subelement: nontransmitted BSSID profile
+ * @subie_len: length of @subelement
+ * @sub_copy: scratch buffer of at least @subie_len
+ * @sub_index: scratch index for @sub_copy
+ * @new_index: index of the output buffer, reset with the buffer and its
+ *	size; holds the synthesized IEs on return
+ * @bssid_index: BSSID index of the profile
+ *
+ * Both IE lists are walked through their index, elements of the profile
+ * are looked up by ID instead of re-scanning the profile for each
+ * transmitted element, and the output is indexed as it is written.
+ *
+ * Return: length of the synthesized IEs
+ */
+static uint32_t util_gen_new_ie(struct scan_ie_index *ie_index,
+				uint8_t *subelement, size_t subie_len,
+				uint8_t *sub_copy,
+				struct scan_ie_index *sub_index,
+				struct scan_ie_index *new_index,
 				uint8_t bssid_index)
 {
 	uint8_t *pos, *tmp;
 	const uint8_t *tmp_old, *tmp_new;
-	uint8_t *sub_copy, *extn_elem = NULL;
+	uint8_t *extn_elem = NULL;
 	struct non_inheritance_ie ninh = {0};
 	uint8_t *elem_list = NULL, *extn_elem_list = NULL;
 	size_t tmp_rem_len;
+	uint16_t i;
+	int rnr_len;
 
 	/* copy subelement as we need to change its content to
 	 * mark an ie after it is processed.
 	 */
-	sub_copy = qdf_mem_malloc(subie_len);
-	if (!sub_copy)
-		return 0;
 	qdf_mem_copy(sub_copy, subelement, subie_len);
+	util_scan_ie_index_build(sub_index, sub_copy, subie_len);
 
-	pos = &new_ie[0];
+	pos = new_index->ies;
 
 	/* new ssid */
-	tmp_new = util_scan_find_ie(WLAN_ELEMID_SSID, sub_copy, subie_len);
+	tmp_new = util_scan_ie_index_find(sub_index, WLAN_ELEMID_SSID);
 	if (tmp_new) {
 		scm_debug(" SSID %.*s", tmp_new[1],
 			  &tmp_new[PAYLOAD_START_POS]);
-		if ((pos + tmp_new[1] + MIN_IE_LEN) <=
-		    (new_ie + ielen)) {
-			qdf_mem_copy(pos, tmp_new,
-				     (tmp_new[1] + MIN_IE_LEN));
-			pos += (tmp_new[1] + MIN_IE_LEN);
-		}
+		util_gen_ie_append(new_index, &pos, tmp_new);
 	}
 
-	extn_elem = util_scan_find_noninheritance_ie(WLAN_ELEMID_EXTN_ELEM,
-						     sub_copy, subie_len);
+	extn_elem = util_scan_find_noninheritance_ie(sub_index);
 
 	if (extn_elem && extn_elem[TAG_LEN_POS]) {
 		util_parse_noninheritance_list(extn_elem, &elem_list,
@@ -2484,10 +2791,11 @@ static uint32_t util_gen_new_ie(uint8_t *ie, uint32_t ielen,
 	/* go through IEs in ie (skip SSID) and subelement,
 	 * merge them into new_ie
 	 */
-	tmp_old = util_scan_find_ie(WLAN_ELEMID_SSID, ie, ielen);
-	tmp_old = (tmp_old) ? tmp_old + tmp_old[1] + MIN_IE_LEN : ie;
+	i = ie_index->first[WLAN_ELEMID_SSID];
+	i = (i != SCAN_IE_INDEX_NONE) ? i + 1 : 0;
 
-	while (((tmp_old + tmp_old[1] + MIN_IE_LEN) - ie) <= ielen) {
+	for (; i < ie_index->num_ie; i++) {
+		tmp_old = ie_index->ies + ie_index->elem[i].offset;
 		ninh.non_inh_ie_found = 0;
 		if (ninh.non_inherit) {
 			if (ninh.list_len) {
@@ -2507,29 +2815,26 @@ static uint32_t util_gen_new_ie(uint8_t *ie, uint32_t ielen,
 			}
 		}
 
-		if (ninh.non_inh_ie_found || (tmp_old[0] == 0)) {
-			tmp_old += tmp_old[1] + MIN_IE_LEN;
+		if (ninh.non_inh_ie_found || (tmp_old[0] == 0))
 			continue;
-		}
 
-		tmp = (uint8_t *)util_scan_find_ie(tmp_old[0], sub_copy,
-						   subie_len);
+		tmp = util_scan_ie_index_find(sub_index, tmp_old[0]);
 		if (!tmp) {
 			/* ie in old ie but not in subelement */
 			if (tmp_old[0] == WLAN_ELEMID_REDUCED_NEIGHBOR_REPORT) {
 				/* handle rnr ie for mbssid*/
-				pos +=
+				rnr_len =
 				    util_handle_rnr_ie_for_mbssid(tmp_old,
 								  bssid_index,
 								  pos);
-			} else if (tmp_old[0] != WLAN_ELEMID_MULTIPLE_BSSID) {
-				if ((pos + tmp_old[1] + MIN_IE_LEN) <=
-				    (new_ie + ielen)) {
-					qdf_mem_copy(pos, tmp_old,
-						     (tmp_old[1] +
-						      MIN_IE_LEN));
-					pos += tmp_old[1] + MIN_IE_LEN;
+				if (rnr_len) {
+					util_scan_ie_index_add(new_index,
+							       pos -
+							       new_index->ies);
+					pos += rnr_len;
 				}
+			} else if (tmp_old[0] != WLAN_ELEMID_MULTIPLE_BSSID) {
+				util_gen_ie_append(new_index, &pos, tmp_old);
 			}
 		} else {
 			/* ie in transmitting ie also in subelement,
@@ -2549,96 +2854,50 @@ static uint32_t util_gen_new_ie(uint8_t *ie, uint32_t ielen,
 					/* same vendor ie, copy from
 					 * subelement
 					 */
-					if ((pos + tmp[1] + MIN_IE_LEN) <=
-					    (new_ie + ielen)) {
-						qdf_mem_copy(pos, tmp,
-							     tmp[1] +
-							     MIN_IE_LEN);
-						pos += tmp[1] + MIN_IE_LEN;
+					if (util_gen_ie_append(new_index,
+							       &pos, tmp))
 						tmp[0] = 0;
-					}
 				} else {
-					if ((pos + tmp_old[1] +
-					     MIN_IE_LEN) <=
-					    (new_ie + ielen)) {
-						qdf_mem_copy(pos, tmp_old,
-							     tmp_old[1] +
-							     MIN_IE_LEN);
-						pos += tmp_old[1] +
-							MIN_IE_LEN;
-					}
+					util_gen_ie_append(new_index, &pos,
+							   tmp_old);
 				}
 			} else if (tmp_old[0] == WLAN_ELEMID_EXTN_ELEM) {
 				if (tmp_old[PAYLOAD_START_POS] ==
 				    tmp[PAYLOAD_START_POS]) {
 					/* same ie, copy from subelement */
-					if ((pos + tmp[1] + MIN_IE_LEN) <=
-					    (new_ie + ielen)) {
-						qdf_mem_copy(pos, tmp,
-							     tmp[1] +
-							     MIN_IE_LEN);
-						pos += tmp[1] + MIN_IE_LEN;
+					if (util_gen_ie_append(new_index,
+							       &pos, tmp))
 						tmp[0] = 0;
-					}
 				} else {
-					if ((pos + tmp_old[1] + MIN_IE_LEN) <=
-					    (new_ie + ielen)) {
-						qdf_mem_copy(pos, tmp_old,
-							     tmp_old[1] +
-							     MIN_IE_LEN);
-						pos += tmp_old[1] +
-							MIN_IE_LEN;
-					}
+					util_gen_ie_append(new_index, &pos,
+							   tmp_old);
 				}
 
 			} else {
 				/* copy ie from subelement into new ie */
-				if ((pos + tmp[1] + MIN_IE_LEN) <=
-				    (new_ie + ielen)) {
-					qdf_mem_copy(pos, tmp,
-						     tmp[1] + MIN_IE_LEN);
-					pos += tmp[1] + MIN_IE_LEN;
+				if (util_gen_ie_append(new_index, &pos, tmp))
 					tmp[0] = 0;
-				}
 			}
 		}
-
-		if (((tmp_old + tmp_old[1] + MIN_IE_LEN) - ie) >= ielen)
-			break;
-
-		tmp_old += tmp_old[1] + MIN_IE_LEN;
 	}
 
 	/* go through subelement again to check if there is any ie not
 	 * copied to new ie, skip ssid, capability, bssid-index ie
 	 */
-	tmp_new = sub_copy;
-	while (((tmp_new + tmp_new[1] + MIN_IE_LEN) - sub_copy) <=
-	       subie_len) {
+	for (i = 0; i < sub_index->num_ie; i++) {
+		tmp_new = sub_copy + sub_index->elem[i].offset;
 		if (!(tmp_new[0] == WLAN_ELEMID_NONTX_BSSID_CAP ||
 		      tmp_new[0] == WLAN_ELEMID_SSID ||
 		      tmp_new[0] == WLAN_ELEMID_MULTI_BSSID_IDX ||
 		      ((tmp_new[0] == WLAN_ELEMID_EXTN_ELEM) &&
-		       (tmp_new[2] == WLAN_EXTN_ELEMID_NONINHERITANCE)))) {
-			if ((pos + tmp_new[1] + MIN_IE_LEN) <=
-			    (new_ie + ielen)) {
-				qdf_mem_copy(pos, tmp_new,
-					     tmp_new[1] + MIN_IE_LEN);
-				pos += tmp_new[1] + MIN_IE_LEN;
-			}
-		}
-		if (((tmp_new + tmp_new[1] + MIN_IE_LEN) - sub_copy) >=
-		    subie_len)
-			break;
-		tmp_new += tmp_new[1] + MIN_IE_LEN;
+		       (tmp_new[2] == WLAN_EXTN_ELEMID_NONINHERITANCE))))
+			util_gen_ie_append(new_index, &pos, tmp_new);
 	}
 
-	qdf_mem_free(sub_copy);
+	new_index->ie_len = pos - new_index->ies;
+	new_index->parsed_len = new_index->ie_len;
 
-	if (pos > new_ie)
-		return pos - new_ie;
-	else
-		return 0;
+	return new_index->ie_len;
 }
 
 static enum nontx_profile_reasoncode
@@ -2732,80 +2991,94 @@ util_handle_nontx_prof(uint8_t *mbssid_elem, uint8_t *subelement,
  * and check for the 5th bit from the starting of the next
  * MBSSID IE and if it does not have Nontransmitted BSSID
  * capability element, then it's a split profile case.
+ * The next MBSSID element is the next one in the MBSSID chain
+ * of the IE index.
  */
-static bool util_scan_is_split_prof_found(uint8_t *next_elem,
-					  uint8_t *ie, uint32_t ielen)
+static bool util_scan_is_split_prof_found(struct scan_ie_index *ie_index,
+					  uint16_t next_mbssid_idx)
 {
 	uint8_t *next_mbssid_elem;
 
-	if (next_elem[0] == WLAN_ELEMID_MULTIPLE_BSSID) {
-		if ((next_elem[TAG_LEN_POS] >= VALID_ELEM_LEAST_LEN) &&
-		    (next_elem[SUBELEM_DATA_POS_FROM_MBSSID] !=
-		     WLAN_ELEMID_NONTX_BSSID_CAP)) {
-			return true;
-		}
-	} else {
-		next_mbssid_elem =
-			util_scan_find_ie(WLAN_ELEMID_MULTIPLE_BSSID,
-					  next_elem,
-					  ielen - (next_elem - ie));
-		if (!next_mbssid_elem)
-			return false;
+	if (next_mbssid_idx == SCAN_IE_INDEX_NONE)
+		return false;
 
-		if ((next_mbssid_elem[TAG_LEN_POS] >= VALID_ELEM_LEAST_LEN) &&
-		    (next_mbssid_elem[SUBELEM_DATA_POS_FROM_MBSSID] !=
-		     WLAN_ELEMID_NONTX_BSSID_CAP)) {
-			return true;
-		}
+	next_mbssid_elem = ie_index->ies +
+			   ie_index->elem[next_mbssid_idx].offset;
+	if ((next_mbssid_elem[TAG_LEN_POS] >= VALID_ELEM_LEAST_LEN) &&
+	    (next_mbssid_elem[SUBELEM_DATA_POS_FROM_MBSSID] !=
+	     WLAN_ELEMID_NONTX_BSSID_CAP)) {
+		return true;
 	}
 
 	return false;
 }
 
+/**
+ * util_scan_parse_mbssid() - generate scan entries for the nontransmitted
+ * BSSID profiles of a beacon or probe response
+ * @pdev: pdev pointer
+ * @frame: transmitted BSSID frame
+ * @frame_len: length of @frame
+ * @frm_subtype: beacon or probe
+ * @rx_param: rx meta data
+ * @ie_index: index of the IEs of @frame
+ * @scan_list: list the generated entries are added to
+ *
+ * A profile frame is only synthesized once the profile is found valid,
+ * directly into a buffer reused for all profiles of the frame, and its
+ * IEs are indexed while they are written so that they are not walked
+ * again to build the scan entry.
+ *
+ * Return: QDF_STATUS
+ */
 static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 					 uint8_t *frame, qdf_size_t frame_len,
 					 uint32_t frm_subtype,
 					 struct mgmt_rx_event_params *rx_param,
+					 struct scan_ie_index *ie_index,
 					 qdf_list_t *scan_list)
 {
 	struct wlan_bcn_frame *bcn;
 	struct wlan_frame_hdr *hdr;
 	struct scan_mbssid_info mbssid_info = {0};
-	QDF_STATUS status;
-	uint8_t *pos, *subelement, *next_elem;
+	QDF_STATUS status = QDF_STATUS_SUCCESS;
+	uint8_t *subelement, *next_elem;
 	uint8_t *mbssid_elem;
 	uint32_t subie_len, new_ie_len, ielen;
 	uint8_t *next_subelement = NULL;
 	uint8_t new_bssid[QDF_MAC_ADDR_SIZE], bssid[QDF_MAC_ADDR_SIZE];
-	uint8_t *new_ie, *split_prof_start = NULL, *split_prof_end = NULL;
-	uint8_t *ie, *new_frame = NULL;
+	uint8_t *split_prof_start = NULL, *split_prof_end = NULL;
+	uint8_t *new_frame, *sub_copy = NULL;
+	struct scan_ie_index *sub_index = NULL, *new_index = NULL;
+	uint16_t mbssid_idx, next_mbssid_idx;
 	int new_frame_len = 0, split_prof_len = 0;
 	enum nontx_profile_reasoncode retval;
 	uint8_t *nontx_profile = NULL;
 
 	hdr = (struct wlan_frame_hdr *)frame;
-	bcn = (struct wlan_bcn_frame *)(frame + sizeof(struct wlan_frame_hdr));
-	ie = (uint8_t *)&bcn->ie;
-	ielen = (uint16_t)(frame_len -
-			   sizeof(struct wlan_frame_hdr) -
-			   offsetof(struct wlan_bcn_frame, ie));
+	ielen = ie_index->ie_len;
 	qdf_mem_copy(bssid, hdr->i_addr3, QDF_MAC_ADDR_SIZE);
 
-	if (!util_scan_find_ie(WLAN_ELEMID_MULTIPLE_BSSID, ie, ielen))
+	mbssid_idx = ie_index->first[WLAN_ELEMID_MULTIPLE_BSSID];
+	if (mbssid_idx == SCAN_IE_INDEX_NONE)
 		return QDF_STATUS_E_FAILURE;
 
-	pos = ie;
-
-	new_ie = qdf_mem_malloc(ielen);
-	if (!new_ie)
+	/* The synthesized IEs are never longer than the transmitted ones */
+	new_frame = qdf_mem_malloc(frame_len);
+	if (!new_frame)
 		return QDF_STATUS_E_NOMEM;
 
-	while (pos < (ie + ielen + MIN_IE_LEN)) {
-		mbssid_elem =
-			util_scan_find_ie(WLAN_ELEMID_MULTIPLE_BSSID, pos,
-					  ielen - (pos - ie));
-		if (!mbssid_elem)
-			break;
+	sub_copy = qdf_mem_malloc(ielen);
+	sub_index = util_scan_ie_index_get(ielen);
+	new_index = util_scan_ie_index_get(ielen);
+	if (!sub_copy || !sub_index || !new_index) {
+		status = QDF_STATUS_E_NOMEM;
+		goto free_buf;
+	}
+
+	for (; mbssid_idx != SCAN_IE_INDEX_NONE; mbssid_idx = next_mbssid_idx) {
+		mbssid_elem = ie_index->ies + ie_index->elem[mbssid_idx].offset;
+		next_mbssid_idx = ie_index->elem[mbssid_idx].next;
 
 		mbssid_info.profile_count =
 			(1 << mbssid_elem[MBSSID_INDICATOR_POS]);
@@ -2827,7 +3100,8 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 		 */
 
 		mbssid_info.split_profile =
-			util_scan_is_split_prof_found(next_elem, ie, ielen);
+			util_scan_is_split_prof_found(ie_index,
+						      next_mbssid_idx);
 
 		for (subelement = mbssid_elem + SUBELEMENT_START_POS;
 		     subelement < (next_elem - 1);
@@ -2856,8 +3130,8 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 				if (mbssid_info.split_prof_continue)
 					qdf_mem_free(split_prof_start);
 
-				qdf_mem_free(new_ie);
-				return QDF_STATUS_E_INVAL;
+				status = QDF_STATUS_E_INVAL;
+				goto free_buf;
 			}
 
 			if ((next_elem - subelement) <
@@ -2876,8 +3150,8 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 					   subelement[ID_POS],
 					   subelement[TAG_LEN_POS]);
 				qdf_mem_free(split_prof_start);
-				qdf_mem_free(new_ie);
-				return QDF_STATUS_E_INVAL;
+				status = QDF_STATUS_E_INVAL;
+				goto free_buf;
 			} else if (retval == INVALID_NONTX_PROF) {
 				continue;
 			}
@@ -2910,8 +3184,8 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 						qdf_mem_malloc(ielen);
 					if (!split_prof_start) {
 						scm_err_rl("Malloc failed");
-						qdf_mem_free(new_ie);
-						return QDF_STATUS_E_NOMEM;
+						status = QDF_STATUS_E_NOMEM;
+						goto free_buf;
 					}
 
 					qdf_mem_copy(split_prof_start,
@@ -2981,11 +3255,16 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 				nontx_profile = subelement;
 			}
 
+			/* Generate the new ie in place in the new frame */
+			util_scan_ie_index_reset(new_index,
+						 new_frame + frame_len - ielen,
+						 ielen);
 			new_ie_len =
-				util_gen_new_ie(ie, ielen,
+				util_gen_new_ie(ie_index,
 						(nontx_profile +
 						 PAYLOAD_START_POS),
-						subie_len, new_ie,
+						subie_len, sub_copy,
+						sub_index, new_index,
 						mbssid_info.profile_num);
 
 			if (!new_ie_len)
@@ -2993,33 +3272,11 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 
 			new_frame_len = frame_len - ielen + new_ie_len;
 
-			if (new_frame_len < 0) {
-				if (mbssid_info.split_prof_continue)
-					qdf_mem_free(split_prof_start);
-				qdf_mem_free(new_ie);
-				scm_err("Invalid frame:Stop MBSSIE parsing");
-				scm_err("Frame_len: %zu,ielen:%u,new_ie_len:%u",
-					frame_len, ielen, new_ie_len);
-				return QDF_STATUS_E_INVAL;
-			}
-
-			new_frame = qdf_mem_malloc(new_frame_len);
-			if (!new_frame) {
-				if (mbssid_info.split_prof_continue)
-					qdf_mem_free(split_prof_start);
-				qdf_mem_free(new_ie);
-				scm_err_rl("Malloc for new_frame failed");
-				scm_err_rl("split_prof_continue: %d",
-					   mbssid_info.split_prof_continue);
-				return QDF_STATUS_E_NOMEM;
-			}
-
 			/*
 			 * Copy the header(24byte), timestamp(8 byte),
 			 * beaconinterval(2byte) and capability(2byte)
 			 */
 			qdf_mem_copy(new_frame, frame, FIXED_LENGTH);
-			/* Copy the new ie generated from MBSSID profile*/
 			hdr = (struct wlan_frame_hdr *)new_frame;
 			qdf_mem_copy(hdr->i_addr2, new_bssid,
 				     QDF_MAC_ADDR_SIZE);
@@ -3032,16 +3289,12 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 				     nontx_profile + CAP_INFO_POS,
 				     CAP_INFO_LEN);
 
-			/* Copy the new ie generated from MBSSID profile*/
-			qdf_mem_copy(new_frame +
-				     offsetof(struct wlan_bcn_frame, ie) +
-				     sizeof(struct wlan_frame_hdr),
-				     new_ie, new_ie_len);
 			status = util_scan_gen_scan_entry(pdev, new_frame,
 							  new_frame_len,
 							  frm_subtype,
 							  rx_param,
 							  &mbssid_info,
+							  new_index,
 							  scan_list);
 			if (QDF_IS_STATUS_ERROR(status)) {
 				if (mbssid_info.split_prof_continue) {
@@ -3049,29 +3302,32 @@ static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 					qdf_mem_zero(&mbssid_info,
 						     sizeof(mbssid_info));
 				}
-				qdf_mem_free(new_frame);
 				scm_err_rl("failed to generate a scan entry");
 				scm_err_rl("split_prof_continue: %d",
 					   mbssid_info.split_prof_continue);
 				break;
 			}
-			/* scan entry makes its own copy so free the frame*/
+			/* scan entry makes its own copy of the frame */
 			if (mbssid_info.split_prof_continue)
 				qdf_mem_free(split_prof_start);
-			qdf_mem_free(new_frame);
 		}
-
-		pos = next_elem;
 	}
-	qdf_mem_free(new_ie);
+	status = QDF_STATUS_SUCCESS;
 
-	return QDF_STATUS_SUCCESS;
+free_buf:
+	util_scan_ie_index_put(new_index);
+	util_scan_ie_index_put(sub_index);
+	qdf_mem_free(sub_copy);
+	qdf_mem_free(new_frame);
+
+	return status;
 }
 #else
 static QDF_STATUS util_scan_parse_mbssid(struct wlan_objmgr_pdev *pdev,
 					 uint8_t *frame, qdf_size_t frame_len,
 					 uint32_t frm_subtype,
 					 struct mgmt_rx_event_params *rx_param,
+					 struct scan_ie_index *ie_index,
 					 qdf_list_t *scan_list)
 {
 	return QDF_STATUS_SUCCESS;
@@ -3092,6 +3348,7 @@ util_scan_parse_beacon_frame(struct wlan_objmgr_pdev *pdev,
 	uint32_t ie_len = 0;
 	QDF_STATUS status = QDF_STATUS_E_FAILURE;
 	struct scan_mbssid_info mbssid_info = { 0 };
+	struct scan_ie_index *ie_index;
 
 	hdr = (struct wlan_frame_hdr *)frame;
 	bcn = (struct wlan_bcn_frame *)
@@ -3100,18 +3357,24 @@ util_scan_parse_beacon_frame(struct wlan_objmgr_pdev *pdev,
 		sizeof(struct wlan_frame_hdr) -
 		offsetof(struct wlan_bcn_frame, ie));
 
-	extcap_ie = util_scan_find_ie(WLAN_ELEMID_XCAPS,
-				      (uint8_t *)&bcn->ie, ie_len);
+	/* Walk the IEs once, all parsing below works on the index */
+	ie_index = util_scan_ie_index_get(ie_len);
+	if (!ie_index)
+		return QDF_STATUS_E_NOMEM;
+	util_scan_ie_index_build(ie_index, (uint8_t *)&bcn->ie, ie_len);
+
+	extcap_ie = util_scan_ie_index_find(ie_index, WLAN_ELEMID_XCAPS);
 	/* Process MBSSID when Multiple BSSID (Bit 22) is set in Ext Caps */
 	if (extcap_ie &&
 	    extcap_ie[1] >= 3 && extcap_ie[1] <= WLAN_EXTCAP_IE_MAX_LEN &&
 	    (extcap_ie[4] & 0x40)) {
-		mbssid_ie = util_scan_find_ie(WLAN_ELEMID_MULTIPLE_BSSID,
-					      (uint8_t *)&bcn->ie, ie_len);
+		mbssid_ie = util_scan_ie_index_find(ie_index,
+						    WLAN_ELEMID_MULTIPLE_BSSID);
 		if (mbssid_ie) {
 			if (mbssid_ie[1] <= 0) {
 				scm_debug("MBSSID IE length is wrong %d",
 					  mbssid_ie[1]);
+				util_scan_ie_index_put(ie_index);
 				return status;
 			}
 			qdf_mem_copy(&mbssid_info.trans_bssid,
@@ -3122,7 +3385,7 @@ util_scan_parse_beacon_frame(struct wlan_objmgr_pdev *pdev,
 
 	status = util_scan_gen_scan_entry(pdev, frame, frame_len,
 					  frm_subtype, rx_param,
-					  &mbssid_info,
+					  &mbssid_info, ie_index,
 					  scan_list);
 
 	/*
@@ -3133,7 +3396,9 @@ util_scan_parse_beacon_frame(struct wlan_objmgr_pdev *pdev,
 	if (mbssid_ie)
 		status = util_scan_parse_mbssid(pdev, frame, frame_len,
 						frm_subtype, rx_param,
-						scan_list);
+						ie_index, scan_list);
+
+	util_scan_ie_index_put(ie_index);
 
 	if (QDF_IS_STATUS_ERROR(status))
 		scm_debug_rl("Failed to create a scan entry");
@@ -3167,6 +3432,46 @@ util_scan_unpack_beacon_frame(struct wlan_objmgr_pdev *pdev, uint8_t *frame,
 	return scan_list;
 }
 
+#ifdef WLAN_SCAN_IE_PARSE_BENCHMARK
+QDF_STATUS
+util_scan_ie_parse_benchmark(struct wlan_objmgr_pdev *pdev,
+			     uint8_t **frames, qdf_size_t *frame_lens,
+			     uint32_t num_frames,
+			     struct mgmt_rx_event_params *rx_param,
+			     uint32_t iterations)
+{
+	qdf_list_t *scan_list;
+	uint64_t start_us, total_us;
+	uint32_t i, j, num_entries = 0, num_err = 0;
+
+	if (!pdev || !frames || !frame_lens || !rx_param || !num_frames)
+		return QDF_STATUS_E_INVAL;
+
+	start_us = qdf_ktime_to_us(qdf_ktime_get());
+	for (i = 0; i < iterations; i++) {
+		for (j = 0; j < num_frames; j++) {
+			scan_list = util_scan_unpack_beacon_frame(
+					pdev, frames[j], frame_lens[j],
+					MGMT_SUBTYPE_BEACON, rx_param);
+			if (!scan_list) {
+				num_err++;
+				continue;
+			}
+			num_entries += qdf_list_size(scan_list);
+			ucfg_scan_purge_results(scan_list);
+		}
+	}
+	total_us = qdf_ktime_to_us(qdf_ktime_get()) - start_us;
+
+	scm_nofl_info("scan IE parse benchmark: frames %u iterations %u entries %u errors %u total %llu us frames/s %llu",
+		      num_frames, iterations, num_entries, num_err, total_us,
+		      total_us ? qdf_do_div((uint64_t)num_frames * iterations *
+					    1000000, total_us) : 0);
+
+	return QDF_STATUS_SUCCESS;
+}
+#endif
+
 QDF_STATUS
 util_scan_entry_update_mlme_info(struct wlan_objmgr_pdev *pdev,
 	struct scan_cache_entry *scan_entry)
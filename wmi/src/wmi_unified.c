@@ -26,6 +26,7 @@
 #include "wmi_unified_api.h"
 #include "qdf_module.h"
 #include "qdf_platform.h"
+#include "qdf_func_tracker.h"
 #ifdef WMI_EXT_DBG
 #include "qdf_list.h"
 #include "qdf_atomic.h"
@@ -2768,6 +2769,7 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 	uint32_t idx = 0;
 	struct wmi_raw_event_buffer ev_buf;
 	enum wmi_rx_buff_type ev_buff_type;
+	qdf_prof_ts_t prof_ts;
 
 	id = WMI_GET_FIELD(qdf_nbuf_data(evt_buf), WMI_CMD_HDR, COMMANDID);
 
@@ -2827,6 +2829,7 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 		qdf_spin_unlock_bh(&wmi_handle->log_info.wmi_record_lock);
 	}
 #endif
+	prof_ts = qdf_prof_start();
 	/* Call the WMI registered event handler */
 	if (wmi_handle->target_type == WMI_TLV_TARGET) {
 		ev_buff_type = wmi_handle->ctx[idx].buff_type;
@@ -2844,6 +2847,8 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 		wmi_handle->event_handler[idx] (wmi_handle->scn_handle,
 			data, len);
 
+	qdf_prof_end(QDF_PROF_WMI_RX_EVENT, prof_ts);
+
 end:
 	/* Free event buffer and allocated event tlv */
 #ifndef WMI_NON_TLV_SUPPORT